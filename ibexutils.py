@@ -10,11 +10,16 @@ class UTestContext (Build.BuildContext):
     cmd = "utest"
     fun = "utest"
 
+class MicroBenchContext (Build.BuildContext):
+    cmd = "microbench"
+    fun = "microbench"
+
 class BenchmarksContext (Build.BuildContext):
     cmd = "benchmarks"
     fun = "benchmarks"
     bench_results = {}
     bench_cmp = {}
+    bench_cmp_geomeans = {}
     bench_errors = []
 
 # not @Configure.conf because, the function is also called by 'options'
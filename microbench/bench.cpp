@@ -0,0 +1,162 @@
+//============================================================================
+//                                  I B E X
+// File        : bench.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "bench.h"
+#include "ibex_Setting.h"
+
+#include <chrono>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+
+using namespace std;
+
+namespace ibex {
+
+namespace bench {
+
+namespace {
+
+struct Entry {
+	const char* name;
+	Kernel kernel;
+};
+
+vector<Entry>& registry() {
+	static vector<Entry> _registry;
+	return _registry;
+}
+
+double now() {
+	return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// written at the end of each run so that the results
+// of the kernels cannot be optimized away.
+volatile double sink_result;
+
+/*
+ * Run a kernel n times (ns per operation).
+ */
+double ns_per_op(Kernel kernel, long n) {
+	Run run(n);
+	kernel(run);
+	return 1e9*run.time()/n;
+}
+
+/*
+ * Number of operations such that a run lasts at least min_time seconds.
+ */
+long calibrate(Kernel kernel, double min_time) {
+	long n=1;
+	while (true) {
+		Run run(n);
+		kernel(run);
+		if (run.time()>=min_time || n>=(1L<<40)) return n;
+		// aim a bit above min_time, but never grow by more than 10
+		double factor=run.time()>0 ? 1.2*min_time/run.time() : 10;
+		n=(long) (n*std::min(10.0,std::max(2.0,factor)));
+	}
+}
+
+void usage() {
+	cerr << "usage: ibexbench [--min-time=<seconds>] [--repeat=<n>] [--list] [filter...]\n"
+			"\n"
+			"Run the micro-benchmarks whose name contains one of the filters (all by default)\n"
+			"and print one line per benchmark: name, nanoseconds per operation (median of\n"
+			"the repetitions) and number of operations per repetition, separated by tabs.\n"
+			"Each repetition lasts at least min-time seconds (default: 0.05).\n";
+}
+
+} // end anonymous namespace
+
+Run::Run(long n) : n(n), t_start(0), _time(0), sink(0) {
+
+}
+
+void Run::start() {
+	t_start=now();
+}
+
+void Run::stop() {
+	_time=now()-t_start;
+	sink_result=sink;
+}
+
+Register::Register(const char* name, Kernel kernel) {
+	Entry e = { name, kernel };
+	registry().push_back(e);
+}
+
+} // namespace bench
+
+} // namespace ibex
+
+using namespace ibex::bench;
+
+int main(int argc, char** argv) {
+
+	double min_time=0.05;
+	int repeat=5;
+	bool list=false;
+	vector<string> filters;
+
+	for (int i=1; i<argc; i++) {
+		if (strncmp(argv[i],"--min-time=",11)==0)
+			min_time=atof(argv[i]+11);
+		else if (strncmp(argv[i],"--repeat=",9)==0)
+			repeat=atoi(argv[i]+9);
+		else if (strcmp(argv[i],"--list")==0)
+			list=true;
+		else if (argv[i][0]=='-') {
+			usage();
+			return strcmp(argv[i],"--help")==0 ? 0 : 1;
+		} else
+			filters.push_back(argv[i]);
+	}
+
+	if (min_time<=0 || repeat<1) {
+		usage();
+		return 1;
+	}
+
+	// sort by name for a stable output
+	vector<Entry> entries=registry();
+	sort(entries.begin(), entries.end(), [](const Entry& e1, const Entry& e2) { return strcmp(e1.name,e2.name)<0; });
+
+	if (!list) {
+		cout << "# ibex " << _IBEX_RELEASE_ << " interval-lib=" << _IBEX_INTERVAL_LIB_ << endl;
+		cout << "benchmark\tns/op\titerations" << endl;
+	}
+
+	for (vector<Entry>::const_iterator it=entries.begin(); it!=entries.end(); ++it) {
+		bool selected=filters.empty();
+		for (vector<string>::const_iterator f=filters.begin(); !selected && f!=filters.end(); ++f)
+			selected = string(it->name).find(*f)!=string::npos;
+		if (!selected) continue;
+
+		if (list) {
+			cout << it->name << endl;
+			continue;
+		}
+
+		long n=calibrate(it->kernel, min_time);
+
+		vector<double> times;
+		for (int r=0; r<repeat; r++)
+			times.push_back(ns_per_op(it->kernel, n));
+		sort(times.begin(), times.end());
+
+		cout << it->name << '\t' << times[repeat/2] << '\t' << n << endl;
+	}
+
+	return 0;
+}
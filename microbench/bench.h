@@ -0,0 +1,114 @@
+//============================================================================
+//                                  I B E X
+// File        : bench.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_MICRO_BENCH_H__
+#define __IBEX_MICRO_BENCH_H__
+
+#include "ibex_Interval.h"
+
+namespace ibex {
+
+namespace bench {
+
+/**
+ * \brief Timed run of a micro-benchmark.
+ *
+ * A kernel performs its setup, then calls #start(), executes its
+ * operation #n times and calls #stop(). The result of each operation
+ * must be consumed with #use(...) so that the compiler does not remove
+ * the loop.
+ */
+class Run {
+public:
+	/**
+	 * \brief Number of operations to perform.
+	 */
+	long n;
+
+	/**
+	 * \brief Start the timer (after the setup).
+	 */
+	void start();
+
+	/**
+	 * \brief Stop the timer.
+	 */
+	void stop();
+
+	/**
+	 * \brief Consume a result.
+	 */
+	void use(double x);
+
+	/**
+	 * \brief Consume a result.
+	 */
+	void use(const Interval& x);
+
+	/**
+	 * \brief Time (in seconds) between start() and stop().
+	 */
+	double time() const;
+
+	explicit Run(long n);
+
+protected:
+	double t_start;
+	double _time;
+	double sink;
+};
+
+/**
+ * \brief A micro-benchmark.
+ */
+typedef void (*Kernel)(Run& run);
+
+/**
+ * \brief Register a micro-benchmark (see IBEX_BENCH).
+ */
+class Register {
+public:
+	Register(const char* name, Kernel kernel);
+};
+
+/*================================== inline implementations ========================================*/
+
+inline void Run::use(double x) {
+	sink+=x;
+}
+
+inline void Run::use(const Interval& x) {
+	sink+=x.lb();
+}
+
+inline double Run::time() const {
+	return _time;
+}
+
+} // namespace bench
+
+} // namespace ibex
+
+/**
+ * \brief Define a micro-benchmark.
+ *
+ * Example:
+ *
+ *    IBEX_BENCH(itv_add, "interval/add") {
+ *        Interval x(1,2), y(3,4);
+ *        run.start();
+ *        for (long i=0; i<run.n; i++) run.use(x+y);
+ *        run.stop();
+ *    }
+ */
+#define IBEX_BENCH(fn,name) \
+	static void fn(ibex::bench::Run& run); \
+	static ibex::bench::Register _bench_register_##fn(name, fn); \
+	static void fn(ibex::bench::Run& run)
+
+#endif // __IBEX_MICRO_BENCH_H__
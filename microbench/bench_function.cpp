@@ -0,0 +1,142 @@
+//============================================================================
+//                                  I B E X
+// File        : bench_function.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "bench.h"
+#include "ibex_Function.h"
+#include "ibex_Expr.h"
+
+using namespace std;
+using namespace ibex;
+
+namespace {
+
+const int n=10;
+
+typedef enum { SUM, POLY, TRIG, DAG } Shape;
+
+/*
+ * A function of n variables with a representative expression shape:
+ * - SUM:  sum of squares (wide and flat tree)
+ * - POLY: Horner scheme (deep tree of products)
+ * - TRIG: products of trigonometric functions
+ * - DAG:  repeated shared subexpressions
+ */
+Function* function(Shape shape) {
+	Variable x(n);
+	const ExprNode* e=NULL;
+	switch (shape) {
+	case SUM:
+		e=&sqr(x[0]);
+		for (int i=1; i<n; i++) e=&(*e+sqr(x[i]));
+		break;
+	case POLY:
+		e=&(x[0]*x[1]);
+		for (int i=2; i<n; i++) e=&((*e+1)*x[i]);
+		break;
+	case TRIG:
+		e=&(sin(x[0])*cos(x[1]));
+		for (int i=2; i<n; i++) e=&(*e+sin(x[i-1])*cos(x[i]));
+		break;
+	case DAG: {
+		const ExprNode* s=&(x[0]+x[1]);
+		e=s;
+		for (int i=2; i<n; i++) {
+			s=&(*s*x[i]+*s);
+			e=&(*e+*s);
+		}
+		break;
+	}
+	}
+	return new Function(x, *e);
+}
+
+/*
+ * The vector function (x[i]^2+x[i]*x[i+1]-1)_i, for the Jacobian.
+ */
+Function* vector_function(int m) {
+	Variable x(m);
+	Array<const ExprNode> f(m);
+	for (int i=0; i<m; i++)
+		f.set_ref(i, sqr(x[i])+x[i]*x[(i+1)%m]-1);
+	return new Function(x, ExprVector::new_col(f));
+}
+
+IntervalVector box(int size) {
+	return IntervalVector(size,Interval(-1,2));
+}
+
+void eval(Shape shape, bench::Run& run) {
+	Function* f=function(shape);
+	IntervalVector x=box(n);
+	run.start();
+	for (long i=0; i<run.n; i++)
+		run.use(f->eval(x));
+	run.stop();
+	delete f;
+}
+
+void backward(Shape shape, bench::Run& run) {
+	Function* f=function(shape);
+	IntervalVector x0=box(n);
+	IntervalVector x(n);
+	run.start();
+	for (long i=0; i<run.n; i++) {
+		x=x0;
+		f->backward(Interval(0,1),x);
+		run.use(x[0]);
+	}
+	run.stop();
+	delete f;
+}
+
+void gradient(Shape shape, bench::Run& run) {
+	Function* f=function(shape);
+	IntervalVector x=box(n);
+	IntervalVector g(n);
+	run.start();
+	for (long i=0; i<run.n; i++) {
+		f->gradient(x,g);
+		run.use(g[0]);
+	}
+	run.stop();
+	delete f;
+}
+
+void jacobian(int m, bench::Run& run) {
+	Function* f=vector_function(m);
+	IntervalVector x=box(m);
+	IntervalMatrix J(m,m);
+	run.start();
+	for (long i=0; i<run.n; i++) {
+		f->jacobian(x,J);
+		run.use(J[0][0]);
+	}
+	run.stop();
+	delete f;
+}
+
+IBEX_BENCH(eval_sum,  "function/eval/sum")  { eval(SUM, run); }
+IBEX_BENCH(eval_poly, "function/eval/poly") { eval(POLY, run); }
+IBEX_BENCH(eval_trig, "function/eval/trig") { eval(TRIG, run); }
+IBEX_BENCH(eval_dag,  "function/eval/dag")  { eval(DAG, run); }
+
+IBEX_BENCH(bwd_sum,  "function/hc4revise/sum")  { backward(SUM, run); }
+IBEX_BENCH(bwd_poly, "function/hc4revise/poly") { backward(POLY, run); }
+IBEX_BENCH(bwd_trig, "function/hc4revise/trig") { backward(TRIG, run); }
+IBEX_BENCH(bwd_dag,  "function/hc4revise/dag")  { backward(DAG, run); }
+
+IBEX_BENCH(grad_sum,  "function/gradient/sum")  { gradient(SUM, run); }
+IBEX_BENCH(grad_poly, "function/gradient/poly") { gradient(POLY, run); }
+IBEX_BENCH(grad_trig, "function/gradient/trig") { gradient(TRIG, run); }
+IBEX_BENCH(grad_dag,  "function/gradient/dag")  { gradient(DAG, run); }
+
+IBEX_BENCH(jac_2,  "function/jacobian/2")  { jacobian(2, run); }
+IBEX_BENCH(jac_10, "function/jacobian/10") { jacobian(10, run); }
+IBEX_BENCH(jac_50, "function/jacobian/50") { jacobian(50, run); }
+
+} // end anonymous namespace
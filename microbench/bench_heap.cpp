@@ -0,0 +1,81 @@
+//============================================================================
+//                                  I B E X
+// File        : bench_heap.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "bench.h"
+#include "ibex_Heap.h"
+#include "ibex_CellStack.h"
+#include "ibex_CellList.h"
+#include "ibex_Random.h"
+
+#include <vector>
+
+using namespace std;
+using namespace ibex;
+
+namespace {
+
+struct Node {
+	double key;
+};
+
+class NodeCost : public CostFunc<Node> {
+public:
+	virtual double cost(const Node& n) const { return n.key; }
+};
+
+/*
+ * Pop the minimum of a heap of "size" elements and push it
+ * back with a new (random) cost: one operation = pop+push.
+ */
+void heap(int size, bench::Run& run) {
+	RNG::srand(1);
+	NodeCost costf;
+	Heap<Node> h(costf);
+	vector<Node> nodes(size);
+	for (int i=0; i<size; i++) {
+		nodes[i].key=RNG::rand(0,1);
+		h.push(&nodes[i]);
+	}
+	run.start();
+	for (long i=0; i<run.n; i++) {
+		Node* n=h.pop();
+		run.use(n->key);
+		n->key+=RNG::rand(0,1);
+		h.push(n);
+	}
+	run.stop();
+	// the nodes are not owned by the heap
+	while (!h.empty()) h.pop();
+}
+
+/*
+ * Fill the buffer with "size" cells and empty it: one operation = push+pop.
+ */
+void buffer(CellBuffer& buf, int size, bench::Run& run) {
+	vector<Cell*> cells(size);
+	for (int i=0; i<size; i++)
+		cells[i]=new Cell(IntervalVector(2,Interval(i,i+1)));
+	run.start();
+	for (long i=0; i<run.n; i++) {
+		buf.push(cells[i%size]);
+		if ((int) buf.size()==size)
+			while (!buf.empty()) run.use(buf.pop()->box[0]);
+	}
+	while (!buf.empty()) run.use(buf.pop()->box[0]);
+	run.stop();
+	for (int i=0; i<size; i++)
+		delete cells[i];
+}
+
+IBEX_BENCH(heap_100,   "heap/pop_push/100")   { heap(100, run); }
+IBEX_BENCH(heap_10000, "heap/pop_push/10000") { heap(10000, run); }
+
+IBEX_BENCH(stack_100, "buffer/stack/push_pop/100") { CellStack buf; buffer(buf, 100, run); }
+IBEX_BENCH(list_100,  "buffer/list/push_pop/100")  { CellList buf;  buffer(buf, 100, run); }
+
+} // end anonymous namespace
@@ -0,0 +1,189 @@
+//============================================================================
+//                                  I B E X
+// File        : bench_interval.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "bench.h"
+#include "ibex_IntervalVector.h"
+#include "ibex_IntervalMatrix.h"
+#include "ibex_Random.h"
+#include "ibex_Setting.h"
+
+#ifdef _IBEX_WITH_AFFINE_
+#include "ibex_Affine.h"
+#endif
+
+#include <vector>
+
+using namespace std;
+using namespace ibex;
+
+namespace {
+
+const int N=1024; // number of operands (power of 2)
+
+/*
+ * N random intervals in [lb,ub].
+ */
+vector<Interval> intervals(double lb, double ub) {
+	RNG::srand(1);
+	vector<Interval> x(N);
+	for (int i=0; i<N; i++) {
+		double a=RNG::rand(lb,ub);
+		double b=RNG::rand(lb,ub);
+		x[i]=Interval(std::min(a,b),std::max(a,b));
+	}
+	return x;
+}
+
+IntervalVector vec(int n) {
+	IntervalVector v(n);
+	for (int i=0; i<n; i++) {
+		double a=RNG::rand(-10,10);
+		v[i]=Interval(a,a+RNG::rand(0,1));
+	}
+	return v;
+}
+
+#define ITV_BINARY_OP(fn,name,expr,lb,ub) \
+IBEX_BENCH(fn,name) { \
+	vector<Interval> x=intervals(lb,ub); \
+	vector<Interval> y=intervals(lb,ub); \
+	run.start(); \
+	for (long i=0; i<run.n; i++) { \
+		const Interval& a=x[i&(N-1)]; \
+		const Interval& b=y[(i+1)&(N-1)]; \
+		run.use(expr); \
+	} \
+	run.stop(); \
+}
+
+#define ITV_UNARY_OP(fn,name,expr,lb,ub) \
+IBEX_BENCH(fn,name) { \
+	vector<Interval> x=intervals(lb,ub); \
+	run.start(); \
+	for (long i=0; i<run.n; i++) { \
+		const Interval& a=x[i&(N-1)]; \
+		run.use(expr); \
+	} \
+	run.stop(); \
+}
+
+ITV_BINARY_OP(itv_add, "interval/add", a+b,     -10, 10)
+ITV_BINARY_OP(itv_mul, "interval/mul", a*b,     -10, 10)
+ITV_BINARY_OP(itv_div, "interval/div", a/b,       1, 10)
+ITV_BINARY_OP(itv_inter, "interval/inter", a&b, -10, 10)
+ITV_BINARY_OP(itv_hull, "interval/hull", a|b,   -10, 10)
+ITV_UNARY_OP(itv_sqr,  "interval/sqr",  sqr(a),  -10, 10)
+ITV_UNARY_OP(itv_sqrt, "interval/sqrt", sqrt(a),   0, 10)
+ITV_UNARY_OP(itv_exp,  "interval/exp",  exp(a),  -10, 10)
+ITV_UNARY_OP(itv_log,  "interval/log",  log(a),    1, 10)
+ITV_UNARY_OP(itv_sin,  "interval/sin",  sin(a),  -10, 10)
+ITV_UNARY_OP(itv_pow,  "interval/pow3", pow(a,3),-10, 10)
+
+IBEX_BENCH(itv_bwd_mul, "interval/bwd_mul") {
+	vector<Interval> x=intervals(-10,10);
+	vector<Interval> y=intervals(-10,10);
+	run.start();
+	for (long i=0; i<run.n; i++) {
+		Interval a=x[i&(N-1)];
+		Interval b=y[(i+1)&(N-1)];
+		bwd_mul(Interval(-1,1), a, b);
+		run.use(a);
+	}
+	run.stop();
+}
+
+#define VEC_BINARY_OP(fn,name,size,expr) \
+IBEX_BENCH(fn,name) { \
+	RNG::srand(1); \
+	IntervalVector x=vec(size); \
+	IntervalVector y=vec(size); \
+	run.start(); \
+	for (long i=0; i<run.n; i++) { \
+		expr; \
+	} \
+	run.stop(); \
+}
+
+VEC_BINARY_OP(vec_add_10,    "vector/add/10",     10, IntervalVector z=x+y; run.use(z[0]))
+VEC_BINARY_OP(vec_add_100,   "vector/add/100",   100, IntervalVector z=x+y; run.use(z[0]))
+VEC_BINARY_OP(vec_inter_100, "vector/inter/100", 100, IntervalVector z=x&y; run.use(z[0]))
+VEC_BINARY_OP(vec_dot_100,   "vector/dot/100",   100, run.use(x*y))
+VEC_BINARY_OP(vec_diam_100,  "vector/max_diam/100", 100, run.use(x.max_diam()))
+VEC_BINARY_OP(vec_copy_100,  "vector/copy/100",  100, y=x; run.use(y[0]))
+
+IBEX_BENCH(mat_vec_10, "matrix/mul_vector/10") {
+	RNG::srand(1);
+	IntervalMatrix A(10,10);
+	for (int i=0; i<10; i++) A[i]=vec(10);
+	IntervalVector x=vec(10);
+	run.start();
+	for (long i=0; i<run.n; i++) {
+		IntervalVector y=A*x;
+		run.use(y[0]);
+	}
+	run.stop();
+}
+
+IBEX_BENCH(mat_mul_10, "matrix/mul/10") {
+	RNG::srand(1);
+	IntervalMatrix A(10,10), B(10,10);
+	for (int i=0; i<10; i++) {
+		A[i]=vec(10);
+		B[i]=vec(10);
+	}
+	run.start();
+	for (long i=0; i<run.n; i++) {
+		IntervalMatrix C=A*B;
+		run.use(C[0][0]);
+	}
+	run.stop();
+}
+
+#ifdef _IBEX_WITH_AFFINE_
+
+IBEX_BENCH(aff_add, "affine2/add") {
+	RNG::srand(1);
+	IntervalVector box=vec(4);
+	Affine2 x(4,1,box[0]);
+	Affine2 y(4,2,box[1]);
+	run.start();
+	for (long i=0; i<run.n; i++) {
+		Affine2 z=x+y;
+		run.use(z.itv());
+	}
+	run.stop();
+}
+
+IBEX_BENCH(aff_mul, "affine2/mul") {
+	RNG::srand(1);
+	IntervalVector box=vec(4);
+	Affine2 x(4,1,box[0]);
+	Affine2 y(4,2,box[1]);
+	run.start();
+	for (long i=0; i<run.n; i++) {
+		Affine2 z=x*y;
+		run.use(z.itv());
+	}
+	run.stop();
+}
+
+IBEX_BENCH(aff_exp, "affine2/exp") {
+	RNG::srand(1);
+	IntervalVector box=vec(4);
+	Affine2 x(4,1,box[0]);
+	run.start();
+	for (long i=0; i<run.n; i++) {
+		Affine2 z=exp(x);
+		run.use(z.itv());
+	}
+	run.stop();
+}
+
+#endif
+
+} // end anonymous namespace
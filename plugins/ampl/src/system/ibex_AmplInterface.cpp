@@ -16,6 +16,7 @@
 #include "amplsolvers/getstub.h"
 #include "amplsolvers/opcode.hd"
 #include <stdint.h>
+#include <cassert>
 
 
 #define OBJ_DE    ((const ASL_fg *) asl) -> I.obj_de_
@@ -124,10 +125,108 @@ size_t getOperator (efunc *f) {
 
 // (C++) code starts here ///////////////////////////////////////////////////////////////////////////
 
+using std::vector;
+using std::pair;
+using std::make_pair;
+
 namespace ibex {
 
 //const double AmplInterface::default_max_bound= 1.e20;
 
+const int AmplInterface::max_chain_size = 8;
+
+namespace {
+
+/*
+ * A node of the ASL tree in the translation stack.
+ * If build==false, the operands of the node still have to be translated.
+ * If build==true, the operands are translated (they are on top of the result
+ * stack) and the node itself can be built.
+ */
+struct Task {
+	Task(expr* e, bool build) : e(e), build(build) { }
+	expr* e;
+	bool build;
+};
+
+/*
+ * The operands of an ASL node, in the order they are translated.
+ *
+ * A unary minus in operand is absorbed by the operator when possible,
+ * e.g., a+(-b) is translated into a-b.
+ */
+void operands(expr* e, int op, vector<expr*>& args) {
+	args.clear();
+	switch (op) {
+	case OPPLUS:
+		if (getOperator(e->R.e->op)==OPUMINUS) {
+			args.push_back(e->L.e);
+			args.push_back(e->R.e->L.e);
+		} else if (getOperator(e->L.e->op)==OPUMINUS) {
+			args.push_back(e->R.e);
+			args.push_back(e->L.e->L.e);
+		} else {
+			args.push_back(e->R.e);
+			args.push_back(e->L.e);
+		}
+		break;
+	case OPMINUS:
+		args.push_back(e->L.e);
+		args.push_back(getOperator(e->R.e->op)==OPUMINUS ? e->R.e->L.e : e->R.e);
+		break;
+	case OPUMINUS:
+		args.push_back(getOperator(e->L.e->op)==OPUMINUS ? e->L.e->L.e : e->L.e);
+		break;
+	case OPDIV:
+	case OPMULT:
+	case OPPOW:
+	case OP_atan2:
+		args.push_back(e->L.e);
+		args.push_back(e->R.e);
+		break;
+	case OPCPOW:
+		args.push_back(e->R.e);
+		break;
+	case MINLIST:
+	case MAXLIST:
+		for (expr** ep=e->L.ep; ep<e->R.ep; ep++)
+			args.push_back(*ep);
+		break;
+	case OPSUMLIST:
+		for (expr** ep=e->L.ep; ep<e->R.ep; ep++)
+			args.push_back(ep>e->L.ep && getOperator((*ep)->op)==OPUMINUS ? (*ep)->L.e : *ep);
+		break;
+	default: // unary operators
+		args.push_back(e->L.e);
+	}
+}
+
+/*
+ * Whether an ASL expression is the constant 0
+ * (typically, the nonlinear part of a linear constraint).
+ */
+bool is_zero(expr* e) {
+	return getOperator(e->op)==OPNUM && ((expr_n*) e)->v==0;
+}
+
+/*
+ * Sum of terms, built as a balanced tree of additions
+ * (the height is logarithmic in the number of terms).
+ */
+const ExprNode& balanced_sum(vector<const ExprNode*>& terms) {
+	assert(!terms.empty());
+	size_t n=terms.size();
+	while (n>1) {
+		size_t k=0;
+		for (size_t i=0; i+1<n; i+=2)
+			terms[k++] = &(*terms[i] + *terms[i+1]);
+		if (n%2==1) terms[k++]=terms[n-1];
+		n=k;
+	}
+	return *terms[0];
+}
+
+} // end anonymous namespace
 
 AmplInterface::AmplInterface(std::string nlfile) : asl(NULL), _nlfile(nlfile), _x(NULL){
 
@@ -142,9 +241,17 @@ AmplInterface::AmplInterface(std::string nlfile) : asl(NULL), _nlfile(nlfile), _
 }
 
 AmplInterface::~AmplInterface() {
+	// the expressions have been copied by the factory
+	if (!roots.empty()) {
+		Array<const ExprNode> a(0);
+		a.add(roots);
+		cleanup(a, false);
+	}
+
 	if (_x) delete _x;
 
 	var_data.clear();
+	common_data.clear();
 
 	if (asl) {
 		ASL_free(&asl);
@@ -218,6 +325,9 @@ bool AmplInterface::readnl() {
 	_x =new Variable(n_var,"x");
 	IntervalVector bound(n_var);
 
+	var_data.assign(n_var, NULL);
+	common_data.assign(ncom0+ncom1, NULL);
+
 		// Each has a linear and a nonlinear part
 		// thanks to Dominique Orban:
 		//        http://www.gerad.ca/~orban/drampl/def-vars.html
@@ -244,194 +354,63 @@ bool AmplInterface::readnl() {
 		} // else it is [-oo,+oo]
 		add_var(*_x, bound);
 
+		vector<pair<int,double> > terms;
+
 	// objective functions /////////////////////////////////////////////////////////////
 		if (n_obj>1) {ibex_error("Error AmplInterface: too much objective function in the ampl model."); return false;}
 
 		for (int i = 0; i < n_obj; i++) {
-			///////////////////////////////////////////////////
-			//  the nonlinear part
-			const ExprNode *body = &(nl2expr (OBJ_DE [i] . e));
-
-			////////////////////////////////////////////////
-			// The linear part
-			// count nonzero terms in linear part
-			double coeff;
-			int index;
-			for (ograd *objgrad = Ograd [i]; objgrad; objgrad = objgrad -> next) {
-				if ((dynamic_cast<const ExprConstant*>(body))&&(((ExprConstant*)(body))->is_zero())) {
-					delete body;
-					if (fabs (objgrad -> coef) != 0.0) {
-						coeff = objgrad -> coef;
-						index = objgrad -> varno;
-						if (coeff==1) {
-							body = &((*_x)[index]);
-						} else if (coeff==-1) {
-							body = &( - (*_x)[index]);
-						} else {
-							body = &(coeff * (*_x)[index]);
-						}
-					}
-				} else {
-					if (fabs (objgrad -> coef) != 0.0) {
-						coeff = objgrad -> coef;
-						index = objgrad -> varno;
-						if (coeff==1) {
-							body = &(*body + (*_x)[index]);
-						} else if (coeff==-1) {
-							body = &(*body - (*_x)[index]);
-						} else {
-							body = &(*body +coeff * (*_x)[index]);
-						}
-					}
-				}
-			}
+			// the nonlinear part
+			const ExprNode* body = is_zero(OBJ_DE [i] . e) ? NULL : &(nl2expr (OBJ_DE [i] . e));
+
+			// the linear part
+			terms.clear();
+			for (ograd *objgrad = Ograd [i]; objgrad; objgrad = objgrad -> next)
+				terms.push_back(make_pair(objgrad -> varno, objgrad -> coef));
 
-			////////////////////////////////////////////////
-			// Max or Min
 			// 3rd/ASL/solvers/asl.h, line 336: 0 is minimization, 1 is maximization
-			if (OBJ_sense [i] == 0) {
-				add_goal(*body);
-			} else {
-				add_goal(-(*body));
-			}
+			add_objective(linear(body, terms), OBJ_sense [i] != 0);
 		}
 
 	// constraints ///////////////////////////////////////////////////////////////////
-		// allocate space for argument list of all constraints' summations
-		// of linear and nonlinear terms
-		const ExprNode **body_con = new const ExprNode*[n_con];
-		///////////////////////////////////////////////////
-		// The nonlinear part :
-		//init array of each constraint with the nonlinear part
-		for (int i = 0; i<n_con;i++)
-			body_con[i] = &(nl2expr (CON_DE [i] . e));
-
-		///////////////////////////////////////////////////
-		// count all linear terms
-		if (A_colstarts && A_vals)    {      // Constraints' linear info is stored in A_vals
-			for (int j = 0; j < n_var; j++){
-				for (int i = A_colstarts [j], k = A_colstarts [j+1] - i; k--; i++) {
-					if ((dynamic_cast<const ExprConstant*>(body_con[A_rownos[i]]))&&(((ExprConstant*)(body_con[A_rownos[i]]))->is_zero())) {
-						delete body_con[A_rownos[i]];
-						if (A_vals[i]==1) {
-							body_con[A_rownos[i]] = &((*_x)[j]);
-						} else if (A_vals[i]==-1) {
-							body_con[A_rownos[i]] = &(- (*_x)[j]);
-						} else {
-							body_con[A_rownos[i]] = &((A_vals[i]) * (*_x)[j]);
-						}
-					} else {
-						if (A_vals[i]==1) {
-							body_con[A_rownos[i]] = &(*(body_con[A_rownos[i]]) + (*_x)[j]);
-						} else if (A_vals[i]==-1) {
-							body_con[A_rownos[i]] = &(*(body_con[A_rownos[i]]) - (*_x)[j]);
-						} else {
-							body_con[A_rownos[i]] = &(*(body_con[A_rownos[i]]) + (A_vals[i]) * (*_x)[j]);
-						}
-					}
-
-				}
-			}
-		} else {		// Constraints' linear info is stored in Cgrad
-			cgrad *congrad;
-			double coeff;
-			int index;
-			for ( int i = 0; i < n_con; i++)
-				for (congrad = Cgrad [i]; congrad; congrad = congrad -> next) {
-					if ((dynamic_cast<const ExprConstant*>(body_con[i]))&&(((ExprConstant*)(body_con[i]))->is_zero())) {
-						delete body_con[i];
-						coeff = congrad -> coef;
-						if (fabs (coeff) != 0.0) {
-							index = congrad -> varno;
-							if (coeff==1) {
-								body_con[i] = &( (*_x)[index]);
-							} else if (coeff==-1) {
-								body_con[i] = &(-(*_x)[index]);
-							} else {
-								body_con[i] = &((coeff) * (*_x)[index]);
-							}
-						}
-
-					} else {
-						coeff = congrad -> coef;
-						if (fabs (coeff) != 0.0) {
-							index = congrad -> varno;
-							if (coeff==1) {
-								body_con[i] = &(*(body_con[i]) + (*_x)[index]);
-							} else if (coeff==-1) {
-								body_con[i] = &(*(body_con[i]) - (*_x)[index]);
-							} else {
-								body_con[i] = &(*(body_con[i]) + (coeff) * (*_x)[index]);
-							}
-						}
-					}
-				}
+		// When the linear parts are stored in A_vals (column-wise),
+		// they are first transposed (row-wise).
+		vector<int> row_start;
+		vector<pair<int,double> > row_terms;
+
+		if (A_colstarts && A_vals) {
+			row_start.assign(n_con+1, 0);
+			for (int i = 0; i < A_colstarts [n_var]; i++)
+				row_start[A_rownos[i]+1]++;
+			for (int i = 0; i < n_con; i++)
+				row_start[i+1] += row_start[i];
+
+			vector<int> pos(row_start.begin(), row_start.end()-1);
+			row_terms.resize(A_colstarts [n_var]);
+			for (int j = 0; j < n_var; j++)
+				for (int i = A_colstarts [j]; i < A_colstarts [j+1]; i++)
+					row_terms[pos[A_rownos[i]]++] = make_pair(j, A_vals[i]);
 		}
-		///////////////////////////////////////////////////
-		// Kind of constraints : equality, inequality
+
 		for (int i = 0; i < n_con; i++) {
-			int sig;
-			double lb, ub;
+			// the nonlinear part
+			const ExprNode* body = is_zero(CON_DE [i] . e) ? NULL : &(nl2expr (CON_DE [i] . e));
 
-			/* LUrhs is the constraint lower bound if Urhsx!=0, and the constraint lower and upper bound if Uvx == 0 */
-			if (Urhsx) {
-				lb = LUrhs [i];
-				ub = Urhsx [i];
-			} else {
-				lb = LUrhs [2*i];
-				ub = LUrhs [2*i+1];
-			}
+			// the linear part
+			terms.clear();
+			if (A_colstarts && A_vals)
+				terms.assign(row_terms.begin()+row_start[i], row_terms.begin()+row_start[i+1]);
+			else
+				for (cgrad* congrad = Cgrad [i]; congrad; congrad = congrad -> next)
+					terms.push_back(make_pair(congrad -> varno, congrad -> coef));
 
-			// set constraint sign
-			if (negInfinity < lb)
-				if (ub < Infinity)  sig =1; // EQ;
-				else                sig =2; // GEQ;
-			else                    sig =3; // LEQ;
-
-			// add them (and set lower-upper bound)
-			switch (sig) {
-
-			case  1:  {
-				if (lb==ub) {
-					if (lb==0) {
-						add_ctr_eq((*(body_con[i])));
-					} else if (lb<0) {
-						add_ctr_eq((*(body_con[i])+(-lb)));
-					} else {
-						add_ctr_eq((*(body_con[i])-lb));
-					}
-				} else  {
-					 add_ctr_eq((*(body_con[i])-Interval(lb,ub)));
-				}
-				break;
-			}
-			case  2:  {
-				if (lb==0) {
-					add_ctr(ExprCtr(*(body_con[i]),GEQ));
-				} else if (lb<0) {
-					add_ctr(ExprCtr(*(body_con[i])+(-lb),GEQ));
-				} else {
-					add_ctr(ExprCtr(*(body_con[i])-lb,GEQ));
-				}
-				break;
-			}
-			case  3: {
-				if (ub==0) {
-					add_ctr(ExprCtr(*(body_con[i]),LEQ));
-				} else if (ub<0) {
-					add_ctr(ExprCtr(*(body_con[i])+(-ub),LEQ));
-				} else {
-					add_ctr(ExprCtr(*(body_con[i])-ub,LEQ));
-				}
-				break;
-			}
-			default: ibex_error("Error: could not recognize a constraint\n"); return false;
-			}
+			/* LUrhs is the constraint lower bound if Urhsx!=0, and the constraint lower and upper bound if Uvx == 0 */
+			if (Urhsx)
+				add_constraint(linear(body, terms), LUrhs [i], Urhsx [i]);
+			else
+				add_constraint(linear(body, terms), LUrhs [2*i], LUrhs [2*i+1]);
 		}
 
-
-		delete[] body_con;
-
 	} catch (...) {
 		return false;
 	}
@@ -439,226 +418,345 @@ bool AmplInterface::readnl() {
 	return true;
 }
 
-// converts an AMPL expression (sub)tree into an expression* (sub)tree
-// thank to Dominique Orban for the explication of the DAG inside AMPL:
-// http://www.gerad.ca/~orban/drampl/dag.html
-const ExprNode& AmplInterface::nl2expr(expr *e) {
-
-	switch (getOperator (e -> op)) {
+void AmplInterface::add_objective(const ExprNode& body, bool maximize) {
+	const ExprNode& goal = maximize ? (const ExprNode&) -body : body;
+	roots.push_back(&goal);
+	add_goal(goal);
+}
 
-	case OPNUM:    return  (ExprConstant::new_scalar(((expr_n *)e)->v));
-	case OPPLUS:   {
-		if (getOperator(e->R.e->op)==OPUMINUS) {
-			return  (( nl2expr(e -> L.e)) - nl2expr((e->R.e)->L.e) );
+void AmplInterface::add_constraint(const ExprNode& body, double lb, double ub) {
+	const ExprNode* f;
+	CmpOp op=LEQ;
+	bool eq=false; // note: "EQ" is a macro of the ASL
+
+	// set constraint sign (and lower-upper bound)
+	if (negInfinity < lb) {
+		if (ub < Infinity) {
+			eq = true;
+			if (lb==ub) {
+				if (lb==0)     f = &body;
+				else if (lb<0) f = &(body+(-lb));
+				else           f = &(body-lb);
+			} else
+				f = &(body-Interval(lb,ub));
 		} else {
-			if (getOperator(e->L.e->op)==OPUMINUS) {
-				return  (nl2expr(e->R.e) - nl2expr((e->L.e)->L.e) );
-			} else {
-				return  (nl2expr(e->R.e) + nl2expr(e->L.e) );
-			}
+			op = GEQ;
+			if (lb==0)     f = &body;
+			else if (lb<0) f = &(body+(-lb));
+			else           f = &(body-lb);
 		}
+	} else {
+		op = LEQ;
+		if (ub==0)     f = &body;
+		else if (ub<0) f = &(body+(-ub));
+		else           f = &(body-ub);
 	}
-	case OPMINUS:  {
-		if (getOperator(e->R.e->op)==OPUMINUS)  {
-			return (( nl2expr(e->L.e)) + nl2expr((e->R.e)->L.e) );
+
+	roots.push_back(f);
+	if (eq)
+		add_ctr_eq(*f);
+	else
+		add_ctr(ExprCtr(*f,op));
+}
+
+const ExprNode& AmplInterface::var(int j) {
+	if (!var_data[j])
+		var_data[j] = &(*_x)[j];
+	return *var_data[j];
+}
+
+const ExprNode& AmplInterface::linear(const ExprNode* body, vector<pair<int,double> >& terms) {
+
+	// remove null coefficients (e.g., zeros of the Jacobian for nonlinear variables)
+	size_t nb_terms=0;
+	for (size_t i=0; i<terms.size(); i++)
+		if (terms[i].second!=0) terms[nb_terms++]=terms[i];
+	terms.resize(nb_terms);
+
+	if (terms.empty())
+		return body ? *body : ExprConstant::new_scalar(0.);
+
+	if (terms.size() > (size_t) max_chain_size) {
+		const ExprNode* lin;
+
+		if (2*terms.size() >= (size_t) n_var) {
+			// dense linear part: a single product a^T x
+			IntervalVector a(n_var, Interval(0));
+			for (size_t i=0; i<terms.size(); i++)
+				a[terms[i].first] += terms[i].second;
+			lin = &(ExprConstant::new_vector(a,true) * (*_x));
 		} else {
-			return  (( nl2expr(e->L.e)) - nl2expr(e->R.e));
-		}
-	}
-	case OPDIV:    return  (( nl2expr(e -> L.e)) / (nl2expr(e -> R.e)));
-	case OPMULT:   return  (operator*((nl2expr (e -> L.e)) , (nl2expr(e -> R.e))));
-	case OPPOW:    return  pow( nl2expr(e -> L.e), nl2expr(e -> R.e));
-	case OP1POW:   {
-		if (((int) (((expr_n *)e->R.e)->v) )==(((expr_n *)e->R.e)->v)) {
-			return pow( nl2expr(e -> L.e), (int) (((expr_n *)e->R.e)->v));
-		} else
-			return pow( nl2expr(e -> L.e), ExprConstant::new_scalar(((expr_n *)e->R.e)->v));
-	}
-	case OP2POW:   return sqr( nl2expr(e -> L.e));
-	case OPCPOW:   return pow(ExprConstant::new_scalar(((expr_n *)e->L.e)->v), nl2expr(e -> R.e));
-	case MINLIST: {
-		expr **ep = e->L.ep;
-		const ExprNode* ee = &(nl2expr(*ep));
-		ep++;
-		while (ep < e->R.ep) {
-			ee = &(min(*ee , nl2expr(*ep)));
-			ep++;
-		}
-		return *ee;
-	}
-	case MAXLIST:  {
-		expr **ep = e->L.ep;
-		const ExprNode* ee = &(nl2expr(*ep));
-		ep++;
-		while (ep < e->R.ep) {
-			ee = &(max(*ee , nl2expr(*ep)));
-			ep++;
-		}
-		return *ee;
-	}
-	case OPSUMLIST: {
-		expr **ep = e->L.ep;
-		const ExprNode* ee = &(nl2expr(*ep));
-		ep++;
-		while (ep < e->R.ep) {
-			if (getOperator((*ep)->op)==OPUMINUS) {
-				ee = &(*ee - nl2expr((*ep)->L.e) );
-			} else {
-				ee = &(*ee + nl2expr(*ep) );
+			// sparse linear part: a balanced sum of terms
+			vector<const ExprNode*> nodes;
+			for (size_t i=0; i<terms.size(); i++) {
+				double coeff = terms[i].second;
+				const ExprNode& xj = var(terms[i].first);
+				if (coeff==1)       nodes.push_back(&xj);
+				else if (coeff==-1) nodes.push_back(&(-xj));
+				else                nodes.push_back(&(coeff*xj));
 			}
-			ep++;
+			lin = &balanced_sum(nodes);
 		}
-		return *ee;
+
+		return body ? *body + *lin : *lin;
 	}
-	case ABS:      return abs( nl2expr(e -> L.e));
-	case OPUMINUS: {
-		if (getOperator(e->L.e->op)==OPUMINUS)  {
-			return  (nl2expr((e -> L.e)->L.e));
+
+	// short linear part: a chain of additions
+	const ExprNode* sum = body;
+	for (size_t i=0; i<terms.size(); i++) {
+		double coeff = terms[i].second;
+		const ExprNode& xj = var(terms[i].first);
+		if (!sum) {
+			if (coeff==1)       sum = &xj;
+			else if (coeff==-1) sum = &(-xj);
+			else                sum = &(coeff*xj);
 		} else {
-			return  (operator-(nl2expr(e -> L.e)));
+			if (coeff==1)       sum = &(*sum + xj);
+			else if (coeff==-1) sum = &(*sum - xj);
+			else                sum = &(*sum + coeff*xj);
 		}
 	}
-	case OP_sqrt:  return sqrt(nl2expr(e -> L.e));
-	case OP_exp:   return exp( nl2expr(e -> L.e));
-	case OP_log:   return log( nl2expr(e -> L.e));
-	case OP_log10: return ((ExprConstant::new_scalar(1.0/log(Interval(10.0)))) * log(nl2expr (e -> L.e)));
-	case OP_cos:   return cos( nl2expr(e -> L.e));
-	case OP_sin:   return sin( nl2expr(e -> L.e));
-	case OP_tan:   return tan( nl2expr(e -> L.e));
-	case OP_cosh:  return cosh(nl2expr(e -> L.e));
-	case OP_sinh:  return sinh(nl2expr(e -> L.e));
-	case OP_tanh:  return tanh(nl2expr(e -> L.e));
-	case OP_acos:  return acos(nl2expr(e -> L.e));
-	case OP_asin:  return asin(nl2expr(e -> L.e));
-	case OP_atan:  return atan(nl2expr(e -> L.e));
-	//case OP_asinh: notimpl ("asinh");
-	//case OP_acosh: notimpl ("acosh");
-	//case OP_atanh: notimpl ("atanh");
-	case OP_atan2: return atan2(nl2expr(e -> L.e), nl2expr(e -> R.e));
-	//case OPintDIV: notimpl ("intdiv");
-	//case OPprecision: notimpl ("precision");
-	//case OPround:  notimpl ("round");
-	//case OPtrunc:  notimpl ("trunc");
-	//case FLOOR:   notimpl ("floor");
-	//case CEIL:    notimpl ("ceil");
-	//case OPFUNCALL: notimpl ("function call");
-	//case OPPLTERM:  notimpl ("plterm");
-	//case OPIFSYM:   notimpl ("ifsym");
-	//case OPHOL:     notimpl ("hol");
-	//case OPREM:   notimpl ("remainder");
-	//case OPLESS:  notimpl ("less");
-	//case OPIFnl:  // TODO return (chi(nl2expr(????))) BoolInterval??
-	                // see ASL/solvers/rops.c, see f_OPIFnl and  expr_if
-	case OPVARVAL:  {
-		int j = ((expr_v *) e) -> a;
-		if (j<n_var) {
-			return (*_x)[j];
+	return *sum;
+}
+
+// converts an AMPL expression (sub)tree into an expression* (sub)tree
+// thank to Dominique Orban for the explication of the DAG inside AMPL:
+// http://www.gerad.ca/~orban/drampl/dag.html
+//
+// The tree is traversed with an explicit stack (the depth of ASL trees
+// is not bounded, e.g., long sums) and each common expression is built
+// only once (the same node is shared by all the expressions that use it).
+const ExprNode& AmplInterface::nl2expr(expr *e) {
+
+	vector<Task> tasks;                  // nodes to be translated
+	vector<const ExprNode*> result;      // translated nodes
+	vector<expr*> args;                  // operands of the current node
+	vector<pair<int,double> > terms;     // linear part of a common expression
+
+	tasks.push_back(Task(e,false));
+
+	while (!tasks.empty()) {
+		Task t=tasks.back();
+		tasks.pop_back();
+		e=t.e;
+		int op=getOperator(e->op);
+
+		if (op==OPNUM) {
+			result.push_back(&ExprConstant::new_scalar(((expr_n *)e)->v));
+			continue;
 		}
-		else {
+
+		if (op==OPVARVAL) {
+			int j = ((expr_v *) e) -> a;
+			if (j<n_var) {
+				result.push_back(&var(j));
+				continue;
+			}
+
 			// http://www.gerad.ca/~orban/drampl/def-vars.html
 			// common expression | defined variable
 			int k = (expr_v *)e - VAR_E;
-			double coeff;
-			int index;
 
-			if( k >= n_var ) {
-				const ExprNode* body;
-				// This is a common expression. Find pointer to its root.
+			if (k < n_var) {
+				ibex_error("Error AmplInterface: unknown defined variable \n");
+				throw -1;
+			}
 
-				// Check if the common expression are already construct
-				if (var_data.find(k)!=var_data.end()) {
-					body = var_data[k];
-				}
-				else {
-
-					// Constract the common expression
-					j = k - n_var;
-					if( j < ncom0 ) 	{
-						cexp *common = CEXPS +j;
-						// init with the nonlinear part
-						body = &(nl2expr(common->e));
-
-						int nlin = common->nlin; // Number of linear terms
-						if( nlin > 0 ) {
-							linpart * L = common->L;
-							for(int i = 0; i < nlin; i++ ) {
-								if ((dynamic_cast<const ExprConstant*>(body))&&(((ExprConstant*)(body))->is_zero())) {
-									coeff = (L[i]).fac;
-									index = ((uintptr_t) (L[i].v.rp) - (uintptr_t) VAR_E) / sizeof (expr_v);
-									if (coeff==1) {
-										body = &((*_x)[index]);
-									} else if (coeff==-1) {
-										body = &( - (*_x)[index]);
-									} else if (coeff != 0) {
-										body = &(coeff * (*_x)[index]);
-									}
-								} else {
-									coeff = (L[i]).fac;
-									index = ((uintptr_t) (L[i].v.rp) - (uintptr_t) VAR_E) / sizeof (expr_v);
-									if (coeff==1) {
-										body = &(*body + (*_x)[index]);
-									} else if (coeff==-1) {
-										body = &(*body - (*_x)[index]);
-									} else if (coeff != 0) {
-										body = &(*body +coeff * (*_x)[index]);
-									}
-								}
-							}
-						}
-					}
-					else {
-						cexp1 *common = (CEXPS1 - ncom0) +j ;
-						// init with the nonlinear part
-						body = &(nl2expr(common->e));
-
-						int nlin = common->nlin; // Number of linear terms
-						if( nlin > 0 ) {
-							linpart * L = common->L;
-							for(int i = 0; i < nlin; i++ ) {
-								if ((dynamic_cast<const ExprConstant*>(body))&&(((ExprConstant*)(body))->is_zero())) {
-									coeff = (L[i]).fac;
-									index = ((uintptr_t) (L[i].v.rp) - (uintptr_t) VAR_E) / sizeof (expr_v);
-									if (coeff==1) {
-										body = &( (*_x)[index]);
-									} else if (coeff==-1) {
-										body = &( - (*_x)[index]);
-									} else if (coeff != 0) {
-										body = &(coeff * (*_x)[index]);
-									}
-								} else {
-									coeff = (L[i]).fac;
-									index = ((uintptr_t) (L[i].v.rp) - (uintptr_t) VAR_E) / sizeof (expr_v);
-									if (coeff==1) {
-										body = &(*body + (*_x)[index]);
-									} else if (coeff==-1) {
-										body = &(*body - (*_x)[index]);
-									} else if (coeff != 0) {
-										body = &(*body +coeff * (*_x)[index]);
-									}
-
-								}
-							}
-						}
-					}
-					var_data[k] = body;;
-				}
-				return *body;
+			j = k - n_var;
 
+			expr* nl_part;
+			int nlin;
+			linpart* L;
+
+			if (j < ncom0) {
+				cexp *common = CEXPS + j;
+				nl_part = common->e;
+				nlin = common->nlin;
+				L = common->L;
 			} else {
-				ibex_error("Error AmplInterface: unknown defined variable \n");
-				throw -1;
+				cexp1 *common = (CEXPS1 - ncom0) + j;
+				nl_part = common->e;
+				nlin = common->nlin;
+				L = common->L;
+			}
+
+			if (common_data[j]) {
+				// the common expression is already built
+				result.push_back(common_data[j]);
+			} else if (!t.build) {
+				// first build the nonlinear part
+				tasks.push_back(Task(e,true));
+				if (nlin>0 && is_zero(nl_part))
+					result.push_back(NULL);
+				else
+					tasks.push_back(Task(nl_part,false));
+			} else {
+				// add the linear part to the nonlinear part
+				const ExprNode* body = result.back();
+				result.pop_back();
+
+				terms.clear();
+				for (int i = 0; i < nlin; i++)
+					terms.push_back(make_pair((int) (((uintptr_t) (L[i].v.rp) - (uintptr_t) VAR_E) / sizeof (expr_v)), (double) L[i].fac));
+
+				common_data[j] = &linear(body, terms);
+				result.push_back(common_data[j]);
 			}
+			continue;
 		}
-	}
 
-	default: {
-		ibex_error( "Error AmplInterface: unknown operator or not implemented \n");
-		throw -2;
-	}
+		switch (op) {
+		case OPPLUS:
+		case OPMINUS:
+		case OPDIV:
+		case OPMULT:
+		case OPPOW:
+		case OP1POW:
+		case OP2POW:
+		case OPCPOW:
+		case MINLIST:
+		case MAXLIST:
+		case OPSUMLIST:
+		case ABS:
+		case OPUMINUS:
+		case OP_sqrt:
+		case OP_exp:
+		case OP_log:
+		case OP_log10:
+		case OP_cos:
+		case OP_sin:
+		case OP_tan:
+		case OP_cosh:
+		case OP_sinh:
+		case OP_tanh:
+		case OP_acos:
+		case OP_asin:
+		case OP_atan:
+		case OP_atan2:
+			break;
+		//case OP_asinh: notimpl ("asinh");
+		//case OP_acosh: notimpl ("acosh");
+		//case OP_atanh: notimpl ("atanh");
+		//case OPintDIV: notimpl ("intdiv");
+		//case OPprecision: notimpl ("precision");
+		//case OPround:  notimpl ("round");
+		//case OPtrunc:  notimpl ("trunc");
+		//case FLOOR:   notimpl ("floor");
+		//case CEIL:    notimpl ("ceil");
+		//case OPFUNCALL: notimpl ("function call");
+		//case OPPLTERM:  notimpl ("plterm");
+		//case OPIFSYM:   notimpl ("ifsym");
+		//case OPHOL:     notimpl ("hol");
+		//case OPREM:   notimpl ("remainder");
+		//case OPLESS:  notimpl ("less");
+		//case OPIFnl:  // TODO return (chi(nl2expr(????))) BoolInterval??
+		                // see ASL/solvers/rops.c, see f_OPIFnl and  expr_if
+		default: {
+			ibex_error( "Error AmplInterface: unknown operator or not implemented \n");
+			throw -2;
+		}
+		}
+
+		operands(e, op, args);
+
+		if (!t.build) {
+			tasks.push_back(Task(e,true));
+			// push the operands in reverse order so that
+			// they are translated (and stacked) in order.
+			for (vector<expr*>::reverse_iterator it=args.rbegin(); it!=args.rend(); ++it)
+				tasks.push_back(Task(*it,false));
+			continue;
+		}
+
+		// the translated operands
+		size_t nb_args=args.size();
+		const ExprNode** x=&result[result.size()-nb_args];
+		const ExprNode* y;
+
+		switch (op) {
+		case OPPLUS:
+			if (getOperator(e->R.e->op)==OPUMINUS || getOperator(e->L.e->op)==OPUMINUS)
+				y = &(*x[0] - *x[1]);
+			else
+				y = &(*x[0] + *x[1]);
+			break;
+		case OPMINUS:
+			if (getOperator(e->R.e->op)==OPUMINUS)
+				y = &(*x[0] + *x[1]);
+			else
+				y = &(*x[0] - *x[1]);
+			break;
+		case OPDIV:    y = &(*x[0] / *x[1]); break;
+		case OPMULT:   y = &(operator*(*x[0], *x[1])); break;
+		case OPPOW:    y = &pow(*x[0], *x[1]); break;
+		case OP1POW:   {
+			if (((int) (((expr_n *)e->R.e)->v) )==(((expr_n *)e->R.e)->v)) {
+				y = &pow(*x[0], (int) (((expr_n *)e->R.e)->v));
+			} else
+				y = &pow(*x[0], ExprConstant::new_scalar(((expr_n *)e->R.e)->v));
+			break;
+		}
+		case OP2POW:   y = &sqr(*x[0]); break;
+		case OPCPOW:   y = &pow(ExprConstant::new_scalar(((expr_n *)e->L.e)->v), *x[0]); break;
+		case MINLIST:
+			y = x[0];
+			for (size_t i=1; i<nb_args; i++)
+				y = &min(*y, *x[i]);
+			break;
+		case MAXLIST:
+			y = x[0];
+			for (size_t i=1; i<nb_args; i++)
+				y = &max(*y, *x[i]);
+			break;
+		case OPSUMLIST: {
+			expr **ep = e->L.ep;
+			if (nb_args <= (size_t) max_chain_size) {
+				y = x[0];
+				for (size_t i=1; i<nb_args; i++) {
+					if (getOperator(ep[i]->op)==OPUMINUS)
+						y = &(*y - *x[i]);
+					else
+						y = &(*y + *x[i]);
+				}
+			} else {
+				vector<const ExprNode*> sum(x, x+nb_args);
+				for (size_t i=1; i<nb_args; i++)
+					if (getOperator(ep[i]->op)==OPUMINUS)
+						sum[i] = &(-*sum[i]);
+				y = &balanced_sum(sum);
+			}
+			break;
+		}
+		case ABS:      y = &abs(*x[0]); break;
+		case OPUMINUS:
+			if (getOperator(e->L.e->op)==OPUMINUS)
+				y = x[0];
+			else
+				y = &(-*x[0]);
+			break;
+		case OP_sqrt:  y = &sqrt(*x[0]); break;
+		case OP_exp:   y = &exp(*x[0]); break;
+		case OP_log:   y = &log(*x[0]); break;
+		case OP_log10: y = &((ExprConstant::new_scalar(1.0/log(Interval(10.0)))) * log(*x[0])); break;
+		case OP_cos:   y = &cos(*x[0]); break;
+		case OP_sin:   y = &sin(*x[0]); break;
+		case OP_tan:   y = &tan(*x[0]); break;
+		case OP_cosh:  y = &cosh(*x[0]); break;
+		case OP_sinh:  y = &sinh(*x[0]); break;
+		case OP_tanh:  y = &tanh(*x[0]); break;
+		case OP_acos:  y = &acos(*x[0]); break;
+		case OP_asin:  y = &asin(*x[0]); break;
+		case OP_atan:  y = &atan(*x[0]); break;
+		default:       y = &atan2(*x[0], *x[1]); // OP_atan2
+		}
+
+		result.resize(result.size()-nb_args);
+		result.push_back(y);
 	}
-	return ExprConstant::new_scalar(0.);
+
+	assert(result.size()==1);
+	return *result.back();
 }
 
 
 }
-
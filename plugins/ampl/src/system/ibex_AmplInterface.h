@@ -15,21 +15,8 @@
 #include "ibex_SystemFactory.h"
 #include "ibex_Expr.h"
 
-#ifdef __GNUC__
-#include <ciso646> // just to initialize _LIBCPP_VERSION
-#ifdef _LIBCPP_VERSION
-#include <unordered_map>
-#else
-#include <tr1/unordered_map>
-#endif
-#else
-#if (_MSC_VER >= 1600)
-#include <unordered_map>
-#else
-#include <unordered_map>
-#endif // (_MSC_VER >= 1600)
-#endif
-
+#include <vector>
+#include <utility>
 
 struct ASL;
 struct expr;
@@ -45,26 +32,32 @@ private:
 
 
 
-#ifdef __GNUC__
-#include <ciso646> // just to initialize _LIBCPP_VERSION
-#ifdef _LIBCPP_VERSION
-	std::unordered_map<int, const ExprNode*> var_data;
-#else
-	std::tr1::unordered_map<int, const ExprNode*> var_data;
-#endif
-#else
-#if (_MSC_VER >= 1600)
-	std::unordered_map<int, const ExprNode*> var_data;
-#else
-	std::tr1::unordered_map<int, const ExprNode*> var_data;
-#endif // (_MSC_VER >= 1600)
-#endif
+	// The i^th component of x (built once, shared by all expressions)
+	std::vector<const ExprNode*> var_data;
+
+	// The common expressions (defined variables), built on demand
+	std::vector<const ExprNode*> common_data;
 
+	// All the expressions given to the factory (for cleanup)
+	std::vector<const ExprNode*> roots;
 
 	bool readnl();
 	bool readASLfg();
 	const ExprNode& nl2expr(expr *e);
 
+	/*
+	 * Return body+a^T x where the linear part a^T x is given by a list
+	 * of (index, coefficient) terms. If body==NULL, return a^T x.
+	 */
+	const ExprNode& linear(const ExprNode* body, std::vector<std::pair<int,double> >& terms);
+
+	/* The i^th component of x */
+	const ExprNode& var(int i);
+
+	/* Add the objective/constraint to the factory */
+	void add_objective(const ExprNode& body, bool maximize);
+	void add_constraint(const ExprNode& body, double lb, double ub);
+
 
 public:
 	AmplInterface(std::string nlfile);
@@ -76,6 +69,15 @@ public:
 
 	//static const double default_max_bound;
 
+	/**
+	 * \brief Maximal number of terms of a sum built as a chain of additions.
+	 *
+	 * Longer sums are built as balanced trees or, if the sum is a linear
+	 * part that involves at least half of the variables, as a single
+	 * dot product with a constant (row) vector.
+	 */
+	static const int max_chain_size;
+
 };
 
 }
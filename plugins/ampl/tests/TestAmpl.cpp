@@ -256,4 +256,25 @@ void TestAmpl::variable3() {
 	CPPUNIT_ASSERT(sys.ops[1]==GEQ);
 	CPPUNIT_ASSERT(sys.ops[2]==LEQ);
 }
+
+void TestAmpl::large_sum() {
+	AmplInterface inter(SRCDIR_TESTS "/../plugins/ampl/tests/ex_ampl/ex7.nl" );
+	System sys(inter);
+	// long sums are built as balanced trees
+	CPPUNIT_ASSERT(sameExpr(sys.goal->expr(),"(((((x(1)*x(1))+(x(2)*x(2)))+((x(3)*x(3))+(x(4)*x(4))))+(((x(5)*x(5))+(x(6)*x(6)))+((x(7)*x(7))+(x(8)*x(8)))))+((x(9)*x(9))+(x(10)*x(10))))"));
+	CPPUNIT_ASSERT(sys.ctrs.size()==2);
+	CPPUNIT_ASSERT(sys.f_ctrs.nb_var()==10);
+	CPPUNIT_ASSERT(sameExpr(sys.f_ctrs[0].expr(),"((((((x(1)*x(2))+(x(2)*x(3)))+((x(3)*x(4))+(x(4)*x(5))))+(((x(5)*x(6))+(x(6)*x(7)))+((x(7)*x(8))+(x(8)*x(9)))))+(x(9)*x(10)))-x(10))"));
+	// a dense linear part is a single product
+	CPPUNIT_ASSERT(sameExpr(sys.f_ctrs[1].expr(),"(((1 , 2 , 3 , 4 , 5 , 6 , 7 , 8 , 9 , 10)*x)-1)"));
+	CPPUNIT_ASSERT(sys.ops[0]==GEQ);
+	CPPUNIT_ASSERT(sys.ops[1]==LEQ);
+
+	IntervalVector box(10,Interval(1));
+	check(sys.goal->eval(box),Interval(10));
+	IntervalMatrix J=sys.f_ctrs.jacobian(box);
+	for (int i=0; i<10; i++)
+		check(J[1][i],Interval(i+1));
+}
+
 } // end namespace
@@ -0,0 +1,8 @@
+var x{1..10};
+
+minimize goal: sum {i in 1..10} x[i]*x[i];
+
+s.t. con1: sum {i in 1..9} x[i]*x[i+1] - x[10] >= 0;
+s.t. con2: sum {i in 1..10} i*x[i] <= 1;
+
+write gex7;
@@ -0,0 +1,132 @@
+g3 0 1 0	# problem ex7
+ 10 2 1 0 0	# vars, constraints, objectives, ranges, eqns
+ 1 1	# nonlinear constraints, objectives
+ 0 0	# network constraints: nonlinear, linear
+ 10 10 10	# nonlinear vars in constraints, objectives, both
+ 0 0 0 1	# linear network variables; functions; arith, flags
+ 0 0 0 0 0	# discrete variables: binary, integer, nonlinear (b,c,o)
+ 20 10	# nonzeros in Jacobian, gradients
+ 0 0	# max name lengths: constraints, variables
+ 0 0 0 0 0	# common exprs: b,c,o,c1,o1
+C0
+o54
+9
+o2
+v0
+v1
+o2
+v1
+v2
+o2
+v2
+v3
+o2
+v3
+v4
+o2
+v4
+v5
+o2
+v5
+v6
+o2
+v6
+v7
+o2
+v7
+v8
+o2
+v8
+v9
+C1
+n0
+O0 0
+o54
+10
+o2
+v0
+v0
+o2
+v1
+v1
+o2
+v2
+v2
+o2
+v3
+v3
+o2
+v4
+v4
+o2
+v5
+v5
+o2
+v6
+v6
+o2
+v7
+v7
+o2
+v8
+v8
+o2
+v9
+v9
+r
+2 0
+1 1
+b
+3
+3
+3
+3
+3
+3
+3
+3
+3
+3
+k9
+2
+4
+6
+8
+10
+12
+14
+16
+18
+J0 10
+0 0
+1 0
+2 0
+3 0
+4 0
+5 0
+6 0
+7 0
+8 0
+9 -1
+J1 10
+0 1
+1 2
+2 3
+3 4
+4 5
+5 6
+6 7
+7 8
+8 9
+9 10
+G0 10
+0 0
+1 0
+2 0
+3 0
+4 0
+5 0
+6 0
+7 0
+8 0
+9 0
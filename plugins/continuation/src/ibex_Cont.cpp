@@ -19,8 +19,11 @@
 #include "ibex_Timer.h"
 #include "ibex_Newton.h"
 #include "ibex_Linear.h"
+#include "ibex_ThreadPool.h"
 #include <fstream>
 #include <iomanip>
+#include <algorithm>
+
 
 using namespace std;
 
@@ -34,14 +37,22 @@ class ChooseFail : public Exception { };
 void Cont::add_to_neighbors(ContCell* cell) {
 	list<ContCell*> neighbors;
 
-	for(IBEX_NEIGHBORHOOD::iterator it=neighborhood.begin(); it!=neighborhood.end(); it++){
-		if(cell->unicity_box.intersects(it->first->unicity_box)) {
-			neighbors.push_back(it->first);
-			it->second.push_back(cell);
+	vector<int> cells;
+	cell_index.intersecting(cell->unicity_box, cells);
+
+	for (vector<int>::iterator it=cells.begin(); it!=cells.end(); it++) {
+		ContCell* cell2=cell_index.cell(*it);
+		if (cell->unicity_box.intersects(cell2->unicity_box)) {
+			neighbors.push_back(cell2);
+			neighborhood[cell2].push_back(cell);
 		}
 	}
 
 	neighborhood.insert(make_pair(cell,neighbors));
+
+	cell_index.insert(cell);
+	l_pos.push_back(l.end());
+	done_rank.push_back(-1);
 }
 
 //void Cont::update_neighbors(ContCell* cell) {
@@ -81,17 +92,17 @@ Function* Cont::merge(Function &f, Function& g) {
 	return new Function(x,ExprVector::new_col(fg));
 }
 
-Cont::Cont(Function &f, Function &g, double h_min, double alpha, double beta) : dfs(false), full_diff(true), n(f.nb_var()+g.image_dim()), m(f.image_dim()+g.image_dim()), f(*merge(f,g)), g(&g), domain(this->f.nb_var()), h_min(h_min), alpha(alpha), beta(beta) {
+Cont::Cont(Function &f, Function &g, double h_min, double alpha, double beta) : dfs(false), full_diff(true), n(f.nb_var()+g.image_dim()), m(f.image_dim()+g.image_dim()), f(*merge(f,g)), g(&g), domain(this->f.nb_var()), h_min(h_min), alpha(alpha), beta(beta), cell_index(n), nb_threads(1), pool(NULL) {
 
 	for (int i=0; i<g.image_dim(); i++)
 		domain[f.nb_var()+i] = Interval::NEG_REALS;
 }
 
-Cont::Cont(Function &f, const IntervalVector& domain, double h_min, double alpha, double beta) : dfs(false), full_diff(true), n(f.nb_var()), m(f.image_dim()), f(f), g(NULL), domain(domain), h_min(h_min), alpha(alpha), beta(beta) {
+Cont::Cont(Function &f, const IntervalVector& domain, double h_min, double alpha, double beta) : dfs(false), full_diff(true), n(f.nb_var()), m(f.image_dim()), f(f), g(NULL), domain(domain), h_min(h_min), alpha(alpha), beta(beta), cell_index(n), nb_threads(1), pool(NULL) {
 
 }
 
-Cont::Cont(Function &f, double h_min, double alpha, double beta) : dfs(false), full_diff(true), n(f.nb_var()), m(f.image_dim()), f(f), g(NULL), domain(f.nb_var(),Interval::ALL_REALS), h_min(h_min), alpha(alpha), beta(beta) {
+Cont::Cont(Function &f, double h_min, double alpha, double beta) : dfs(false), full_diff(true), n(f.nb_var()), m(f.image_dim()), f(f), g(NULL), domain(f.nb_var(),Interval::ALL_REALS), h_min(h_min), alpha(alpha), beta(beta), cell_index(n), nb_threads(1), pool(NULL) {
 
 }
 
@@ -104,6 +115,25 @@ void Cont::remove_next_cell() {
 	else l.pop_front();
 }
 
+void Cont::store_todo(ContCell* cell) {
+	l_pos[cell_index.num(cell)]=l.insert(l.end(),cell);
+}
+
+void Cont::store_done(ContCell* cell) {
+	done_rank[cell_index.num(cell)]=l_empty_facets.size();
+	l_empty_facets.push_back(cell);
+}
+
+void Cont::set_nb_threads(int n) {
+#ifdef _IBEX_WITH_THREADS_
+	nb_threads = n<1 ? 1 : n;
+	while ((int) thread_f.size() < nb_threads-1)
+		thread_f.push_back(new Function(f,Function::COPY));
+	if (pool) delete pool;
+	pool = nb_threads>1 ? new ThreadPool(nb_threads) : NULL;
+#endif
+}
+
 Cont::~Cont() {
 	if (g!=NULL) delete &f;
 
@@ -111,6 +141,11 @@ Cont::~Cont() {
 	for(IBEX_NEIGHBORHOOD::iterator it=neighborhood.begin(); it!=neighborhood.end(); it++) {
 		delete it->first;
 	}
+
+	if (pool) delete pool;
+
+	for (vector<Function*>::iterator it=thread_f.begin(); it!=thread_f.end(); it++)
+		delete *it;
 }
 
 void Cont::start(IntervalVector x, double h, int kmax) {
@@ -215,30 +250,45 @@ void Cont::start(IntervalVector x, double h, int kmax) {
 
 void Cont::diff(ContCell* new_cell) {
 
-	// No: we can't erase in l using iterators in neighorhood[new_cell] !
-	//	for (list<ContCell*>::iterator it=neighborhood[new_cell].begin(); it!=neighborhood[new_cell].end(); ) {
+	// Only the cells that intersect the new one are concerned
+	// (see ContCell::diff). They are processed in the order of
+	// the lists l and l_empty_facets.
+	vector<int> cells;
+	cell_index.intersecting(new_cell->unicity_box, cells);
 
-	for (list<ContCell*>::iterator it=l.begin(); it!=l.end(); ) {
+	int new_num=cell_index.num(new_cell);
 
-		if (!full_diff && ((*it)->vars!=new_cell->vars)) {
-			it++;
-			continue;
-		}
+	// The cells in l, ordered by creation as in l
+	for (vector<int>::iterator it=cells.begin(); it!=cells.end(); it++) {
 
-		new_cell->diff((*it)->unicity_box,f,(*it)->vars);
+		if (*it==new_num || done_rank[*it]!=-1) continue;
 
-		if (!(*it)->empty_facets()) {
-			(*it)->diff(new_cell->unicity_box,f,new_cell->vars);
+		ContCell* cell=cell_index.cell(*it);
 
-			if ((*it)->empty_facets()) { // move the cell to the list without facets
-				l_empty_facets.push_back(*it);
-				it=l.erase(it); // "it" points to the next element
-			} else it++;
-		} else it++;
+		if (!full_diff && (cell->vars!=new_cell->vars)) continue;
+
+		new_cell->diff(cell->unicity_box,f,cell->vars);
+
+		if (!cell->empty_facets()) {
+			cell->diff(new_cell->unicity_box,f,new_cell->vars);
+
+			if (cell->empty_facets()) { // move the cell to the list without facets
+				l.erase(l_pos[*it]);
+				store_done(cell);
+			}
+		}
+	}
+
+	// The cells in l_empty_facets (including the ones just moved)
+	vector<pair<int,int> > done;
+	for (vector<int>::iterator it=cells.begin(); it!=cells.end(); it++) {
+		if (done_rank[*it]!=-1) done.push_back(make_pair(done_rank[*it],*it));
 	}
+	sort(done.begin(),done.end());
 
-	for (list<ContCell*>::iterator it=l_empty_facets.begin(); it!=l_empty_facets.end(); it++) {
-		new_cell->diff((*it)->unicity_box,f,(*it)->vars);
+	for (vector<pair<int,int> >::iterator it=done.begin(); it!=done.end(); it++) {
+		ContCell* cell=cell_index.cell(it->second);
+		new_cell->diff(cell->unicity_box,f,cell->vars);
 	}
 
 	// Try to remove cells in the solution-find-fail list
@@ -256,9 +306,9 @@ void Cont::diff(ContCell* new_cell) {
 
 	// Choose where to store the new cell
 	if (new_cell->empty_facets())
-		l_empty_facets.push_back(new_cell);
+		store_done(new_cell);
 	else
-		l.push_back(new_cell);
+		store_todo(new_cell);
 }
 
 bool Cont::is_valid_cell_1_old(const IntervalVector& box_existence, const VarSet& vars, const VarSet& forced_params) {
@@ -292,7 +342,7 @@ bool Cont::is_valid_cell_1_old(const IntervalVector& box_existence, const VarSet
 }
 
 
-bool Cont::is_valid_cell_1(const IntervalVector& box_existence, const VarSet& vars, const vector<pair<int,bool> >& wrong_vars) {
+bool Cont::is_valid_cell_1(Function& f, const IntervalVector& box_existence, const VarSet& vars, const vector<pair<int,bool> >& wrong_vars) {
 
 	// ========= calculate the Jacobian of the implicit function ===========
 	IntervalMatrix Jp(m,n-m); // Jacobian % parameters
@@ -419,57 +469,40 @@ bool Cont::is_valid_cell_2(const IntervalVector& box_existence, const VarSet& va
 	return valid_cell;
 }
 
-ContCell* Cont::choose(const ContCell::Facet* x_facet, const IntervalVector& x, double h) {
-	IntervalVector x_box(m);
-	IntervalVector p_box(n-m);
-	IntervalVector p_box_h(n-m);
-	IntervalVector box(n);
-	IntervalVector box_unicity(n);
-	IntervalVector box_existence(n);
-	VarSet vars=get_newton_vars(f, x.mid(), VarSet(n,BitSet::empty(n),false));
-
-	x_box=vars.var_box(x);
-	p_box=vars.param_box(x);
-
-	// IntervalVector g_box(g? g->image_dim() : 1 /* unused if g==NULL*/);
-
-	// Have we found a new cell?
-	bool success;
+bool Cont::try_cell(Function& f, const VarSet& vars, const IntervalVector& x_box, const IntervalVector& p_box, double h,
+		IntervalVector& box_existence, IntervalVector& box_unicity) {
 
 	// Is this cell valid?
 	// If the cell is inside the domain, it is valid. If the cell crosses the
 	// boundary of the domain, the manifold inside the intersection of the cell
 	// and the domain must be homeomorph to a half-ball.
-	bool valid_cell;
+	bool valid_cell=true; // by default
 
-	do {
+	// We need to recalculate variables even when success==false
+	// because the existence box may cross the boundary
+	// of the domain but the manifold may not.
 
-		valid_cell=true; // by default
-
-		// We need to recalculate variables even when success==false
-		// because the existence box may cross the boundary
-		// of the domain but the manifold may not.
+	bool success;
 
-		try {
+	try {
 
-			IntervalVector shift(vars.nb_param,Interval(-h,h));
+		IntervalVector shift(vars.nb_param,Interval(-h,h));
 
-			// minimize overlapping with the x-cell by shifting
+		// minimize overlapping with the x-cell by shifting
 //			if (x_facet!=NULL)
 //				shift[x_facet->p] = h*(x_facet->sign? Interval(-0.01,1.99) : Interval(-1.99,0.01));
 
-			p_box_h = p_box + shift;
-			box=vars.full_box(x_box, p_box_h);
+		IntervalVector box=vars.full_box(x_box, p_box + shift);
 
-			success=inflating_newton(f,vars,box,box_existence,box_unicity);
+		success=inflating_newton(f,vars,box,box_existence,box_unicity);
 
-		} catch(SingularMatrixException&) {
-			// should not happen
-			success = false;
-		}
+	} catch(SingularMatrixException&) {
+		// should not happen
+		success = false;
+	}
 
-		/*
-		if(success && g!=NULL){
+	/*
+	if(success && g!=NULL){
             if(g->image_dim()==1)
                 g_box[0]=g->eval(box_existence);
             else
@@ -478,24 +511,24 @@ ContCell* Cont::choose(const ContCell::Facet* x_facet, const IntervalVector& x,
                 success=false;
         }*/
 
-		// Dimensions that should be parameters (by default: none).
-		BitSet forced_params(BitSet::empty(n));
+	// Dimensions that should be parameters (by default: none).
+	BitSet forced_params(BitSet::empty(n));
 
-		// The indices of variables (among the variables, not all the dimensions)
+	// The indices of variables (among the variables, not all the dimensions)
         // that violate a bound of the domain + a boolean which indicates the bound
-		// (false=lower bound, true=upper bound)
-		vector<pair<int,bool> > wrong_vars;
+	// (false=lower bound, true=upper bound)
+	vector<pair<int,bool> > wrong_vars;
 
-		if(success) { // check if the cell is valid
+	if(success) { // check if the cell is valid
 
-			// Check if the cell crosses the domain only
-			// in the dimension of parameters.
+		// Check if the cell crosses the domain only
+		// in the dimension of parameters.
 
-			// Find dimensions along with the box exceeds domain
-			// and mark them has "should be parameters"
+		// Find dimensions along with the box exceeds domain
+		// and mark them has "should be parameters"
            int var_number=0;
-			for (int i=0; i<n; i++) {
-				if (!box_existence[i].is_subset(domain[i])) {
+		for (int i=0; i<n; i++) {
+			if (!box_existence[i].is_subset(domain[i])) {
                     forced_params.add(i);
                     if (vars.is_var[i]) {
                     	if (box_existence[i].lb() < domain[i].lb()) {
@@ -511,39 +544,89 @@ ContCell* Cont::choose(const ContCell::Facet* x_facet, const IntervalVector& x,
                     		wrong_vars.push_back(make_pair(var_number,true));
                     	}
                     }
-				}
-                if (vars.is_var[i]) var_number++;
 			}
+                if (vars.is_var[i]) var_number++;
 		}
+	}
 
 //		if (success && !valid_cell) {
 //			valid_cell = is_valid_cell_1_old(box_existence,vars,forced_params);
 //        }
 
-		if (success && !valid_cell) {
-			valid_cell = is_valid_cell_1(box_existence,vars,wrong_vars);
+	if (success && !valid_cell) {
+		valid_cell = is_valid_cell_1(f,box_existence,vars,wrong_vars);
         }
 
 //		if (success && !valid_cell) {
 //			valid_cell = is_valid_cell_2(box_existence,vars,forced_params);
 //        }
-		//============================================================
+	//============================================================
         
-		if (success && valid_cell) {
-			ContCell* cell = new ContCell(box_existence,box_unicity,domain,vars);
+	return success && valid_cell;
+}
+
+ContCell* Cont::choose(const ContCell::Facet* x_facet, const IntervalVector& x, double h) {
+	IntervalVector box_unicity(n);
+	IntervalVector box_existence(n);
+	VarSet vars=get_newton_vars(f, x.mid(), VarSet(n,BitSet::empty(n),false));
+
+	IntervalVector x_box=vars.var_box(x);
+	IntervalVector p_box=vars.param_box(x);
+
+	// The successive parameter widths (h is decreased
+	// until a cell is found)
+	vector<double> widths;
+	do {
+		widths.push_back(h);
+		h = alpha*h;
+	} while(h>=h_min);
+
+	// index of the first width that succeeds
+	int found=-1;
 
-			// Contract each facet separately
-			CtcParamNewton ctc(f,vars);
-			cell->contract_facets(ctc);
+	if (nb_threads<=1) {
+		for (int i=0; found==-1 && i<(int) widths.size(); i++)
+			if (try_cell(f,vars,x_box,p_box,widths[i],box_existence,box_unicity))
+				found=i;
+	}
+	else {
+		// The candidate cells (one per width) are verified by batches of
+		// nb_threads, in parallel, by the threads of the pool, each with
+		// its own copy of f. The first width that succeeds in the sequence
+		// is kept, so that the result is the same as the sequential one.
+		for (int i=0; found==-1 && i<(int) widths.size(); i+=nb_threads) {
+			int batch=std::min(nb_threads,(int) widths.size()-i);
+
+			vector<IntervalVector> existence(batch,IntervalVector(n));
+			vector<IntervalVector> unicity(batch,IntervalVector(n));
+			vector<char> success(batch,false);
+
+			pool->run([&](int t) {
+				if (t<batch) {
+					Function& ft = t==0 ? f : *thread_f[t-1];
+					success[t]=try_cell(ft,vars,x_box,p_box,widths[i+t],existence[t],unicity[t]);
+				}
+			});
 
-			return cell;
-		} else {
-			h = alpha*h;
+			for (int t=0; found==-1 && t<batch; t++) {
+				if (success[t]) {
+					found=i+t;
+					box_existence=existence[t];
+					box_unicity=unicity[t];
+				}
+			}
 		}
+	}
 
-	} while(h>=h_min);
+	if (found==-1) throw ChooseFail();
 
-	throw ChooseFail();
+	ContCell* cell = new ContCell(box_existence,box_unicity,domain,vars);
+
+	// Contract each facet separately
+	CtcParamNewton ctc(f,vars);
+	cell->contract_facets(ctc);
+
+	return cell;
 }
 
 pair<ContCell*,ContCell::Facet*> Cont::find_solution_in_cells(IntervalVector& x) {
@@ -566,8 +649,8 @@ pair<ContCell*,ContCell::Facet*> Cont::find_solution_in_cells(IntervalVector& x)
 
 			// No solution in all the remaining facets => remove the cell
 			if (x.is_empty()) {
-				l_empty_facets.push_back(cell);
 				remove_next_cell();
+				store_done(cell);
 			} else {
 				return pair<ContCell*,ContCell::Facet*>(cell,&cell->facets.front());
 			}
@@ -611,14 +694,18 @@ void Cont::move_facet_to_fails(bool choose) {
 		l_find_solution_failed_facets.push_back(cell->pop_front_facet());
 
 	if (cell->empty_facets()) {
-		l_empty_facets.push_back(cell);
 		remove_next_cell();
+		store_done(cell);
 	}
 }
 
 void Cont::check_no_facet_contains(const IntervalVector& x) {
-	for (list<ContCell*>::iterator it=l.begin(); it!=l.end(); it++) {
-		(*it)->check_no_facet_contains(x);
+	vector<int> cells;
+	cell_index.intersecting(x, cells);
+
+	for (vector<int>::iterator it=cells.begin(); it!=cells.end(); it++) {
+		if (done_rank[*it]==-1)
+			cell_index.cell(*it)->check_no_facet_contains(x);
 	}
 }
 
@@ -14,9 +14,11 @@
 #define __IBEX_CONTINUATION_H__
 
 #include "ibex_ContCell.h"
+#include "ibex_ContCellIndex.h"
 
 #include <list>
 #include <set>
+#include <vector>
 
 #ifdef __GNUC__
 #include <ciso646> // just to initialize _LIBCPP_VERSION
@@ -43,6 +45,8 @@
 
 namespace ibex {
 
+class ThreadPool;
+
 
 struct same_cont_cell {
 	bool operator() (const ContCell* cell1, const ContCell* cell2) const {
@@ -118,6 +122,20 @@ public:
 	 */
 	void to_mathematica(const std::string& basename) const;
 
+	/**
+	 * \brief Set the number of threads (1 by default).
+	 *
+	 * With n>1 threads, the construction of a cell verifies n candidate
+	 * cells, of parameter widths h, alpha*h, alpha^2*h, etc., in parallel
+	 * and keeps the largest one that succeeds, instead of trying them one
+	 * after the other. The result is the same. The threads are created
+	 * once (see #ibex::ThreadPool) and each of them owns a copy of the
+	 * function f.
+	 *
+	 * Has no effect if Ibex is built without thread support.
+	 */
+	void set_nb_threads(int n);
+
 	/**
 	 * \brief Cell choice heuristic.
 	 *
@@ -263,6 +281,9 @@ public:
     /** Maps a cell to the list of its neighbors */
 	IBEX_NEIGHBORHOOD neighborhood;
 
+	/** Spatial index of all the cells (numbered by order of creation) */
+	ContCellIndex cell_index;
+
 protected:
 	friend class TestCont;
 
@@ -273,14 +294,39 @@ protected:
 
 	void remove_next_cell();
 
+	// Store a cell in l
+	void store_todo(ContCell* cell);
+
+	// Store a cell in l_empty_facets
+	void store_done(ContCell* cell);
+
+	// Try to build a cell of parameter width h around x=x_box x p_box
+	bool try_cell(Function& f, const VarSet& vars, const IntervalVector& x_box, const IntervalVector& p_box, double h,
+			IntervalVector& box_existence, IntervalVector& box_unicity);
+
 	/* Old test, which checks that there is no zero in the J_implicit_wrong,
 	 * using only J_implicit and forced_params */
 	bool is_valid_cell_1_old(const IntervalVector& box_existence, const VarSet& vars, const VarSet& forced_params);
 
-	bool is_valid_cell_1(const IntervalVector& box_existence, const VarSet& vars, const std::vector<std::pair<int,bool> > & wrong_vars);
+	bool is_valid_cell_1(Function& f, const IntervalVector& box_existence, const VarSet& vars, const std::vector<std::pair<int,bool> > & wrong_vars);
 
 	bool is_valid_cell_2(const IntervalVector& box_existence, const VarSet& vars, const VarSet& forced_params);
 
+	// Position in l of the cells (by number), if they are in l.
+	std::vector<std::list<ContCell*>::iterator> l_pos;
+
+	// Position in l_empty_facets of the cells (by number), -1 if they are not in.
+	std::vector<int> done_rank;
+
+	// Number of threads
+	int nb_threads;
+
+	// Copies of f for the threads (except the first one, which uses f)
+	std::vector<Function*> thread_f;
+
+	// Threads verifying the candidate cells (NULL if nb_threads=1)
+	ThreadPool* pool;
+
 };
 
 } /* namespace ibex */
@@ -0,0 +1,210 @@
+/* ============================================================================
+ * I B E X - Spatial index of continuation cells
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ *
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_ContCellIndex.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+using namespace std;
+
+namespace ibex {
+
+const int ContCellIndex::MAX_ENTRIES=8;
+
+namespace {
+
+/*
+ * Sum of the diameters. Used instead of the volume to
+ * measure the boxes, since cells are very thin in some
+ * dimensions (the volume is often zero).
+ */
+double margin(const IntervalVector& box) {
+	double m=0;
+	for (int i=0; i<box.size(); i++) m+=box[i].diam();
+	return m;
+}
+
+double enlargement(const IntervalVector& hull, const IntervalVector& box) {
+	return margin(hull | box) - margin(hull);
+}
+
+} // end anonymous namespace
+
+ContCellIndex::ContCellIndex(int n) : n(n), root(-1) {
+
+}
+
+int ContCellIndex::num(const ContCell* cell) const {
+	map<const ContCell*,int>::const_iterator it=nums.find(cell);
+	return it==nums.end() ? -1 : it->second;
+}
+
+int ContCellIndex::insert(ContCell* cell) {
+	assert(cell->unicity_box.size()==n);
+
+	int i=cells.size();
+	cells.push_back(cell);
+	boxes.push_back(cell->unicity_box | cell->existence_box);
+	nums.insert(make_pair(cell,i));
+
+	if (root==-1) {
+		nodes.push_back(Node(n,true));
+		root=nodes.size()-1;
+	}
+
+	int sibling=insert(root,i);
+
+	if (sibling!=-1) {
+		// the root has been split: grow the tree
+		Node new_root(n,false);
+		new_root.entries.push_back(root);
+		new_root.entries.push_back(sibling);
+		new_root.hull = nodes[root].hull | nodes[sibling].hull;
+		nodes.push_back(new_root);
+		root=nodes.size()-1;
+	}
+	return i;
+}
+
+int ContCellIndex::insert(int node, int i) {
+	// note: "nodes" may be reallocated by the recursive calls,
+	// so we don't keep references to its elements.
+	nodes[node].hull |= boxes[i];
+
+	if (!nodes[node].leaf) {
+		// choose the child with the least enlargement
+		const Node& nd=nodes[node];
+		int best=-1;
+		double best_enl=0, best_margin=0;
+		for (size_t j=0; j<nd.entries.size(); j++) {
+			const IntervalVector& h=nodes[nd.entries[j]].hull;
+			double enl=enlargement(h,boxes[i]);
+			double m=margin(h);
+			if (best==-1 || enl<best_enl || (enl==best_enl && m<best_margin)) {
+				best=nd.entries[j];
+				best_enl=enl;
+				best_margin=m;
+			}
+		}
+
+		int sibling=insert(best,i);
+		if (sibling==-1) return -1;
+		nodes[node].entries.push_back(sibling);
+	} else
+		nodes[node].entries.push_back(i);
+
+	if ((int) nodes[node].entries.size()>MAX_ENTRIES)
+		return split(node);
+	else
+		return -1;
+}
+
+int ContCellIndex::split(int node) {
+	vector<int> entries;
+	entries.swap(nodes[node].entries);
+	bool leaf=nodes[node].leaf;
+	int size=entries.size();
+
+	vector<IntervalVector> b;
+	for (int j=0; j<size; j++)
+		b.push_back(leaf ? boxes[entries[j]] : nodes[entries[j]].hull);
+
+	// pick the two seeds that would waste the most
+	int s1=0, s2=1;
+	double worst=NEG_INFINITY;
+	for (int j=0; j<size; j++)
+		for (int k=j+1; k<size; k++) {
+			double waste=margin(b[j] | b[k]) - margin(b[j]) - margin(b[k]);
+			if (waste>worst) {
+				worst=waste;
+				s1=j;
+				s2=k;
+			}
+		}
+
+	Node group2(n,leaf);
+	IntervalVector& hull1=nodes[node].hull;
+	hull1=b[s1];
+	nodes[node].entries.push_back(entries[s1]);
+	group2.hull=b[s2];
+	group2.entries.push_back(entries[s2]);
+
+	const int min_entries=(MAX_ENTRIES+1)/2;
+	vector<bool> assigned(size,false);
+	assigned[s1]=assigned[s2]=true;
+
+	for (int left=size-2; left>0; left--) {
+		int n1=nodes[node].entries.size();
+		int n2=group2.entries.size();
+
+		// pick the entry with the greatest preference for one group
+		int next=-1;
+		double d1=0, d2=0, best_diff=-1;
+		for (int j=0; j<size; j++) {
+			if (assigned[j]) continue;
+			double e1=enlargement(hull1,b[j]);
+			double e2=enlargement(group2.hull,b[j]);
+			if (std::abs(e1-e2)>best_diff) {
+				best_diff=std::abs(e1-e2);
+				next=j;
+				d1=e1;
+				d2=e2;
+			}
+		}
+
+		bool first;
+		if (n1+left<=min_entries) first=true;       // group 1 needs all the remaining entries
+		else if (n2+left<=min_entries) first=false;
+		else if (d1!=d2) first=d1<d2;
+		else first=n1<=n2;
+
+		if (first) {
+			hull1 |= b[next];
+			nodes[node].entries.push_back(entries[next]);
+		} else {
+			group2.hull |= b[next];
+			group2.entries.push_back(entries[next]);
+		}
+		assigned[next]=true;
+	}
+
+	nodes.push_back(group2);
+	return nodes.size()-1;
+}
+
+void ContCellIndex::intersecting(const IntervalVector& box, vector<int>& res) const {
+	res.clear();
+	if (root==-1) return;
+
+	vector<int> stack;
+	stack.push_back(root);
+
+	while (!stack.empty()) {
+		const Node& node=nodes[stack.back()];
+		stack.pop_back();
+
+		if (!node.hull.intersects(box)) continue;
+
+		for (size_t j=0; j<node.entries.size(); j++) {
+			if (node.leaf) {
+				if (boxes[node.entries[j]].intersects(box))
+					res.push_back(node.entries[j]);
+			} else
+				stack.push_back(node.entries[j]);
+		}
+	}
+
+	sort(res.begin(),res.end());
+}
+
+} /* namespace ibex */
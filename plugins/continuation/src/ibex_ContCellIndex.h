@@ -0,0 +1,132 @@
+/* ============================================================================
+ * I B E X - Spatial index of continuation cells
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ *
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_CONTCELL_INDEX_H__
+#define __IBEX_CONTCELL_INDEX_H__
+
+#include "ibex_ContCell.h"
+
+#include <vector>
+#include <map>
+
+namespace ibex {
+
+/**
+ * \brief Spatial index (R-tree) of continuation cells.
+ *
+ * Each cell is indexed by the hull of its unicity and existence boxes
+ * (which contains all its facets). The cells are numbered in the order
+ * of insertion and the queries return the numbers of the matching cells
+ * in increasing order, so that the cells can be processed in the order
+ * of their creation.
+ *
+ * The cells cannot be removed and their boxes must not be modified
+ * once inserted (the facets can).
+ */
+class ContCellIndex {
+public:
+	/**
+	 * \brief Create an empty index.
+	 *
+	 * \param n - the dimension of the boxes.
+	 */
+	explicit ContCellIndex(int n);
+
+	/**
+	 * \brief Insert a cell.
+	 *
+	 * \return the number of the cell.
+	 */
+	int insert(ContCell* cell);
+
+	/**
+	 * \brief Number of cells.
+	 */
+	int size() const;
+
+	/**
+	 * \brief The cell with number i.
+	 */
+	ContCell* cell(int i) const;
+
+	/**
+	 * \brief The number of a cell (-1 if the cell is not indexed).
+	 */
+	int num(const ContCell* cell) const;
+
+	/**
+	 * \brief The cells which may intersect a box.
+	 *
+	 * \param res - (output) the numbers of all the cells whose indexed box
+	 *              intersects box, in increasing order.
+	 */
+	void intersecting(const IntervalVector& box, std::vector<int>& res) const;
+
+	/**
+	 * \brief Maximal number of entries in a node.
+	 */
+	static const int MAX_ENTRIES;
+
+protected:
+
+	struct Node {
+		Node(int n, bool leaf) : leaf(leaf), hull(IntervalVector::empty(n)) { }
+
+		/** True for a leaf (entries are cell numbers). */
+		bool leaf;
+
+		/** Hull of the entries. */
+		IntervalVector hull;
+
+		/** Child nodes or cell numbers. */
+		std::vector<int> entries;
+	};
+
+	/*
+	 * Insert the cell i in the subtree of a node.
+	 * Return the new sibling node if the node has been split, -1 otherwise.
+	 */
+	int insert(int node, int i);
+
+	/*
+	 * Split an overflowing node (quadratic split).
+	 * Return the new node.
+	 */
+	int split(int node);
+
+	/* Dimension */
+	const int n;
+
+	/* Nodes (-1 if no root) */
+	std::vector<Node> nodes;
+	int root;
+
+	/* Cells and their indexed boxes */
+	std::vector<ContCell*> cells;
+	std::vector<IntervalVector> boxes;
+
+	/* Number of each cell */
+	std::map<const ContCell*,int> nums;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline int ContCellIndex::size() const {
+	return (int) cells.size();
+}
+
+inline ContCell* ContCellIndex::cell(int i) const {
+	return cells[i];
+}
+
+} /* namespace ibex */
+
+#endif /* __IBEX_CONTCELL_INDEX_H__ */
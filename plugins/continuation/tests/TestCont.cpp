@@ -39,4 +39,32 @@ void TestCont::test01() {
 	delete cell;
 }
 
+void TestCont::threads() {
+	Variable x,y,z;
+	Function f(x,y,z,sqr(x)+sqr(y)+sqr(z)-1);
+
+	double __sol[][2]={{0,0},{0,0},{1,1}};
+	IntervalVector sol(3,__sol);
+
+	Cont cont1(f, 1e-3, 0.5, 1.1);
+	Cont cont2(f, 1e-3, 0.5, 1.1);
+	cont2.set_nb_threads(2);
+
+	// start() displays the progress
+	streambuf* buf=cout.rdbuf(NULL);
+	cont1.start(sol,0.1,50);
+	cont2.start(sol,0.1,50);
+	cout.rdbuf(buf);
+
+	// same cells, in the same order
+	CPPUNIT_ASSERT(cont1.l.size()==cont2.l.size());
+	CPPUNIT_ASSERT(cont1.l_empty_facets.size()==cont2.l_empty_facets.size());
+	CPPUNIT_ASSERT(cont1.cell_index.size()==cont2.cell_index.size());
+
+	for (int i=0; i<cont1.cell_index.size(); i++) {
+		CPPUNIT_ASSERT(cont1.cell_index.cell(i)->unicity_box==cont2.cell_index.cell(i)->unicity_box);
+		CPPUNIT_ASSERT(cont1.cell_index.cell(i)->nb_facets()==cont2.cell_index.cell(i)->nb_facets());
+	}
+}
+
 } // end namespace
@@ -0,0 +1,79 @@
+/* ============================================================================
+ * I B E X - Spatial index of continuation cells Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestContCellIndex.h"
+#include "ibex_ContCellIndex.h"
+#include "ibex_Random.h"
+
+using namespace std;
+
+namespace ibex {
+
+void TestContCellIndex::empty() {
+	ContCellIndex index(2);
+	vector<int> res;
+	index.intersecting(IntervalVector(2,Interval::ALL_REALS),res);
+	CPPUNIT_ASSERT(index.size()==0);
+	CPPUNIT_ASSERT(res.empty());
+	CPPUNIT_ASSERT(index.num(NULL)==-1);
+}
+
+void TestContCellIndex::random() {
+	Variable x,y;
+	Function f(x,y,x+y);
+	VarSet vars(f,x);
+	IntervalVector domain(2,Interval::ALL_REALS);
+
+	RNG::srand(1);
+
+	ContCellIndex index(2);
+	vector<ContCell*> cells;
+
+	// more cells than MAX_ENTRIES^2, so that the tree has several levels
+	for (int i=0; i<200; i++) {
+		IntervalVector box(2);
+		for (int j=0; j<2; j++) {
+			double c=RNG::rand(0,10);
+			double r=RNG::rand(0,0.5);
+			box[j]=Interval(c-r,c+r);
+		}
+		ContCell* cell=new ContCell(box,box,domain,vars);
+		cells.push_back(cell);
+		CPPUNIT_ASSERT(index.insert(cell)==i);
+	}
+
+	CPPUNIT_ASSERT(index.size()==200);
+	for (int i=0; i<200; i++) {
+		CPPUNIT_ASSERT(index.cell(i)==cells[i]);
+		CPPUNIT_ASSERT(index.num(cells[i])==i);
+	}
+
+	// compare with a linear search
+	for (int k=0; k<100; k++) {
+		IntervalVector box(2);
+		for (int j=0; j<2; j++) {
+			double c=RNG::rand(0,10);
+			double r=RNG::rand(0,2);
+			box[j]=Interval(c-r,c+r);
+		}
+		vector<int> expected;
+		for (int i=0; i<200; i++)
+			if (cells[i]->unicity_box.intersects(box)) expected.push_back(i);
+
+		vector<int> res;
+		index.intersecting(box,res);
+		CPPUNIT_ASSERT(res==expected);
+	}
+
+	for (int i=0; i<200; i++)
+		delete cells[i];
+}
+
+} // end namespace
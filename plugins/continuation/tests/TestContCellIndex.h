@@ -0,0 +1,38 @@
+/* ============================================================================
+ * I B E X - Spatial index of continuation cells Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_CONTCELL_INDEX_H__
+#define __TEST_CONTCELL_INDEX_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestContCellIndex : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestContCellIndex);
+	CPPUNIT_TEST(empty);
+	CPPUNIT_TEST(random);
+	CPPUNIT_TEST_SUITE_END();
+
+	void empty();
+	void random();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestContCellIndex);
+
+
+} // end namespace
+
+#endif // __TEST_CONTCELL_INDEX_H__
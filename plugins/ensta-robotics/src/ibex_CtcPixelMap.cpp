@@ -11,13 +11,25 @@
 
 namespace ibex {
 
-CtcPixelMap::CtcPixelMap(PixelMap &data): Ctc(data.ndim), I(data) {
-    pixel_coords = new int[2*I.ndim];
+CtcPixelMap::CtcPixelMap(PixelMap &data): Ctc(data.ndim), I(&data), P(NULL), ndim(data.ndim),
+		origin(data.origin_), leaf_size(data.leaf_size_), grid_size(data.grid_size_) {
+    pixel_coords = new int[2*ndim];
+    lb = new int[ndim];
+    ub = new int[ndim];
+}
+
+CtcPixelMap::CtcPixelMap(PixelMapPyramid &pyramid): Ctc(pyramid.ndim), I(NULL), P(&pyramid), ndim(pyramid.ndim),
+		origin(pyramid.origin_), leaf_size(pyramid.leaf_size_), grid_size(pyramid.grid_size_) {
+    pixel_coords = new int[2*ndim];
+    lb = new int[ndim];
+    ub = new int[ndim];
 }
 
 //-------------------------------------------------------------------------------------------------------------
 CtcPixelMap::~CtcPixelMap() {
     delete[] pixel_coords;
+    delete[] lb;
+    delete[] ub;
 }
 
 
@@ -25,12 +37,12 @@ CtcPixelMap::~CtcPixelMap() {
 void CtcPixelMap::world_to_grid(IntervalVector box) {
 
     for(int i = 0; i < box.size(); i++) {
-        box[i] = (box[i] - I.origin_[i]) / I.leaf_size_[i];
+        box[i] = (box[i] - origin[i]) / leaf_size[i];
         // Limit range to image size on pixel_coord
-        box[i] &= Interval(0,I.grid_size_[i]);
+        box[i] &= Interval(0,grid_size[i]);
     }
     
-    for (unsigned int i = 0; i < I.ndim; i++) {
+    for (unsigned int i = 0; i < ndim; i++) {
         pixel_coords[2*i]   = floor(box[i].lb());
         pixel_coords[2*i+1] = ceil(box[i].ub()-1);
     }
@@ -38,8 +50,8 @@ void CtcPixelMap::world_to_grid(IntervalVector box) {
 
 //-------------------------------------------------------------------------------------------------------------
 void CtcPixelMap::grid_to_world(IntervalVector& box) {
-    for(unsigned int i = 0; i < I.ndim; i++) {
-        box[i] &= Interval(pixel_coords[2*i], pixel_coords[2*i+1]+1) * I.leaf_size_[i] + I.origin_[i];
+    for(unsigned int i = 0; i < ndim; i++) {
+        box[i] &= Interval(pixel_coords[2*i], pixel_coords[2*i+1]+1) * leaf_size[i] + origin[i];
         if(box[i].is_empty()){
             box.set_empty();
             return;
@@ -50,18 +62,15 @@ void CtcPixelMap::grid_to_world(IntervalVector& box) {
 //----------------------------------------------------------------------------------------------------------------
 void CtcPixelMap::contract(IntervalVector& box) {
 
-    assert(box.size() == (int)I.ndim);
+    assert(box.size() == (int)ndim);
     if(box.is_empty()) return;
 
     // Convert world coordinates into pixel coordinates
     world_to_grid(box);
 
     // Contractor the box
-    if( I.ndim == 2) {
-        contract(pixel_coords[0],pixel_coords[1],pixel_coords[2],pixel_coords[3]);
-    } else if ( I.ndim == 3){
-        contract(pixel_coords[0],pixel_coords[1],pixel_coords[2],pixel_coords[3],pixel_coords[4],pixel_coords[5]);        
-    }
+    contract_pixels();
+
     // Check the result
     if(pixel_coords[0] == -1) {
         box.set_empty();
@@ -74,125 +83,74 @@ void CtcPixelMap::contract(IntervalVector& box) {
 
 //------------------------------------------------------------------------------
 //psi contraction
-void CtcPixelMap::contract(int& cxmin, int& cxmax, int& cymin, int& cymax) {
-
-    //compute enclosed pixels on consecutive lines from all dimensions of the box
-
-    cxmax = std::max(0,std::min(I.grid_size_[0]-1,cxmax));
-    cxmin = std::min(I.grid_size_[0]-1,std::max(0,cxmin));
-    cymax = std::max(0,std::min(I.grid_size_[1]-1,cymax));
-    cymin = std::min(I.grid_size_[1]-1,std::max(0,cymin));
-
-    if (enclosed_pixels(cxmin,cxmax,cymin,cymax) == 0){
-        cxmin = -1;
-        return;
-    }
-
-    //right
-    for (int i = cxmin; i <= cxmax; i++)
-    {
-        if(enclosed_pixels(cxmin,i,cymin,cymax)>0) {
-            cxmin = i;
-            break;
-        }
-    }
-    //left
-    for (int i = cxmax; i >= cxmin ; i--)
-    {
-        if(enclosed_pixels(i,cxmax,cymin,cymax)>0) {
-            cxmax = i;
-            break;
-        }
-    }
-    //down
-    for (int j = cymin; j <=cymax; j++)
-    {
-        if(enclosed_pixels(cxmin,cxmax,cymin,j)>0) {
-            cymin = j;
-            break;
+void CtcPixelMap::contract_pixels() {
+
+    for (unsigned int d = 0; d < ndim; d++) {
+        int& cmin = pixel_coords[2*d];
+        int& cmax = pixel_coords[2*d+1];
+        cmax = std::max(0,std::min(grid_size[d]-1,cmax));
+        cmin = std::min(grid_size[d]-1,std::max(0,cmin));
+        lb[d] = cmin;
+        ub[d] = cmax;
+    }
+
+    // each bound is contracted in turn, with the
+    // bounds contracted so far
+    for (unsigned int d = 0; d < ndim; d++) {
+        int m = extremal(d, false);
+        if (m == -1) {
+            pixel_coords[0] = -1;
+            return;
         }
+        lb[d] = m;
+        ub[d] = extremal(d, true);
     }
-    //up
-    for (int j = cymax; j >= cymin ; j--)
-    {
-        if(enclosed_pixels(cxmin,cxmax,j,cymax)>0) {
-            cymax = j;
-            break;
-        }
+
+    for (unsigned int d = 0; d < ndim; d++) {
+        pixel_coords[2*d] = lb[d];
+        pixel_coords[2*d+1] = ub[d];
     }
 }
-//////////////////////////////////////////////////////////////////////
 
-void CtcPixelMap::contract(int& cxmin, int& cxmax, int& cymin,int& cymax, int& czmin, int& czmax) {
+int CtcPixelMap::extremal(int d, bool max) {
 
-    cxmax = std::max(0,std::min(I.grid_size_[0]-1,cxmax));
-    cxmin = std::min(I.grid_size_[0]-1,std::max(0,cxmin));
-    cymax = std::max(0,std::min(I.grid_size_[1]-1,cymax));
-    cymin = std::min(I.grid_size_[1]-1,std::max(0,cymin));
-    czmax = std::max(0, std::min(I.grid_size_[2]-1,czmax));
-    czmin = std::min(I.grid_size_[2]-1, std::max(0,czmin));
-    
-    if (enclosed_pixels(cxmin,cxmax,cymin,cymax,czmin,czmax) == 0) {
-        cxmin = -1;
-        return;
-    }
+    if (P) return P->extremal(lb, ub, d, max);
 
-    //right
-    for (int i = cxmin; i <= cxmax; i++)
-    {
-        if(enclosed_pixels(cxmin,i,cymin,cymax,czmin,czmax)>0) {
-            cxmin = i;
-            break;
-        }
-    }
-    //left
-    for (int i = cxmax; i >= cxmin ; i--)
-    {
-        if(enclosed_pixels(i,cxmax,cymin,cymax,czmin,czmax)>0) {
-            cxmax = i;
-            break;
-        }
-    }
-    //down
-    for (int j = cymin; j <=cymax; j++)
-    {
-        if(enclosed_pixels(cxmin,cxmax,cymin,j,czmin,czmax)>0) {
-            cymin = j;
-            break;
-        }
-    }
-    //up
-    for (int j = cymax; j >= cymin ; j--)
-    {
-        int res = enclosed_pixels(cxmin,cxmax,j,cymax,czmin,czmax);
-        if(res>0) {
-            cymax = j;
-            break;
-        }
-    }
-    //bottom
-    for (int k = czmin; k <=czmax; k++)
-    {
-        if(enclosed_pixels(cxmin,cxmax,cymin,cymax,czmin,k)>0) {
-            czmin = k;
-            break;
-        }
-    }
-    //top
-    for (int k = czmax; k >= czmin ; k--)
-    {
-        int res = enclosed_pixels(cxmin,cxmax,cymin,cymax,k,czmax);
-        if(res>0) {
-            czmax = k;
-            break;
+    if (enclosed_pixels() == 0) return -1;
+
+    // the bound of the slab that moves
+    int& bound = max ? lb[d] : ub[d];
+    const int saved = bound;
+
+    int low = lb[d], high = ub[d];
+    while (low < high) {
+        if (max) {
+            // is there a pixel in [mid,ub[d]]?
+            bound = (low + high + 1) / 2;
+            if (enclosed_pixels() > 0) low = bound;
+            else high = bound - 1;
+        } else {
+            // is there a pixel in [lb[d],mid]?
+            bound = (low + high) / 2;
+            if (enclosed_pixels() > 0) high = bound;
+            else low = bound + 1;
         }
     }
+    bound = saved;
+    return low;
+}
+
+unsigned int CtcPixelMap::enclosed_pixels() {
+    if (ndim == 2)
+        return enclosed_pixels(lb[0], ub[0], lb[1], ub[1]);
+    else
+        return enclosed_pixels(lb[0], ub[0], lb[1], ub[1], lb[2], ub[2]);
 }
 
 unsigned int CtcPixelMap::enclosed_pixels(int xmin,int xmax,int ymin,int ymax) {
 
     // The raster picture is cast into a 2D PixelMap to access its elements
-    PixelMap2D& I_tmp = (PixelMap2D&) I;
+    PixelMap2D& I_tmp = (PixelMap2D&) *I;
     int b1 = I_tmp(xmax,ymax);
     int b2 = I_tmp(xmax,ymin-1);
     int b3 = I_tmp(xmin-1,ymax);
@@ -204,7 +162,7 @@ unsigned int CtcPixelMap::enclosed_pixels(int xmin,int xmax,int ymin,int ymax) {
 unsigned int CtcPixelMap::enclosed_pixels(int xmin, int xmax, int ymin, int ymax, int zmin, int zmax) {
 
     // The raster picture is cast into a 3D PixelMap to access its elements
-    PixelMap3D &I_tmp = (PixelMap3D&) I;
+    PixelMap3D &I_tmp = (PixelMap3D&) *I;
     unsigned int L8 = I_tmp(xmax, ymax,zmax);
     unsigned int L5 = I_tmp(xmin-1, ymin-1, zmax);
     unsigned int L6 = I_tmp(xmin-1, ymax,zmax) ;
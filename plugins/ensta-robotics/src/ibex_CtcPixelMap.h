@@ -14,6 +14,7 @@
 #include "ibex_Ctc.h"
 #include "ibex_IntervalVector.h"
 #include "ibex_PixelMap.h"
+#include "ibex_PixelMapPyramid.h"
 
 namespace ibex {
 
@@ -39,6 +40,15 @@ public:
      */
     CtcPixelMap(PixelMap& data);
 
+    /**
+     * \brief CtcPixelMap
+     *
+     * \param pyramid - multiresolution occupancy grid. Contraction only descends into
+     *                  the occupied regions of the box (better for large maps
+     *                  and large boxes).
+     */
+    CtcPixelMap(PixelMapPyramid& pyramid);
+
     /**
      * \brief Delete this.
      */
@@ -56,8 +66,23 @@ private:
 
     /**
      * \brief 2D array used for storing the integral image of the occupancy grid.
+     *
+     * NULL if the pyramid is used.
+     */
+    PixelMap* I;
+
+    /**
+     * \brief Multiresolution occupancy grid (NULL if the integral image is used).
+     */
+    PixelMapPyramid* P;
+
+    /**
+     * \brief Geometry of the grid (in I or P).
      */
-    PixelMap &I;
+    const unsigned int ndim;
+    const double* origin;
+    const double* leaf_size;
+    const int* grid_size;
 
     /**
      * \brief Array storing pixel coordinates.
@@ -68,7 +93,11 @@ private:
      */
     int *pixel_coords;
 
-    
+    /**
+     * \brief Lower and upper pixel coordinates (temporary arrays).
+     */
+    int *lb, *ub;
+
     /**
      * \brief Converts coordinates from world frame to the image frame.
      *
@@ -84,15 +113,27 @@ private:
     void grid_to_world(IntervalVector& box);
 
     /**
-     * \brief contract the box defined by [cxmin, cxmax]x[cymin, cymax] w.r.t the integral image.
+     * \brief Contract the box defined by pixel_coords.
+     *
+     * Set pixel_coords[0] to -1 if the box contains no 1-valued pixel.
      */
-    void contract(int &cxmin, int &cxmax, int &cymin, int &cymax);
+    void contract_pixels();
 
     /**
-     * \brief contract the box defined by [cxmin, cxmax]x[cymin, cymax]x[zmin, zmax] w.r.t the integral image.
+     * \brief Lowest (or greatest) coordinate along d of a 1-valued pixel in the box [lb,ub].
+     *
+     * With the integral image, the number of 1-valued pixels in [lb[d],i] (or [i,ub[d]])
+     * is monotonic in i so the coordinate is found by dichotomy.
+     *
+     * \return -1 if the box contains no 1-valued pixel.
      */
-    void contract(int &cxmin, int &cxmax, int &cymin, int &cymax, int &czmin, int &czmax);
-    
+    int extremal(int d, bool max);
+
+    /**
+     * \brief Return the number of 1-valued pixels in the box [lb,ub].
+     */
+    unsigned int enclosed_pixels();
+
     /**
      * \brief Return the number of 1-valued pixels in the box [xmin,xmax] x [ymin, ymax].
      *
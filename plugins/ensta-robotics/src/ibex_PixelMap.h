@@ -83,6 +83,7 @@ public:
 protected:
 
 	friend class TestPixelMap;
+	friend class PixelMapPyramid;
 
 	/**
 	 * \brief return the value of the element idx in the array data
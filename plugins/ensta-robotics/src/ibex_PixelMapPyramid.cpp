@@ -0,0 +1,283 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_PixelMapPyramid.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_PixelMapPyramid.h"
+#include "ibex_Exception.h"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <algorithm>
+#include <cassert>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+const char* PixelMapPyramid::FORMAT_VERSION="1.0.0";
+const char* PixelMapPyramid::FF_DATA_PYRAMID_ND="DATA_PYRAMID_ND";
+
+PixelMapPyramid::PixelMapPyramid(const PixelMap& map) : ndim(map.ndim), bits(NULL), mapped(NULL), mapped_size(0) {
+	leaf_size_ = new double[ndim];
+	origin_ = new double[ndim];
+	grid_size_ = new int[ndim];
+	for (unsigned int i=0; i<ndim; i++) {
+		leaf_size_[i] = map.leaf_size_[i];
+		origin_[i] = map.origin_[i];
+		grid_size_[i] = map.grid_size_[i];
+	}
+	init();
+
+	buffer.assign(nb_bytes,0);
+	bits = &buffer[0];
+
+	int p[3]={0,0,0};
+	int q[3];
+	unsigned int d;
+	do {
+		int idx=0;
+		for (d=0; d<ndim; d++) idx += map.divb_mul_[d]*p[d];
+
+		if (map.data[idx]!=0) {
+			// mark the pixel and its ancestors (stop at the first
+			// one already marked: the next ones are also marked)
+			for (int l=0; l<nb_levels(); l++) {
+				for (d=0; d<ndim; d++) q[d]=p[d]>>l;
+				if (l>0 && occupied(l,q)) break;
+				set(l,q);
+			}
+		}
+
+		// next pixel
+		d=0;
+		while (d<ndim && ++p[d]==grid_size_[d]) p[d++]=0;
+	} while (d<ndim);
+}
+
+PixelMapPyramid::PixelMapPyramid(const char* filename) : ndim(read_ndim(filename)), bits(NULL), mapped(NULL), mapped_size(0) {
+	leaf_size_ = new double[ndim];
+	origin_ = new double[ndim];
+	grid_size_ = new int[ndim];
+
+	ifstream in_file(filename, ios::in | ios::binary);
+
+	std::string line;
+	bool leaf_size_is_set = false, origin_is_set = false, grid_size_is_set  = false;
+	int file_tile_bits = -1;
+
+	while (getline(in_file, line)) {
+		std::stringstream sstream(line);
+		sstream.imbue (std::locale::classic());
+
+		std::string line_type;
+		sstream >> line_type;
+
+		if (line_type == "LEAF_SIZE") {
+			for (unsigned int i=0; i<ndim; i++) sstream >> leaf_size_[i];
+			leaf_size_is_set = true;
+		} else if (line_type == "ORIGIN") {
+			for (unsigned int i=0; i<ndim; i++) sstream >> origin_[i];
+			origin_is_set = true;
+		} else if (line_type == "GRID_SIZE") {
+			for (unsigned int i=0; i<ndim; i++) sstream >> grid_size_[i];
+			grid_size_is_set = true;
+		} else if (line_type == "TILE_BITS") {
+			sstream >> file_tile_bits;
+		} else if (line_type == "END_HEADER")
+			break;
+	}
+
+	if (!leaf_size_is_set || !origin_is_set || !grid_size_is_set)
+		ibex_error("PixelMapPyramid [load]: incomplete header");
+
+	init();
+
+	if (file_tile_bits != tile_bits)
+		ibex_error("PixelMapPyramid [load]: tile size does not match");
+
+	streamoff data_offset = in_file.tellg();
+	in_file.seekg(0, ios::end);
+	streamoff file_size = in_file.tellg();
+
+	if (data_offset<0 || file_size < data_offset + (streamoff) nb_bytes)
+		ibex_error("PixelMapPyramid [load]: file too short");
+
+#ifndef _WIN32
+	int fd = open(filename, O_RDONLY);
+	if (fd!=-1) {
+		void* addr = mmap(NULL, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		close(fd);
+		if (addr!=MAP_FAILED) {
+			mapped = addr;
+			mapped_size = file_size;
+			bits = (unsigned char*) mapped + data_offset;
+			return;
+		}
+	}
+#endif
+
+	// no memory mapping: read the whole file
+	buffer.resize(nb_bytes);
+	in_file.seekg(data_offset);
+	in_file.read((char*) &buffer[0], nb_bytes);
+	if (in_file.fail())
+		ibex_error("PixelMapPyramid [load]: reading error");
+	bits = &buffer[0];
+}
+
+PixelMapPyramid::~PixelMapPyramid() {
+#ifndef _WIN32
+	if (mapped) munmap(mapped, mapped_size);
+#endif
+	delete[] leaf_size_;
+	delete[] origin_;
+	delete[] grid_size_;
+}
+
+unsigned int PixelMapPyramid::read_ndim(const char* filename) {
+	ifstream in_file(filename, ios::in | ios::binary);
+	if (in_file.fail()) {
+		std::stringstream s;
+		s << "PixelMapPyramid [load]: cannot open file " << filename << " for reading data";
+		ibex_error(s.str().c_str());
+	}
+
+	std::string line;
+	while (getline(in_file, line) && line.substr(0,10)!="END_HEADER") {
+		std::stringstream sstream(line);
+		std::string line_type, tag;
+		sstream >> line_type;
+		if (line_type == "TYPE") {
+			unsigned int dim=0;
+			sstream >> tag >> dim;
+			if (tag != FF_DATA_PYRAMID_ND || (dim!=2 && dim!=3))
+				break;
+			return dim;
+		}
+	}
+	ibex_error("PixelMapPyramid [load]: file format does not match the required file format");
+	return 0;
+}
+
+void PixelMapPyramid::init() {
+	assert(ndim==2 || ndim==3);
+
+	// tiles of 2^14 (2D) or 2^15 (3D) bits
+	tile_bits = ndim==2 ? 7 : 5;
+
+	int n=1;
+	for (unsigned int d=0; d<ndim; d++) {
+		assert(grid_size_[d]>0);
+		n = std::max(n, grid_size_[d]);
+	}
+
+	// the last level has one pixel
+	int L=1;
+	while ((1<<(L-1)) < n) L++;
+
+	sizes.resize(L*ndim);
+	tiles.resize(L*ndim);
+	offset.resize(L+1);
+	offset[0]=0;
+
+	for (int l=0; l<L; l++) {
+		long long nb_tiles=1;
+		for (unsigned int d=0; d<ndim; d++) {
+			sizes[l*ndim+d] = ((grid_size_[d]-1)>>l)+1;
+			tiles[l*ndim+d] = ((sizes[l*ndim+d]-1)>>tile_bits)+1;
+			nb_tiles *= tiles[l*ndim+d];
+		}
+		offset[l+1] = offset[l] + (nb_tiles<<(tile_bits*ndim));
+	}
+
+	nb_bytes = offset[L]/8;
+}
+
+void PixelMapPyramid::save(const char* filename) const {
+	ofstream out_file(filename, ios::out | ios::trunc | ios::binary);
+
+	if (out_file.fail()) {
+		std::stringstream s;
+		s << "PixelMapPyramid [save]: cannot open file " << filename << " for dumping data";
+		ibex_error(s.str().c_str());
+	}
+
+	std::ostringstream oss;
+	oss.imbue (std::locale::classic ());
+	oss.precision(17);
+
+	oss << "VERSION " << FORMAT_VERSION;
+	oss << "\nTYPE " << FF_DATA_PYRAMID_ND << " " << ndim;
+	oss << "\nLEAF_SIZE"; for(unsigned int i=0; i<ndim; i++) oss << " " << leaf_size_[i];
+	oss << "\nORIGIN";    for(unsigned int i=0; i<ndim; i++) oss << " " << origin_[i];
+	oss << "\nGRID_SIZE"; for(unsigned int i=0; i<ndim; i++) oss << " " << grid_size_[i];
+	oss << "\nTILE_BITS " << tile_bits;
+	oss << "\nEND_HEADER\n";
+
+	out_file << oss.str();
+	out_file.write((const char*) bits, nb_bytes);
+
+	if (out_file.fail())
+		ibex_error("PixelMapPyramid [save]: writing error");
+}
+
+void PixelMapPyramid::search(int l, const int* p, const int* lb, const int* ub, int d, bool max, int& best) const {
+
+	// range of the pixel at level 0
+	for (unsigned int k=0; k<ndim; k++) {
+		int a = p[k]<<l;
+		int b = ((p[k]+1)<<l)-1;
+		if (b<lb[k] || a>ub[k]) return;
+		if ((int) k==d && best!=-1) {
+			// cannot improve the current best pixel
+			if (max && std::min(b,ub[k])<=best) return;
+			if (!max && std::max(a,lb[k])>=best) return;
+		}
+	}
+
+	if (!occupied(l,p)) return;
+
+	if (l==0) {
+		best = p[d];
+		return;
+	}
+
+	// visit the children, the most promising half (along d) first
+	int q[3];
+	for (int side=0; side<2; side++) {
+		int s = max ? 1-side : side;
+		for (int c=0; c<(1<<ndim); c++) {
+			if (((c>>d)&1)!=s) continue;
+			bool inside=true;
+			for (unsigned int k=0; k<ndim; k++) {
+				q[k] = 2*p[k] + ((c>>k)&1);
+				if (q[k]>=level_size(l-1,k)) inside=false;
+			}
+			if (inside) search(l-1, q, lb, ub, d, max, best);
+		}
+	}
+}
+
+int PixelMapPyramid::extremal(const int* lb, const int* ub, int d, bool max) const {
+	int best=-1;
+	for (unsigned int k=0; k<ndim; k++) {
+		assert(lb[k]>=0 && ub[k]<grid_size_[k]);
+		if (lb[k]>ub[k]) return best;
+	}
+	int p[3]={0,0,0};
+	search(nb_levels()-1, p, lb, ub, d, max, best);
+	return best;
+}
+
+} // namespace ibex
@@ -0,0 +1,202 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_PixelMapPyramid.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_PIXEL_MAP_PYRAMID_H__
+#define __IBEX_PIXEL_MAP_PYRAMID_H__
+
+#include "ibex_PixelMap.h"
+
+#include <vector>
+#include <cstddef>
+
+namespace ibex {
+
+/**
+ * \brief Multiresolution 2D/3D occupancy map.
+ *
+ * Level 0 is the occupancy grid of a PixelMap (one bit per pixel) and
+ * a pixel of level l+1 is occupied iff one of its 2^ndim children at
+ * level l is. The last level has a single pixel.
+ *
+ * The search of occupied pixels in a box starts from the last level and
+ * only descends into occupied pixels, so that large empty regions are
+ * discarded at once. The whole pyramid takes about 1/6 byte per pixel
+ * in 2D, against 4 bytes for the integral image.
+ *
+ * Each level is stored by tiles of 2^tile_bits pixels in each dimension
+ * (4KB at most) so that a search only touches a few memory pages. The
+ * pyramid can be saved in a file and then mapped in memory: the pages
+ * are only read when accessed.
+ *
+ * \see #CtcPixelMap(PixelMapPyramid&).
+ */
+class PixelMapPyramid {
+public:
+
+	/**
+	 * \brief Build the pyramid of an occupancy grid.
+	 *
+	 * A pixel is occupied iff its value is not zero. The map must not
+	 * be an integral image, i.e., this constructor must be called before
+	 * PixelMap::compute_integral_image(). The map is not used anymore after
+	 * the construction.
+	 */
+	PixelMapPyramid(const PixelMap& map);
+
+	/**
+	 * \brief Load a pyramid saved with #save(const char*).
+	 *
+	 * On POSIX systems, the file is mapped in memory (read-only)
+	 * and not read.
+	 */
+	PixelMapPyramid(const char* filename);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~PixelMapPyramid();
+
+	/**
+	 * \brief Save the pyramid into a file.
+	 */
+	void save(const char* filename) const;
+
+	/**
+	 * \brief Number of levels.
+	 */
+	int nb_levels() const;
+
+	/**
+	 * \brief Number of pixels of the level l in dimension d.
+	 */
+	int level_size(int l, int d) const;
+
+	/**
+	 * \brief Whether a pixel of the level l is occupied.
+	 *
+	 * \pre the pixel is inside the grid of the level.
+	 */
+	bool occupied(int l, const int* pixel) const;
+
+	/**
+	 * \brief Extremal occupied pixel in a box.
+	 *
+	 * \param lb, ub - the box [lb[0],ub[0]]x...x[lb[ndim-1],ub[ndim-1]] in
+	 *                 pixel coordinates (bounds included, inside the grid).
+	 * \param d      - a dimension.
+	 * \param max    - if false (resp. true), look for the lowest (resp. greatest)
+	 *                 coordinate along d.
+	 * \return the lowest/greatest coordinate along d of an occupied pixel in the
+	 *         box or -1 if the box contains no occupied pixel.
+	 */
+	int extremal(const int* lb, const int* ub, int d, bool max) const;
+
+	/** \brief Either 2 or 3 */
+	const unsigned int ndim;
+
+	/** \brief The size of a leaf. */
+	double *leaf_size_;
+
+	/** \brief The coordinate of the bottom left front corner */
+	double *origin_;
+
+	/** \brief The size of the grid in each dimension. */
+	int *grid_size_;
+
+private:
+
+	static const char* FORMAT_VERSION;
+	static const char* FF_DATA_PYRAMID_ND;
+
+	PixelMapPyramid(const PixelMapPyramid&); // forbidden
+
+	/*
+	 * Read the dimension in the header of a file.
+	 */
+	static unsigned int read_ndim(const char* filename);
+
+	/*
+	 * Calculate the layout of the levels (grid_size_ must be set).
+	 */
+	void init();
+
+	/*
+	 * Position of a pixel of the level l in the bit array.
+	 */
+	long long bit(int l, const int* pixel) const;
+
+	/*
+	 * Mark the pixel of the level l as occupied.
+	 */
+	void set(int l, const int* pixel);
+
+	/*
+	 * Search in the pixel p of level l (see extremal).
+	 * The current best coordinate is updated.
+	 */
+	void search(int l, const int* p, const int* lb, const int* ub, int d, bool max, int& best) const;
+
+	/* Number of bits of the tile side */
+	int tile_bits;
+
+	/* Number of pixels of each level in each dimension (nb_levels x ndim) */
+	std::vector<int> sizes;
+
+	/* Number of tiles of each level in each dimension (nb_levels x ndim) */
+	std::vector<int> tiles;
+
+	/* Position of the first bit of each level */
+	std::vector<long long> offset;
+
+	/* Number of bytes */
+	size_t nb_bytes;
+
+	/* The bits */
+	unsigned char* bits;
+
+	/* Memory (if not mapped) */
+	std::vector<unsigned char> buffer;
+
+	/* Mapped file (if any) */
+	void* mapped;
+	size_t mapped_size;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline int PixelMapPyramid::nb_levels() const {
+	return offset.size()-1;
+}
+
+inline int PixelMapPyramid::level_size(int l, int d) const {
+	return sizes[l*ndim+d];
+}
+
+inline long long PixelMapPyramid::bit(int l, const int* p) const {
+	long long tile=0, in_tile=0;
+	const int mask=(1<<tile_bits)-1;
+	for (int d=ndim-1; d>=0; d--) {
+		tile = tile*tiles[l*ndim+d] + (p[d]>>tile_bits);
+		in_tile = (in_tile<<tile_bits) + (p[d]&mask);
+	}
+	return offset[l] + (tile<<(tile_bits*ndim)) + in_tile;
+}
+
+inline bool PixelMapPyramid::occupied(int l, const int* p) const {
+	long long b=bit(l,p);
+	return (bits[b>>3]>>(b&7)) & 1;
+}
+
+inline void PixelMapPyramid::set(int l, const int* p) {
+	long long b=bit(l,p);
+	bits[b>>3] |= (unsigned char) (1<<(b&7));
+}
+
+} // namespace ibex
+
+#endif // __IBEX_PIXEL_MAP_PYRAMID_H__
@@ -0,0 +1,275 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SlicedTube.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_SlicedTube.h"
+
+#include <cmath>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * Empty slices (lb>ub) get the bounds [+oo,-oo], which are
+ * neutral for the hull.
+ */
+void normalize(double* lb, double* ub, int n) {
+	for (int i=0; i<n; i++) {
+		bool empty = lb[i]>ub[i];
+		lb[i] = empty ? POS_INFINITY : lb[i];
+		ub[i] = empty ? NEG_INFINITY : ub[i];
+	}
+}
+
+} // end anonymous namespace
+
+SlicedTube::SlicedTube(double t0, double tf, double step, const Interval& x) :
+		_t0(t0), _tf(tf), _deltaT(step), sums_ok(false), leaves(0), tree_ok(false) {
+	assert(tf>t0 && step>0);
+	int n=(int) round((tf-t0)/step);
+	if (n<1) n=1;
+	_lb.resize(n);
+	_ub.resize(n);
+	for (int i=0; i<n; i++) set_bounds(i,x);
+}
+
+SlicedTube::SlicedTube(double t0, double step, const IntervalVector& x) :
+		_t0(t0), _tf(t0+x.size()*step), _deltaT(step), _lb(x.size()), _ub(x.size()),
+		sums_ok(false), leaves(0), tree_ok(false) {
+	assert(step>0);
+	for (int i=0; i<x.size(); i++) set_bounds(i,x[i]);
+}
+
+IntervalVector SlicedTube::to_vector() const {
+	IntervalVector v(size());
+	for (int i=0; i<size(); i++) v[i]=(*this)[i];
+	return v;
+}
+
+void SlicedTube::set(int i, const Interval& x) {
+	set_bounds(i,x);
+	sums_ok=false;
+	if (tree_ok) {
+		int j=leaves+i;
+		tree_lb[j]=_lb[i];
+		tree_ub[j]=_ub[i];
+		for (j/=2; j>=1; j/=2) {
+			tree_lb[j]=std::min(tree_lb[2*j],tree_lb[2*j+1]);
+			tree_ub[j]=std::max(tree_ub[2*j],tree_ub[2*j+1]);
+		}
+	}
+}
+
+void SlicedTube::build_sums() const {
+	int n=size();
+	sum_lb.resize(n+1);
+	sum_ub.resize(n+1);
+	nb_inf_lb.resize(n+1);
+	nb_inf_ub.resize(n+1);
+	nb_empty.resize(n+1);
+
+	sum_lb[0]=sum_ub[0]=Interval::ZERO;
+	nb_inf_lb[0]=nb_inf_ub[0]=nb_empty[0]=0;
+
+	for (int k=0; k<n; k++) {
+		sum_lb[k+1]=sum_lb[k];
+		sum_ub[k+1]=sum_ub[k];
+		nb_inf_lb[k+1]=nb_inf_lb[k];
+		nb_inf_ub[k+1]=nb_inf_ub[k];
+		nb_empty[k+1]=nb_empty[k];
+
+		if (_lb[k]>_ub[k])
+			nb_empty[k+1]++;
+		else {
+			if (_lb[k]==NEG_INFINITY) nb_inf_lb[k+1]++;
+			else sum_lb[k+1]+=Interval(_lb[k]);
+
+			if (_ub[k]==POS_INFINITY) nb_inf_ub[k+1]++;
+			else sum_ub[k+1]+=Interval(_ub[k]);
+		}
+	}
+	sums_ok=true;
+}
+
+void SlicedTube::build_tree() const {
+	int n=size();
+	leaves=1;
+	while (leaves<n) leaves*=2;
+
+	tree_lb.assign(2*leaves,POS_INFINITY);
+	tree_ub.assign(2*leaves,NEG_INFINITY);
+
+	for (int i=0; i<n; i++) {
+		tree_lb[leaves+i]=_lb[i];
+		tree_ub[leaves+i]=_ub[i];
+	}
+
+	for (int j=leaves-1; j>=1; j--) {
+		tree_lb[j]=std::min(tree_lb[2*j],tree_lb[2*j+1]);
+		tree_ub[j]=std::max(tree_ub[2*j],tree_ub[2*j+1]);
+	}
+	tree_ok=true;
+}
+
+Interval SlicedTube::at(const Interval& t) const {
+	if (t.is_empty()) return Interval::EMPTY_SET;
+
+	if (!tree_ok) build_tree();
+
+	double lb=POS_INFINITY;
+	double ub=NEG_INFINITY;
+
+	// bottom-up traversal of the nodes covering [first,last]
+	int l=leaves+index(t.lb());
+	int r=leaves+index(t.ub())+1;
+	while (l<r) {
+		if (l&1) {
+			lb=std::min(lb,tree_lb[l]);
+			ub=std::max(ub,tree_ub[l]);
+			l++;
+		}
+		if (r&1) {
+			r--;
+			lb=std::min(lb,tree_lb[r]);
+			ub=std::max(ub,tree_ub[r]);
+		}
+		l/=2;
+		r/=2;
+	}
+	return lb<=ub ? Interval(lb,ub) : Interval::EMPTY_SET;
+}
+
+Interval SlicedTube::integral(int kmin, int kmax) const {
+	assert(0<=kmin && kmin<=kmax && kmax<size());
+
+	if (!sums_ok) build_sums();
+
+	if (nb_empty[kmax+1]>nb_empty[kmin]) return Interval::EMPTY_SET;
+
+	double lb = nb_inf_lb[kmax+1]>nb_inf_lb[kmin] ?
+			NEG_INFINITY : ((sum_lb[kmax+1]-sum_lb[kmin])*_deltaT).lb();
+
+	double ub = nb_inf_ub[kmax+1]>nb_inf_ub[kmin] ?
+			POS_INFINITY : ((sum_ub[kmax+1]-sum_ub[kmin])*_deltaT).ub();
+
+	return Interval(lb,ub);
+}
+
+SlicedTube SlicedTube::primitive() const {
+	SlicedTube p(*this);
+	for (int i=0; i<size(); i++)
+		p.set_bounds(i,integral(0,i));
+	p.modified();
+	return p;
+}
+
+SlicedTube& SlicedTube::ctcIn(const Interval& t, const Interval& x) {
+	if (t.is_empty()) return *this;
+
+	int first=index(t.lb());
+	int last=index(t.ub());
+
+	if (x.is_empty()) {
+		for (int i=first; i<=last; i++) set_bounds(i,x);
+	} else {
+		double xl=x.lb();
+		double xu=x.ub();
+		double* lb=&_lb[0];
+		double* ub=&_ub[0];
+		for (int i=first; i<=last; i++) {
+			lb[i]=std::max(lb[i],xl);
+			ub[i]=std::min(ub[i],xu);
+		}
+		normalize(lb+first, ub+first, last-first+1);
+	}
+	modified();
+	return *this;
+}
+
+SlicedTube& SlicedTube::operator&=(const SlicedTube& x) {
+	__assert_sliced_tube_time_domain__(*this,x);
+	int n=size();
+	double* lb=&_lb[0];
+	double* ub=&_ub[0];
+	const double* xl=x.lb();
+	const double* xu=x.ub();
+	for (int i=0; i<n; i++) {
+		lb[i]=std::max(lb[i],xl[i]);
+		ub[i]=std::min(ub[i],xu[i]);
+	}
+	normalize(lb,ub,n);
+	modified();
+	return *this;
+}
+
+SlicedTube& SlicedTube::operator|=(const SlicedTube& x) {
+	__assert_sliced_tube_time_domain__(*this,x);
+	int n=size();
+	double* lb=&_lb[0];
+	double* ub=&_ub[0];
+	const double* xl=x.lb();
+	const double* xu=x.ub();
+	for (int i=0; i<n; i++) {
+		lb[i]=std::min(lb[i],xl[i]);
+		ub[i]=std::max(ub[i],xu[i]);
+	}
+	modified();
+	return *this;
+}
+
+// Note: the arithmetic operations require directed rounding and are
+// performed slice by slice with the interval arithmetic.
+
+SlicedTube& SlicedTube::operator+=(const Interval& x) {
+	for (int i=0; i<size(); i++) set_bounds(i,(*this)[i]+x);
+	modified();
+	return *this;
+}
+
+SlicedTube& SlicedTube::operator+=(const SlicedTube& x) {
+	__assert_sliced_tube_time_domain__(*this,x);
+	for (int i=0; i<size(); i++) set_bounds(i,(*this)[i]+x[i]);
+	modified();
+	return *this;
+}
+
+SlicedTube& SlicedTube::operator-=(const SlicedTube& x) {
+	__assert_sliced_tube_time_domain__(*this,x);
+	for (int i=0; i<size(); i++) set_bounds(i,(*this)[i]-x[i]);
+	modified();
+	return *this;
+}
+
+SlicedTube& SlicedTube::operator*=(const Interval& x) {
+	for (int i=0; i<size(); i++) set_bounds(i,(*this)[i]*x);
+	modified();
+	return *this;
+}
+
+double SlicedTube::max() const {
+	const double* ub=&_ub[0];
+	double m=NEG_INFINITY;
+	for (int i=0; i<size(); i++) m=std::max(m,ub[i]);
+	return m;
+}
+
+double SlicedTube::min() const {
+	const double* lb=&_lb[0];
+	double m=POS_INFINITY;
+	for (int i=0; i<size(); i++) m=std::min(m,lb[i]);
+	return m;
+}
+
+std::ostream& operator<<(std::ostream& os, const SlicedTube& x) {
+	os << "Tube from t0="<< x.get_t0() << "s to tf="<< x.get_tF() << "s of step=" << x.get_delta_t() << "s.";
+	return os;
+}
+
+} // end namespace ibex
@@ -0,0 +1,315 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SlicedTube.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_SLICED_TUBE_H__
+#define __IBEX_SLICED_TUBE_H__
+
+#include "ibex_IntervalVector.h"
+
+#include <vector>
+#include <iostream>
+#include <cassert>
+
+namespace ibex {
+
+/**
+ * \ingroup arithmetic
+ *
+ * \brief Tube with compact slice storage.
+ *
+ * A tube represents an unknown real-valued function of the time t,
+ * over [t0,tf]. The ith slice is the enclosure of the function over
+ * [t0+i*step, t0+(i+1)*step].
+ *
+ * Contrary to Tube, the lower and upper bounds of the slices are stored
+ * in two contiguous arrays, so that the elementwise operations
+ * (intersection, hull, etc.) are simple loops the compiler can vectorize.
+ * The slices can only be modified through the methods of the class, which
+ * allows to maintain:
+ * - prefix sums of the bounds, for the integral over any range of slices in O(1);
+ * - a tree of hulls of consecutive slices, for the evaluation over a time
+ *   interval (at(const Interval&)) in O(log N).
+ *
+ * Both are rebuilt lazily (in O(N)) on the first query following a modification,
+ * except the tree that is also updated in O(log N) by #set(int, const Interval&).
+ */
+class SlicedTube {
+public:
+
+	/**
+	 * \brief Create a tube over [t0,tf] with all the slices set to x.
+	 *
+	 * \pre tf>t0 and step>0.
+	 */
+	SlicedTube(double t0, double tf, double step, const Interval& x=Interval::ALL_REALS);
+
+	/**
+	 * \brief Create a tube over [t0,t0+x.size()*step] with the slices of x.
+	 */
+	SlicedTube(double t0, double step, const IntervalVector& x);
+
+	/**
+	 * \brief Number of slices.
+	 */
+	int size() const;
+
+	/**
+	 * \brief Get initial time.
+	 */
+	double get_t0() const;
+
+	/**
+	 * \brief Get final time.
+	 */
+	double get_tF() const;
+
+	/**
+	 * \brief Get the time discretization step.
+	 */
+	double get_delta_t() const;
+
+	/**
+	 * \brief The ith slice.
+	 */
+	Interval operator[](int i) const;
+
+	/**
+	 * \brief Set the ith slice.
+	 */
+	void set(int i, const Interval& x);
+
+	/**
+	 * \brief Lower bounds of the slices (size() values).
+	 *
+	 * An empty slice has a lower bound greater than its upper bound.
+	 */
+	const double* lb() const;
+
+	/**
+	 * \brief Upper bounds of the slices (size() values).
+	 */
+	const double* ub() const;
+
+	/**
+	 * \brief The slices, as a vector.
+	 */
+	IntervalVector to_vector() const;
+
+	/**
+	 * \brief Index of the slice containing t.
+	 *
+	 * The final time belongs to the last slice.
+	 *
+	 * \pre t0<=t<=tf.
+	 */
+	int index(double t) const;
+
+	/**
+	 * \brief Return f(t).
+	 *
+	 * \pre t0<=t<=tf.
+	 */
+	Interval at(double t) const;
+
+	/**
+	 * \brief Return f([t]).
+	 *
+	 * \return the hull of the slices that intersect [t] (O(log N)).
+	 * \pre [t] is a subset of [t0,tf].
+	 */
+	Interval at(const Interval& t) const;
+
+	/**
+	 * \brief Integral of the tube from the slice kmin to the slice kmax (included).
+	 *
+	 * Calculated in O(1). The result is empty if one of these slices is empty.
+	 *
+	 * \pre 0<=kmin<=kmax<size().
+	 */
+	Interval integral(int kmin, int kmax) const;
+
+	/**
+	 * \brief Primitive of the tube.
+	 *
+	 * \return the tube whose ith slice is the integral from the slice 0 to the
+	 *         slice i.
+	 */
+	SlicedTube primitive() const;
+
+	/**
+	 * \brief Contract the tube at time t to x.
+	 */
+	SlicedTube& ctcIn(double t, const Interval& x);
+
+	/**
+	 * \brief Contract the tube on the time interval [t] to x.
+	 */
+	SlicedTube& ctcIn(const Interval& t, const Interval& x);
+
+	/**
+	 * \brief Set this tube to its intersection with x.
+	 *
+	 * \pre Time domains must match.
+	 */
+	SlicedTube& operator&=(const SlicedTube& x);
+
+	/**
+	 * \brief Set this tube to its hull with x.
+	 *
+	 * \pre Time domains must match.
+	 */
+	SlicedTube& operator|=(const SlicedTube& x);
+
+	/** \brief (*this)+=x. */
+	SlicedTube& operator+=(const Interval& x);
+	/** \brief (*this)+=x. */
+	SlicedTube& operator+=(const SlicedTube& x);
+	/** \brief (*this)-=x. */
+	SlicedTube& operator-=(const Interval& x);
+	/** \brief (*this)-=x. */
+	SlicedTube& operator-=(const SlicedTube& x);
+	/** \brief (*this)*=x. */
+	SlicedTube& operator*=(const Interval& x);
+
+	/**
+	 * \brief Return the maximal value of the tube.
+	 */
+	double max() const;
+
+	/**
+	 * \brief Return the minimal value of the tube.
+	 */
+	double min() const;
+
+protected:
+
+	/*
+	 * Set the bounds of the ith slice (no update of the
+	 * prefix sums and the tree).
+	 */
+	void set_bounds(int i, const Interval& x);
+
+	/*
+	 * Mark the prefix sums and the tree as out of date.
+	 */
+	void modified();
+
+	/*
+	 * Build the prefix sums.
+	 */
+	void build_sums() const;
+
+	/*
+	 * Build the tree of hulls.
+	 */
+	void build_tree() const;
+
+	double _t0;
+	double _tf;
+	double _deltaT;
+
+	/* Bounds of the slices */
+	std::vector<double> _lb, _ub;
+
+	/*
+	 * Prefix sums: sum_lb[k] (resp. sum_ub[k]) is an enclosure of the sum of
+	 * the finite lower (resp. upper) bounds of the slices 0..k-1. The numbers
+	 * of infinite lower bounds, infinite upper bounds and empty slices are
+	 * counted separately.
+	 */
+	mutable std::vector<Interval> sum_lb, sum_ub;
+	mutable std::vector<int> nb_inf_lb, nb_inf_ub, nb_empty;
+	mutable bool sums_ok;
+
+	/*
+	 * Tree of hulls (segment tree): the hull of node i (i>=1) is
+	 * [tree_lb[i],tree_ub[i]], the children of node i are 2i and 2i+1
+	 * and the slice i is the leaf leaves+i.
+	 */
+	mutable std::vector<double> tree_lb, tree_ub;
+	mutable int leaves;
+	mutable bool tree_ok;
+};
+
+/**
+ * \brief Display the tube x.
+ */
+std::ostream& operator<<(std::ostream& os, const SlicedTube& x);
+
+/*============================================ inline implementation ============================================ */
+
+#define __assert_sliced_tube_time_domain__(t1,t2) assert(((t1).get_t0()==(t2).get_t0()) \
+											   && ((t1).size()==(t2).size()) \
+											   && ((t1).get_delta_t()==(t2).get_delta_t()))
+
+inline int SlicedTube::size() const {
+	return (int) _lb.size();
+}
+
+inline double SlicedTube::get_t0() const {
+	return _t0;
+}
+
+inline double SlicedTube::get_tF() const {
+	return _tf;
+}
+
+inline double SlicedTube::get_delta_t() const {
+	return _deltaT;
+}
+
+inline Interval SlicedTube::operator[](int i) const {
+	return _lb[i]<=_ub[i] ? Interval(_lb[i],_ub[i]) : Interval::EMPTY_SET;
+}
+
+inline const double* SlicedTube::lb() const {
+	return &_lb[0];
+}
+
+inline const double* SlicedTube::ub() const {
+	return &_ub[0];
+}
+
+inline int SlicedTube::index(double t) const {
+	assert(t>=_t0 && t<=_tf);
+	int i=(int) ((t-_t0)/_deltaT);
+	return i<size() ? i : size()-1;
+}
+
+inline Interval SlicedTube::at(double t) const {
+	return (*this)[index(t)];
+}
+
+inline void SlicedTube::set_bounds(int i, const Interval& x) {
+	if (x.is_empty()) {
+		_lb[i]=POS_INFINITY;
+		_ub[i]=NEG_INFINITY;
+	} else {
+		_lb[i]=x.lb();
+		_ub[i]=x.ub();
+	}
+}
+
+inline void SlicedTube::modified() {
+	sums_ok=false;
+	tree_ok=false;
+}
+
+inline SlicedTube& SlicedTube::ctcIn(double t, const Interval& x) {
+	int i=index(t);
+	set(i,(*this)[i] & x);
+	return *this;
+}
+
+inline SlicedTube& SlicedTube::operator-=(const Interval& x) {
+	return (*this)+=(-x);
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_SLICED_TUBE_H__
@@ -0,0 +1,202 @@
+/* ============================================================================
+ * I B E X - PixelMapPyramid Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestPixelMapPyramid.h"
+
+#include <cstdlib>
+#include <cstdio>
+
+namespace ibex {
+
+namespace {
+
+// value of a pixel
+unsigned int& pixel(PixelMap& map, const int* p) {
+	if (map.ndim==2)
+		return ((PixelMap2D&) map)(p[0],p[1]);
+	else
+		return ((PixelMap3D&) map)(p[0],p[1],p[2]);
+}
+
+// random box in pixel coordinates
+void random_box(const PixelMap& map, int* lb, int* ub) {
+	for (unsigned int d=0; d<map.ndim; d++) {
+		int a=rand()%map.grid_size_[d];
+		int b=rand()%map.grid_size_[d];
+		lb[d]=std::min(a,b);
+		ub[d]=std::max(a,b);
+	}
+}
+
+// hull of the occupied pixels of an occupancy grid in [lb,ub]
+// (returns false if there is none)
+bool hull(PixelMap& map, const int* lb, const int* ub, int* hlb, int* hub) {
+	bool found=false;
+	int p[3];
+	for (unsigned int d=0; d<map.ndim; d++) p[d]=lb[d];
+	unsigned int d;
+	do {
+		if (pixel(map,p)) {
+			for (d=0; d<map.ndim; d++) {
+				if (!found || p[d]<hlb[d]) hlb[d]=p[d];
+				if (!found || p[d]>hub[d]) hub[d]=p[d];
+			}
+			found=true;
+		}
+		d=0;
+		while (d<map.ndim && ++p[d]>ub[d]) { p[d]=lb[d]; d++; }
+	} while (d<map.ndim);
+	return found;
+}
+
+} // end anonymous namespace
+
+void TestPixelMapPyramid::random_map(PixelMap& map, int nb_pixels) {
+	srand(1);
+	int p[3];
+	for (int i=0; i<nb_pixels; i++) {
+		for (unsigned int d=0; d<map.ndim; d++)
+			p[d]=rand()%map.grid_size_[d];
+		pixel(map,p)=1;
+	}
+}
+
+void TestPixelMapPyramid::check_extremal(PixelMap& map, const PixelMapPyramid& pyramid, int nb_boxes) {
+	int lb[3],ub[3],hlb[3],hub[3];
+	for (int i=0; i<nb_boxes; i++) {
+		random_box(map,lb,ub);
+		bool found=hull(map,lb,ub,hlb,hub);
+		for (unsigned int d=0; d<map.ndim; d++) {
+			CPPUNIT_ASSERT(pyramid.extremal(lb,ub,d,false)==(found? hlb[d] : -1));
+			CPPUNIT_ASSERT(pyramid.extremal(lb,ub,d,true)==(found? hub[d] : -1));
+		}
+	}
+}
+
+void TestPixelMapPyramid::check_ctc(PixelMap& map, int nb_boxes) {
+	PixelMapPyramid pyramid(map);
+
+	// the integral image is calculated on a copy
+	PixelMap* integral = map.ndim==2 ? (PixelMap*) new PixelMap2D((PixelMap2D&) map) : (PixelMap*) new PixelMap3D((PixelMap3D&) map);
+	integral->compute_integral_image();
+
+	CtcPixelMap ctc1(*integral);
+	CtcPixelMap ctc2(pyramid);
+
+	int lb[3],ub[3],hlb[3],hub[3];
+	for (int i=0; i<nb_boxes; i++) {
+		random_box(map,lb,ub);
+		IntervalVector box(map.ndim);
+		for (unsigned int d=0; d<map.ndim; d++)
+			// (strictly inside the pixels, so that the box does not touch the next ones)
+			box[d]=Interval(lb[d]+0.25,ub[d]+0.75)*map.leaf_size_[d]+map.origin_[d];
+
+		IntervalVector box1(box);
+		IntervalVector box2(box);
+		ctc1.contract(box1);
+		ctc2.contract(box2);
+
+		if (hull(map,lb,ub,hlb,hub)) {
+			for (unsigned int d=0; d<map.ndim; d++) {
+				Interval h=box[d] & (Interval(hlb[d],hub[d]+1)*map.leaf_size_[d]+map.origin_[d]);
+				CPPUNIT_ASSERT(box1[d]==h);
+				CPPUNIT_ASSERT(box2[d]==h);
+			}
+		} else {
+			CPPUNIT_ASSERT(box1.is_empty());
+			CPPUNIT_ASSERT(box2.is_empty());
+		}
+	}
+	delete integral;
+}
+
+void TestPixelMapPyramid::levels2D() {
+	PixelMap2D map;
+	map.set_leaf_size(1,1);
+	map.set_origin(0,0);
+	map.set_grid_size(300,5);
+	map(200,3)=1;
+
+	PixelMapPyramid pyramid(map);
+	CPPUNIT_ASSERT(pyramid.nb_levels()==10);
+	CPPUNIT_ASSERT(pyramid.level_size(0,0)==300);
+	CPPUNIT_ASSERT(pyramid.level_size(1,1)==3);
+	CPPUNIT_ASSERT(pyramid.level_size(9,0)==1);
+	CPPUNIT_ASSERT(pyramid.level_size(9,1)==1);
+
+	for (int l=0; l<pyramid.nb_levels(); l++) {
+		int p[2] = { 200>>l, 3>>l };
+		CPPUNIT_ASSERT(pyramid.occupied(l,p));
+		// the ancestor of (0,0) is the one of (200,3) from level 8
+		int q[2] = { 0, 0 };
+		CPPUNIT_ASSERT(pyramid.occupied(l,q)==(l>=8));
+	}
+}
+
+void TestPixelMapPyramid::extremal2D() {
+	PixelMap2D map;
+	map.set_leaf_size(0.1,0.1);
+	map.set_origin(-2,1);
+	map.set_grid_size(300,200);
+	random_map(map,100);
+	PixelMapPyramid pyramid(map);
+	check_extremal(map,pyramid,200);
+}
+
+void TestPixelMapPyramid::extremal3D() {
+	PixelMap3D map;
+	map.set_leaf_size(0.1,0.1,0.05);
+	map.set_origin(-2,1,0);
+	map.set_grid_size(70,40,50);
+	random_map(map,50);
+	PixelMapPyramid pyramid(map);
+	check_extremal(map,pyramid,100);
+}
+
+void TestPixelMapPyramid::save_load() {
+	PixelMap2D map;
+	map.set_leaf_size(0.1,0.3);
+	map.set_origin(-2,1);
+	map.set_grid_size(500,300);
+	random_map(map,100);
+
+	PixelMapPyramid pyramid(map);
+	pyramid.save("test.pyramid2D");
+
+	PixelMapPyramid pyramid2("test.pyramid2D");
+	CPPUNIT_ASSERT(pyramid2.ndim==2);
+	for (int d=0; d<2; d++) {
+		CPPUNIT_ASSERT(pyramid2.leaf_size_[d]==map.leaf_size_[d]);
+		CPPUNIT_ASSERT(pyramid2.origin_[d]==map.origin_[d]);
+		CPPUNIT_ASSERT(pyramid2.grid_size_[d]==map.grid_size_[d]);
+	}
+	check_extremal(map,pyramid2,100);
+	remove("test.pyramid2D");
+}
+
+void TestPixelMapPyramid::ctc2D() {
+	PixelMap2D map;
+	map.set_leaf_size(0.1,0.1);
+	map.set_origin(-2,1);
+	map.set_grid_size(300,200);
+	random_map(map,30);
+	check_ctc(map,200);
+}
+
+void TestPixelMapPyramid::ctc3D() {
+	PixelMap3D map;
+	map.set_leaf_size(0.1,0.1,0.05);
+	map.set_origin(-2,1,0);
+	map.set_grid_size(40,30,50);
+	random_map(map,20);
+	check_ctc(map,100);
+}
+
+} // end namespace ibex
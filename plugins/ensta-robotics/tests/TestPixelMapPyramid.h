@@ -0,0 +1,52 @@
+/* ============================================================================
+ * I B E X - PixelMapPyramid Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_PIXEL_MAP_PYRAMID_H__
+#define __TEST_PIXEL_MAP_PYRAMID_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "ibex_PixelMapPyramid.h"
+#include "ibex_CtcPixelMap.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestPixelMapPyramid : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestPixelMapPyramid);
+	CPPUNIT_TEST(levels2D);
+	CPPUNIT_TEST(extremal2D);
+	CPPUNIT_TEST(extremal3D);
+	CPPUNIT_TEST(save_load);
+	CPPUNIT_TEST(ctc2D);
+	CPPUNIT_TEST(ctc3D);
+	CPPUNIT_TEST_SUITE_END();
+
+	void levels2D();
+	void extremal2D();
+	void extremal3D();
+	void save_load();
+	void ctc2D();
+	void ctc3D();
+
+private:
+	void random_map(PixelMap& map, int nb_pixels);
+	void check_extremal(PixelMap& map, const PixelMapPyramid& pyramid, int nb_boxes);
+	void check_ctc(PixelMap& map, int nb_boxes);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestPixelMapPyramid);
+
+} // end namespace
+
+#endif // __TEST_PIXEL_MAP_PYRAMID_H__
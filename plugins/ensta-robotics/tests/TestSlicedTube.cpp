@@ -0,0 +1,166 @@
+/* ============================================================================
+ * I B E X - SlicedTube Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestSlicedTube.h"
+
+#include <cstdlib>
+
+using namespace std;
+
+namespace ibex {
+
+IntervalVector TestSlicedTube::random_slices(int n) {
+	IntervalVector x(n);
+	for (int i=0; i<n; i++) {
+		double a=(rand()%2000-1000)/100.0;
+		x[i]=Interval(a,a+(rand()%500)/100.0);
+	}
+	return x;
+}
+
+void TestSlicedTube::slices() {
+	SlicedTube x(0,10,0.5,Interval(-1,1));
+	CPPUNIT_ASSERT(x.size()==20);
+	CPPUNIT_ASSERT(x.get_tF()==10);
+	CPPUNIT_ASSERT(x.index(0)==0);
+	CPPUNIT_ASSERT(x.index(0.75)==1);
+	CPPUNIT_ASSERT(x.index(10)==19);
+
+	x.set(3,Interval(2,3));
+	CPPUNIT_ASSERT(x.at(1.6)==Interval(2,3));
+	CPPUNIT_ASSERT(x.lb()[3]==2 && x.ub()[3]==3);
+
+	x.set(4,Interval::EMPTY_SET);
+	CPPUNIT_ASSERT(x[4].is_empty());
+	CPPUNIT_ASSERT(x.lb()[4]>x.ub()[4]);
+	CPPUNIT_ASSERT(x.max()==3);
+	CPPUNIT_ASSERT(x.min()==-1);
+
+	IntervalVector v=x.to_vector();
+	CPPUNIT_ASSERT(v.size()==20);
+	CPPUNIT_ASSERT(v[3]==Interval(2,3));
+	CPPUNIT_ASSERT(v[4].is_empty());
+}
+
+void TestSlicedTube::integral() {
+	srand(1);
+	int n=200;
+	double dt=0.1;
+	IntervalVector v=random_slices(n);
+	SlicedTube x(0,dt,v);
+
+	for (int t=0; t<500; t++) {
+		int kmin=rand()%n;
+		int kmax=kmin+rand()%(n-kmin);
+		Interval s=Interval::ZERO;
+		for (int k=kmin; k<=kmax; k++) s+=v[k]*dt;
+		CPPUNIT_ASSERT(almost_eq(x.integral(kmin,kmax),s,1e-9));
+	}
+
+	// the sums are updated after a modification
+	x.set(10,Interval(100,101));
+	v[10]=Interval(100,101);
+	Interval s=Interval::ZERO;
+	for (int k=0; k<=20; k++) s+=v[k]*dt;
+	CPPUNIT_ASSERT(almost_eq(x.integral(0,20),s,1e-9));
+
+	SlicedTube p=x.primitive();
+	CPPUNIT_ASSERT(almost_eq(p[20],s,1e-9));
+
+	x.set(15,Interval::EMPTY_SET);
+	CPPUNIT_ASSERT(x.integral(0,20).is_empty());
+	CPPUNIT_ASSERT(!x.integral(16,20).is_empty());
+}
+
+void TestSlicedTube::integral_unbounded() {
+	SlicedTube x(0,10,1,Interval(0,1));
+	x.set(5,Interval(NEG_INFINITY,2));
+	CPPUNIT_ASSERT(x.integral(0,4)==Interval(0,5));
+	CPPUNIT_ASSERT(x.integral(0,5)==Interval(NEG_INFINITY,7));
+	CPPUNIT_ASSERT(x.integral(6,9)==Interval(0,4));
+	x.set(7,Interval(1,POS_INFINITY));
+	CPPUNIT_ASSERT(x.integral(5,7)==Interval::ALL_REALS);
+	CPPUNIT_ASSERT(x.integral(6,7)==Interval(1,POS_INFINITY));
+}
+
+void TestSlicedTube::at_interval() {
+	srand(2);
+	int n=1000;
+	IntervalVector v=random_slices(n);
+	SlicedTube x(0,0.01,v);
+
+	for (int t=0; t<500; t++) {
+		if (t==250) {
+			// modify the tube after the tree is built
+			for (int k=0; k<50; k++) {
+				int i=rand()%n;
+				v[i]=Interval(-20+rand()%40);
+				x.set(i,v[i]);
+			}
+		}
+		int first=rand()%n;
+		int last=first+rand()%(n-first);
+		Interval h=Interval::EMPTY_SET;
+		for (int k=first; k<=last; k++) h|=v[k];
+		// a time interval strictly inside the slices
+		Interval time(first*0.01+0.003,last*0.01+0.007);
+		CPPUNIT_ASSERT(x.at(time)==h);
+	}
+	CPPUNIT_ASSERT(x.at(Interval::EMPTY_SET).is_empty());
+}
+
+void TestSlicedTube::inter_union() {
+	SlicedTube x(0,4,1,Interval(0,2));
+	SlicedTube y(0,4,1,Interval(1,3));
+	y.set(1,Interval(5,6));
+	y.set(2,Interval::EMPTY_SET);
+
+	SlicedTube z(x);
+	z&=y;
+	CPPUNIT_ASSERT(z[0]==Interval(1,2));
+	CPPUNIT_ASSERT(z[1].is_empty());
+	CPPUNIT_ASSERT(z[2].is_empty());
+	CPPUNIT_ASSERT(z.at(Interval(0,2.5))==Interval(1,2));
+
+	z|=x;
+	CPPUNIT_ASSERT(z[1]==Interval(0,2));
+	CPPUNIT_ASSERT(z[2]==Interval(0,2));
+
+	x|=y;
+	CPPUNIT_ASSERT(x[0]==Interval(0,3));
+	CPPUNIT_ASSERT(x[1]==Interval(0,6));
+	CPPUNIT_ASSERT(x[2]==Interval(0,2));
+
+	x.ctcIn(Interval(1.5,2.5),Interval(1,10));
+	CPPUNIT_ASSERT(x[0]==Interval(0,3));
+	CPPUNIT_ASSERT(x[1]==Interval(1,6));
+	CPPUNIT_ASSERT(x[2]==Interval(1,2));
+	x.ctcIn(3.5,Interval(5,6));
+	CPPUNIT_ASSERT(x[3].is_empty());
+	CPPUNIT_ASSERT(x.integral(0,3).is_empty());
+}
+
+void TestSlicedTube::arith() {
+	SlicedTube x(0,3,1,Interval(0,1));
+	SlicedTube y(0,3,1,Interval(1,2));
+	y.set(1,Interval::EMPTY_SET);
+	x+=y;
+	CPPUNIT_ASSERT(x[0]==Interval(1,3));
+	CPPUNIT_ASSERT(x[1].is_empty());
+	x-=Interval(1);
+	CPPUNIT_ASSERT(x[2]==Interval(0,2));
+	x*=Interval(-1,2);
+	CPPUNIT_ASSERT(x[2]==Interval(-2,4));
+	x-=y;
+	CPPUNIT_ASSERT(x[0]==Interval(-4,3));
+	CPPUNIT_ASSERT(x.integral(2,2)==Interval(-4,3));
+}
+
+} // namespace ibex
@@ -0,0 +1,49 @@
+/* ============================================================================
+ * I B E X - SlicedTube Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_SLICED_TUBE_H__
+#define __TEST_SLICED_TUBE_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "ibex_SlicedTube.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestSlicedTube : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestSlicedTube);
+	CPPUNIT_TEST(slices);
+	CPPUNIT_TEST(integral);
+	CPPUNIT_TEST(integral_unbounded);
+	CPPUNIT_TEST(at_interval);
+	CPPUNIT_TEST(inter_union);
+	CPPUNIT_TEST(arith);
+	CPPUNIT_TEST_SUITE_END();
+
+	void slices();
+	void integral();
+	void integral_unbounded();
+	void at_interval();
+	void inter_union();
+	void arith();
+
+private:
+	IntervalVector random_slices(int n);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestSlicedTube);
+
+} // namespace ibex
+
+#endif // __TEST_SLICED_TUBE_H__
@@ -99,6 +99,12 @@ int main(int argc, char** argv){
   args::ValueFlag<int> _print_convergence(parser, "int", "Print Convergence.", {"print_convergence"});
 	args::Flag _trace(parser, "trace", "Activate trace. Updates of loup/uplo are printed while minimizing.", {"trace"});
 	args::Flag _plot(parser, "plot", "Save a file to be plotted by plot.py.", {"plot"});
+	args::Flag _adaptive_ctc(parser, "adaptive-ctc", "Adaptive scheduling of contractors: the linear relaxation "
+			"is skipped when it rarely contracts.", {"adaptive-ctc"});
+	args::ValueFlag<std::string> _summary_json(parser, "filename", "Export a summary of the run in JSON in this file: status, number of solutions, "
+			"time, number of cells, cells per second, number of evaluations and LP solves and peak memory.", {"summary-json"});
+	args::ValueFlag<std::string> _search_log(parser, "filename", "Record the search tree in this (binary) file: one record per box processed. "
+			"The file can be summarized with ibexlog.", {"search-log"});
 	args::Positional<std::string> filename(parser, "filename", "The name of the MINIBEX file.");
 
 	try
@@ -216,6 +222,9 @@ int main(int argc, char** argv){
 	cout << "eps_contract?: " << ((OptimizerMOP::_eps_contract)? "yes":"no") << endl;
 	cout << "segments?: " << ((_segments)? "yes":"no") << endl;
 	cout << "hamburger?: " << ((_hamburger)? "yes":"no") << endl;
+	cout << "adaptive ctc?: " << ((_adaptive_ctc)? "yes":"no") << endl;
+	if (_search_log)
+		cout << "search log: " << _search_log.Get() << endl;
 
 
 	SystemFactory fac;
@@ -353,7 +362,7 @@ int main(int argc, char** argv){
 	//  the actual contractor  ctc + linear relaxation
 	Ctc* ctcxn;
 	if (linearrelaxation=="compo" || linearrelaxation=="art"|| linearrelaxation=="xn")
-          ctcxn= new CtcCompo  (*ctc, *cxn);
+          ctcxn= _adaptive_ctc? (Ctc*) new CtcAdaptiveCompo (*ctc, *cxn) : (Ctc*) new CtcCompo (*ctc, *cxn);
 	else
 	  ctcxn = ctc;
 
@@ -371,8 +380,20 @@ int main(int argc, char** argv){
 		o->trace=(_trace)? _trace.Get() : false;
 		// the allowed time for search
 		o->timeout=timelimit;
+		// the search tree record
+		SearchLog* search_log=NULL;
+		if (_search_log) {
+			search_log=new SearchLog(_search_log.Get());
+			o->search_log=search_log;
+		}
 		o->optimize(ext_sys.box);
 		o->report();
+		if (_summary_json)
+			o->summary().to_json(_summary_json.Get());
+		if (search_log) {
+			delete search_log;
+			cout << " search log written in " << _search_log.Get() << endl;
+		}
 
 
 	
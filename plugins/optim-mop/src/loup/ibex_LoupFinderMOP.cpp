@@ -9,6 +9,8 @@
 #include "ibex_PdcHansenFeasibility.h"
 #include "ibex_FncActivation.h"
 
+#include <cmath>
+
 
 namespace ibex {
 
@@ -111,21 +113,29 @@ std::pair<IntervalVector, double> LoupFinderMOP::find(const IntervalVector& box,
 		IntervalVector box2(box);
 		box2.resize(n+2);
 		box2[n]=0.0; box2[n+1]=0.0; 
-		IntervalVector ig= (phase==0)?
-				(goal1.gradient(box2.mid())+ _weight2*goal2.gradient(box2.mid())) :
-				(goal2.gradient(box2.mid())+ _weight2*goal1.gradient(box2.mid()));
+
+		// the gradients only give the direction of the LP objective:
+		// no need for interval arithmetic
+		Vector mid2=box2.mid();
+		Vector g1(n+2), g2(n+2);
+		goal1.point_evaluator().gradient(mid2,g1);
+		goal2.point_evaluator().gradient(mid2,g2);
+
+		Vector g= (phase==0)? g1 + _weight2*g2 : g2 + _weight2*g1;
 
     	if(nb_sol==1)
-       		ig = goal1.gradient(box2.mid()) + goal2.gradient(box2.mid()) ;
+       		g = g1 + g2;
 
-		if (ig.is_empty()){ // unfortunately, at the midpoint the function is not differentiable
-			phase = 0;
-			throw NotFound(); // not a big deal: wait for another box...
+		for (int j=0; j<n+2; j++) {
+			if (!std::isfinite(g[j])) { // unfortunately, at the midpoint the function is not differentiable
+				phase = 0;
+				throw NotFound(); // not a big deal: wait for another box...
+			}
 		}
 
-		ig.resize(n);
-
-		Vector g=ig.mid();
+		g.resize(n);
+		g1.resize(n);
+		g2.resize(n);
 
 		// set the objective coefficient
 		// TODO: replace with lp_solver.set_obj(g) when implemented
@@ -152,11 +162,11 @@ std::pair<IntervalVector, double> LoupFinderMOP::find(const IntervalVector& box,
 
 			if(dynamic_nb_sol){
 				if(phase==0){
-					y11= (goal1.gradient(box2.mid())*loup_point).mid();
-					y21= (goal2.gradient(box2.mid())*loup_point).mid();
+					y11= g1*loup_point;
+					y21= g2*loup_point;
 				}else if(phase==1){
-					y12= (goal1.gradient(box2.mid())*loup_point).mid();
-					y22= (goal2.gradient(box2.mid())*loup_point).mid();
+					y12= g1*loup_point;
+					y22= g2*loup_point;
 
 					nb_sol=std::min((int) ceil(std::min(std::abs(y12-y11), std::abs(y22-y21))/eps), max_nb_sol);
 				}
@@ -35,4 +35,22 @@ BxpMOPData::~BxpMOPData() {
 
 }
 
+void BxpMOPData::write(std::ostream& os) const {
+	os.write((char*) &idd, sizeof(idd));
+	os.write((char*) &a, sizeof(a));
+	os.write((char*) &w_lb, sizeof(w_lb));
+	os.write((char*) &ub_distance, sizeof(ub_distance));
+}
+
+void BxpMOPData::read(std::istream& is) {
+	is.read((char*) &idd, sizeof(idd));
+	is.read((char*) &a, sizeof(a));
+	is.read((char*) &w_lb, sizeof(w_lb));
+	is.read((char*) &ub_distance, sizeof(ub_distance));
+}
+
+bool BxpMOPData::storable() const {
+	return true;
+}
+
 } // end namespace ibex
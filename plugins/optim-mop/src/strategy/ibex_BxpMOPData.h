@@ -46,6 +46,21 @@ public:
 	 */
 	void update(const BoxEvent& event, const BoxProperties& prop);
 
+	/**
+	 * \brief Write the data (for spilling cells to disk).
+	 */
+	virtual void write(std::ostream& os) const;
+
+	/**
+	 * \brief Read the data.
+	 */
+	virtual void read(std::istream& is);
+
+	/**
+	 * \brief Always true.
+	 */
+	virtual bool storable() const;
+
 	//id of the property
 	static const long id;
 
@@ -43,9 +43,9 @@ OptimizerMOP::OptimizerMOP(int n, const Function &f1,  const Function &f2,
 		Ctc& ctc, Bsc& bsc, CellBufferOptim& buffer, LoupFinderMOP& finder,
 		Mode nds_mode, Mode split_mode, double eps, double rel_eps) : n(n),
                 				ctc(ctc), bsc(bsc), buffer(buffer), goal1(f1), goal2(f2),
-								finder(finder), trace(false), timeout(-1), status(SUCCESS),
+								finder(finder), trace(false), timeout(-1), search_log(NULL), status(SUCCESS),
                 				time(0), nb_cells(0), eps(eps), nds_mode(nds_mode), split_mode(split_mode),
-												rel_eps(rel_eps) {
+												rel_eps(rel_eps), nb_evals(0), nb_lp_solves(0) {
 
 	if (trace) cout.precision(12);
 }
@@ -391,6 +391,12 @@ void OptimizerMOP::pre_optimize(const IntervalVector& init_box, Cell* root){
 	// add data required by the contractor
 	ctc.add_property(init_box, root->prop);
 
+	// number the nodes of the search tree
+	if (search_log) search_log->add_property(root->prop);
+
+	// all the properties must be storable if cells are spilled to disk
+	buffer.check_spill(root->prop);
+
 	BxpMOPData::y1_init=eval_goal(goal1, root->box, n);
 	BxpMOPData::y2_init=eval_goal(goal2, root->box, n);
 
@@ -410,6 +416,9 @@ OptimizerMOP::Status OptimizerMOP::optimize(const IntervalVector& init_box) {
 
 	status=SUCCESS;
 
+	unsigned long nb_evals_start=RunSummary::nb_evals();
+	unsigned long nb_lp_solves_start=RunSummary::nb_lp_solves();
+
 	Cell* root=new Cell(IntervalVector(n+2));
 	pre_optimize(init_box, root);
 
@@ -441,9 +450,12 @@ OptimizerMOP::Status OptimizerMOP::optimize(const IntervalVector& init_box) {
 			buffer.pop();
 			cells.erase(c);
 
+			if (search_log) search_log->begin(*c);
+
 			if(cdata->ub_distance <= eps){
 				IntervalVector box_y=NDS_seg::get_box_y(c);
 				//cout << box_y.lb() << "dist:" << cdata->ub_distance << endl;
+				if (search_log) search_log->end(*c, SearchLog::PRUNED);
 				delete c;
 
 				if(dynamic_cast<DistanceSortedCellBufferMOP*>(&buffer)) break;
@@ -454,6 +466,7 @@ OptimizerMOP::Status OptimizerMOP::optimize(const IntervalVector& init_box) {
 			contract_and_bound(*c, init_box);
 
 			if (c->box.is_empty()) {
+				if (search_log) search_log->end(*c, SearchLog::EMPTY);
 				delete c;
 				continue;
 			}
@@ -482,12 +495,17 @@ OptimizerMOP::Status OptimizerMOP::optimize(const IntervalVector& init_box) {
 					delete new_cells.second;
 				}
 
+			if (search_log) search_log->end(*c, atomic_box? SearchLog::EPS_BOX : SearchLog::PRUNED);
 			delete c;
 
 			continue;
 
 			}
 
+			if (search_log) {
+				search_log->bisected(*c, *new_cells.first, *new_cells.second);
+				search_log->end(*c, SearchLog::BISECTED);
+			}
 			delete c; // deletes the cell.
 
 			buffer.push(new_cells.first);
@@ -512,6 +530,11 @@ OptimizerMOP::Status OptimizerMOP::optimize(const IntervalVector& init_box) {
 	timer.stop();
 	time = timer.get_time();
 
+	nb_evals = RunSummary::nb_evals() - nb_evals_start;
+	nb_lp_solves = RunSummary::nb_lp_solves() - nb_lp_solves_start;
+
+	if (search_log) search_log->flush();
+
 	py_Plotter::offline_plot(ndsH.NDS2, NULL, "output2.txt");
 	return status;
 }
@@ -689,6 +712,21 @@ bool OptimizerMOP::process_node(PFunction& pf, Node_t& n_t) {
 }
 
 
+RunSummary OptimizerMOP::summary() const {
+	RunSummary s;
+	switch(status) {
+	case SUCCESS:           s.add_string("status", "SUCCESS"); break;
+	case INFEASIBLE:        s.add_string("status", "INFEASIBLE"); break;
+	case NO_FEASIBLE_FOUND: s.add_string("status", "NO_FEASIBLE_FOUND"); break;
+	case UNBOUNDED_OBJ:     s.add_string("status", "UNBOUNDED_OBJ"); break;
+	case TIME_OUT:          s.add_string("status", "TIME_OUT"); break;
+	case UNREACHED_PREC:    s.add_string("status", "UNREACHED_PREC"); break;
+	}
+	s.add_int("nb_solutions", ndsH.size());
+	s.add_search(time, nb_cells, nb_evals, nb_lp_solves);
+	return s;
+}
+
 void OptimizerMOP::report(bool verbose) {
 
 	if (!verbose) {
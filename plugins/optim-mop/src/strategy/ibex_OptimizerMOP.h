@@ -19,6 +19,8 @@
 #include "ibex_pyPlotter.h"
 #include "ibex_PFunction.h"
 #include "ibex_NDS.h"
+#include "ibex_SearchLog.h"
+#include "ibex_RunSummary.h"
 
 #include <set>
 #include <map>
@@ -160,6 +162,15 @@ public:
 	 */
 	void report(bool verbose=true);
 
+	/**
+	 * \brief Machine-readable summary of the last call to optimize(...).
+	 *
+	 * Contains the status, the number of non-dominated solutions, the time, the
+	 * number of cells and the throughput (cells per second), the number of function
+	 * evaluations and LP solves and the peak resident memory.
+	 */
+	RunSummary summary() const;
+
 
 	/**
 	 * \brief Get the status.
@@ -260,6 +271,14 @@ public:
 	 */
 	double timeout;
 
+	/**
+	 * \brief Search tree log (NULL by default).
+	 *
+	 * If not NULL, a record is appended for each cell processed
+	 * (see #ibex::SearchLog).
+	 */
+	SearchLog* search_log;
+
 	//pair <double, double> y1ref;
 	//pair <double, double> y2ref;
 
@@ -416,6 +435,9 @@ protected:
 	/** Number of cells pushed into the heap (which passed through the contractors) */
 	int nb_cells;
 
+	/** Number of function evaluations and LP solves of the current optimization. */
+	unsigned long nb_evals, nb_lp_solves;
+
 	set<Cell*> cells;
 
 };
@@ -147,15 +147,15 @@ do_benchs_iter (System &sys, DecimalFP prec, double time_limit,
 		/* Do the actual computation */
 		Optimizer::Status status = DefOpt.optimize (sys.box);
 
-		/* Report some information (computation time, etc.) */
-		std::cout << "BENCH: eps = 10^-" << prec
-		          << " ; status = " << DefOpt.get_status()
-		          << " ; time = " << DefOpt.get_time()
-		          << " ; nb_cells = " << DefOpt.get_nb_cells()
-		          << " ; uplo = " << DefOpt.get_uplo()
-		          << " ; loup = " << DefOpt.get_loup()
-		          << " ; random_seed = " << random_seed
-		          << std::endl;
+		/* Report some information (computation time, throughput, etc.)
+		 * as a JSON object, parsed by waf_benchmarks.py */
+		stringstream eps_str;
+		eps_str << "10^-" << prec;
+		RunSummary summary = DefOpt.summary();
+		summary.add_string ("eps", eps_str.str());
+		summary.add_real ("random_seed", random_seed);
+		std::cout << "BENCH: ";
+		summary.to_json (std::cout);
 
 		tot_time += DefOpt.get_time();
 		timeout |= status == Optimizer::TIME_OUT;
@@ -40,6 +40,8 @@ int main(int argc, char** argv) {
 	args::ValueFlag<double> eps_h(parser, "float", _eps_h.str(), {"eps-h"});
 	args::ValueFlag<double> timeout(parser, "float", "Timeout (time in seconds). Default value is +oo.", {'t', "timeout"});
 	args::ValueFlag<double> random_seed(parser, "float", _random_seed.str(), {"random-seed"});
+	args::ValueFlag<unsigned int> spill(parser, "int", "Maximal number of pending boxes kept in memory. The other ones are "
+			"written to a temporary file and reloaded when required. Default value is +oo (none).", {"spill"});
 	args::ValueFlag<double> eps_x(parser, "float", _eps_x.str(), {"eps-x"});
 	args::ValueFlag<double> initial_loup(parser, "float", "Intial \"loup\" (a priori known upper bound).", {"initial-loup"});
 	args::ValueFlag<string> input_file(parser, "filename", "COV input file. The file contains "
@@ -49,6 +51,22 @@ int main(int argc, char** argv) {
 	args::Flag rigor(parser, "rigor", "Activate rigor mode (certify feasibility of equalities).", {"rigor"});
 	args::Flag output_no_obj(parser, "output-no-obj", "Generate a COV with domains of variables only (not objective values).", {"output-no-obj"});
 	args::Flag trace(parser, "trace", "Activate trace. Updates of loup/uplo are printed while minimizing.", {"trace"});
+	args::Flag adaptive_ctc(parser, "adaptive-ctc", "Adaptive scheduling of contractors: an expensive contractor "
+			"(like the linear relaxation) is skipped when it rarely contracts.", {"adaptive-ctc"});
+	args::ValueFlag<int> threads(parser, "int", "Number of threads used to contract the slices of the ACID contractor "
+			"in parallel (the result does not depend on it). Default value is 1.", {"threads"});
+	args::ValueFlag<int> lp_threads(parser, "int", "Number of threads used to contract the bounds of the linear "
+			"relaxation in parallel. Default value is 1.", {"lp-threads"});
+	args::Flag dual_tightening(parser, "dual-tightening", "Tighten the bounds of the linear relaxation with the multipliers "
+			"of each LP solved (saves LP solves, but each one costs more).", {"dual-tightening"});
+	args::Flag profile(parser, "profile", "Activate profiling. The number of calls, time and average box reduction of each contractor, "
+			"of the bisector and of the loup finder are displayed in the report.", {"profile"});
+	args::ValueFlag<string> profile_json(parser, "filename", "Activate profiling and export the counters in JSON in this file.", {"profile-json"});
+	args::ValueFlag<string> search_log_file(parser, "filename", "Record the search tree in this (binary) file: one record per box handled. "
+			"The file can be summarized with ibexlog.", {"search-log"});
+	args::ValueFlag<string> summary_json(parser, "filename", "Export a summary of the run in JSON in this file: status, bounds, time, "
+			"number of cells, cells per second, number of evaluations and LP solves, peak memory, time to the first loup and "
+			"times to reach a relative gap of 1e-1,...,1e-6.", {"summary-json"});
 	args::Flag format(parser, "format", "Give a description of the COV format used by IbexOpt", {"format"});
 	args::Flag quiet(parser, "quiet", "Print no report on the standard output.",{'q',"quiet"});
 
@@ -149,6 +167,26 @@ int main(int argc, char** argv) {
 				cout << "  rigor mode:\t\tON\t(feasibility of equalities certified)" << endl;
 		}
 
+		if (adaptive_ctc) {
+			if (!quiet)
+				cout << "  adaptive contraction:\tON" << endl;
+		}
+
+		if (threads) {
+			if (!quiet)
+				cout << "  threads:\t\t" << threads.Get() << "\t(parallel ACID slices)" << endl;
+		}
+
+		if (lp_threads) {
+			if (!quiet)
+				cout << "  LP threads:\t\t" << lp_threads.Get() << "\t(parallel linear relaxation)" << endl;
+		}
+
+		if (dual_tightening) {
+			if (!quiet)
+				cout << "  dual tightening:\tON" << endl;
+		}
+
 		if (initial_loup) {
 			if (!quiet)
 				cout << "  initial loup:\t\t" << initial_loup.Get() << " (a priori upper bound of the minimum)" << endl;
@@ -200,6 +238,10 @@ int main(int argc, char** argv) {
 			inHC4=false;
 		}
 
+		// Profiling counters (if required)
+		Profiler prof;
+		Profiler* profiler=(profile || profile_json)? &prof : NULL;
+
 		// Build the default optimizer
 		DefaultOptimizer o(*sys,
 				rel_eps_f? rel_eps_f.Get() : Optimizer::default_rel_eps_f,
@@ -207,9 +249,21 @@ int main(int argc, char** argv) {
 				eps_h ?    eps_h.Get() :     NormalizedSystem::default_eps_h,
 				rigor, inHC4,
 				random_seed? random_seed.Get() : DefaultOptimizer::default_random_seed,
-				eps_x ?    eps_x.Get() :     Optimizer::default_eps_x
+				eps_x ?    eps_x.Get() :     Optimizer::default_eps_x,
+				profiler,
+				adaptive_ctc,
+				threads? threads.Get() : 1,
+				lp_threads? lp_threads.Get() : 1,
+				dual_tightening
 				);
 
+		// This option bounds the memory used by pending boxes
+		if (spill) {
+			if (!quiet)
+				cout << "  spill:\t\t" << spill.Get() << " boxes in memory" << endl;
+			o.buffer.set_spill(spill.Get());
+		}
+
 		// This option limits the search time
 		if (timeout) {
 			if (!quiet)
@@ -224,6 +278,19 @@ int main(int argc, char** argv) {
 			o.trace=trace.Get();
 		}
 
+		if (profiler && !quiet) {
+			cout << "  profiling:\t\tON" << endl;
+		}
+
+		// This option records the search tree
+		SearchLog* search_log=NULL;
+		if (search_log_file) {
+			if (!quiet)
+				cout << "  search log:\t\t" << search_log_file.Get() << endl;
+			search_log=new SearchLog(search_log_file.Get());
+			o.search_log=search_log;
+		}
+
 		if (!inHC4) {
 			cerr << "\n  \033[33mwarning: inHC4 disabled\033[0m (does not support vector/matrix operations)" << endl;
 		}
@@ -265,6 +332,24 @@ int main(int argc, char** argv) {
 
 		o.get_data().save(output_cov_file.c_str());
 
+		if (profile_json) {
+			prof.to_json(profile_json.Get());
+			if (!quiet)
+				cout << " profiling data written in " << profile_json.Get() << "\n";
+		}
+
+		if (summary_json) {
+			o.summary().to_json(summary_json.Get());
+			if (!quiet)
+				cout << " summary written in " << summary_json.Get() << "\n";
+		}
+
+		if (search_log) {
+			delete search_log;
+			if (!quiet)
+				cout << " search log written in " << search_log_file.Get() << "\n";
+		}
+
 		if (!quiet) {
 			cout << " results written in " << output_cov_file << "\n";
 			if (overwitten)
@@ -10,8 +10,25 @@
 
 #include "ibex_LoupFinderProbing.h"
 
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
 namespace ibex {
 
+namespace {
+
+// sort point indices by approximate cost
+class CostOrder {
+public:
+	CostOrder(const Vector& y) : y(y) { }
+	bool operator()(int k1, int k2) const { return y[k1]<y[k2]; }
+	const Vector& y;
+};
+
+}
+
 LoupFinderProbing::LoupFinderProbing(const System& sys, int sample_size) : sys(sys), sample_size(sample_size)/*, loup_point(sys.nb_var), loup(POS_INFINITY) */{
 
 }
@@ -22,16 +39,29 @@ std::pair<IntervalVector, double> LoupFinderProbing::find(const IntervalVector&
 	Vector loup_point(n);
 	double loup = current_loup;
 
-	Vector pt(n);
 	bool loup_changed=false;
 	bool _is_inner = sys.is_inner(box);
 
-	for(int i=0; i<sample_size; i++) {
-		pt = box.random();
-		//	cout << " box " << box << " pt " << pt << endl;
-		if (check(sys, pt, loup, _is_inner)) {
+	Matrix pts(sample_size, n);
+	for (int k=0; k<sample_size; k++)
+		pts[k] = box.random();
+
+	Vector y(sample_size);
+	approx_goal(pts, _is_inner, y);
+
+	// candidates that (approximately) improve the loup,
+	// by increasing order of their approximate cost
+	vector<int> cand;
+	for (int k=0; k<sample_size; k++)
+		if (y[k]<loup) cand.push_back(k);
+
+	sort(cand.begin(), cand.end(), CostOrder(y));
+
+	for (vector<int>::const_iterator it=cand.begin(); it!=cand.end(); ++it) {
+		if (check(sys, pts[*it], loup, _is_inner)) {
 			loup_changed = true;
-			loup_point = pt;
+			loup_point = pts[*it];
+			break;
 		}
 	}
 
@@ -43,14 +73,17 @@ std::pair<IntervalVector, double> LoupFinderProbing::find(const IntervalVector&
 			// we activate line probing only if the starting point has improved the goal.
 			// we use the full box (not inbox)
 			line_probing(loup_point, loup, box);
-		else if (!current_loup_point.is_empty())
-			// Try Hansen dichotomy between the last candidate point (pt)
-			// and the loup (note: the segment goes outside of the box, this is on purpose).
-			//
-			// Possible improvement: chose the random point with the smallest criterion
-			// instead of the last one.
+		else if (!current_loup_point.is_empty() && sample_size>0) {
+			// Try Hansen dichotomy between the random point with the smallest
+			// criterion and the loup (note: the segment goes outside of the box,
+			// this is on purpose).
+			int best=0;
+			for (int k=1; k<sample_size; k++)
+				if (y[k]<y[best]) best=k;
+
 			loup_point = current_loup_point.lb();
-			loup_changed = dichotomic_line_search(loup_point, loup, pt,true);
+			loup_changed = dichotomic_line_search(loup_point, loup, pts[best], true);
+		}
 	}
 
 	/*========================================================*/
@@ -61,6 +94,37 @@ std::pair<IntervalVector, double> LoupFinderProbing::find(const IntervalVector&
 		throw NotFound();
 }
 
+void LoupFinderProbing::approx_goal(const Matrix& pts, bool is_inner, Vector& y) {
+	int K=pts.nb_rows();
+
+	Matrix res(K,1);
+	sys.goal->point_evaluator().eval(pts, res);
+	for (int k=0; k<K; k++)
+		y[k] = std::isnan(res[k][0])? POS_INFINITY : res[k][0];
+
+	if (is_inner || sys.nb_ctr==0) return;
+
+	Matrix g(K, sys.f_ctrs.image_dim());
+	sys.f_ctrs.point_evaluator().eval(pts, g);
+
+	for (int k=0; k<K; k++) {
+		for (int i=0; i<sys.f_ctrs.image_dim(); i++) {
+			bool sat;
+			switch (sys.ops[i]) {
+			case LT:
+			case LEQ: sat = g[k][i]<=0; break;
+			case GT:
+			case GEQ: sat = g[k][i]>=0; break;
+			default:  sat = true; // left to certification
+			}
+			if (!sat) {
+				y[k]=POS_INFINITY;
+				break;
+			}
+		}
+	}
+}
+
 bool LoupFinderProbing::line_probing(Vector& loup_point, double& loup, const IntervalVector& box) {
 
 	int n=sys.nb_var;
@@ -69,8 +133,13 @@ bool LoupFinderProbing::line_probing(Vector& loup_point, double& loup, const Int
 
 	// ------------------------------------------------------------------------
 	// Calculates the gradient of f at the startpoint of the box (once for all)
+	// (only the direction matters: no need for interval arithmetic)
 	// ------------------------------------------------------------------------
-	Vector g = sys.goal->gradient(loup_point).lb();
+	Vector g(n);
+	sys.goal->point_evaluator().gradient(loup_point,g);
+
+	for (int j=0; j<n; j++)
+		if (std::isnan(g[j])) return false; // not differentiable
 
 	// --------------------------------------------------
 	// Build the (signed) distance Vector. This Vector gives
@@ -156,37 +225,48 @@ bool LoupFinderProbing::line_probing(Vector& loup_point, double& loup, const Int
 bool LoupFinderProbing::dichotomic_line_search(Vector& loup_point, double& loup, const Vector& end_point, bool exit_if_above_loup) {
 	Vector seg=end_point-loup_point;
 
-	double eps=1.0/64.0;
-	double alpha0=0;
-	double alpha1=1.0;
-	double alpha2=alpha1;
+	// the dichotomy only visits the points loup_point + (j/N)*seg
+	const int N=64;
+
+	Matrix pts(N+1, loup_point.size());
+	for (int j=0; j<=N; j++)
+		pts[j] = loup_point+(((double) j)/N)*seg;
+
+	Vector y(N+1);
+	approx_goal(pts, false, y);
+
+	int j0=0;
+	int j1=N;
+	int j2=j1;
 
 	double fy0=loup;
 
-	while (alpha2-alpha0>eps) {
+	vector<int> improved; // successive approximate improvements
 
-		Vector y1=loup_point+alpha1*seg;
+	while (j2-j0>1) {
 
-		if (check(sys,y1,fy0,false)) { // a better loup is found!
-			// note: fy0 is updated
-			alpha0=alpha1;
+		if (y[j1]<fy0) { // a better loup is found!
+			fy0=y[j1];
+			j0=j1;
+			improved.push_back(j1);
 		} else {
-			if (exit_if_above_loup && sys.goal_ub(y1)>=fy0)
+			if (exit_if_above_loup)
 				break;
 			else
-				alpha2=alpha1;
+				j2=j1;
 		}
 
-		alpha1=0.5*(alpha0+alpha2);
+		j1=(j0+j2)/2;
 	}
 
-	if (alpha0>0) {
-		loup_point += alpha0*seg;
-		loup = fy0;
-		return true;
-	} else {
-		return false;
+	// certify the last improvement (or the previous ones, in turn)
+	for (vector<int>::reverse_iterator it=improved.rbegin(); it!=improved.rend(); ++it) {
+		if (check(sys, pts[*it], loup, false)) {
+			loup_point = pts[*it];
+			return true;
+		}
 	}
+	return false;
 }
 
 } /* namespace ibex */
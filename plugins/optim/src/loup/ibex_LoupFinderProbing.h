@@ -26,6 +26,12 @@ namespace ibex {
  * 2- intensification (in the current version of the code, only in case
  *    of unconstrained optimization): perform a line probing search.
  *
+ * The candidate points are evaluated all at once with the floating-point
+ * evaluator of the goal and the constraints (see #PointEval). Only the
+ * most promising candidates are then certified with interval arithmetic,
+ * in increasing order of their (approximate) cost, until one succeeds.
+ * This makes large sample sizes affordable.
+ *
  * \note Only works with inequality constraints.
  *
  */
@@ -64,11 +70,21 @@ public:
 	 *
 	 * If \a exit_if_above_loup is true, the search stops as soon as we fall on
 	 * a candidate x with f(x)>loup.
+	 *
+	 * All the points the dichotomy may visit (the segment is split into 64
+	 * parts) are evaluated in one batch with floating-point arithmetic; only
+	 * the final point is certified with interval arithmetic (or the previous
+	 * ones, in turn, if certification fails).
 	 */
 	bool dichotomic_line_search(Vector& loup_point, double& loup, const Vector& end_point, bool exit_if_above_loup);
 
 	/**
-	 * Default sample size
+	 * Default sample size.
+	 *
+	 * Kept to 1 so that the default strategies (which build this loup finder
+	 * with the default size, see LoupFinderFwdBwd and LoupFinderInHC4) draw the
+	 * same random points as before batched evaluation: a larger sample changes
+	 * the search path. Larger samples are opt-in (constructor argument).
 	 */
 	static constexpr int default_sample_size = 1;
 
@@ -83,16 +99,18 @@ public:
 	const int sample_size;
 
 protected:
-//
-//	/**
-//	 * Current loup-point
-//	 */
-//	Vector loup_point;
-//
-//	/**
-//	 * Current loup
-//	 */
-//	double loup;
+
+	/**
+	 * \brief Approximate cost of a set of points.
+	 *
+	 * Set y[k] to the floating-point value of the goal at the kth
+	 * row of \a pts, or to +oo if the point (approximately) violates
+	 * a constraint or is outside the definition domain.
+	 *
+	 * \param is_inner - true if all the points are known to satisfy
+	 *                   the constraints.
+	 */
+	void approx_goal(const Matrix& pts, bool is_inner, Vector& y);
 };
 
 } /* namespace ibex */
@@ -0,0 +1,42 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_LoupFinderProfiler.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_LoupFinderProfiler.h"
+
+using namespace std;
+
+namespace ibex {
+
+LoupFinderProfiler::LoupFinderProfiler(LoupFinder& finder, Profiler& profiler, const string& name) : finder(finder),
+		entry(profiler.add(name.empty() ? Profiler::class_name(typeid(finder)) : name)) {
+
+}
+
+pair<IntervalVector, double> LoupFinderProfiler::find(const IntervalVector& box, const IntervalVector& loup_point, double loup) {
+	Profiler::Measure m(entry);
+	pair<IntervalVector, double> p=finder.find(box,loup_point,loup); // may throw NotFound
+	entry.nb_success++;
+	return p;
+}
+
+pair<IntervalVector, double> LoupFinderProfiler::find(const IntervalVector& box, const IntervalVector& loup_point, double loup, BoxProperties& prop) {
+	Profiler::Measure m(entry);
+	pair<IntervalVector, double> p=finder.find(box,loup_point,loup,prop); // may throw NotFound
+	entry.nb_success++;
+	return p;
+}
+
+bool LoupFinderProfiler::rigorous() const {
+	return finder.rigorous();
+}
+
+void LoupFinderProfiler::add_property(const IntervalVector& init_box, BoxProperties& prop) {
+	finder.add_property(init_box,prop);
+}
+
+} // end namespace ibex
@@ -0,0 +1,71 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_LoupFinderProfiler.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_LOUP_FINDER_PROFILER_H__
+#define __IBEX_LOUP_FINDER_PROFILER_H__
+
+#include "ibex_LoupFinder.h"
+#include "ibex_Profiler.h"
+
+namespace ibex {
+
+/**
+ * \ingroup optim
+ *
+ * \brief Profiling wrapper of a loup finder.
+ *
+ * Forwards all the calls to a loup finder and records in a profiler
+ * entry the number of calls, the time spent and the number of
+ * calls where a new loup has been found.
+ */
+class LoupFinderProfiler : public LoupFinder {
+public:
+
+	/**
+	 * \brief Wrap a loup finder.
+	 *
+	 * \param finder   - the profiled loup finder
+	 * \param profiler - where a new entry is created for finder
+	 * \param name     - name of the entry. By default: the name of the class of finder.
+	 */
+	LoupFinderProfiler(LoupFinder& finder, Profiler& profiler, const std::string& name="");
+
+	/**
+	 * \brief Find a new loup with the profiled loup finder.
+	 */
+	virtual std::pair<IntervalVector, double> find(const IntervalVector& box, const IntervalVector& loup_point, double loup);
+
+	/**
+	 * \brief Find a new loup with the profiled loup finder.
+	 */
+	virtual std::pair<IntervalVector, double> find(const IntervalVector& box, const IntervalVector& loup_point, double loup, BoxProperties& prop);
+
+	/**
+	 * \brief True if the profiled loup finder is rigorous.
+	 */
+	virtual bool rigorous() const;
+
+	/**
+	 * \brief Add the properties required by the profiled loup finder.
+	 */
+	virtual void add_property(const IntervalVector& init_box, BoxProperties& prop);
+
+	/**
+	 * \brief The profiled loup finder.
+	 */
+	LoupFinder& finder;
+
+	/**
+	 * \brief The counters.
+	 */
+	Profiler::Entry& entry;
+};
+
+} // end namespace ibex
+
+#endif // __IBEX_LOUP_FINDER_PROFILER_H__
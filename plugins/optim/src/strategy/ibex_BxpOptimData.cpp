@@ -39,6 +39,30 @@ long BxpOptimData::get_id(const ExtendedSystem& sys) {
 	}
 }
 
+void BxpOptimData::write(std::ostream& os) const {
+	char empty=pf.is_empty();
+	double lb=empty? 0 : pf.lb();
+	double ub=empty? 0 : pf.ub();
+	os.write(&empty, sizeof(empty));
+	os.write((char*) &lb, sizeof(lb));
+	os.write((char*) &ub, sizeof(ub));
+	os.write((char*) &pu, sizeof(pu));
+}
+
+void BxpOptimData::read(std::istream& is) {
+	char empty;
+	double lb,ub;
+	is.read(&empty, sizeof(empty));
+	is.read((char*) &lb, sizeof(lb));
+	is.read((char*) &ub, sizeof(ub));
+	is.read((char*) &pu, sizeof(pu));
+	pf = empty? Interval::EMPTY_SET : Interval(lb,ub);
+}
+
+bool BxpOptimData::storable() const {
+	return true;
+}
+
 void BxpOptimData::compute_pf(const Function& goal, const IntervalVector& box) {
 	pf=goal.eval(box);
 }
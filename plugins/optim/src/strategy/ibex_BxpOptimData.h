@@ -46,6 +46,21 @@ public:
 	 */
 	void update(const BoxEvent& event, const BoxProperties& prop);
 
+	/**
+	 * \brief Write "pf" and "pu" in a binary stream.
+	 */
+	virtual void write(std::ostream& os) const;
+
+	/**
+	 * \brief Read "pf" and "pu" from a binary stream.
+	 */
+	virtual void read(std::istream& is);
+
+	/**
+	 * \brief True.
+	 */
+	virtual bool storable() const;
+
 	/**
 	 * \brief Initialize the value of "pf"
 	 *
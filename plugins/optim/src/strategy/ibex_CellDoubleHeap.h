@@ -31,6 +31,13 @@ namespace ibex {
  *
  * \see "A new multi-selection technique in interval methods
  *       for global optimization", L.G. Casado, Computing, 2000
+ *
+ * When spilling is enabled (see #CellBuffer::set_spill(...)), the cells
+ * with the highest cost (first heap) are written to disk. A batch is
+ * reloaded as soon as it contains a cell better than all the cells in
+ * memory, so that #minimum() is still the minimum of all cells.
+ * The cells on disk removed by #contract(double) are no longer counted
+ * by #size() and are discarded when they are reloaded.
  */
 class CellDoubleHeap : public DoubleHeap<Cell>, public CellBufferOptim {
 
@@ -69,7 +76,11 @@ public:
 	 */
 	void flush();
 
-	/** \brief Return the size of the buffer. */
+	/**
+	 * \brief Return the size of the buffer.
+	 *
+	 * Includes the cells on disk (see #nb_spilled()).
+	 */
 	unsigned int size() const;
 
 	/** \brief Return true if the buffer is empty. */
@@ -118,6 +129,18 @@ protected:
 	 * The system
 	 */
 	const ExtendedSystem& sys;
+
+	/**
+	 * The last upper bound given to #contract(double)
+	 */
+	double loup;
+
+private:
+	/*
+	 * Reload cells from disk that are better
+	 * than the ones in memory.
+	 */
+	void reload();
 };
 
 /*================================== inline implementations ========================================*/
@@ -125,7 +148,7 @@ protected:
 inline CellDoubleHeap::CellDoubleHeap(const ExtendedSystem& sys, int crit2_pr, CellCostFunc::criterion crit2) :
 		DoubleHeap<Cell>(*new CellCostVarLB(sys, sys.goal_var()), false,
 				*CellCostFunc::get_cost(sys, crit2, sys.goal_var()), true /* TODO: give right value */, crit2_pr),
-		sys(sys) {
+		sys(sys), loup(POS_INFINITY) {
 }
 
 inline CellDoubleHeap::~CellDoubleHeap() {
@@ -145,6 +168,22 @@ inline void CellDoubleHeap::contract(double new_loup) {
 
 	cost2().set_loup(new_loup);
 	DoubleHeap<Cell>::contract(new_loup);
+
+	loup = new_loup;
+	if (spill) {
+		spill->contract(new_loup);
+		reload();
+	}
+}
+
+inline void CellDoubleHeap::reload() {
+	while (!spill->empty() && (DoubleHeap<Cell>::empty() || spill->min_key() < DoubleHeap<Cell>::minimum())) {
+		std::vector<Cell*> cells;
+		// note: the cells removed by spill->contract(loup) are not returned
+		spill->read(cells);
+		for (std::vector<Cell*>::iterator it=cells.begin(); it!=cells.end(); it++)
+			push(*it);
+	}
 }
 
 inline CellCostFunc& CellDoubleHeap::cost1()      { return (CellCostFunc&) heap1->costf; }
@@ -156,9 +195,12 @@ inline void CellDoubleHeap::add_property(const IntervalVector& init_box, BoxProp
        cost2().add_property(map);
 }
 
-inline void CellDoubleHeap::flush()               { DoubleHeap<Cell>::flush(); }
+inline void CellDoubleHeap::flush() {
+	DoubleHeap<Cell>::flush();
+	if (spill) spill->flush();
+}
 
-inline unsigned int CellDoubleHeap::size() const  { return DoubleHeap<Cell>::size(); }
+inline unsigned int CellDoubleHeap::size() const  { return DoubleHeap<Cell>::size() + (spill? spill->size() : 0); }
 
 inline bool CellDoubleHeap::empty() const         { return DoubleHeap<Cell>::empty(); }
 
@@ -169,10 +211,24 @@ inline void CellDoubleHeap::push(Cell* cell) {
        // the cell is put into the 2 heaps
        DoubleHeap<Cell>::push(cell);
 
+	if (spill && DoubleHeap<Cell>::size()>mem_capacity) {
+		// the worst half (first heap) is written to disk, by rank,
+		// so that cells with the same cost are also spilled
+		std::vector<Cell*> cells;
+		DoubleHeap<Cell>::contract_rank1(DoubleHeap<Cell>::size()/2, cells);
+		std::vector<double> keys;
+		for (std::vector<Cell*>::iterator it=cells.begin(); it!=cells.end(); it++)
+			keys.push_back(cost1().cost(**it));
+		spill->write(cells, keys);
+	}
+}
 
+inline Cell* CellDoubleHeap::pop() {
+	Cell* c=DoubleHeap<Cell>::pop();
+	if (spill) reload();
+	return c;
 }
 
-inline Cell* CellDoubleHeap::pop()                { return DoubleHeap<Cell>::pop(); }
 inline Cell* CellDoubleHeap::top() const          { return DoubleHeap<Cell>::top(); }
 
 inline double CellDoubleHeap::minimum() const     { return DoubleHeap<Cell>::minimum(); }
@@ -13,6 +13,7 @@
 #include "ibex_CtcHC4.h"
 #include "ibex_CtcAcid.h"
 #include "ibex_CtcCompo.h"
+#include "ibex_CtcAdaptiveCompo.h"
 #include "ibex_CtcFixPoint.h"
 #include "ibex_CtcLinearRelax.h"
 #include "ibex_CellDoubleHeap.h"
@@ -25,6 +26,9 @@
 #include "ibex_Random.h"
 #include "ibex_CellBeamSearch.h"
 #include "ibex_CellHeap.h"
+#include "ibex_CtcProfiler.h"
+#include "ibex_BscProfiler.h"
+#include "ibex_LoupFinderProfiler.h"
 
 using namespace std;
 
@@ -56,13 +60,14 @@ ExtendedSystem& DefaultOptimizer::get_ext_sys(const System& sys, double eps_h) {
 	}
 }
 
-DefaultOptimizer::DefaultOptimizer(const System& sys, double rel_eps_f, double abs_eps_f, double eps_h, bool rigor, bool inHC4, double random_seed, double eps_x) :
+DefaultOptimizer::DefaultOptimizer(const System& sys, double rel_eps_f, double abs_eps_f, double eps_h, bool rigor, bool inHC4, double random_seed, double eps_x,
+		Profiler* profiler, bool adaptive, int nb_threads, int lp_threads, bool dual_tightening) :
 		Optimizer(sys.nb_var,
-			  ctc(get_ext_sys(sys,eps_h)), // warning: we don't know which argument is evaluated first
+			  ctc(get_ext_sys(sys,eps_h), profiler, adaptive, nb_threads, lp_threads, dual_tightening), // warning: we don't know which argument is evaluated first
 //			  rec(new SmearSumRelative(get_ext_sys(sys,eps_h),eps_x)),
-			  rec(new LSmear(get_ext_sys(sys,eps_h),eps_x)),
-			  rec(rigor? (LoupFinder*) new LoupFinderCertify(sys,rec(new LoupFinderDefault(get_norm_sys(sys,eps_h), inHC4))) :
-						 (LoupFinder*) new LoupFinderDefault(get_norm_sys(sys,eps_h), inHC4)),
+			  profiled(rec(new LSmear(get_ext_sys(sys,eps_h),eps_x)), profiler),
+			  profiled(rec(rigor? (LoupFinder*) new LoupFinderCertify(sys,rec(new LoupFinderDefault(get_norm_sys(sys,eps_h), inHC4))) :
+						 (LoupFinder*) new LoupFinderDefault(get_norm_sys(sys,eps_h), inHC4)), profiler),
 			  (CellBufferOptim&) rec(new CellDoubleHeap(get_ext_sys(sys,eps_h))),
 //			  (CellBufferOptim&) rec (new  CellBeamSearch (
 //								       (CellHeap&) rec (new CellHeap (get_ext_sys(sys,eps_h))),
@@ -76,27 +81,59 @@ DefaultOptimizer::DefaultOptimizer(const System& sys, double rel_eps_f, double a
 
 	RNG::srand(random_seed);
 
+	this->profiler=profiler;
 }
 
-Ctc&  DefaultOptimizer::ctc(const ExtendedSystem& ext_sys) {
+Ctc&  DefaultOptimizer::ctc(const ExtendedSystem& ext_sys, Profiler* profiler, bool adaptive, int nb_threads, int lp_threads, bool dual_tightening) {
 	Array<Ctc> ctc_list(3);
 
 	// first contractor on ext_sys : incremental HC4 (propag ratio=0.01)
-	ctc_list.set_ref(0, rec(new CtcHC4 (ext_sys,0.01,true)));
+	ctc_list.set_ref(0, profiled(rec(new CtcHC4 (ext_sys,0.01,true)), profiler, "hc4"));
 	// second contractor on ext_sys : "Acid" with incremental HC4 (propag ratio=0.1)
-	ctc_list.set_ref(1, rec(new CtcAcid (ext_sys,rec(new CtcHC4 (ext_sys,0.1,true)),true)));
+	CtcAcid& acid=rec(new CtcAcid (ext_sys,profiled(rec(new CtcHC4 (ext_sys,0.1,true)), profiler, "acid/hc4"),true));
+	if (nb_threads>1) {
+		// each thread has its own HC4, built on its own copy of the system
+		Array<Ctc> thread_hc4(nb_threads);
+		for (int i=0; i<nb_threads; i++)
+			thread_hc4.set_ref(i, rec(new CtcHC4 (rec(new System(ext_sys)),0.1,true)));
+		acid.set_thread_ctcs(thread_hc4);
+	}
+	ctc_list.set_ref(1, profiled(acid, profiler, "acid"));
 	// the last contractor is "XNewton"
+	CtcLinearRelax& linear_relax=rec(new CtcLinearRelax(ext_sys));
+	if (lp_threads>1)
+		linear_relax.set_nb_threads(lp_threads);
+	if (dual_tightening)
+		linear_relax.set_dual_tightening(true);
 
 	if (ext_sys.nb_ctr > 1) {
-		ctc_list.set_ref(2,rec(new CtcFixPoint
+		ctc_list.set_ref(2,profiled(rec(new CtcFixPoint
 				(rec(new CtcCompo(
-						rec(new CtcLinearRelax(ext_sys)),
-						rec(new CtcHC4(ext_sys,0.01)))), default_relax_ratio)));
+						profiled(linear_relax, profiler, "fixpoint/linear relax"),
+						profiled(rec(new CtcHC4(ext_sys,0.01)), profiler, "fixpoint/hc4"))), default_relax_ratio)), profiler, "fixpoint"));
 	} else {
-		ctc_list.set_ref(2,rec(new CtcLinearRelax(ext_sys)));
+		ctc_list.set_ref(2,profiled(linear_relax, profiler, "linear relax"));
 	}
 
-	return rec(new CtcCompo(ctc_list));
+	if (adaptive)
+		return profiled(rec(new CtcAdaptiveCompo(ctc_list)), profiler, "contractor");
+	else
+		return profiled(rec(new CtcCompo(ctc_list)), profiler, "contractor");
+}
+
+Ctc& DefaultOptimizer::profiled(Ctc& ctc, Profiler* profiler, const char* name) {
+	if (profiler) return rec(new CtcProfiler(ctc, *profiler, name));
+	else return ctc;
+}
+
+Bsc& DefaultOptimizer::profiled(Bsc& bsc, Profiler* profiler) {
+	if (profiler) return rec(new BscProfiler(bsc, *profiler));
+	else return bsc;
+}
+
+LoupFinder& DefaultOptimizer::profiled(LoupFinder& finder, Profiler* profiler) {
+	if (profiler) return rec(new LoupFinderProfiler(finder, *profiler));
+	else return finder;
 }
 
 } // end namespace ibex
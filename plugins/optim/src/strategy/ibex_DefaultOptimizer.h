@@ -41,6 +41,21 @@ public:
 	 *                      reproducibility). Set by default to #default_random_seed.
 	 * \param eps_x       - Stopping criterion for box splitting (absolute precision).
 	 *                      (**deprecated**).
+	 * \param profiler    - If not NULL, the contractors, the bisector and the loup
+	 *                      finder are profiled with this profiler (see #Optimizer::profiler).
+	 * \param adaptive    - If true, the contractors are scheduled adaptively (an expensive
+	 *                      contractor that rarely contracts is skipped, see #ibex::CtcAdaptiveCompo).
+	 *                      By default: false.
+	 * \param nb_threads  - Number of threads used by the ACID contractor to contract
+	 *                      the slices of a variable in parallel (see
+	 *                      #ibex::Ctc3BCid::set_thread_ctcs). The result is the same
+	 *                      as in sequential mode. By default: 1.
+	 * \param lp_threads  - Number of threads used by the linear relaxation to contract
+	 *                      the bounds of the box in parallel (see
+	 *                      #ibex::CtcPolytopeHull::set_nb_threads). By default: 1.
+	 * \param dual_tightening - If true, the linear relaxation tightens all the bounds it can
+	 *                      from the multipliers of each LP solved, which saves LP solves
+	 *                      (see #ibex::CtcPolytopeHull::set_dual_tightening). By default: false.
 	 */
     DefaultOptimizer(const System& sys,
     		double rel_eps_f=Optimizer::default_rel_eps_f,
@@ -48,7 +63,9 @@ public:
 			double eps_h=NormalizedSystem::default_eps_h,
 			bool rigor=false, bool inHC4=true,
 			double random_seed=default_random_seed,
-    		double eps_x=Optimizer::default_eps_x);
+    		double eps_x=Optimizer::default_eps_x,
+			Profiler* profiler=NULL, bool adaptive=false, int nb_threads=1, int lp_threads=1,
+			bool dual_tightening=false);
 
 	/** Default random seed: 1.0. */
 	static constexpr double default_random_seed = 1.0;
@@ -58,7 +75,14 @@ private:
     /**
      * The contractor: HC4 + acid(HC4) + X-Newton
      */
-	Ctc& ctc(const ExtendedSystem& ext_sys);
+	Ctc& ctc(const ExtendedSystem& ext_sys, Profiler* profiler, bool adaptive, int nb_threads, int lp_threads, bool dual_tightening);
+
+	/**
+	 * Wrap an operator with its profiling wrapper (if profiler is not NULL).
+	 */
+	Ctc& profiled(Ctc& ctc, Profiler* profiler, const char* name);
+	Bsc& profiled(Bsc& bsc, Profiler* profiler);
+	LoupFinder& profiled(LoupFinder& finder, Profiler* profiler);
 
 	NormalizedSystem& get_norm_sys(const System& sys, double eps_h);
 
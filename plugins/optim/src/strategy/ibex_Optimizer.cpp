@@ -17,11 +17,27 @@
 #include <float.h>
 #include <stdlib.h>
 #include <iomanip>
+#include <sstream>
 
 using namespace std;
 
 namespace ibex {
 
+namespace {
+
+const char* status_name(Optimizer::Status status) {
+	switch (status) {
+	case Optimizer::SUCCESS:           return "SUCCESS";
+	case Optimizer::INFEASIBLE:        return "INFEASIBLE";
+	case Optimizer::NO_FEASIBLE_FOUND: return "NO_FEASIBLE_FOUND";
+	case Optimizer::UNBOUNDED_OBJ:     return "UNBOUNDED_OBJ";
+	case Optimizer::TIME_OUT:          return "TIME_OUT";
+	default:                           return "UNREACHED_PREC";
+	}
+}
+
+} // end anonymous namespace
+
 /*
  * TODO: redundant with ExtendedSystem.
  */
@@ -47,12 +63,16 @@ Optimizer::Optimizer(int n, Ctc& ctc, Bsc& bsc, LoupFinder& finder,
                 						n(n), goal_var(goal_var),
 										ctc(ctc), bsc(bsc), loup_finder(finder), buffer(buffer),
 										eps_x(eps_x), rel_eps_f(rel_eps_f), abs_eps_f(abs_eps_f),
-										trace(0), timeout(-1), extended_COV(true), anticipated_upper_bounding(true),
+										trace(0), timeout(-1), extended_COV(true), anticipated_upper_bounding(true), profiler(NULL), search_log(NULL),
 										status(SUCCESS),
 										//kkt(normalized_user_sys),
 										uplo(NEG_INFINITY), uplo_of_epsboxes(POS_INFINITY), loup(POS_INFINITY),
 										loup_point(IntervalVector::empty(n)), initial_loup(POS_INFINITY), loup_changed(false),
-										time(0), nb_cells(0), cov(NULL) {
+										time(0), nb_cells(0), time_first_loup(-1),
+										nb_evals_start(0), nb_lp_solves_start(0), nb_evals(0), nb_lp_solves(0), cov(NULL) {
+
+	for (int k=0; k<nb_gap_decades; k++)
+		time_to_gap[k]=-1;
 
 	if (trace) cout.precision(12);
 }
@@ -167,8 +187,12 @@ void Optimizer::update_uplo_of_epsboxes(double ymin) {
 
 void Optimizer::handle_cell(Cell& c) {
 
+	if (search_log) search_log->begin(c);
+
 	contract_and_bound(c);
 
+	if (search_log) search_log->end(c, outcome, loup, uplo);
+
 	if (c.box.is_empty()) {
 		delete &c;
 	} else {
@@ -178,6 +202,8 @@ void Optimizer::handle_cell(Cell& c) {
 
 void Optimizer::contract_and_bound(Cell& c) {
 
+	outcome=SearchLog::KEPT;
+
 	/*======================== contract y with y<=loup ========================*/
 	Interval& y=c.box[goal_var];
 
@@ -191,6 +217,7 @@ void Optimizer::contract_and_bound(Cell& c) {
 
 	if (y.is_empty()) {
 		c.box.set_empty();
+		outcome=SearchLog::PRUNED;
 		return;
 	} else {
 		c.prop.update(BoxEvent(c.box,BoxEvent::CONTRACT,BitSet::singleton(n+1,goal_var)));
@@ -209,7 +236,10 @@ void Optimizer::contract_and_bound(Cell& c) {
 
 	ctc.contract(c.box, context);
 	//cout << c.prop << endl;
-	if (c.box.is_empty()) return;
+	if (c.box.is_empty()) {
+		outcome=SearchLog::EMPTY;
+		return;
+	}
 
 	//cout << " [contract]  x after=" << c.box << endl;
 	//cout << " [contract]  y after=" << y << endl;
@@ -236,6 +266,7 @@ void Optimizer::contract_and_bound(Cell& c) {
 
 	if (y.is_empty()) { // fix issue #44
 		c.box.set_empty();
+		outcome=SearchLog::PRUNED;
 		return;
 	}
 
@@ -249,6 +280,7 @@ void Optimizer::contract_and_bound(Cell& c) {
 	if ((tmp_box.max_diam()<=eps_x && y.diam() <=abs_eps_f) || !c.box.is_bisectable()) {
 		update_uplo_of_epsboxes(y.lb());
 		c.box.set_empty();
+		outcome=SearchLog::EPS_BOX;
 		return;
 	}
 
@@ -257,6 +289,7 @@ void Optimizer::contract_and_bound(Cell& c) {
 
 	if (tmp_box.is_empty()) {
 		c.box.set_empty();
+		outcome=SearchLog::EMPTY;
 	} else {
 		// the current extended box in the cell is updated
 		write_ext_box(tmp_box,c.box);
@@ -293,6 +326,9 @@ void Optimizer::start(const IntervalVector& init_box, double obj_init_bound) {
 
 	nb_cells=0;
 
+	nb_evals_start=RunSummary::nb_evals();
+	nb_lp_solves_start=RunSummary::nb_lp_solves();
+
 	buffer.flush();
 
 	Cell* root=new Cell(IntervalVector(n+1));
@@ -311,6 +347,12 @@ void Optimizer::start(const IntervalVector& init_box, double obj_init_bound) {
 	// add data required by the loup finder
 	loup_finder.add_property(init_box, root->prop);
 
+	// number the nodes of the search tree
+	if (search_log) search_log->add_property(root->prop);
+
+	// all the properties must be storable if cells are spilled to disk
+	buffer.check_spill(root->prop);
+
 	//cout << "**** Properties ****\n" << root->prop << endl;
 
 	loup_changed=false;
@@ -342,6 +384,9 @@ void Optimizer::start(const CovOptimData& data, double obj_init_bound) {
 
 	nb_cells=0;
 
+	nb_evals_start=RunSummary::nb_evals();
+	nb_lp_solves_start=RunSummary::nb_lp_solves();
+
 	buffer.flush();
 
 	for (size_t i=loup_point.is_empty()? 0 : 1; i<data.size(); i++) {
@@ -371,6 +416,11 @@ void Optimizer::start(const CovOptimData& data, double obj_init_bound) {
 		// add data required by the loup finder
 		loup_finder.add_property(box, cell->prop);
 
+		// number the nodes of the search tree
+		if (search_log) search_log->add_property(cell->prop);
+
+		buffer.check_spill(cell->prop);
+
 		buffer.push(cell);
 	}
 
@@ -391,6 +441,11 @@ Optimizer::Status Optimizer::optimize() {
 
 	update_uplo();
 
+	time_first_loup=-1;
+	for (int k=0; k<nb_gap_decades; k++)
+		time_to_gap[k]=-1;
+	update_progress(); // the root may have given a loup
+
 	try {
 	     while (!buffer.empty()) {
 		  
@@ -402,6 +457,7 @@ Optimizer::Status Optimizer::optimize() {
 			try {
 
 				pair<Cell*,Cell*> new_cells=bsc.bisect(*c);
+				if (search_log) search_log->bisected(*c, *new_cells.first, *new_cells.second);
 				buffer.pop();
 				delete c; // deletes the cell.
 
@@ -441,6 +497,8 @@ Optimizer::Status Optimizer::optimize() {
 				if (timeout>0) timer.check(timeout); // TODO: not reentrant, JN: done
 				time = timer.get_time();
 
+				update_progress();
+
 			}
 			catch (NoBisectableVariableException& ) {
 				update_uplo_of_epsboxes((c->box)[goal_var].lb());
@@ -454,6 +512,8 @@ Optimizer::Status Optimizer::optimize() {
 	 	timer.stop();
 	 	time = timer.get_time();
 
+	 	update_progress();
+
 		// No solution found and optimization stopped with empty buffer
 		// before the required precision is reached => means infeasible problem
 	 	if (uplo_of_epsboxes == NEG_INFINITY)
@@ -475,6 +535,11 @@ Optimizer::Status Optimizer::optimize() {
 	for (int i=0; i<(extended_COV ? n+1 : n); i++)
 		cov->data->_optim_var_names.push_back(string(""));
 
+	if (search_log) search_log->flush();
+
+	nb_evals = RunSummary::nb_evals() - nb_evals_start;
+	nb_lp_solves = RunSummary::nb_lp_solves() - nb_lp_solves_start;
+
 	cov->data->_optim_optimizer_status = (unsigned int) status;
 	cov->data->_optim_uplo = uplo;
 	cov->data->_optim_uplo_of_epsboxes = uplo_of_epsboxes;
@@ -538,6 +603,32 @@ const char* white() {
 
 }
 
+void Optimizer::update_progress() {
+	if (time_first_loup<0 && loup<initial_loup)
+		time_first_loup=time;
+
+	double rel_prec=get_obj_rel_prec();
+	for (int k=0; k<nb_gap_decades; k++)
+		if (time_to_gap[k]<0 && rel_prec<=::pow(10.0,-(k+1)))
+			time_to_gap[k]=time;
+}
+
+RunSummary Optimizer::summary() const {
+	RunSummary s;
+	s.add_string("status", status_name(status));
+	s.add_real("uplo", uplo);
+	s.add_real("loup", loup);
+	s.add_search(time, nb_cells, nb_evals, nb_lp_solves);
+	// unreached events are exported as null
+	s.add_real("time_first_loup", time_first_loup>=0 ? time_first_loup : NAN);
+	for (int k=0; k<nb_gap_decades; k++) {
+		stringstream key;
+		key << "time_to_gap_1e-" << (k+1);
+		s.add_real(key.str(), time_to_gap[k]>=0 ? time_to_gap[k] : NAN);
+	}
+	return s;
+}
+
 void Optimizer::report() {
 
 	if (!cov || !buffer.empty()) { // not started
@@ -607,6 +698,12 @@ void Optimizer::report() {
 	if (cov->nb_cells()!=nb_cells)
 		cout << " [total=" << cov->nb_cells() << "]";
 	cout << endl << endl;
+
+	if (profiler) {
+		cout << " profiling:" << endl;
+		profiler->report(cout);
+		cout << endl;
+	}
 }
 
 
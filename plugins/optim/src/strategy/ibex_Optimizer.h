@@ -18,6 +18,9 @@
 //#include "ibex_EntailedCtr.h"
 #include "ibex_CtcKhunTucker.h"
 #include "ibex_CovOptimData.h"
+#include "ibex_Profiler.h"
+#include "ibex_SearchLog.h"
+#include "ibex_RunSummary.h"
 
 namespace ibex {
 
@@ -218,6 +221,38 @@ public:
 	 */
 	const CovOptimData& get_data() const;
 
+	/**
+	 * \brief Get the time when the first loup was found.
+	 *
+	 * \return the time (from the beginning of the last call to optimize(...))
+	 *         or -1 if no loup has been found.
+	 */
+	double get_time_first_loup() const;
+
+	/**
+	 * \brief Get the time when the relative precision on the objective
+	 *        reached 10^-k, for k=1..#nb_gap_decades.
+	 *
+	 * \return the time (from the beginning of the last call to optimize(...))
+	 *         or -1 if this precision has not been reached.
+	 */
+	double get_time_to_gap(int k) const;
+
+	/**
+	 * \brief Machine-readable summary of the last call to optimize(...).
+	 *
+	 * Contains the status, the bounds on the objective, the time, the number
+	 * of cells and the throughput (cells per second), the number of function
+	 * evaluations and LP solves, the peak resident memory, the time to the first
+	 * loup and the times to reach a relative gap of 10^-1, ..., 10^-6 ("time_to_gap_1e-k").
+	 */
+	RunSummary summary() const;
+
+	/**
+	 * \brief Number of relative gaps 10^-k recorded (see #get_time_to_gap(int)).
+	 */
+	static const int nb_gap_decades = 6;
+
 	/* =========================== Settings ============================= */
 
 	/**
@@ -321,6 +356,23 @@ public:
 	 */
 	bool anticipated_upper_bounding;
 
+	/**
+	 * \brief Profiling counters (NULL by default).
+	 *
+	 * If not NULL, the counters are displayed by report(). They are fed
+	 * by the profiling wrappers of the operators (see #ibex::CtcProfiler,
+	 * #ibex::BscProfiler and #ibex::LoupFinderProfiler).
+	 */
+	Profiler* profiler;
+
+	/**
+	 * \brief Search tree log (NULL by default).
+	 *
+	 * If not NULL, a record is appended for each cell handled
+	 * (see #ibex::SearchLog).
+	 */
+	SearchLog* search_log;
+
 protected:
 	/*
 	 * \brief Initialize the optimizer from a single box.
@@ -395,6 +447,11 @@ protected:
 	 */
 	void time_limit_check();
 
+	/**
+	 * \brief Record the time of the first loup and the times to gap (for the summary).
+	 */
+	void update_progress();
+
 	/*=======================================================================================================*/
 	/*                                Functions to manage the extended CSP                                   */
 	/*=======================================================================================================*/
@@ -450,12 +507,27 @@ private:
 	/** True if loup has changed in the last call to handle_cell(..) */
 	bool loup_changed;
 
+	/** What happened to the cell in the last call to contract_and_bound(..) (for the search log) */
+	SearchLog::Outcome outcome;
+
 	/* CPU running time of the current optimization. */
 	double time;
 
 	/** Number of cells pushed into the heap (which passed through the contractors) */
 	size_t nb_cells;
 
+	/** Time when the first loup was found (-1 if none). */
+	double time_first_loup;
+
+	/** Time when the relative precision reached 10^-(k+1) (-1 if not reached). */
+	double time_to_gap[nb_gap_decades];
+
+	/** Values of the process-wide counters (see RunSummary) when the optimization started. */
+	unsigned long nb_evals_start, nb_lp_solves_start;
+
+	/** Number of function evaluations and LP solves of the current optimization. */
+	unsigned long nb_evals, nb_lp_solves;
+
 	/** Result. */
 	CovOptimData* cov;
 };
@@ -472,6 +544,13 @@ inline double Optimizer::get_time() const { return time; }
 
 inline size_t Optimizer::get_nb_cells() const { return nb_cells; }
 
+inline double Optimizer::get_time_first_loup() const { return time_first_loup; }
+
+inline double Optimizer::get_time_to_gap(int k) const {
+	assert(k>=1 && k<=nb_gap_decades);
+	return time_to_gap[k-1];
+}
+
 inline double Optimizer::get_obj_rel_prec() const {
 	if (loup==POS_INFINITY)
 		return POS_INFINITY;
@@ -16,6 +16,8 @@
 #include "ibex_BitSet.h"
 #include "ibex_LineSearch.h"
 
+#include <cmath>
+
 namespace ibex {
 
 /**
@@ -147,15 +149,19 @@ private:
 	void update_B_SR1(Matrix& Bk, const Vector& sk, const Vector& gk, const Vector& gk1);
 
 	/*
-	 * \brief Return the midpoint if the interval is not empty,
-	 * throw a InvalidPointException otherwise.
+	 * \brief Approximate value of f at x.
+	 *
+	 * Calculated with floating-point arithmetic (see #PointEval).
+	 * Throw a InvalidPointException if the result is not finite.
 	 */
-	double _mid(const Interval& x);
+	double eval(const Vector& x);
 
 	/**
-	 * \see #_mid(const Interval&).
+	 * \brief Approximate gradient of f at x.
+	 *
+	 * \see #eval(const Vector&).
 	 */
-	Vector _mid(const IntervalVector& x);
+	void gradient(const Vector& x, Vector& g);
 
 };
 
@@ -168,14 +174,16 @@ inline int UnconstrainedLocalSearch::nb_iter() const {
 	return this->niter;
 }
 
-inline double UnconstrainedLocalSearch::_mid(const Interval& x) {
-	if (x.is_empty() || x.is_unbounded()) throw InvalidPointException();
-	else return x.mid();
+inline double UnconstrainedLocalSearch::eval(const Vector& x) {
+	double y=f.point_evaluator().eval(x);
+	if (!std::isfinite(y)) throw InvalidPointException();
+	else return y;
 }
 
-inline Vector UnconstrainedLocalSearch::_mid(const IntervalVector& x) {
-	if (x.is_empty() || x.is_unbounded()) throw InvalidPointException();
-	else return x.mid();
+inline void UnconstrainedLocalSearch::gradient(const Vector& x, Vector& g) {
+	f.point_evaluator().gradient(x,g);
+	for (int i=0; i<n; i++)
+		if (!std::isfinite(g[i])) throw InvalidPointException();
 }
 
 } // end namespace
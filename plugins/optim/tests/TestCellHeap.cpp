@@ -392,4 +392,82 @@ void TestCellHeap::test_D05() {
 
 
 
+void TestCellHeap::spill01() {
+	const ExprSymbol& x=ExprSymbol::new_();
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_goal(x);
+	System _sys(fac);
+	ExtendedSystem sys(_sys);
+	cleanup(x,true);
+
+	// only the first heap is used
+	CellDoubleHeap h(sys, 0);
+	h.set_spill(8);
+
+	int nb=200;
+	for (int i=0; i<nb; i++) {
+		double lb=(i*37)%nb;
+		Cell* cell=new Cell(IntervalVector(2,Interval(lb,lb+1)));
+		cell->prop.add(new BxpOptimData(sys));
+		((BxpOptimData*) cell->prop[BxpOptimData::get_id(sys)])->pu=lb;
+		h.push(cell);
+	}
+	CPPUNIT_ASSERT(h.size()==(unsigned int) nb);
+	CPPUNIT_ASSERT(h.minimum()==0);
+
+	// cells with lb>150 are removed (those on disk
+	// are discarded only when they are reloaded)
+	h.contract(150);
+	CPPUNIT_ASSERT(h.size()==151);
+
+	for (int i=0; i<=150; i++) {
+		CPPUNIT_ASSERT(h.minimum()==i);
+		Cell* cell=h.pop();
+		CPPUNIT_ASSERT(cell->box[1].lb()==i);
+		CPPUNIT_ASSERT(((BxpOptimData*) cell->prop[BxpOptimData::get_id(sys)])->pu==i);
+		delete cell;
+	}
+	CPPUNIT_ASSERT(h.empty());
+	CPPUNIT_ASSERT(h.size()==0);
+}
+
+void TestCellHeap::spill02() {
+	const ExprSymbol& x=ExprSymbol::new_();
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_goal(x);
+	System _sys(fac);
+	ExtendedSystem sys(_sys);
+	cleanup(x,true);
+
+	CellDoubleHeap h(sys, 0);
+	h.set_spill(8);
+
+	// all the cells have the same cost, except
+	// the last ones (that are removed by contract)
+	int nb=100;
+	for (int i=0; i<nb; i++) {
+		double lb=i<90? 0 : 1;
+		Cell* cell=new Cell(IntervalVector(2,Interval(lb,lb+1)));
+		cell->prop.add(new BxpOptimData(sys));
+		h.push(cell);
+		CPPUNIT_ASSERT(h.size()-h.nb_spilled()<=8);
+	}
+	CPPUNIT_ASSERT(h.size()==(unsigned int) nb);
+	CPPUNIT_ASSERT(h.nb_spilled()>0);
+
+	h.contract(0.5);
+	CPPUNIT_ASSERT(h.size()==90);
+
+	for (int i=0; i<90; i++) {
+		CPPUNIT_ASSERT(h.size()==(unsigned int) 90-i);
+		Cell* cell=h.pop();
+		CPPUNIT_ASSERT(cell->box[1].lb()==0);
+		delete cell;
+	}
+	CPPUNIT_ASSERT(h.empty());
+	CPPUNIT_ASSERT(h.size()==0);
+}
+
 } // end namespace
@@ -33,6 +33,8 @@ public:
 	CPPUNIT_TEST(test_D03);
 	CPPUNIT_TEST(test_D04);
 	CPPUNIT_TEST(test_D05);
+	CPPUNIT_TEST(spill01);
+	CPPUNIT_TEST(spill02);
 	CPPUNIT_TEST_SUITE_END();
 
 	void test01();
@@ -45,6 +47,8 @@ public:
 	void test_D03();
 	void test_D04();
 	void test_D05();
+	void spill01();
+	void spill02();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestCellHeap);
@@ -40,7 +40,7 @@ void CtcQInterProjF::contract(IntervalVector& box) {
 		refs.set_ref(i,boxes[i]);
 	}
 
-	box = qinter_projf(refs,q);
+	box = qinter_projf(refs,q,proj);
 }
 
 CtcQInterCoreF::CtcQInterCoreF(const Array<Ctc>& list, int q) :  Ctc(list), list(list), q(q), boxes(list.size(), nb_var) { }
@@ -55,7 +55,7 @@ void CtcQInterCoreF::contract(IntervalVector& box) {
 		refs.set_ref(i,boxes[i]);
 	}
 
-	box = qinter_coref(refs,q);
+	box = qinter_coref(refs,q,proj);
 }
 
 } // end namespace ibex
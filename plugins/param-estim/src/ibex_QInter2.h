@@ -20,6 +20,7 @@
 #include "ibex_KCoreGraph.h"
 #include "ibex_Array.h"
 #include "ibex_IntStack.h"
+#include "ibex_QInterProjection.h"
 
 namespace ibex {
 
@@ -29,12 +30,32 @@ namespace ibex {
  */
 IntervalVector qinter_projf(const Array<IntervalVector>& _boxes, int q);
 
+/**
+ * \ingroup combinatorial
+ * \brief Q-intersection - HEURISTIC - Projective filtering, iterated
+ *
+ * Same as #qinter_projf(const Array<IntervalVector>&, int) but the boxes that
+ * do not intersect the projection are removed until a fixpoint is reached
+ * (see QInterProjection::filter). The projection object should be reused from
+ * one call to the other with the same list of boxes.
+ */
+IntervalVector qinter_projf(const Array<IntervalVector>& _boxes, int q, QInterProjection& proj);
+
 /**
  * \ingroup combinatorial
  * \brief Q-intersection - HEURISTIC - k-core filtering + greedy coloring
  */
 IntervalVector qinter_coref(const Array<IntervalVector>& _boxes, int q);
 
+/**
+ * \ingroup combinatorial
+ * \brief Q-intersection - HEURISTIC - k-core filtering + greedy coloring, after projective filtering
+ *
+ * The intersection graph is only built with the boxes that intersect the iterated
+ * projection (see QInterProjection::filter), clipped to it.
+ */
+IntervalVector qinter_coref(const Array<IntervalVector>& _boxes, int q, QInterProjection& proj);
+
 /**
  * \ingroup combinatorial
  * \brief Q-intersection - EXACT - QInter2 : Cliquer-based solver
@@ -114,4 +114,33 @@ IntervalVector qinter_coref(const Array<IntervalVector>& _boxes, int q) {
 	return res;
 }
 
+IntervalVector qinter_coref(const Array<IntervalVector>& _boxes, int q, QInterProjection& proj) {
+
+	assert(q>0);
+	assert(_boxes.size()>0);
+
+	IntervalVector hull=proj.filter(_boxes,q);
+
+	if (hull.is_empty()) return hull;
+
+	/* Only keep the boxes that intersect the projection, clipped to it */
+
+	int p=0;
+	for (int i=0; i<_boxes.size(); i++) {
+		if (!proj.discarded(i)) p++;
+	}
+
+	Array<IntervalVector> boxes(p);
+	int j=0;
+	for (int i=0; i<_boxes.size(); i++) {
+		if (!proj.discarded(i)) boxes.set_ref(j++,*new IntervalVector(_boxes[i] & hull));
+	}
+
+	IntervalVector res=qinter_coref(boxes,q);
+
+	for (int i=0; i<p; i++) delete &boxes[i];
+
+	return res;
+}
+
 } // end namespace ibex
@@ -71,6 +71,8 @@ void GoldsztejnSICBisector::contract(IntervalVector& box, ContractContext& conte
 				[](const ParameterEvaluationsCache& p1, const ParameterEvaluationsCache& p2) {
 					return p1.evaluation.ub() > p2.evaluation.ub();
 				});
+		// the parameter boxes are reordered (and bisected below)
+		node_data->sic_constraints_caches[cst_index].paving_changed();
 		const SIConstraint& constraint = system_.sic_constraints_[cst_index];
 		const int bisection_limit = 50;
 		int bisections = 0;
@@ -12,6 +12,7 @@
 #include "ibex_SICPaving.h"
 
 #include "ibex_SIPSystem.h"
+#include "ibex_ParameterKdTree.h"
 
 #include "ibex_utils.h"
 #include "ibex_Newton.h"
@@ -28,19 +29,17 @@ void bisect_paving(SIConstraintCache& cache) {
 			cache.parameter_caches_.emplace_back(ParameterEvaluationsCache(bisects[j]));
 		}
 	}
+	cache.paving_changed();
 }
 
 bool is_feasible_with_paving(const SIConstraint& constraint, const SIConstraintCache& cache, const IntervalVector& box) {
-	const auto& list = cache.parameter_caches_;
-	for(int i = 0; i < list.size(); ++i) {
-		if(constraint.evaluate(box, list[i].parameter_box).ub() > 0) {
-			return false;
-		}
-	}
-	return true;
+	return cache.parameter_tree().is_satisfied(cache, [&](const IntervalVector& parameter_box) {
+		return constraint.evaluate(box, parameter_box);
+	}, ParameterKdTree::bounds_valid(cache, box));
 }
 
 void simplify_paving(const SIConstraint& constraint, SIConstraintCache& cache, const IntervalVector& box, bool with_newton) {
+	// only the new parameter boxes are evaluated if the box has not changed
     cache.update_cache(*constraint.function_, box, true);
 	monotonicity_filter(constraint, cache, box);
     evaluation_filter(constraint, cache, box);
@@ -77,6 +76,7 @@ void monotonicity_filter(const SIConstraint& constraint, SIConstraintCache& cach
 		}
 		if (!keepInVector) {
 			it = list.erase(it);
+			cache.paving_changed();
 		} else {
 			//_updateMemoryBox(*it);
 			++it;
@@ -86,14 +86,23 @@ void monotonicity_filter(const SIConstraint& constraint, SIConstraintCache& cach
 
 void evaluation_filter(const SIConstraint& constraint, SIConstraintCache& cache, const IntervalVector& box) {
     auto& list = cache.parameter_caches_;
-    auto it = list.begin();
-	while (it != list.end()) {
-		if (constraint.evaluate(box, it->parameter_box).ub() <= 0) {
-			it = list.erase(it);
-		} else {
-			it++;
+	std::vector<bool> satisfied(list.size(), false);
+	cache.parameter_tree().find_satisfied(cache, [&](const IntervalVector& parameter_box) {
+		return constraint.evaluate(box, parameter_box);
+	}, ParameterKdTree::bounds_valid(cache, box), satisfied);
+
+	// remove the parameter boxes where the constraint is satisfied (keeping the order)
+	int j = 0;
+	for (int i = 0; i < list.size(); ++i) {
+		if (!satisfied[i]) {
+			if (j < i) list[j] = list[i];
+			j++;
 		}
 	}
+	if (j < list.size()) {
+		list.erase(list.begin() + j, list.end());
+		cache.paving_changed();
+	}
 }
 
 void newton_filter(const SIConstraint& constraint, SIConstraintCache& cache, const IntervalVector& box) {
@@ -152,6 +161,8 @@ void newton_filter(const SIConstraint& constraint, SIConstraintCache& cache, con
             it++;
         }
     }
+    // the parameter boxes may be enlarged
+    cache.paving_changed();
 }
 
 void blankenship(const IntervalVector& box, const SIPSystem& sys, BxpNodeData* node_data) {
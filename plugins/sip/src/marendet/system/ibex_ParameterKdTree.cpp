@@ -0,0 +1,77 @@
+/* ============================================================================
+ * I B E X - ibex_ParameterKdTree.cpp
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_ParameterKdTree.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace ibex {
+
+ParameterKdTree::ParameterKdTree(const SIConstraintCache& cache) {
+	const auto& caches = cache.parameter_caches_;
+	if (caches.empty()) return;
+
+	order.resize(caches.size());
+	for (int i = 0; i < (int) caches.size(); ++i) {
+		order[i] = i;
+	}
+	nodes.reserve(2*caches.size()-1);
+	build(caches, 0, caches.size());
+}
+
+bool ParameterKdTree::bounds_valid(const SIConstraintCache& cache, const IntervalVector& box) {
+	return !cache.must_be_updated_ && !cache.box_cached_.is_empty() && box.is_subset(cache.box_cached_);
+}
+
+int ParameterKdTree::build(const vector<ParameterEvaluationsCache>& caches, int first, int last) {
+	IntervalVector hull = caches[order[first]].parameter_box;
+	for (int j = first + 1; j < last; ++j) {
+		hull |= caches[order[j]].parameter_box;
+	}
+
+	const int i = nodes.size();
+	nodes.push_back(Node(hull, first, last));
+
+	if (last - first == 1) return i;
+
+	// median split of the midpoints along the widest dimension
+	const int dim = hull.extr_diam_index(false);
+	const int middle = (first + last) / 2;
+	nth_element(order.begin() + first, order.begin() + middle, order.begin() + last,
+			[&](int a, int b) {
+				return caches[a].parameter_box[dim].mid() < caches[b].parameter_box[dim].mid();
+			});
+
+	// note: "nodes" may be reallocated by the recursive calls
+	const int left = build(caches, first, middle);
+	const int right = build(caches, middle, last);
+	nodes[i].left = left;
+	nodes[i].right = right;
+	return i;
+}
+
+void ParameterKdTree::bounds(const SIConstraintCache& cache, vector<Interval>& bound) const {
+	const auto& caches = cache.parameter_caches_;
+	bound.resize(nodes.size());
+	// children are after their parent
+	for (int i = nodes.size() - 1; i >= 0; --i) {
+		const Node& node = nodes[i];
+		if (node.left == -1) {
+			const ParameterEvaluationsCache& leaf = caches[order[node.first]];
+			bound[i] = leaf.is_evaluation_valid() ? leaf.evaluation : Interval::ALL_REALS;
+		} else {
+			bound[i] = bound[node.left] | bound[node.right];
+		}
+	}
+}
+
+} // end namespace ibex
@@ -0,0 +1,193 @@
+/* ============================================================================
+ * I B E X - ibex_ParameterKdTree.h
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __SIP_IBEX_PARAMETER_KD_TREE_H__
+#define __SIP_IBEX_PARAMETER_KD_TREE_H__
+
+#include "ibex_SIConstraintCache.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \brief k-d tree over the parameter boxes of a SIConstraintCache.
+ *
+ * Each node stores the hull of the parameter boxes of its subtree. With the
+ * cached evaluations, the sign of the constraint can be proven on a whole
+ * subtree with no evaluation at all (with the hull of the cached
+ * evaluations) or with a single one (on the hull of the parameter boxes),
+ * instead of scanning all the parameter boxes.
+ *
+ * The tree is a static index: it refers to the parameter boxes by their
+ * position in SIConstraintCache::parameter_caches_. It does not depend on
+ * the evaluations, so it is built once and shared by the copies of the
+ * cache (i.e., by the nodes of the search tree) until the parameter boxes
+ * are modified (see SIConstraintCache::paving_changed()).
+ */
+class ParameterKdTree {
+public:
+	struct Node {
+		/** Hull of the parameter boxes of the subtree. */
+		IntervalVector hull;
+		/** Leaves of the subtree: order[first..last-1]. */
+		int first, last;
+		/** Children (-1 for a leaf). */
+		int left, right;
+
+		Node(const IntervalVector& hull, int first, int last) :
+			hull(hull), first(first), last(last), left(-1), right(-1) {
+		}
+	};
+
+	/**
+	 * \brief Build the tree over the parameter boxes of the cache.
+	 */
+	explicit ParameterKdTree(const SIConstraintCache& cache);
+
+	/**
+	 * \brief Whether the cached evaluations enclose the constraint on "box".
+	 *
+	 * They do if box is included in the box they were computed with. The
+	 * evaluation of a parameter box is only used if the box is also included
+	 * in the parameter box of the evaluation (the Newton filter may enlarge it,
+	 * see ParameterEvaluationsCache::is_evaluation_valid()).
+	 */
+	static bool bounds_valid(const SIConstraintCache& cache, const IntervalVector& box);
+
+	/**
+	 * \brief True if there is no parameter box.
+	 */
+	bool empty() const;
+
+	/**
+	 * \brief Number of parameter boxes.
+	 */
+	int size() const;
+
+	/**
+	 * \brief Check that the constraint is satisfied for all the parameters.
+	 *
+	 * \param cache      - the cache the tree has been built with.
+	 * \param eval       - eval(p) must return an enclosure of the constraint
+	 *                     over the parameter box p.
+	 * \param use_bounds - whether the cached evaluations can be used (see
+	 *                     #bounds_valid). If not, the constraint is evaluated
+	 *                     on every parameter box, as with a plain loop
+	 *                     (the hulls are not evaluated).
+	 * \return true if eval(p).ub()<=0 for all the parameter boxes p (or for
+	 *         boxes enclosing them).
+	 */
+	template<class Eval>
+	bool is_satisfied(const SIConstraintCache& cache, Eval eval, bool use_bounds) const;
+
+	/**
+	 * \brief Find the parameter boxes where the constraint is satisfied.
+	 *
+	 * Same as #is_satisfied but proceeds with all the subtrees. A parameter
+	 * box is proven to satisfy the constraint if eval(p).ub()<=0 for it or
+	 * for the hull of a subtree containing it.
+	 *
+	 * \param proven - (output) proven[i] is set to true for every proven parameter
+	 *                 box i (position in parameter_caches_). Must have the size of
+	 *                 parameter_caches_. Other entries are not modified.
+	 */
+	template<class Eval>
+	void find_satisfied(const SIConstraintCache& cache, Eval eval, bool use_bounds, std::vector<bool>& proven) const;
+
+	/** Nodes (the root is the first one, a node is before its children). */
+	std::vector<Node> nodes;
+
+	/** Positions of the parameter boxes in parameter_caches_, sorted by leaf. */
+	std::vector<int> order;
+
+private:
+	int build(const std::vector<ParameterEvaluationsCache>& caches, int first, int last);
+
+	/*
+	 * Hull of the valid cached evaluations of each node (all reals if one
+	 * of them is unknown or not valid).
+	 */
+	void bounds(const SIConstraintCache& cache, std::vector<Interval>& bound) const;
+
+	template<class Eval>
+	int check(int node, Eval& eval, const std::vector<Interval>* bound, std::vector<bool>* proven) const;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline bool ParameterKdTree::empty() const {
+	return nodes.empty();
+}
+
+inline int ParameterKdTree::size() const {
+	return order.size();
+}
+
+/*
+ * Return 1 if the constraint is proven satisfied on the subtree, -1 if
+ * it is proven violated for at least one parameter box and 0 otherwise.
+ * If proven is NULL, the traversal stops as soon as -1 or 0 is obtained
+ * for a subtree. If bound is NULL, only the leaves are evaluated.
+ */
+template<class Eval>
+int ParameterKdTree::check(int i, Eval& eval, const std::vector<Interval>* bound, std::vector<bool>* proven) const {
+	const Node& node = nodes[i];
+
+	int res;
+
+	if (bound && (*bound)[i].ub() <= 0)
+		res = 1;
+	else if (bound && (*bound)[i].lb() > 0)
+		return -1;
+	else if (node.left!=-1 && (!bound || !(*bound)[i].is_unbounded()))
+		res = 0; // the evaluation on the hull would not be sharper than the bound (or the leaves)
+	else {
+		Interval z = eval(node.hull);
+		if (z.ub() <= 0) res = 1;
+		else if (z.lb() > 0) return -1;
+		else res = 0;
+	}
+
+	if (res == 1) {
+		if (proven)
+			for (int j = node.first; j < node.last; j++)
+				(*proven)[order[j]] = true;
+		return 1;
+	}
+
+	if (node.left == -1) return 0;
+
+	int l = check(node.left, eval, bound, proven);
+	if (!proven && l!=1) return l;
+	int r = check(node.right, eval, bound, proven);
+	if (l==-1 || r==-1) return -1;
+	return (l==1 && r==1)? 1 : 0;
+}
+
+template<class Eval>
+bool ParameterKdTree::is_satisfied(const SIConstraintCache& cache, Eval eval, bool use_bounds) const {
+	if (empty()) return true;
+	std::vector<Interval> bound;
+	if (use_bounds) bounds(cache, bound);
+	return check(0, eval, use_bounds ? &bound : NULL, NULL) == 1;
+}
+
+template<class Eval>
+void ParameterKdTree::find_satisfied(const SIConstraintCache& cache, Eval eval, bool use_bounds, std::vector<bool>& proven) const {
+	if (empty()) return;
+	std::vector<Interval> bound;
+	if (use_bounds) bounds(cache, bound);
+	check(0, eval, use_bounds ? &bound : NULL, &proven);
+}
+
+} // end namespace ibex
+
+#endif // __SIP_IBEX_PARAMETER_KD_TREE_H__
@@ -10,6 +10,7 @@
  * ---------------------------------------------------------------------------- */
  
 #include "ibex_SIConstraintCache.h"
+#include "ibex_ParameterKdTree.h"
 
 #include "ibex_utils.h"
 
@@ -26,12 +27,17 @@ SIConstraintCache::SIConstraintCache(const IntervalVector& initial_box) :
 }
 
 void SIConstraintCache::update_cache(const Function &function, const IntervalVector& new_box_, bool force) {
-	if (force || must_be_updated_ || box_cached_ != new_box_) {
-		box_cached_ = new_box_;
-		must_be_updated_ = false;
-	} else {
+	// Only the parameter boxes without a valid evaluation are evaluated if
+	// the box is the same (force means that parameter boxes may have changed).
+	const bool same_box = !must_be_updated_ && box_cached_ == new_box_;
+	if (same_box && !force) {
 		return;
 	}
+	// The previous evaluations are still valid enclosures if the new box is
+	// a subbox (typically, in a child node of the search tree).
+	const bool inherited = !same_box && !must_be_updated_ && !box_cached_.is_empty() && new_box_.is_subset(box_cached_);
+	box_cached_ = new_box_;
+	must_be_updated_ = false;
 
 	// Reinitialize cache
 	const int x_dim = new_box_.size();
@@ -42,11 +48,56 @@ void SIConstraintCache::update_cache(const Function &function, const IntervalVec
 	// Prepare IntervalVector to save instantiating a new IV for each computation
 	full_box.put(0, new_box_);
 	for (auto& cache_cell : parameter_caches_) {
-		full_box.put(x_dim, cache_cell.parameter_box);
-		cache_cell.evaluation = centeredFormEval(function, full_box);
-		cache_cell.full_gradient = function.gradient(full_box);
+		if (!same_box || !cache_cell.is_evaluation_valid()) {
+			update_cell(function, full_box, cache_cell, inherited);
+		}
 		eval_cache_ |= cache_cell.evaluation;
 		gradient_cache_ |= cache_cell.full_gradient.subvector(0, x_dim-1);
 	}
 }
+
+void SIConstraintCache::update_cell(const Function& function, IntervalVector& full_box, ParameterEvaluationsCache& cache_cell, bool inherited) {
+	const bool valid = inherited && cache_cell.is_evaluation_valid();
+
+	// the constraint is proven satisfied in the parent box: this holds
+	// in the subbox and the evaluation is not needed more precisely
+	if (valid && cache_cell.evaluation.ub() <= 0) {
+		return;
+	}
+
+	full_box.put(box_cached_.size(), cache_cell.parameter_box);
+	Interval evaluation = centeredFormEval(function, full_box);
+	IntervalVector full_gradient = function.gradient(full_box);
+	// the intersections are only empty if the function is undefined; the new
+	// evaluations are kept in this case
+	if (valid) {
+		Interval shared_evaluation = evaluation & cache_cell.evaluation;
+		if (!shared_evaluation.is_empty()) {
+			evaluation = shared_evaluation;
+		}
+		if (cache_cell.full_gradient.size() == full_gradient.size()) {
+			IntervalVector shared_gradient = full_gradient & cache_cell.full_gradient;
+			if (!shared_gradient.is_empty()) {
+				full_gradient = shared_gradient;
+			}
+		}
+	}
+	cache_cell.evaluation = evaluation;
+	cache_cell.full_gradient = full_gradient;
+	cache_cell.evaluation_box = cache_cell.parameter_box;
+}
+
+const ParameterKdTree& SIConstraintCache::parameter_tree() const {
+	// the size is checked in case paving_changed() has been forgotten
+	// after a box has been added or removed
+	if (!tree_ || tree_->size() != (int) parameter_caches_.size()) {
+		tree_ = std::make_shared<const ParameterKdTree>(*this);
+	}
+	return *tree_;
+}
+
+void SIConstraintCache::paving_changed() {
+	tree_.reset();
+}
+
 } // end namespace ibex
@@ -18,23 +18,41 @@
 #include "ibex_Vector.h"
 
 #include <list>
+#include <memory>
 #include <vector>
 
 namespace ibex {
+
+class ParameterKdTree;
+
 struct ParameterEvaluationsCache {
 	IntervalVector parameter_box;
 	Interval evaluation;
 	IntervalVector full_gradient;
+	/**
+	 * Parameter box the evaluation and the gradient were calculated with
+	 * (parameter_box may be modified afterwards, and possibly enlarged by
+	 * newton_filter).
+	 */
+	IntervalVector evaluation_box;
 
 	ParameterEvaluationsCache(const IntervalVector& parameter_box) :
 			parameter_box(parameter_box), evaluation(Interval::EMPTY_SET), full_gradient(
-					1) {
+					1), evaluation_box(IntervalVector::empty(parameter_box.size())) {
 	}
 	ParameterEvaluationsCache(const IntervalVector& parameter_box,
 			const Interval& eval,
 			const IntervalVector& full_gradient) :
 			parameter_box(parameter_box), evaluation(eval), full_gradient(
-					full_gradient) {
+					full_gradient), evaluation_box(parameter_box) {
+	}
+
+	/**
+	 * \brief Whether evaluation and full_gradient enclose the function on parameter_box
+	 * (for the box of variables they were calculated with).
+	 */
+	bool is_evaluation_valid() const {
+		return !evaluation.is_empty() && parameter_box.is_subset(evaluation_box);
 	}
 };
 
@@ -42,9 +60,40 @@ class SIConstraintCache {
 public:
 	SIConstraintCache(const IntervalVector& initial_box);
 	virtual ~SIConstraintCache() {}
+
+	/**
+	 * \brief Evaluate the function and its gradient on new_box_ for all the parameter boxes.
+	 *
+	 * If new_box_ is the box the cache was computed with, only the parameter
+	 * boxes without a valid evaluation (new or enlarged boxes) are evaluated,
+	 * unless force is true.
+	 *
+	 * If new_box_ is a subset of this box (typically, in a child node of the
+	 * search tree), the previous evaluations are reused: they are kept as they
+	 * are if they prove that the constraint is satisfied (this cannot change
+	 * in a subbox) and intersected with the new ones otherwise.
+	 */
 	void update_cache(const Function& function,
 			const IntervalVector& new_box_, bool force=false);
 
+	/**
+	 * \brief k-d tree over the parameter boxes (see #ParameterKdTree).
+	 *
+	 * The tree is built on the first call and shared by the copies of the
+	 * cache until #paving_changed() is called.
+	 */
+	const ParameterKdTree& parameter_tree() const;
+
+	/**
+	 * \brief To be called when parameter boxes are added, removed, reordered
+	 * or enlarged in parameter_caches_.
+	 *
+	 * The k-d tree is then rebuilt on the next call to #parameter_tree().
+	 * Parameter boxes that are only shrunk do not require it (the hulls of the
+	 * tree still enclose them).
+	 */
+	void paving_changed();
+
 	/**
 	 * \brief Force update of the cache next time update_cache is called.
 	 *
@@ -61,6 +110,12 @@ public:
 
 	std::list<Vector> best_blankenship_points_;
 	//double best_blankenship_point_value_ = NEG_INFINITY;
+
+private:
+	void update_cell(const Function& function, IntervalVector& full_box, ParameterEvaluationsCache& cache_cell, bool inherited);
+
+	// k-d tree over parameter_caches_ (NULL if not built yet)
+	mutable std::shared_ptr<const ParameterKdTree> tree_;
 };
 
 } // end namespace ibex
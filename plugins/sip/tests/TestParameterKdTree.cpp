@@ -0,0 +1,199 @@
+/* ============================================================================
+ * I B E X - ParameterKdTree Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestParameterKdTree.h"
+
+#include "ibex_SICPaving.h"
+#include "ibex_ParameterKdTree.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * Paving of [0,1]x[0,1] with 4^n boxes.
+ */
+SIConstraintCache paving(int n) {
+	SIConstraintCache cache(IntervalVector(2,Interval(0,1)));
+	for (int i=0; i<n; i++)
+		bisect_paving(cache);
+	return cache;
+}
+
+/*
+ * The former (flat) evaluation filter.
+ */
+void flat_evaluation_filter(const SIConstraint& constraint, SIConstraintCache& cache, const IntervalVector& box) {
+	auto& list = cache.parameter_caches_;
+	auto it = list.begin();
+	while (it != list.end()) {
+		if (constraint.evaluate(box, it->parameter_box).ub() <= 0) {
+			it = list.erase(it);
+		} else {
+			it++;
+		}
+	}
+}
+
+/*
+ * The former (flat) feasibility test.
+ */
+bool flat_is_feasible(const SIConstraint& constraint, const SIConstraintCache& cache, const IntervalVector& box) {
+	const auto& list = cache.parameter_caches_;
+	for (int i = 0; i < list.size(); ++i) {
+		if (constraint.evaluate(box, list[i].parameter_box).ub() > 0) {
+			return false;
+		}
+	}
+	return true;
+}
+
+} // end anonymous namespace
+
+void TestParameterKdTree::evaluation_filter01() {
+	// linear in the parameters: the evaluation on a hull is the hull of the evaluations
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& p=ExprSymbol::new_("p",Dim::col_vec(2));
+	Function f(x,p,p[0]+p[1]-x);
+	SIConstraint c(&f, 1);
+
+	double _x[][2] = {{0.5,0.5}, {1,1.25}, {2,2}, {-1,0}};
+	for (int k=0; k<4; k++) {
+		IntervalVector box(1,Interval(_x[k][0],_x[k][1]));
+
+		SIConstraintCache cache=paving(3);
+		SIConstraintCache flat=cache;
+
+		cache.update_cache(f, box, true);
+		evaluation_filter(c, cache, box);
+		flat_evaluation_filter(c, flat, box);
+
+		CPPUNIT_ASSERT(cache.parameter_caches_.size()==flat.parameter_caches_.size());
+		for (int i=0; i<flat.parameter_caches_.size(); i++)
+			CPPUNIT_ASSERT(cache.parameter_caches_[i].parameter_box==flat.parameter_caches_[i].parameter_box);
+	}
+}
+
+void TestParameterKdTree::is_feasible01() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& p=ExprSymbol::new_("p",Dim::col_vec(2));
+	Function f(x,p,p[0]+p[1]-x);
+	SIConstraint c(&f, 1);
+
+	double _x[][2] = {{0.5,0.5}, {1.5,3}, {2,2}, {1.75,2}, {-1,0}};
+	for (int k=0; k<5; k++) {
+		IntervalVector box(1,Interval(_x[k][0],_x[k][1]));
+		SIConstraintCache cache=paving(3);
+		// without cached evaluations
+		CPPUNIT_ASSERT(is_feasible_with_paving(c, cache, box)==flat_is_feasible(c, cache, box));
+		// with cached evaluations
+		cache.update_cache(f, box, true);
+		CPPUNIT_ASSERT(is_feasible_with_paving(c, cache, box)==flat_is_feasible(c, cache, box));
+	}
+}
+
+void TestParameterKdTree::inherited01() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& p=ExprSymbol::new_("p");
+	Function f(x,p,x*p);
+	SIConstraintCache cache(IntervalVector(1,Interval(0,1)));
+
+	cache.update_cache(f, IntervalVector(1,Interval(1,2)));
+	const ParameterEvaluationsCache& cell=cache.parameter_caches_[0];
+	CPPUNIT_ASSERT(cell.is_evaluation_valid());
+	CPPUNIT_ASSERT(cell.evaluation.is_superset(Interval(0,2)));
+
+	cache.update_cache(f, IntervalVector(1,Interval(1,1.5)));
+	CPPUNIT_ASSERT(cell.evaluation.is_subset(Interval(0,2)));
+	CPPUNIT_ASSERT(cell.evaluation.is_superset(Interval(0,1.5)));
+}
+
+void TestParameterKdTree::inherited02() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& p=ExprSymbol::new_("p");
+	Function f(x,p,x*p);
+	SIConstraintCache cache(IntervalVector(1,Interval(0,1)));
+
+	cache.update_cache(f, IntervalVector(1,Interval(1,2)));
+	ParameterEvaluationsCache& cell=cache.parameter_caches_[0];
+
+	// enlarged parameter box (as newton_filter may do)
+	cell.parameter_box=IntervalVector(1,Interval(0,4));
+	CPPUNIT_ASSERT(!cell.is_evaluation_valid());
+
+	cache.update_cache(f, IntervalVector(1,Interval(1,1.5)));
+	CPPUNIT_ASSERT(cell.is_evaluation_valid());
+	CPPUNIT_ASSERT(cell.evaluation.is_superset(Interval(0,6)));
+}
+
+void TestParameterKdTree::inherited03() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& p=ExprSymbol::new_("p");
+	Function f(x,p,x*p-3);
+	SIConstraintCache cache(IntervalVector(1,Interval(0,1)));
+
+	cache.update_cache(f, IntervalVector(1,Interval(1,2)));
+	const ParameterEvaluationsCache& cell=cache.parameter_caches_[0];
+	Interval parent=cell.evaluation;
+	CPPUNIT_ASSERT(parent.ub()<=0);
+
+	cache.update_cache(f, IntervalVector(1,Interval(1,1.5)));
+	CPPUNIT_ASSERT(cell.evaluation==parent);
+	CPPUNIT_ASSERT(cache.eval_cache_==parent);
+}
+
+void TestParameterKdTree::nb_evals01() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& p=ExprSymbol::new_("p",Dim::col_vec(2));
+	Function f(x,p,p[0]+p[1]-x);
+	SIConstraint c(&f, 1);
+
+	IntervalVector box(1,Interval(3,4));
+	SIConstraintCache cache=paving(3);
+	const ParameterKdTree& tree=cache.parameter_tree();
+	CPPUNIT_ASSERT(tree.size()==64);
+
+	int nb_evals=0;
+	auto eval=[&](const IntervalVector& parameter_box) {
+		nb_evals++;
+		return c.evaluate(box, parameter_box);
+	};
+
+	// no valid cached evaluation: the hulls are not evaluated
+	CPPUNIT_ASSERT(tree.is_satisfied(cache, eval, false));
+	CPPUNIT_ASSERT(nb_evals==64);
+
+	nb_evals=0;
+	vector<bool> proven(64,false);
+	tree.find_satisfied(cache, eval, false, proven);
+	CPPUNIT_ASSERT(nb_evals==64);
+
+	// with cached evaluations: no evaluation at all
+	cache.update_cache(f, box, true);
+	nb_evals=0;
+	CPPUNIT_ASSERT(tree.is_satisfied(cache, eval, ParameterKdTree::bounds_valid(cache, box)));
+	CPPUNIT_ASSERT(nb_evals==0);
+}
+
+void TestParameterKdTree::shared01() {
+	SIConstraintCache cache=paving(2);
+	const ParameterKdTree* tree=&cache.parameter_tree();
+
+	SIConstraintCache copy=cache;
+	CPPUNIT_ASSERT(&copy.parameter_tree()==tree);
+
+	bisect_paving(copy);
+	CPPUNIT_ASSERT(&cache.parameter_tree()==tree);
+	CPPUNIT_ASSERT(copy.parameter_tree().size()==64);
+}
+
+} // end namespace ibex
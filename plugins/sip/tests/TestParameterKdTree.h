@@ -0,0 +1,60 @@
+/* ============================================================================
+ * I B E X - ParameterKdTree Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_PARAMETER_KD_TREE_H__
+#define __TEST_PARAMETER_KD_TREE_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestParameterKdTree : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestParameterKdTree);
+	CPPUNIT_TEST(evaluation_filter01);
+	CPPUNIT_TEST(is_feasible01);
+	CPPUNIT_TEST(inherited01);
+	CPPUNIT_TEST(inherited02);
+	CPPUNIT_TEST(inherited03);
+	CPPUNIT_TEST(nb_evals01);
+	CPPUNIT_TEST(shared01);
+	CPPUNIT_TEST_SUITE_END();
+
+	// same boxes removed by evaluation_filter as with a flat loop
+	void evaluation_filter01();
+
+	// same answers of is_feasible_with_paving as with a flat loop
+	void is_feasible01();
+
+	// evaluations intersected in a subbox
+	void inherited01();
+
+	// evaluations not intersected if the parameter box was enlarged
+	void inherited02();
+
+	// evaluations kept as they are if they prove the constraint
+	void inherited03();
+
+	// no more evaluations than parameter boxes without cached evaluations
+	void nb_evals01();
+
+	// the tree is shared by the copies of the cache until the paving changes
+	void shared01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestParameterKdTree);
+
+} // namespace ibex
+
+#endif // __TEST_PARAMETER_KD_TREE_H__
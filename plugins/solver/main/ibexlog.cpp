@@ -0,0 +1,64 @@
+//============================================================================
+//                                  I B E X
+//
+//                               ************
+//                                  IbexLog
+//                               ************
+//
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex.h"
+#include "args.hxx"
+
+using namespace std;
+using namespace ibex;
+
+int main(int argc, char** argv) {
+
+	args::ArgumentParser parser("********* IbexLog *********.", "Summarize a search log (see the --search-log option of ibexsolve/ibexopt).");
+	args::HelpFlag help(parser, "help", "Display this help menu", {'h', "help"});
+	args::Flag records(parser, "records", "Display all the records (one line per node).", {'r',"records"});
+	args::Positional<std::string> filename(parser, "filename", "The name of the search log file.");
+
+	try
+	{
+		parser.ParseCLI(argc, argv);
+	}
+	catch (args::Help&)
+	{
+		std::cout << parser;
+		return 0;
+	}
+	catch (args::ParseError& e)
+	{
+		std::cerr << e.what() << std::endl;
+		std::cerr << parser;
+		return 1;
+	}
+
+	if (filename.Get()=="") {
+		ibex_error("no input file (try ibexlog --help)");
+		exit(1);
+	}
+
+	vector<SearchLog::Record> log;
+	SearchLog::read(filename.Get(), log);
+
+	if (records) {
+		cout << "node\tparent\tdepth\tvar\toutcome\tlog(vol) before\tlog(vol) after\tstart\tduration\tloup\tuplo" << endl;
+		for (vector<SearchLog::Record>::const_iterator it=log.begin(); it!=log.end(); ++it)
+			cout << it->node << '\t' << it->parent << '\t' << it->depth << '\t' << it->var << '\t'
+			     << SearchLog::outcome_name(it->outcome) << '\t' << it->log_volume_before << '\t'
+			     << it->log_volume_after << '\t' << it->start << '\t' << it->duration << '\t'
+			     << it->loup << '\t' << it->uplo << endl;
+		cout << endl;
+	}
+
+	cout << endl << "***************************** log ******************************" << endl;
+	cout << " file:\t\t\t\t" << filename.Get() << endl;
+	SearchLog::report(log, cout);
+	cout << endl;
+}
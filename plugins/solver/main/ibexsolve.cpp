@@ -44,8 +44,21 @@ int main(int argc, char** argv) {
 	args::ValueFlag<string> output_file(parser, "filename", "COV output file. The file will contain the "
 			"description of the manifold with boxes in the COV (binary) format. See --format", {'o',"output"});
 	args::Flag format(parser, "format", "Give a description of the COV format used by IbexSolve", {"format"});
+	args::Flag stream(parser, "stream", "Write the output boxes in the COV output file as and when they are found, "
+			"instead of keeping them in memory until the end. The file is updated periodically and can be loaded at any time.", {"stream"});
+	args::ValueFlag<double> checkpoint(parser, "float", "With --stream: maximal time (in seconds) between two updates of the "
+			"COV output file. Default value is 10.", {"checkpoint"});
 	args::Flag bfs(parser, "bfs", "Perform breadth-first search (instead of depth-first search, by default)", {"bfs"});
+	args::ValueFlag<unsigned int> spill(parser, "int", "Maximal number of pending boxes kept in memory. The other ones are "
+			"written to a temporary file and reloaded when required. Default value is +oo (none).", {"spill"});
 	args::Flag trace(parser, "trace", "Activate trace. \"Solutions\" (output boxes) are displayed as and when they are found.", {"trace"});
+	args::Flag profile(parser, "profile", "Activate profiling. The number of calls, time and average box reduction of each contractor "
+			"and of the bisector are displayed in the report.", {"profile"});
+	args::ValueFlag<string> profile_json(parser, "filename", "Activate profiling and export the counters in JSON in this file.", {"profile-json"});
+	args::ValueFlag<string> search_log_file(parser, "filename", "Record the search tree in this (binary) file: one record per box processed. "
+			"The file can be summarized with ibexlog.", {"search-log"});
+	args::ValueFlag<string> summary_json(parser, "filename", "Export a summary of the run in JSON in this file: status, number of boxes, "
+			"time, number of cells, cells per second, number of evaluations and LP solves, peak memory and time to the first solution.", {"summary-json"});
 	args::ValueFlag<string> boundary_test_arg(parser, "true|full-rank|half-ball|false", "Boundary test strength. Possible values are:\n"
 			"\t\t* true:\talways satisfied. Set by default for under constrained problems (0<m<n).\n"
 			"\t\t* full-rank:\tthe gradients of all constraints (equalities and potentially activated inequalities) must be linearly independent.\n"
@@ -153,12 +166,17 @@ int main(int argc, char** argv) {
 			cout << "  output file:\t\t" << output_manifold_file << "\n";
 		}
 
+		// Profiling counters (if required)
+		Profiler prof;
+		Profiler* profiler=(profile || profile_json)? &prof : NULL;
+
 		// Build the default solver
 		DefaultSolver s(sys,
 				eps_x_min ? eps_x_min.Get() : DefaultSolver::default_eps_x_min,
 				eps_x_max ? eps_x_max.Get() : DefaultSolver::default_eps_x_max,
 				!bfs,
-				random_seed? random_seed.Get() : DefaultSolver::default_random_seed);
+				random_seed? random_seed.Get() : DefaultSolver::default_random_seed,
+				profiler);
 
 		if (boundary_test_arg) {
 
@@ -206,6 +224,13 @@ int main(int argc, char** argv) {
 			}
 		}
 
+		// This option bounds the memory used by pending boxes
+		if (spill) {
+			if (!quiet)
+				cout << "  spill:\t\t" << spill.Get() << " boxes in memory" << endl;
+			s.buffer.set_spill(spill.Get());
+		}
+
 		// This option limits the search time
 		if (timeout) {
 			if (!quiet)
@@ -220,6 +245,26 @@ int main(int argc, char** argv) {
 			s.trace=trace.Get();
 		}
 
+		if (profiler && !quiet) {
+			cout << "  profiling:\t\tON" << endl;
+		}
+
+		// This option writes the output boxes as and when they are found
+		if (stream) {
+			if (!quiet)
+				cout << "  stream:\t\tON" << endl;
+			s.set_stream(output_manifold_file, checkpoint ? checkpoint.Get() : CovSolverDataWriter::default_checkpoint_period);
+		}
+
+		// This option records the search tree
+		SearchLog* search_log=NULL;
+		if (search_log_file) {
+			if (!quiet)
+				cout << "  search log:\t\t" << search_log_file.Get() << endl;
+			search_log=new SearchLog(search_log_file.Get());
+			s.search_log=search_log;
+		}
+
 		if (!quiet) {
 			cout << "*****************************************************************" << endl << endl;
 		}
@@ -237,9 +282,32 @@ int main(int argc, char** argv) {
 
 		if (!quiet) s.report();
 
-		if (sols) cout << s.get_data() << endl;
+		if (stream) {
+			// the boxes are in the file only
+			if (sols) cout << CovSolverData(output_manifold_file.c_str()) << endl;
+		} else {
+			if (sols) cout << s.get_data() << endl;
+
+			s.get_data().save(output_manifold_file.c_str());
+		}
+
+		if (profile_json) {
+			prof.to_json(profile_json.Get());
+			if (!quiet)
+				cout << " profiling data written in " << profile_json.Get() << "\n";
+		}
 
-		s.get_data().save(output_manifold_file.c_str());
+		if (summary_json) {
+			s.summary().to_json(summary_json.Get());
+			if (!quiet)
+				cout << " summary written in " << summary_json.Get() << "\n";
+		}
+
+		if (search_log) {
+			delete search_log;
+			if (!quiet)
+				cout << " search log written in " << search_log_file.Get() << "\n";
+		}
 
 		if (!quiet) {
 			cout << " results written in " << output_manifold_file << "\n";
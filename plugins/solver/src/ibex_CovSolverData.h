@@ -208,6 +208,8 @@ public:
 
 protected:
 	friend class Solver;
+	friend class CovSolverDataWriter;
+	friend class CovSolverDataReader;
 
 	/**
 	 * \brief Load solver data from a COV file.
@@ -0,0 +1,270 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CovSolverDataReader.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_CovSolverDataReader.h"
+#include "ibex_Solver.h"
+
+#include <cstring>
+#include <fstream>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * Sequential reading of the mapped file.
+ */
+class Cursor {
+public:
+	Cursor(const char* data, size_t size) : data(data), size(size), pos(0) { }
+
+	void check(size_t nb_bytes) {
+		if (pos+nb_bytes>size || pos+nb_bytes<pos)
+			ibex_error("[CovSolverDataReader]: unexpected end of file.");
+	}
+
+	uint32_t read_pos_int() {
+		uint32_t x;
+		check(sizeof(x));
+		memcpy(&x, data+pos, sizeof(x)); // may be unaligned
+		pos+=sizeof(x);
+		return x;
+	}
+
+	double read_double() {
+		double x;
+		check(sizeof(x));
+		memcpy(&x, data+pos, sizeof(x));
+		pos+=sizeof(x);
+		return x;
+	}
+
+	string read_string() {
+		size_t len=0;
+		while (true) {
+			check(len+1);
+			if (data[pos+len]=='\0') break;
+			len++;
+		}
+		string s(data+pos, len);
+		pos+=len+1;
+		return s;
+	}
+
+	void skip(size_t nb_bytes) {
+		check(nb_bytes);
+		pos+=nb_bytes;
+	}
+
+	/* read an index of box: indices must be < size and increasing. */
+	uint32_t read_index(size_t nb_boxes, long& prev) {
+		uint32_t j=read_pos_int();
+		if (j>=nb_boxes)
+			ibex_error("[CovSolverDataReader]: invalid box index.");
+		if ((long) j<=prev)
+			ibex_error("[CovSolverDataReader]: indices of boxes are not in increasing order.");
+		prev=j;
+		return j;
+	}
+
+	const char* data;
+	size_t size;
+	size_t pos;
+};
+
+}
+
+CovSolverDataReader::CovSolverDataReader(const char* filename) : n(0), data(NULL), data_size(0), _size(0), boxes(NULL),
+		_nb_eq(0), _nb_ineq(0), _solver_status(Solver::SUCCESS), _time(-1), _nb_cells(0),
+		_nb_solution(0), _nb_boundary(0), _nb_unknown(0), _nb_pending(0) {
+	map(filename);
+	parse();
+}
+
+CovSolverDataReader::~CovSolverDataReader() {
+#ifndef _WIN32
+	if (data) munmap((void*) data, data_size);
+#else
+	delete[] data;
+#endif
+}
+
+void CovSolverDataReader::map(const char* filename) {
+#ifndef _WIN32
+	int fd=open(filename, O_RDONLY);
+	if (fd<0)
+		ibex_error("[CovSolverDataReader]: cannot open input file.");
+
+	struct stat st;
+	if (fstat(fd, &st)!=0 || st.st_size==0) {
+		::close(fd);
+		ibex_error("[CovSolverDataReader]: unexpected end of file.");
+	}
+	data_size=st.st_size;
+
+	void* p=mmap(NULL, data_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd); // the mapping remains valid
+	if (p==MAP_FAILED)
+		ibex_error("[CovSolverDataReader]: cannot map input file.");
+	data=(const char*) p;
+#else
+	ifstream f(filename, ios::in | ios::binary | ios::ate);
+	if (f.fail())
+		ibex_error("[CovSolverDataReader]: cannot open input file.");
+	data_size=f.tellg();
+	char* buf=new char[data_size];
+	f.seekg(0);
+	f.read(buf, data_size);
+	data=buf;
+#endif
+}
+
+void CovSolverDataReader::parse() {
+
+	Cursor c(data, data_size);
+
+	// ---------------- Cov ----------------------
+	c.check(CovSolverData::SIGNATURE_LENGTH);
+	if (memcmp(data, CovSolverData::SIGNATURE, CovSolverData::SIGNATURE_LENGTH)!=0)
+		ibex_error("[CovSolverDataReader]: not an Ibex \"cover\" file.");
+	c.skip(CovSolverData::SIGNATURE_LENGTH);
+
+	size_t level=c.read_pos_int();
+	vector<unsigned int> format_id, format_version;
+	for (size_t i=0; i<=level; i++) format_id.push_back(c.read_pos_int());
+	for (size_t i=0; i<=level; i++) format_version.push_back(c.read_pos_int());
+
+	if (format_version[0]>Cov::FORMAT_VERSION)
+		ibex_error("[CovSolverDataReader] unsupported format version");
+
+	// Number of levels of the file that can be read (0=Cov,...,5=CovSolverData)
+	const unsigned int expected_id[]      = { Cov::subformat_number, CovList::subformat_number, CovIUList::subformat_number,
+			CovIBUList::subformat_number, CovManifold::subformat_number, CovSolverData::subformat_number };
+	const unsigned int expected_version[] = { Cov::FORMAT_VERSION, CovList::FORMAT_VERSION, CovIUList::FORMAT_VERSION,
+			CovIBUList::FORMAT_VERSION, CovManifold::FORMAT_VERSION, CovSolverData::FORMAT_VERSION };
+
+	size_t depth=0;
+	while (depth<=level && depth<=CovSolverData::subformat_level &&
+			format_id[depth]==expected_id[depth] && format_version[depth]==expected_version[depth])
+		depth++;
+
+	if (depth<1) return;
+
+	(size_t&) n = c.read_pos_int();
+
+	// ---------------- CovList ------------------
+	if (depth<2) return;
+
+	_size = c.read_pos_int();
+	if (c.pos % sizeof(double)!=0) // cannot happen (see format)
+		ibex_error("[CovSolverDataReader]: misaligned boxes.");
+	boxes = (const double*) (data+c.pos);
+	c.skip(_size*2*n*sizeof(double));
+
+	_status.resize(_size, CovSolverData::UNKNOWN);
+
+	// ---------------- CovIUList ----------------
+	vector<uint32_t> inner;
+	long prev;
+	if (depth>=3) {
+		size_t nb_inner=c.read_pos_int();
+		prev=-1;
+		for (size_t i=0; i<nb_inner; i++)
+			inner.push_back(c.read_index(_size, prev));
+	}
+
+	// ---------------- CovIBUList ---------------
+	if (depth>=4) {
+		c.read_pos_int(); // boundary type
+		size_t nb_bnd=c.read_pos_int();
+		prev=-1;
+		for (size_t i=0; i<nb_bnd; i++)
+			c.read_index(_size, prev);
+	}
+
+	// ---------------- CovManifold --------------
+	if (depth>=5) {
+		_nb_eq = c.read_pos_int();
+		_nb_ineq = c.read_pos_int();
+		c.read_pos_int(); // boundary type
+
+		// size of a varset in the file
+		size_t varset_size = _nb_eq>0 && _nb_eq<n ? (n-_nb_eq)*sizeof(uint32_t) : 0;
+
+		if (_nb_eq>0) {
+			size_t nb_sol=c.read_pos_int();
+			prev=-1;
+			for (size_t i=0; i<nb_sol; i++) {
+				_status[c.read_index(_size, prev)]=CovSolverData::SOLUTION;
+				c.skip(varset_size + 2*n*sizeof(double)); // varset + unicity box
+			}
+		}
+
+		size_t nb_bnd=c.read_pos_int();
+		prev=-1;
+		for (size_t i=0; i<nb_bnd; i++) {
+			_status[c.read_index(_size, prev)]=CovSolverData::BOUNDARY;
+			c.skip(varset_size);
+		}
+	}
+
+	if (_nb_eq==0) {
+		for (vector<uint32_t>::const_iterator it=inner.begin(); it!=inner.end(); ++it)
+			_status[*it]=CovSolverData::SOLUTION;
+	}
+
+	// ---------------- CovSolverData ------------
+	if (depth>=6) {
+		for (size_t i=0; i<n; i++)
+			_var_names.push_back(c.read_string());
+
+		_solver_status = c.read_pos_int();
+		if (_solver_status>Solver::CELL_OVERFLOW)
+			ibex_error("[CovSolverDataReader]: invalid solver status.");
+
+		_time = c.read_double();
+		_nb_cells = c.read_pos_int();
+
+		size_t nb_pending=c.read_pos_int();
+		prev=-1;
+		for (size_t i=0; i<nb_pending; i++) {
+			uint32_t j=c.read_index(_size, prev);
+			if (_status[j]!=CovSolverData::UNKNOWN)
+				ibex_error("[CovSolverDataReader]: a pending box must be an unknown box.");
+			_status[j]=CovSolverData::PENDING;
+		}
+	}
+
+	for (size_t i=0; i<_size; i++) {
+		switch (_status[i]) {
+		case CovSolverData::SOLUTION: _nb_solution++; break;
+		case CovSolverData::BOUNDARY: _nb_boundary++; break;
+		case CovSolverData::UNKNOWN:  _nb_unknown++;  break;
+		default:                      _nb_pending++;
+		}
+	}
+}
+
+IntervalVector CovSolverDataReader::operator[](size_t i) const {
+	IntervalVector x(n);
+	const double* b=box(i);
+	for (size_t j=0; j<n; j++)
+		x[j]=Interval(b[2*j],b[2*j+1]);
+	return x;
+}
+
+} // namespace ibex
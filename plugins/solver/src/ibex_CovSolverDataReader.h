@@ -0,0 +1,206 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CovSolverDataReader.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_COV_SOLVER_DATA_READER_H__
+#define __IBEX_COV_SOLVER_DATA_READER_H__
+
+#include "ibex_CovSolverData.h"
+
+#include <string>
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup data
+ *
+ * \brief Memory-mapped reader of solver data.
+ *
+ * Unlike CovSolverData(filename), this class does not load the boxes:
+ * the COV file is mapped in memory and the bounds of the ith box are
+ * read directly in the file (the operating system loads the pages on
+ * demand). Only the status of each box is stored in memory.
+ *
+ * Any COV file that can be loaded by CovSolverData is accepted
+ * (in particular, a file produced by CovSolverDataWriter).
+ * The file must not be modified while it is mapped.
+ *
+ * On platforms without mmap (Windows), the file is read at once.
+ */
+class CovSolverDataReader {
+public:
+
+	/**
+	 * \brief Map a COV file.
+	 */
+	CovSolverDataReader(const char* filename);
+
+	/**
+	 * \brief Unmap the file and delete this.
+	 */
+	~CovSolverDataReader();
+
+	/**
+	 * \brief Number of boxes.
+	 */
+	size_t size() const;
+
+	/**
+	 * \brief Bounds of the ith box.
+	 *
+	 * Return a pointer to 2n doubles: lb(x1), ub(x1), ..., lb(xn), ub(xn).
+	 * The pointer is valid until this object is deleted.
+	 */
+	const double* box(size_t i) const;
+
+	/**
+	 * \brief The ith box (copy).
+	 */
+	IntervalVector operator[](size_t i) const;
+
+	/**
+	 * \brief Status of the ith box.
+	 */
+	CovSolverData::BoxStatus status(size_t i) const;
+
+	/**
+	 * \brief Number of solution boxes.
+	 */
+	size_t nb_solution() const;
+
+	/**
+	 * \brief Number of boundary boxes.
+	 */
+	size_t nb_boundary() const;
+
+	/**
+	 * \brief Number of unknown boxes.
+	 */
+	size_t nb_unknown() const;
+
+	/**
+	 * \brief Number of pending boxes.
+	 */
+	size_t nb_pending() const;
+
+	/**
+	 * \brief Number of equalities.
+	 */
+	size_t nb_eq() const;
+
+	/**
+	 * \brief Number of inequalities.
+	 */
+	size_t nb_ineq() const;
+
+	/**
+	 * \brief Names of the variables (empty if not in the file).
+	 */
+	const std::vector<std::string>& var_names() const;
+
+	/**
+	 * \brief Status of the solver (see CovSolverData::solver_status()).
+	 */
+	unsigned int solver_status() const;
+
+	/**
+	 * \brief CPU running time (-1 if not in the file).
+	 */
+	double time() const;
+
+	/**
+	 * \brief Number of cells (0 if not in the file).
+	 */
+	unsigned long nb_cells() const;
+
+	/**
+	 * \brief Number of variables.
+	 */
+	const size_t n;
+
+protected:
+	/* read the file and build the status of boxes */
+	void parse();
+
+	/* map the file */
+	void map(const char* filename);
+
+	const char* data;     // the file
+	size_t data_size;
+
+	size_t _size;
+	const double* boxes;  // the first box in the file
+
+	size_t _nb_eq;
+	size_t _nb_ineq;
+	std::vector<std::string> _var_names;
+	unsigned int _solver_status;
+	double _time;
+	unsigned long _nb_cells;
+
+	std::vector<CovSolverData::BoxStatus> _status;
+	size_t _nb_solution, _nb_boundary, _nb_unknown, _nb_pending;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline size_t CovSolverDataReader::size() const {
+	return _size;
+}
+
+inline const double* CovSolverDataReader::box(size_t i) const {
+	return boxes + 2*n*i;
+}
+
+inline CovSolverData::BoxStatus CovSolverDataReader::status(size_t i) const {
+	return _status[i];
+}
+
+inline size_t CovSolverDataReader::nb_solution() const {
+	return _nb_solution;
+}
+
+inline size_t CovSolverDataReader::nb_boundary() const {
+	return _nb_boundary;
+}
+
+inline size_t CovSolverDataReader::nb_unknown() const {
+	return _nb_unknown;
+}
+
+inline size_t CovSolverDataReader::nb_pending() const {
+	return _nb_pending;
+}
+
+inline size_t CovSolverDataReader::nb_eq() const {
+	return _nb_eq;
+}
+
+inline size_t CovSolverDataReader::nb_ineq() const {
+	return _nb_ineq;
+}
+
+inline const std::vector<std::string>& CovSolverDataReader::var_names() const {
+	return _var_names;
+}
+
+inline unsigned int CovSolverDataReader::solver_status() const {
+	return _solver_status;
+}
+
+inline double CovSolverDataReader::time() const {
+	return _time;
+}
+
+inline unsigned long CovSolverDataReader::nb_cells() const {
+	return _nb_cells;
+}
+
+} // namespace ibex
+
+#endif // __IBEX_COV_SOLVER_DATA_READER_H__
@@ -0,0 +1,274 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CovSolverDataWriter.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_CovSolverDataWriter.h"
+#include "ibex_Solver.h"
+
+#include <cstdio>
+#include <cassert>
+#include <limits>
+
+using namespace std;
+
+namespace ibex {
+
+const double CovSolverDataWriter::default_checkpoint_period = 10;
+
+const size_t CovSolverDataWriter::max_buffer_size = 1<<26; // 64MB
+
+namespace {
+
+// write a vector of integers in one call
+void write_pos_ints(ofstream& f, const vector<uint32_t>& v) {
+	if (!v.empty())
+		f.write((const char*) &v[0], v.size()*sizeof(uint32_t));
+}
+
+}
+
+CovSolverDataWriter::CovSolverDataWriter(const char* filename, size_t n, size_t m, size_t nb_ineq,
+		CovManifold::BoundaryType boundary_type, const vector<string>& var_names, double checkpoint_period) :
+				n(n), m(m), nb_ineq(nb_ineq), boundary_type(boundary_type), checkpoint_period(checkpoint_period),
+				filename(filename), tmp_filename(string(filename)+".tmp"), f(NULL), tmp(NULL),
+				nb_written(0), _last(n>0 ? (int) n : 1), _var_names(var_names),
+				_solver_status(Solver::SUCCESS), _time(-1), _nb_cells(0),
+				_nb_unknown(0), nb_manifold_solution(0), nb_manifold_boundary(0) {
+
+	if (n==0)
+		ibex_error("[CovSolverDataWriter]: null dimension");
+
+	// The file starts as an empty (but valid) COV file.
+	CovSolverData empty(n, m, nb_ineq, boundary_type);
+	empty.var_names() = var_names;
+	empty.var_names().resize(n);
+
+	stack<unsigned int> format_id;
+	stack<unsigned int> format_version;
+	f = CovSolverData::write(filename, empty, format_id, format_version);
+	f->flush();
+
+	// signature + format level + format sequence (id and version) + n
+	count_offset = CovSolverData::SIGNATURE_LENGTH + (2*(CovSolverData::subformat_level+1)+2)*sizeof(uint32_t);
+	footer_offset = count_offset + sizeof(uint32_t);
+
+	if (m>0) {
+		tmp = new fstream(tmp_filename.c_str(), ios::in | ios::out | ios::trunc | ios::binary);
+		if (tmp->fail())
+			ibex_error("[CovSolverDataWriter]: cannot create temporary file.");
+	}
+
+	last_checkpoint = chrono::steady_clock::now();
+}
+
+CovSolverDataWriter::~CovSolverDataWriter() {
+	close();
+}
+
+uint32_t CovSolverDataWriter::push(const IntervalVector& x) {
+	if (!f)
+		ibex_error("[CovSolverDataWriter]: file already closed.");
+
+	if ((size_t) x.size()!=n)
+		ibex_error("[CovSolverDataWriter]: bad box dimension.");
+
+	size_t i=size();
+	if (i>=numeric_limits<uint32_t>::max())
+		ibex_error("[CovSolverDataWriter]: too many boxes.");
+
+	for (size_t j=0; j<n; j++) {
+		buffer.push_back(x[j].lb());
+		buffer.push_back(x[j].ub());
+	}
+	_last = x;
+	return (uint32_t) i;
+}
+
+void CovSolverDataWriter::push_varset(vector<uint32_t>& v, const VarSet& varset) {
+	for (int i=0; i<varset.nb_param; i++)
+		v.push_back(varset.param(i));
+}
+
+void CovSolverDataWriter::check() {
+	if (buffer.size()*sizeof(double) >= max_buffer_size)
+		checkpoint();
+	else if (checkpoint_period>0 &&
+			chrono::duration<double>(chrono::steady_clock::now()-last_checkpoint).count() >= checkpoint_period)
+		checkpoint();
+}
+
+void CovSolverDataWriter::add_inner(const IntervalVector& x) {
+	if (m>0)
+		ibex_error("[CovSolverDataWriter]: inner boxes not allowed with equalities");
+	inner.push_back(push(x));
+	check();
+}
+
+void CovSolverDataWriter::add_unknown(const IntervalVector& x) {
+	push(x);
+	_nb_unknown++;
+	check();
+}
+
+void CovSolverDataWriter::add_boundary(const IntervalVector& x) {
+	if (m>0 && m<n)
+		ibex_error("[CovSolverDataWriter]: a boundary box for an under-constrained system requires \"VarSet\" structure (parameters/variables)");
+
+	uint32_t i=push(x);
+	if (boundary_type==CovManifold::HALF_BALL)
+		ibu_boundary.push_back(i);
+	boundary.push_back(i);
+	nb_manifold_boundary++;
+	check();
+}
+
+void CovSolverDataWriter::add_boundary(const IntervalVector& x, const VarSet& varset) {
+	uint32_t i=push(x);
+	if (boundary_type==CovManifold::HALF_BALL)
+		ibu_boundary.push_back(i);
+	boundary.push_back(i);
+	if (m>0 && m<n)
+		push_varset(boundary, varset);
+	nb_manifold_boundary++;
+	check();
+}
+
+void CovSolverDataWriter::add_solution(const IntervalVector& existence, const IntervalVector& unicity) {
+	if (m<n)
+		ibex_error("[CovSolverDataWriter]: a solution of under-constrained system requires \"VarSet\" structure (parameters/variables)");
+
+	add_solution(existence, unicity, VarSet(n,BitSet::empty(n),false));
+}
+
+void CovSolverDataWriter::add_solution(const IntervalVector& existence, const IntervalVector& unicity, const VarSet& varset) {
+	if (m==0)
+		ibex_error("[CovSolverDataWriter]: solution boxes not allowed without equalities");
+
+	uint32_t i=push(existence);
+	ibu_boundary.push_back(i);
+
+	// the record is exactly what is written in the footer
+	vector<uint32_t> rec(1,i);
+	if (m<n)
+		push_varset(rec, varset);
+	tmp->write((const char*) &rec[0], rec.size()*sizeof(uint32_t));
+
+	vector<double> u;
+	for (size_t j=0; j<n; j++) {
+		u.push_back(unicity[j].lb());
+		u.push_back(unicity[j].ub());
+	}
+	tmp->write((const char*) &u[0], u.size()*sizeof(double));
+
+	nb_manifold_solution++;
+	check();
+}
+
+void CovSolverDataWriter::add_pending(const IntervalVector& x) {
+	pending.push_back(push(x));
+	check();
+}
+
+void CovSolverDataWriter::write_footer() {
+
+	// ---------------- CovIUList ----------------
+	CovSolverData::write_pos_int(*f, inner.size());
+	write_pos_ints(*f, inner);
+
+	// ---------------- CovIBUList ---------------
+	CovSolverData::write_pos_int(*f, 1); // INNER_AND_OUTER_PT (see CovManifold)
+	CovSolverData::write_pos_int(*f, ibu_boundary.size());
+	write_pos_ints(*f, ibu_boundary);
+
+	// ---------------- CovManifold --------------
+	CovSolverData::write_pos_int(*f, m);
+	CovSolverData::write_pos_int(*f, nb_ineq);
+
+	switch(boundary_type) {
+	case CovManifold::EQU_ONLY  : CovSolverData::write_pos_int(*f, 0); break;
+	case CovManifold::FULL_RANK : CovSolverData::write_pos_int(*f, 1); break;
+	case CovManifold::HALF_BALL : CovSolverData::write_pos_int(*f, 2); break;
+	default                     : assert(false);
+	}
+
+	if (m>0) {
+		CovSolverData::write_pos_int(*f, nb_manifold_solution);
+
+		// copy the records of solutions
+		tmp->flush();
+		streamsize nb_bytes=tmp->tellp();
+		tmp->seekg(0);
+		vector<char> chunk(1<<20);
+		while (nb_bytes>0) {
+			streamsize k=std::min(nb_bytes, (streamsize) chunk.size());
+			tmp->read(&chunk[0], k);
+			f->write(&chunk[0], k);
+			nb_bytes-=k;
+		}
+		if (tmp->fail())
+			ibex_error("[CovSolverDataWriter]: cannot read temporary file.");
+		tmp->seekp(0, ios::end);
+	}
+
+	CovSolverData::write_pos_int(*f, nb_manifold_boundary);
+	write_pos_ints(*f, boundary);
+
+	// ---------------- CovSolverData ------------
+	vector<string> names(_var_names);
+	names.resize(n);
+	CovSolverData::write_vars(*f, names);
+	CovSolverData::write_pos_int(*f, _solver_status);
+	CovSolverData::write_double(*f, _time);
+	CovSolverData::write_pos_int(*f, _nb_cells);
+	CovSolverData::write_pos_int(*f, pending.size());
+	write_pos_ints(*f, pending);
+}
+
+void CovSolverDataWriter::checkpoint() {
+	if (!f) return;
+
+	// 1- boxes (they overwrite the previous footer)
+	f->seekp(footer_offset);
+	if (!buffer.empty()) {
+		f->write((const char*) &buffer[0], buffer.size()*sizeof(double));
+		footer_offset += buffer.size()*sizeof(double);
+		nb_written += buffer.size()/(2*n);
+		buffer.clear();
+	}
+
+	// 2- footer
+	write_footer();
+	f->flush();
+
+	// 3- header
+	f->seekp(count_offset);
+	CovSolverData::write_pos_int(*f, nb_written);
+	f->flush();
+
+	if (f->fail())
+		ibex_error("[CovSolverDataWriter]: cannot write output file.");
+
+	last_checkpoint = chrono::steady_clock::now();
+}
+
+void CovSolverDataWriter::close() {
+	if (!f) return;
+
+	checkpoint();
+	f->close();
+	delete f;
+	f=NULL;
+
+	if (tmp) {
+		tmp->close();
+		delete tmp;
+		tmp=NULL;
+		remove(tmp_filename.c_str());
+	}
+}
+
+} // namespace ibex
@@ -0,0 +1,291 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CovSolverDataWriter.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_COV_SOLVER_DATA_WRITER_H__
+#define __IBEX_COV_SOLVER_DATA_WRITER_H__
+
+#include "ibex_CovSolverData.h"
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include <chrono>
+
+namespace ibex {
+
+/**
+ * \ingroup data
+ *
+ * \brief Streaming writer of solver data.
+ *
+ * This class produces the same COV file as CovSolverData::save(...)
+ * but boxes are appended to the file as they are produced instead of
+ * being stored in memory.
+ *
+ * Boxes are buffered and written at each "checkpoint", together with
+ * the header and the footer (indices of solution/boundary/pending boxes,
+ * unicity boxes, etc.). A checkpoint occurs when the buffer is full or
+ * when the checkpoint period has elapsed. The file is a valid COV file
+ * after each checkpoint (and in particular at the very beginning):
+ * if the process is killed, only the boxes found since the last checkpoint
+ * are lost (unless it is killed during the checkpoint itself).
+ *
+ * The only information kept in memory is the indices of the boxes
+ * (4 bytes per solution/boundary/pending box) and the parameters of
+ * under-constrained boundary boxes. Unicity boxes of solutions are
+ * spilled in a temporary file (with suffix ".tmp") removed when the
+ * writer is closed.
+ *
+ * The file can be loaded with CovSolverData(filename) or mapped with
+ * CovSolverDataReader.
+ */
+class CovSolverDataWriter {
+public:
+
+	/**
+	 * \brief Create an (empty) COV file.
+	 *
+	 * \param filename          - COV output file
+	 * \param n                 - number of variables
+	 * \param m                 - number of equalities
+	 * \param nb_ineq           - number of inequalities
+	 * \param boundary_type     - see #ibex::CovManifold
+	 * \param var_names         - names of the variables (empty names by default)
+	 * \param checkpoint_period - maximal time (in seconds) between two checkpoints.
+	 *                            A non-positive value means that checkpoints only
+	 *                            occur when the buffer is full.
+	 */
+	CovSolverDataWriter(const char* filename, size_t n, size_t m, size_t nb_ineq=0,
+			CovManifold::BoundaryType boundary_type=CovManifold::EQU_ONLY,
+			const std::vector<std::string>& var_names=std::vector<std::string>(),
+			double checkpoint_period=default_checkpoint_period);
+
+	/**
+	 * \brief Close the file (if not closed yet) and delete this.
+	 */
+	~CovSolverDataWriter();
+
+	/**
+	 * \brief Add a new 'solution' box (m=0).
+	 */
+	void add_inner(const IntervalVector& x);
+
+	/**
+	 * \brief Add a new 'unknown' box.
+	 */
+	void add_unknown(const IntervalVector& x);
+
+	/**
+	 * \brief Add a new 'boundary' box (m=0 or m=n).
+	 */
+	void add_boundary(const IntervalVector& x);
+
+	/**
+	 * \brief Add a new 'boundary' box.
+	 */
+	void add_boundary(const IntervalVector& x, const VarSet& varset);
+
+	/**
+	 * \brief Add a new 'solution' box (m=n).
+	 */
+	void add_solution(const IntervalVector& existence, const IntervalVector& unicity);
+
+	/**
+	 * \brief Add a new 'solution' box.
+	 */
+	void add_solution(const IntervalVector& existence, const IntervalVector& unicity, const VarSet& varset);
+
+	/**
+	 * \brief Add a new 'pending' box.
+	 */
+	void add_pending(const IntervalVector& x);
+
+	/**
+	 * \brief The last box added.
+	 */
+	const IntervalVector& last() const;
+
+	/**
+	 * \brief Names of the variables.
+	 */
+	std::vector<std::string>& var_names();
+
+	/**
+	 * \brief Set the status of the solver.
+	 */
+	void set_solver_status(unsigned int status);
+
+	/**
+	 * \brief Set the CPU running time.
+	 */
+	void set_time(double time);
+
+	/**
+	 * \brief Set the number of cells.
+	 */
+	void set_nb_cells(unsigned long nb_cells);
+
+	/**
+	 * \brief Write the buffered boxes, the footer and the header.
+	 */
+	void checkpoint();
+
+	/**
+	 * \brief Last checkpoint and close the file.
+	 *
+	 * Boxes cannot be added anymore but the counters below
+	 * are still available.
+	 */
+	void close();
+
+	/**
+	 * \brief Number of boxes.
+	 */
+	size_t size() const;
+
+	/**
+	 * \brief Number of solution boxes (inner boxes if m=0).
+	 */
+	size_t nb_solution() const;
+
+	/**
+	 * \brief Number of boundary boxes.
+	 */
+	size_t nb_boundary() const;
+
+	/**
+	 * \brief Number of unknown boxes.
+	 */
+	size_t nb_unknown() const;
+
+	/**
+	 * \brief Number of pending boxes.
+	 */
+	size_t nb_pending() const;
+
+	/**
+	 * \brief Default checkpoint period (10s).
+	 */
+	static const double default_checkpoint_period;
+
+	/**
+	 * \brief Maximal size of the buffer of boxes (in bytes).
+	 */
+	static const size_t max_buffer_size;
+
+	/**
+	 * \brief Number of variables.
+	 */
+	const size_t n;
+
+	/**
+	 * \brief Number of equalities.
+	 */
+	const size_t m;
+
+	/**
+	 * \brief Number of inequalities.
+	 */
+	const size_t nb_ineq;
+
+	/**
+	 * \brief Boundary type.
+	 */
+	const CovManifold::BoundaryType boundary_type;
+
+	/**
+	 * \brief Maximal time (in seconds) between two checkpoints.
+	 */
+	const double checkpoint_period;
+
+protected:
+	/* push a box in the buffer and return its index */
+	uint32_t push(const IntervalVector& x);
+
+	/* push the parameters of a varset in a vector */
+	void push_varset(std::vector<uint32_t>& v, const VarSet& varset);
+
+	/* checkpoint if the buffer is full or if the period has elapsed */
+	void check();
+
+	void write_footer();
+
+	std::string filename;
+	std::string tmp_filename;
+
+	std::ofstream* f;      // the COV file
+	std::fstream* tmp;     // the file of unicity boxes
+
+	std::streamoff count_offset;   // position of the number of boxes
+	std::streamoff footer_offset;  // position of the footer
+
+	size_t nb_written;             // number of boxes written
+	std::vector<double> buffer;    // boxes not written yet
+	IntervalVector _last;
+
+	std::vector<std::string> _var_names;
+	unsigned int _solver_status;
+	double _time;
+	unsigned long _nb_cells;
+
+	size_t _nb_unknown;
+	std::vector<uint32_t> inner;         // CovIUList inner boxes
+	std::vector<uint32_t> ibu_boundary;  // CovIBUList boundary boxes
+	size_t nb_manifold_solution;         // CovManifold solutions (m>0), in the tmp file
+	size_t nb_manifold_boundary;         // CovManifold boundary boxes
+	std::vector<uint32_t> boundary;      // CovManifold boundary records (index+varset)
+	std::vector<uint32_t> pending;       // CovSolverData pending boxes
+
+	std::chrono::steady_clock::time_point last_checkpoint;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline const IntervalVector& CovSolverDataWriter::last() const {
+	return _last;
+}
+
+inline std::vector<std::string>& CovSolverDataWriter::var_names() {
+	return _var_names;
+}
+
+inline void CovSolverDataWriter::set_solver_status(unsigned int status) {
+	_solver_status = status;
+}
+
+inline void CovSolverDataWriter::set_time(double time) {
+	_time = time;
+}
+
+inline void CovSolverDataWriter::set_nb_cells(unsigned long nb_cells) {
+	_nb_cells = nb_cells;
+}
+
+inline size_t CovSolverDataWriter::size() const {
+	return nb_written + buffer.size()/(2*n);
+}
+
+inline size_t CovSolverDataWriter::nb_solution() const {
+	return m==0 ? inner.size() : nb_manifold_solution;
+}
+
+inline size_t CovSolverDataWriter::nb_boundary() const {
+	return nb_manifold_boundary;
+}
+
+inline size_t CovSolverDataWriter::nb_unknown() const {
+	return _nb_unknown;
+}
+
+inline size_t CovSolverDataWriter::nb_pending() const {
+	return pending.size();
+}
+
+} // namespace ibex
+
+#endif // __IBEX_COV_SOLVER_DATA_WRITER_H__
@@ -23,6 +23,8 @@
 #include "ibex_Array.h"
 #include "ibex_Random.h"
 #include "ibex_NormalizedSystem.h"
+#include "ibex_CtcProfiler.h"
+#include "ibex_BscProfiler.h"
 
 using namespace std;
 
@@ -66,57 +68,69 @@ System* get_square_eq_sys(Memory& memory, System& sys) {
 	return x;
 }*/
 
-Ctc* DefaultSolver::ctc (System& sys, double prec) {
+Ctc* DefaultSolver::ctc (System& sys, double prec, Profiler* profiler) {
 	Array<Ctc> ctc_list(4);
 
 	// first contractor : non incremental hc4
-	ctc_list.set_ref(0, rec(new CtcHC4 (sys.ctrs,0.01)));
+	ctc_list.set_ref(0, profiled(rec(new CtcHC4 (sys.ctrs,0.01)), profiler, "hc4"));
 	// second contractor : acid (hc4)
-	ctc_list.set_ref(1, rec(new CtcAcid (sys, rec(new CtcHC4 (sys.ctrs,0.1,true)))));
+	ctc_list.set_ref(1, profiled(rec(new CtcAcid (sys, profiled(rec(new CtcHC4 (sys.ctrs,0.1,true)), profiler, "acid/hc4"))), profiler, "acid"));
 	int index=2;
 	// if the system is a square system of equations, the third contractor is Newton
 	System* eqs=get_square_eq_sys(*this, sys);
 	if (eqs) {
-		ctc_list.set_ref(index,rec(new CtcNewton(eqs->f_ctrs,5e8,prec,1.e-4)));
+		ctc_list.set_ref(index,profiled(rec(new CtcNewton(eqs->f_ctrs,5e8,prec,1.e-4)), profiler, "newton"));
 		index++;
 	}
 
 	//System& norm_sys=rec(new NormalizedSystem(sys));
 
-	ctc_list.set_ref(index,rec(new CtcFixPoint(rec(new CtcCompo(
-			rec(new CtcPolytopeHull(rec(new LinearizerXTaylor(sys, LinearizerXTaylor::RELAX, LinearizerXTaylor::RANDOM_OPP, LinearizerXTaylor::HANSEN)))),
-			rec(new CtcHC4 (sys.ctrs,0.01)))))));
+	ctc_list.set_ref(index,profiled(rec(new CtcFixPoint(rec(new CtcCompo(
+			profiled(rec(new CtcPolytopeHull(rec(new LinearizerXTaylor(sys, LinearizerXTaylor::RELAX, LinearizerXTaylor::RANDOM_OPP, LinearizerXTaylor::HANSEN)))), profiler, "fixpoint/polytope hull"),
+			profiled(rec(new CtcHC4 (sys.ctrs,0.01)), profiler, "fixpoint/hc4"))))), profiler, "fixpoint"));
 
 	ctc_list.resize(index+1); // in case the system is not square.
 
 	return new CtcCompo (ctc_list);
 }
 
+Ctc& DefaultSolver::profiled(Ctc& ctc, Profiler* profiler, const char* name) {
+	if (profiler) return rec(new CtcProfiler(ctc, *profiler, name));
+	else return ctc;
+}
+
+Bsc& DefaultSolver::profiled(Bsc& bsc, Profiler* profiler) {
+	if (profiler) return rec(new BscProfiler(bsc, *profiler));
+	else return bsc;
+}
+
 DefaultSolver::DefaultSolver(System& sys, double eps_x_min, double eps_x_max,
-		bool dfs, double random_seed) : Solver(sys, rec(ctc(sys,eps_x_min)),
-		get_square_eq_sys(*this, sys)!=NULL?
+		bool dfs, double random_seed, Profiler* profiler) : Solver(sys, profiled(rec(ctc(sys,eps_x_min,profiler)), profiler, "contractor"),
+		profiled(get_square_eq_sys(*this, sys)!=NULL?
 				(Bsc&) rec(new SmearSumRelative(*get_square_eq_sys(*this, sys), eps_x_min)) :
-				(Bsc&) rec(new RoundRobin(eps_x_min)),
+				(Bsc&) rec(new RoundRobin(eps_x_min)), profiler),
 				rec(dfs? (CellBuffer*) new CellStack() : (CellBuffer*) new CellList()),
 				Vector(sys.nb_var,eps_x_min), Vector(sys.nb_var,eps_x_max)),
 		sys(sys) {
 
 	RNG::srand(random_seed);
 
+	this->profiler=profiler;
 }
 
 // Note: we set the precision for Newton to the minimum of the precisions.
 DefaultSolver::DefaultSolver(System& sys, const Vector& eps_x_min, double eps_x_max,
-		bool dfs, double random_seed) : Solver(sys, rec(ctc(sys,eps_x_min.min())),
-		get_square_eq_sys(*this, sys)!=NULL?
+		bool dfs, double random_seed, Profiler* profiler) : Solver(sys, profiled(rec(ctc(sys,eps_x_min.min(),profiler)), profiler, "contractor"),
+		profiled(get_square_eq_sys(*this, sys)!=NULL?
 				(Bsc&) rec(new SmearSumRelative(*get_square_eq_sys(*this, sys), eps_x_min)) :
-				(Bsc&) rec(new RoundRobin(eps_x_min)),
+				(Bsc&) rec(new RoundRobin(eps_x_min)), profiler),
 		rec(dfs? (CellBuffer*) new CellStack() : (CellBuffer*) new CellList()),
 		eps_x_min, Vector(sys.nb_var,eps_x_max)),
 		sys(sys) {
 
 	RNG::srand(random_seed);
 
+	this->profiler=profiler;
 }
 
 } // end namespace ibex
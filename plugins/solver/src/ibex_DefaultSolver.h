@@ -33,8 +33,11 @@ public:
 	 * \param eps_x_min - Criterion for stopping bisection (absolute precision)
 	 * \param eps_x_max - Criterion for forcing bisection  (absolute precision)
 	 * \param dfs       - true: depth-first search. false: breadth-first search
+	 * \param profiler  - If not NULL, the contractors and the bisector are profiled
+	 *                    with this profiler (see #Solver::profiler).
 	 */
-    DefaultSolver(System& sys, double eps_x_min=default_eps_x_min, double eps_x_max=default_eps_x_max, bool dfs=true, double random_seed=default_random_seed);
+    DefaultSolver(System& sys, double eps_x_min=default_eps_x_min, double eps_x_max=default_eps_x_max, bool dfs=true, double random_seed=default_random_seed,
+    		Profiler* profiler=NULL);
 
     /**
 	 * \brief Create a default solver.
@@ -44,8 +47,11 @@ public:
 	 *                    precisions, one for each variable)
 	 * \param eps_x_max - Criterion for forcing bisection  (absolute precision)
 	 * \param dfs       - true: depth-first search. false: breadth-first search
+	 * \param profiler  - If not NULL, the contractors and the bisector are profiled
+	 *                    with this profiler (see #Solver::profiler).
 	 */
-    DefaultSolver(System& sys, const Vector& eps_x_min, double eps_x_max=default_eps_x_max, bool dfs=true, double random_seed=default_random_seed);
+    DefaultSolver(System& sys, const Vector& eps_x_min, double eps_x_max=default_eps_x_max, bool dfs=true, double random_seed=default_random_seed,
+    		Profiler* profiler=NULL);
 
 	/**
 	 * \brief Default minimal width: 1e-6.
@@ -73,7 +79,13 @@ private:
 	/**
 	 * The contractor: hc4 + acid(hc4) + newton (if the system is square) + xnewton
 	 */
-	Ctc* ctc(System& sys, double prec);
+	Ctc* ctc(System& sys, double prec, Profiler* profiler);
+
+	/**
+	 * Wrap an operator with its profiling wrapper (if profiler is not NULL).
+	 */
+	Ctc& profiled(Ctc& ctc, Profiler* profiler, const char* name);
+	Bsc& profiled(Bsc& bsc, Profiler* profiler);
 
 //	std::vector<CtcXNewton::corner_point>* default_corners ();
 
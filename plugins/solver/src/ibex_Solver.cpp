@@ -22,15 +22,36 @@ namespace ibex {
 
 namespace {
 	class EmptyBoxException : Exception { };
+
+	// outcome of a box in the search log
+	SearchLog::Outcome log_outcome(CovSolverData::BoxStatus status) {
+		switch (status) {
+		case CovSolverData::BOUNDARY: return SearchLog::BOUNDARY;
+		case CovSolverData::UNKNOWN:  return SearchLog::UNKNOWN;
+		default:                      return SearchLog::SOLUTION;
+		}
+	}
+
+	const char* status_name(Solver::Status status) {
+		switch (status) {
+		case Solver::SUCCESS:           return "SUCCESS";
+		case Solver::INFEASIBLE:        return "INFEASIBLE";
+		case Solver::NOT_ALL_VALIDATED: return "NOT_ALL_VALIDATED";
+		case Solver::TIME_OUT:          return "TIME_OUT";
+		default:                        return "CELL_OVERFLOW";
+		}
+	}
 }
 
 Solver::Solver(const System& sys, Ctc& ctc, Bsc& bsc, CellBuffer& buffer,
 		const Vector& eps_x_min, const Vector& eps_x_max) :
 		  ctc(ctc), bsc(bsc), buffer(buffer), eps_x_min(eps_x_min), eps_x_max(eps_x_max),
-		  boundary_test(ALL_TRUE), time_limit(-1), cell_limit(-1), trace(0),
+		  boundary_test(ALL_TRUE), time_limit(-1), cell_limit(-1), trace(0), profiler(NULL), search_log(NULL),
 		  solve_init_box(sys.box), eqs(NULL), ineqs(NULL),
 		  params(sys.nb_var,BitSet::empty(sys.nb_var),false) /* no forced parameter by default */,
-		  manif(NULL), time(0), nb_cells(0) {
+		  manif(NULL), stream_checkpoint_period(CovSolverDataWriter::default_checkpoint_period), stream(NULL),
+		  time(0), nb_cells(0), time_first_solution(-1),
+		  nb_evals_start(0), nb_lp_solves_start(0), nb_evals(0), nb_lp_solves(0) {
 
 	assert(sys.box.size()==ctc.nb_var);
 
@@ -67,6 +88,20 @@ void Solver::set_params(const VarSet& _params) {
 	params=_params;
 }
 
+void Solver::set_stream(const string& filename, double checkpoint_period) {
+	stream_filename=filename;
+	stream_checkpoint_period=checkpoint_period;
+}
+
+void Solver::open_stream() {
+	if (stream) delete stream; // close the file of the previous search
+
+	if (stream_filename.empty())
+		stream=NULL;
+	else
+		stream=new CovSolverDataWriter(stream_filename.c_str(), n, m, nb_ineq, CovManifold::EQU_ONLY, manif->var_names(), stream_checkpoint_period);
+}
+
 Solver::~Solver() {
 	if (ineqs) {
 		delete ineqs;
@@ -76,6 +111,8 @@ Solver::~Solver() {
 	}
 
 	if (manif) delete manif;
+
+	if (stream) delete stream;
 }
 
 void Solver::start(const IntervalVector& init_box) {
@@ -86,6 +123,8 @@ void Solver::start(const IntervalVector& init_box) {
 
 	manif = new CovSolverData(n, m, nb_ineq, CovManifold::EQU_ONLY, eqs? eqs->var_names() : ineqs->var_names());
 
+	open_stream();
+
 	Cell* root=new Cell(init_box);
 
 	// add data required by the bisector
@@ -96,6 +135,12 @@ void Solver::start(const IntervalVector& init_box) {
 
 	buffer.add_property(init_box, root->prop);
 
+	// number the nodes of the search tree
+	if (search_log) search_log->add_property(root->prop);
+
+	// all the properties must be storable if cells are spilled to disk
+	buffer.check_spill(root->prop);
+
 	buffer.push(root);
 
 	time = 0;
@@ -104,6 +149,10 @@ void Solver::start(const IntervalVector& init_box) {
 	nb_cells = 1;
 	manif->set_nb_cells(0);
 
+	time_first_solution = -1;
+	nb_evals_start = RunSummary::nb_evals();
+	nb_lp_solves_start = RunSummary::nb_lp_solves();
+
 	timer.restart();
 }
 
@@ -117,18 +166,17 @@ void Solver::start(const CovSolverData& data) {
 	// not calculated with the same Minibex file.
 	manif->var_names() = eqs? eqs->var_names() : ineqs->var_names();
 
+	open_stream();
+
 	// just copy inner, solution and boundary boxes
 	for (size_t i=0; i<data.nb_inner(); i++)
-		manif->add_inner(data.inner(i));
+		add_inner(data.inner(i));
 
 	for (size_t i=0; i<data.nb_solution(); i++)
-		if (m==n)
-			manif->add_solution(data.solution(i), data.unicity(i));
-		else
-			manif->add_solution(data.solution(i), data.unicity(i), data.solution_varset(i));
+		add_solution(data.solution(i), data.unicity(i), data.solution_varset(i));
 
 	for (size_t i=0; i<data.nb_boundary(); i++)
-		manif->add_boundary(data.boundary(i), data.boundary_varset(i));
+		add_boundary(data.boundary(i), data.boundary_varset(i));
 
 	// the unknown and pending boxes have to be processed
 	for (size_t i=0; i<data.CovManifold::nb_unknown(); i++) {
@@ -146,6 +194,11 @@ void Solver::start(const CovSolverData& data) {
 		// add data required by the contractor
 		ctc.add_property(box, cell->prop);
 
+		// number the nodes of the search tree
+		if (search_log) search_log->add_property(cell->prop);
+
+		buffer.check_spill(cell->prop);
+
 		buffer.push(cell);
 
 	}
@@ -156,6 +209,10 @@ void Solver::start(const CovSolverData& data) {
 	nb_cells=0; // no new cell created!
 	manif->set_nb_cells(data.nb_cells());
 
+	time_first_solution = -1;
+	nb_evals_start = RunSummary::nb_evals();
+	nb_lp_solves_start = RunSummary::nb_lp_solves();
+
 	timer.restart();
 }
 
@@ -183,6 +240,8 @@ bool Solver::next(CovSolverData::BoxStatus& status, const IntervalVector** sol)
 
 		Cell* c=buffer.top();
 
+		if (search_log) search_log->begin(*c);
+
 		ContractContext context(c->prop);
 
 		int v=c->bisected_var; // last bisected var.
@@ -202,8 +261,9 @@ bool Solver::next(CovSolverData::BoxStatus& status, const IntervalVector** sol)
 				// note: cannot return PENDING status
 				status=check_sol(c->box);
 				if (status!=CovSolverData::UNKNOWN) { // <=> solution or boundary
+					if (search_log) search_log->end(*c, log_outcome(status));
 					delete buffer.pop();
-					if (sol) *sol=&(*manif)[manif->size()-1];
+					if (sol) *sol=&last_box();
 					return true;
 				} // otherwise: continue search...
 			} // else: otherwise: continue search...
@@ -215,6 +275,10 @@ bool Solver::next(CovSolverData::BoxStatus& status, const IntervalVector** sol)
 				// next line may also throw NoBisectableVariableException
 				pair<Cell*,Cell*> new_cells=bsc.bisect(*c);
 
+				if (search_log) {
+					search_log->bisected(*c, *new_cells.first, *new_cells.second);
+					search_log->end(*c, SearchLog::BISECTED);
+				}
 				delete buffer.pop();
 				buffer.push(new_cells.first);
 				buffer.push(new_cells.second);
@@ -230,14 +294,16 @@ bool Solver::next(CovSolverData::BoxStatus& status, const IntervalVector** sol)
 				status=check_sol(c->box);
 				if (status==CovSolverData::UNKNOWN) {
 					if (trace >=1) cout << " [unknown] " << c->box << endl;
-					manif->add_unknown(c->box);
+					add_unknown(c->box);
 				}
+				if (search_log) search_log->end(*c, log_outcome(status));
 				delete buffer.pop();
-				if (sol) *sol=&(*manif)[manif->size()-1];
+				if (sol) *sol=&last_box();
 				return true;
 			}
 		}
 		catch (EmptyBoxException&) {
+			if (search_log) search_log->end(*c, SearchLog::EMPTY);
 			delete buffer.pop();
 			//impact.remove(v); // note: in case of the root node, we should clear the bitset
 			// instead but since the search is over, the impact is not used anymore.
@@ -271,7 +337,8 @@ Solver::Status Solver::solve() {
 	Solver::Status final_status;
 
 	// initialization...
-	if (manif->nb_inner()==0 && manif->nb_solution()==0 && manif->nb_boundary()==0)
+	if (stream? (stream->nb_solution()==0 && stream->nb_boundary()==0) :
+			(manif->nb_inner()==0 && manif->nb_solution()==0 && manif->nb_boundary()==0))
 		final_status = INFEASIBLE;
 	else
 		final_status = SUCCESS;
@@ -285,6 +352,8 @@ Solver::Status Solver::solve() {
 
 			if (status==CovSolverData::UNKNOWN)
 				final_status=NOT_ALL_VALIDATED;
+			else if (time_first_solution<0)
+				time_first_solution=timer.get_time();
 		}
 	} catch(CellLimitException&) {
 		final_status=CELL_OVERFLOW;
@@ -301,6 +370,18 @@ Solver::Status Solver::solve() {
 
 	manif->set_nb_cells(manif->nb_cells() + nb_cells);
 
+	if (stream) {
+		stream->set_solver_status(final_status);
+		stream->set_time(manif->time());
+		stream->set_nb_cells(manif->nb_cells());
+		stream->close();
+	}
+
+	nb_evals = RunSummary::nb_evals() - nb_evals_start;
+	nb_lp_solves = RunSummary::nb_lp_solves() - nb_lp_solves_start;
+
+	if (search_log) search_log->flush();
+
 	return final_status;
 }
 
@@ -334,10 +415,10 @@ CovSolverData::BoxStatus Solver::check_sol(const IntervalVector& box) {
 	if (!eqs) {
 		if (check_ineq(box)) {
 			if (trace >=1) cout << " [solution] " << box << endl;
-			manif->add_inner(box);
+			add_inner(box);
 			return CovSolverData::SOLUTION;
 		} else if (is_boundary(box)) {
-			manif->add_boundary(box);
+			add_boundary(box);
 			return CovSolverData::BOUNDARY;
 		} else
 			return CovSolverData::UNKNOWN;
@@ -401,12 +482,12 @@ CovSolverData::BoxStatus Solver::check_sol(const IntervalVector& box) {
 
 		if (solution) {
 			if (trace >=1) cout << " [solution] " << existence << endl;
-			manif->add_solution(existence, unicity, varset);
+			add_solution(existence, unicity, varset);
 			return CovSolverData::SOLUTION;
 		} else {
 			if (is_boundary(existence)) {
 				if (trace >=1) cout << " [boundary] " << existence << endl;
-				manif->add_boundary(existence, varset);
+				add_boundary(existence, varset);
 				return CovSolverData::BOUNDARY;
 			} else
 				return CovSolverData::UNKNOWN;
@@ -475,11 +556,39 @@ void Solver::flush() {
 	while (!buffer.empty()) {
 		Cell* cell=buffer.top();
 		if (trace >=1) cout << " [pending] " << cell->box << endl;
-		manif->add_pending(cell->box);
+		add_pending(cell->box);
 		delete buffer.pop();
 	}
 }
 
+void Solver::add_inner(const IntervalVector& box) {
+	if (stream) stream->add_inner(box); else manif->add_inner(box);
+}
+
+void Solver::add_boundary(const IntervalVector& box) {
+	if (stream) stream->add_boundary(box); else manif->add_boundary(box);
+}
+
+void Solver::add_boundary(const IntervalVector& box, const VarSet& varset) {
+	if (stream) stream->add_boundary(box, varset); else manif->add_boundary(box, varset);
+}
+
+void Solver::add_unknown(const IntervalVector& box) {
+	if (stream) stream->add_unknown(box); else manif->add_unknown(box);
+}
+
+void Solver::add_solution(const IntervalVector& existence, const IntervalVector& unicity, const VarSet& varset) {
+	if (stream) stream->add_solution(existence, unicity, varset); else manif->add_solution(existence, unicity, varset);
+}
+
+void Solver::add_pending(const IntervalVector& box) {
+	if (stream) stream->add_pending(box); else manif->add_pending(box);
+}
+
+const IntervalVector& Solver::last_box() const {
+	return stream ? stream->last() : (*manif)[manif->size()-1];
+}
+
 namespace {
 const char* green() {
 #ifndef _WIN32
@@ -506,6 +615,21 @@ const char* white() {
 }
 
 }
+RunSummary Solver::summary() const {
+	if (!manif) ibex_error("[Solver] no data (run solver first)");
+
+	RunSummary s;
+	s.add_string("status", status_name((Status) manif->solver_status()));
+	s.add_int("nb_solution", stream ? stream->nb_solution() : manif->nb_solution());
+	s.add_int("nb_boundary", stream ? stream->nb_boundary() : manif->nb_boundary());
+	s.add_int("nb_unknown", stream ? stream->nb_unknown() : manif->nb_unknown());
+	s.add_int("nb_pending", stream ? stream->nb_pending() : manif->nb_pending());
+	s.add_search(time, nb_cells, nb_evals, nb_lp_solves);
+	// unreached event exported as null
+	s.add_real("time_first_solution", time_first_solution>=0 ? time_first_solution : NAN);
+	return s;
+}
+
 void Solver::report() {
 
 	switch ((Status) manif->solver_status()) {
@@ -527,17 +651,22 @@ void Solver::report() {
 
 	cout << white() << endl;
 
+	size_t nb_solution = stream ? stream->nb_solution() : manif->nb_solution();
+	size_t nb_boundary = stream ? stream->nb_boundary() : manif->nb_boundary();
+	size_t nb_unknown  = stream ? stream->nb_unknown()  : manif->nb_unknown();
+	size_t nb_pending  = stream ? stream->nb_pending()  : manif->nb_pending();
+
 	cout << " number of solution boxes:\t";
-	if (manif->nb_solution()==0) cout << "--"; else cout << manif->nb_solution();
+	if (nb_solution==0) cout << "--"; else cout << nb_solution;
 	cout << endl;
 	cout << " number of boundary boxes:\t";
-	if (manif->nb_boundary()==0) cout << "--"; else cout << manif->nb_boundary();
+	if (nb_boundary==0) cout << "--"; else cout << nb_boundary;
 	cout << endl;
 	cout << " number of unknown boxes:\t";
-	if (manif->nb_unknown()==0) cout << "--"; else cout << manif->nb_unknown();
+	if (nb_unknown==0) cout << "--"; else cout << nb_unknown;
 	cout << endl;
 	cout << " number of pending boxes:\t";
-	if (manif->nb_pending()==0) cout << "--"; else cout << manif->nb_pending();
+	if (nb_pending==0) cout << "--"; else cout << nb_pending;
 	cout << endl;
 	cout << " cpu time used:\t\t\t" << time << "s";
 	if (manif->time()!=time)
@@ -547,6 +676,12 @@ void Solver::report() {
 	if (manif->nb_cells()!=nb_cells)
 		cout << " [total=" << manif->nb_cells() << "]";
 	cout << endl << endl;
+
+	if (profiler) {
+		cout << " profiling:" << endl;
+		profiler->report(cout);
+		cout << endl;
+	}
 }
 
 } // end namespace ibex
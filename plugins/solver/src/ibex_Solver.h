@@ -20,6 +20,10 @@
 #include "ibex_Exception.h"
 #include "ibex_Linear.h"
 #include "ibex_CovSolverData.h"
+#include "ibex_CovSolverDataWriter.h"
+#include "ibex_Profiler.h"
+#include "ibex_SearchLog.h"
+#include "ibex_RunSummary.h"
 
 #include <vector>
 
@@ -81,6 +85,23 @@ public:
 	 */
 	void set_params(const VarSet& params);
 
+	/**
+	 * \brief Stream the output boxes into a COV file.
+	 *
+	 * The boxes found by the next searches are appended to this file
+	 * as they are found instead of being stored in memory (see
+	 * #ibex::CovSolverDataWriter). The file is complete when solve(...)
+	 * returns (in interactive mode: at the next start or when the solver
+	 * is deleted). The data returned by get_data() then only contains
+	 * the variable names, the status, the time and the number of cells.
+	 *
+	 * An empty file name disables streaming (the default).
+	 *
+	 * \param checkpoint_period - maximal time (in seconds) between two
+	 *                            updates of the file.
+	 */
+	void set_stream(const std::string& filename, double checkpoint_period=CovSolverDataWriter::default_checkpoint_period);
+
 	/**
 	 * \brief Destructor.
 	 */
@@ -166,7 +187,7 @@ public:
 	 * \param sol - (output argument) pointer to the new box. This parameter is
 	 *              ignored if set to NULL (default value). Otherwise, in return, *sol
 	 *              is the address of the last element added in the CovSolverData
-	 *              structure.
+	 *              structure (or the last box streamed, see set_stream(...)).
 	 *              *sol is set to NULL if search is over, time is out or the number
 	 *              of cells exceeds the limit.
 	 *
@@ -179,6 +200,16 @@ public:
 	 */
 	void report();
 
+	/**
+	 * \brief Machine-readable summary of the last call to solve(...).
+	 *
+	 * Contains the status, the number of boxes of each type, the time, the number
+	 * of cells and the throughput (cells per second), the number of function
+	 * evaluations and LP solves, the peak resident memory and the time to the first
+	 * solution (or boundary) box.
+	 */
+	RunSummary summary() const;
+
 	/**
 	 * \brief Get the "solutions" (output boxes).
 	 *
@@ -262,6 +293,22 @@ public:
 	 */
 	int trace;
 
+	/**
+	 * \brief Profiling counters (NULL by default).
+	 *
+	 * If not NULL, the counters are displayed by report(). They are fed
+	 * by the profiling wrappers of the operators (see #ibex::CtcProfiler
+	 * and #ibex::BscProfiler).
+	 */
+	Profiler* profiler;
+
+	/**
+	 * \brief Search tree log (NULL by default).
+	 *
+	 * If not NULL, a record is appended for each cell processed
+	 * (see #ibex::SearchLog).
+	 */
+	SearchLog* search_log;
 
 protected:
 	/**
@@ -310,6 +357,26 @@ protected:
 	 */
 	void flush();
 
+	/*
+	 * \brief Add a box to the output (either the solver data or the stream).
+	 */
+	void add_inner(const IntervalVector& box);
+	void add_boundary(const IntervalVector& box);
+	void add_boundary(const IntervalVector& box, const VarSet& varset);
+	void add_unknown(const IntervalVector& box);
+	void add_solution(const IntervalVector& existence, const IntervalVector& unicity, const VarSet& varset);
+	void add_pending(const IntervalVector& box);
+
+	/*
+	 * \brief The last box added to the output.
+	 */
+	const IntervalVector& last_box() const;
+
+	/*
+	 * \brief Create the stream (if required) at the beginning of a search.
+	 */
+	void open_stream();
+
 	/*
 	 * \brief Initial box of the current search.
 	 */
@@ -350,6 +417,21 @@ protected:
 	 */
 	CovSolverData* manif;
 
+	/*
+	 * \brief Output file of boxes (empty if no streaming).
+	 */
+	std::string stream_filename;
+
+	/*
+	 * \brief Checkpoint period of the stream.
+	 */
+	double stream_checkpoint_period;
+
+	/*
+	 * \brief Output boxes streamed in the current search (NULL if no streaming).
+	 */
+	CovSolverDataWriter* stream;
+
 	/*
 	 * \brief CPU running time used to obtain this manifold.
 	 */
@@ -371,6 +453,21 @@ protected:
 	 * \brief Number of cells of the previous call.
 	 */
 	unsigned int old_nb_cells;
+
+	/**
+	 * \brief Time when the first solution/boundary box was found (-1 if none).
+	 */
+	double time_first_solution;
+
+	/**
+	 * \brief Values of the process-wide counters (see RunSummary) when the search started.
+	 */
+	unsigned long nb_evals_start, nb_lp_solves_start;
+
+	/**
+	 * \brief Number of function evaluations and LP solves of the last call.
+	 */
+	unsigned long nb_evals, nb_lp_solves;
 };
 
 /*============================================ inline implementation ============================================ */
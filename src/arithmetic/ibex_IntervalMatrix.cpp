@@ -12,6 +12,9 @@
 #include "ibex_IntervalMatrix.h"
 #include "ibex_Agenda.h"
 #include "ibex_TemplateMatrix.h"
+#include "ibex_MidRadArith.h"
+
+#include <math.h>
 
 namespace ibex {
 
@@ -389,4 +392,53 @@ double infinite_norm(const IntervalMatrix& m) {
 }
 
 
+namespace {
+
+bool use_midrad(int m, int k, int n) {
+	return m>=midrad_mul_min_size && k>=midrad_mul_min_size && n>=midrad_mul_min_size;
+}
+
+bool is_finite(const Matrix& m) {
+	for (int i=0; i<m.nb_rows(); i++)
+		for (int j=0; j<m.nb_cols(); j++)
+			if (!(fabs(m[i][j])<POS_INFINITY)) return false;
+	return true;
+}
+
+bool is_bounded(const IntervalMatrix& m) {
+	for (int i=0; i<m.nb_rows(); i++)
+		for (int j=0; j<m.nb_cols(); j++)
+			if (m[i][j].is_empty() || m[i][j].is_unbounded()) return false;
+	return true;
+}
+
+} // end anonymous namespace
+
+IntervalMatrix operator*(const Matrix& m1, const IntervalMatrix& m2) {
+	if (use_midrad(m1.nb_rows(), m1.nb_cols(), m2.nb_cols()) && is_finite(m1) && is_bounded(m2)) {
+		IntervalMatrix m3(m1.nb_rows(), m2.nb_cols());
+		midrad_mul(m1, m2, m3);
+		return m3;
+	}
+	return mulMM<Matrix,IntervalMatrix,IntervalMatrix>(m1,m2);
+}
+
+IntervalMatrix operator*(const IntervalMatrix& m1, const Matrix& m2) {
+	if (use_midrad(m1.nb_rows(), m1.nb_cols(), m2.nb_cols()) && is_bounded(m1) && is_finite(m2)) {
+		IntervalMatrix m3(m1.nb_rows(), m2.nb_cols());
+		midrad_mul(m1, m2, m3);
+		return m3;
+	}
+	return mulMM<IntervalMatrix,Matrix,IntervalMatrix>(m1,m2);
+}
+
+IntervalMatrix operator*(const IntervalMatrix& m1, const IntervalMatrix& m2) {
+	if (use_midrad(m1.nb_rows(), m1.nb_cols(), m2.nb_cols()) && is_bounded(m1) && is_bounded(m2)) {
+		IntervalMatrix m3(m1.nb_rows(), m2.nb_cols());
+		midrad_mul(m1, m2, m3);
+		return m3;
+	}
+	return mulMM<IntervalMatrix,IntervalMatrix,IntervalMatrix>(m1,m2);
+}
+
 } // namespace ibex
@@ -562,16 +562,25 @@ IntervalVector operator*(const IntervalVector& x, const IntervalMatrix& m);
 
 /**
  * \brief $[m]_1*[m]_2$.
+ *
+ * Large products are calculated in midpoint-radius arithmetic
+ * (see #midrad_mul_min_size).
  */
 IntervalMatrix operator*(const IntervalMatrix& m1, const Matrix& m2);
 
 /**
  * \brief $[m]_1*[m]_2$.
+ *
+ * Large products are calculated in midpoint-radius arithmetic
+ * (see #midrad_mul_min_size).
  */
 IntervalMatrix operator*(const Matrix& m1, const IntervalMatrix& m2);
 
 /**
  * \brief $[m]_1*[m]_2$.
+ *
+ * Large products are calculated in midpoint-radius arithmetic
+ * (see #midrad_mul_min_size).
  */
 IntervalMatrix operator*(const IntervalMatrix& m1, const IntervalMatrix& m2);
 
@@ -832,17 +841,5 @@ inline IntervalVector operator*(const IntervalVector& v, const IntervalMatrix& m
 	return mulVM<IntervalVector,IntervalMatrix,IntervalVector>(v,m);
 }
 
-inline IntervalMatrix operator*(const Matrix& m1, const IntervalMatrix& m2) {
-	return mulMM<Matrix,IntervalMatrix,IntervalMatrix>(m1,m2);
-}
-
-inline IntervalMatrix operator*(const IntervalMatrix& m1, const Matrix& m2) {
-	return mulMM<IntervalMatrix,Matrix,IntervalMatrix>(m1,m2);
-}
-
-inline IntervalMatrix operator*(const IntervalMatrix& m1, const IntervalMatrix& m2) {
-	return mulMM<IntervalMatrix,IntervalMatrix,IntervalMatrix>(m1,m2);
-}
-
 } // namespace ibex
 #endif // __IBEX_INTERVAL_MATRIX_H__
@@ -0,0 +1,182 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_MidRadArith.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_MidRadArith.h"
+
+#include <float.h>
+#include <math.h>
+#include <limits>
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+
+namespace ibex {
+
+int midrad_mul_min_size = 16;
+
+namespace {
+
+// block sizes of real_gemm: a KBxNB block of B (64KB) fits in the L2 cache
+const int KB = 64;
+const int NB = 128;
+
+/*
+ * Midpoints and radii of a matrix, in row-major arrays.
+ */
+void midrad(const IntervalMatrix& A, double* mA, double* rA) {
+	int n=A.nb_cols();
+	for (int i=0; i<A.nb_rows(); i++)
+		for (int j=0; j<n; j++)
+			midrad(A[i][j], mA[i*n+j], rA[i*n+j]);
+}
+
+void copy(const Matrix& A, double* a) {
+	int n=A.nb_cols();
+	for (int i=0; i<A.nb_rows(); i++)
+		for (int j=0; j<n; j++)
+			a[i*n+j]=A[i][j];
+}
+
+void set_result(const double* S, const double* T, int k, IntervalMatrix& C) {
+	int n=C.nb_cols();
+	for (int i=0; i<C.nb_rows(); i++)
+		for (int j=0; j<n; j++)
+			C[i][j]=midrad_enclosure(S[i*n+j], T[i*n+j], k);
+}
+
+} // end anonymous namespace
+
+double midrad_gamma(int n) {
+	double e=(n+8)*DBL_EPSILON;
+	return e/(1-e);
+}
+
+void midrad(const Interval& x, double& mid, double& rad) {
+	mid=x.mid();
+	rad=(x-mid).mag();
+}
+
+Interval midrad_enclosure(double mid, double rad, int n) {
+	// the rounding errors of the products of midpoints are in rad;
+	// here we add the errors made when calculating rad itself and
+	// a bound for underflows.
+	double r=(1+2*midrad_gamma(n))*rad + (2*n+8)*std::numeric_limits<double>::denorm_min();
+	if (!(r<POS_INFINITY) || !(fabs(mid)<POS_INFINITY)) return Interval::ALL_REALS;
+	return Interval(mid)+Interval(-r,r);
+}
+
+void real_gemm(int m, int k, int n, const double* A, const double* B, double* C) {
+	for (int kk=0; kk<k; kk+=KB) {
+		int kmax=std::min(kk+KB,k);
+		for (int jj=0; jj<n; jj+=NB) {
+			int jmax=std::min(jj+NB,n);
+			for (int i=0; i<m; i++) {
+				double* ci=C+i*n;
+				const double* ai=A+i*k;
+				for (int p=kk; p<kmax; p++) {
+					double a=ai[p];
+					if (a==0) continue;
+					const double* bp=B+p*n;
+					for (int j=jj; j<jmax; j++)
+						ci[j]+=a*bp[j];
+				}
+			}
+		}
+	}
+}
+
+void midrad_mul(const IntervalMatrix& A, const IntervalMatrix& B, IntervalMatrix& C) {
+	int m=A.nb_rows();
+	int k=A.nb_cols();
+	int n=B.nb_cols();
+	assert(B.nb_rows()==k);
+	assert(C.nb_rows()==m && C.nb_cols()==n);
+
+	double g=midrad_gamma(k);
+
+	vector<double> mA(m*k), rA(m*k), aA(m*k);
+	vector<double> mB(k*n), rB(k*n), aB(k*n);
+	vector<double> S(m*n,0.0), T(m*n,0.0);
+
+	midrad(A, &mA[0], &rA[0]);
+	midrad(B, &mB[0], &rB[0]);
+
+	for (int i=0; i<m*k; i++)
+		aA[i]=fabs(mA[i]);
+
+	for (int i=0; i<k*n; i++) {
+		double a=fabs(mB[i]);
+		aB[i]=a+rB[i];         // |mid(B)|+rad(B)
+		rB[i]=rB[i]+2*g*a;     // rad(B) + bound of rounding errors
+	}
+
+	real_gemm(m, k, n, &mA[0], &mB[0], &S[0]);
+	real_gemm(m, k, n, &aA[0], &rB[0], &T[0]);
+	real_gemm(m, k, n, &rA[0], &aB[0], &T[0]);
+
+	set_result(&S[0], &T[0], k, C);
+}
+
+void midrad_mul(const Matrix& A, const IntervalMatrix& B, IntervalMatrix& C) {
+	int m=A.nb_rows();
+	int k=A.nb_cols();
+	int n=B.nb_cols();
+	assert(B.nb_rows()==k);
+	assert(C.nb_rows()==m && C.nb_cols()==n);
+
+	double g=midrad_gamma(k);
+
+	vector<double> a(m*k), aA(m*k);
+	vector<double> mB(k*n), rB(k*n);
+	vector<double> S(m*n,0.0), T(m*n,0.0);
+
+	copy(A, &a[0]);
+	midrad(B, &mB[0], &rB[0]);
+
+	for (int i=0; i<m*k; i++)
+		aA[i]=fabs(a[i]);
+
+	for (int i=0; i<k*n; i++)
+		rB[i]+=2*g*fabs(mB[i]);
+
+	real_gemm(m, k, n, &a[0], &mB[0], &S[0]);
+	real_gemm(m, k, n, &aA[0], &rB[0], &T[0]);
+
+	set_result(&S[0], &T[0], k, C);
+}
+
+void midrad_mul(const IntervalMatrix& A, const Matrix& B, IntervalMatrix& C) {
+	int m=A.nb_rows();
+	int k=A.nb_cols();
+	int n=B.nb_cols();
+	assert(B.nb_rows()==k);
+	assert(C.nb_rows()==m && C.nb_cols()==n);
+
+	double g=midrad_gamma(k);
+
+	vector<double> mA(m*k), rA(m*k);
+	vector<double> b(k*n), aB(k*n);
+	vector<double> S(m*n,0.0), T(m*n,0.0);
+
+	midrad(A, &mA[0], &rA[0]);
+	copy(B, &b[0]);
+
+	for (int i=0; i<m*k; i++)
+		rA[i]+=2*g*fabs(mA[i]);
+
+	for (int i=0; i<k*n; i++)
+		aB[i]=fabs(b[i]);
+
+	real_gemm(m, k, n, &mA[0], &b[0], &S[0]);
+	real_gemm(m, k, n, &rA[0], &aB[0], &T[0]);
+
+	set_result(&S[0], &T[0], k, C);
+}
+
+} // end namespace ibex
@@ -0,0 +1,111 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_MidRadArith.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_MID_RAD_ARITH_H__
+#define __IBEX_MID_RAD_ARITH_H__
+
+#include "ibex_IntervalMatrix.h"
+
+namespace ibex {
+
+/**\ingroup arithmetic */
+/*@{*/
+
+/**
+ * \brief Minimal size for midpoint-radius matrix products.
+ *
+ * A product of matrices where at least one is an interval matrix is
+ * calculated in midpoint-radius arithmetic (see #midrad_mul) if the
+ * three dimensions (rows of the first matrix, columns of the first
+ * matrix, columns of the second matrix) are all greater than or equal
+ * to this value. Otherwise, the product is calculated with interval
+ * operations. Default value: 16. Set a non-positive value to always
+ * use the midpoint-radius product and a large value to never use it.
+ */
+extern int midrad_mul_min_size;
+
+/**
+ * \brief Midpoint-radius product of interval matrices.
+ *
+ * Each interval [x] is represented by a midpoint m and a radius r
+ * with [x]⊆[m-r,m+r]. The product is then calculated with three
+ * floating-point matrix products (S.M. Rump, "Fast and parallel
+ * interval arithmetic", BIT 39(3), 1999):
+ *
+ *   mid = mid(A)*mid(B)
+ *   rad = |mid(A)|*rad(B) + rad(A)*(|mid(B)|+rad(B)) + rounding errors.
+ *
+ * The rounding errors are bounded a priori (whatever the rounding mode
+ * is) so that the result is rigorous. Compared to the interval product,
+ * the radii are overestimated at most by a factor 1.5 (and not at all
+ * when one of the matrices is real).
+ *
+ * \pre A and B are bounded and nonempty, C is m1.nb_rows()xm2.nb_cols().
+ */
+void midrad_mul(const IntervalMatrix& A, const IntervalMatrix& B, IntervalMatrix& C);
+
+/**
+ * \brief Midpoint-radius product of a real and an interval matrix.
+ *
+ * The product is exact up to the roundings.
+ *
+ * \see #midrad_mul(const IntervalMatrix&, const IntervalMatrix&, IntervalMatrix&).
+ */
+void midrad_mul(const Matrix& A, const IntervalMatrix& B, IntervalMatrix& C);
+
+/**
+ * \brief Midpoint-radius product of an interval and a real matrix.
+ *
+ * The product is exact up to the roundings.
+ *
+ * \see #midrad_mul(const IntervalMatrix&, const IntervalMatrix&, IntervalMatrix&).
+ */
+void midrad_mul(const IntervalMatrix& A, const Matrix& B, IntervalMatrix& C);
+
+/**
+ * \brief Product of real matrices in row-major arrays: C+=A*B.
+ *
+ * A is mxk, B is kxn and C is mxn. The loops are blocked for the
+ * cache and the innermost loop is vectorized by the compiler.
+ *
+ * \warning Not rigorous (the result is rounded).
+ */
+void real_gemm(int m, int k, int n, const double* A, const double* B, double* C);
+
+/**
+ * \brief Bound of the relative rounding error of a dot product of size n.
+ *
+ * This bound is valid for any rounding mode and includes a safety margin
+ * for the calculation of the bound itself.
+ */
+double midrad_gamma(int n);
+
+/**
+ * \brief Midpoint and radius of a bounded interval.
+ *
+ * \pre x is bounded and nonempty.
+ */
+void midrad(const Interval& x, double& mid, double& rad);
+
+/**
+ * \brief Rigorous enclosure of a sum of n products.
+ *
+ * \param mid - the sum of products of midpoints (calculated
+ *              in floating-point arithmetic).
+ * \param rad - the sum of radii, including the term
+ *              midrad_gamma(n)*(sum of |products of midpoints|)
+ *              (calculated in floating-point arithmetic).
+ * \param n   - number of terms.
+ */
+Interval midrad_enclosure(double mid, double rad, int n);
+
+/*@}*/
+
+} // end namespace ibex
+
+#endif // __IBEX_MID_RAD_ARITH_H__
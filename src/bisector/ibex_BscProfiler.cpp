@@ -0,0 +1,31 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BscProfiler.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_BscProfiler.h"
+
+using namespace std;
+
+namespace ibex {
+
+BscProfiler::BscProfiler(Bsc& bsc, Profiler& profiler, const string& name) : Bsc(bsc), bsc(bsc),
+		entry(profiler.add(name.empty() ? Profiler::class_name(typeid(bsc)) : name)) {
+
+}
+
+BisectionPoint BscProfiler::choose_var(const Cell& cell) {
+	Profiler::Measure m(entry);
+	BisectionPoint p=bsc.choose_var(cell);
+	entry.nb_success++;
+	return p;
+}
+
+void BscProfiler::add_property(const IntervalVector& init_box, BoxProperties& map) {
+	bsc.add_property(init_box,map);
+}
+
+} // end namespace ibex
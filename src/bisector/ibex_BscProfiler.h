@@ -0,0 +1,61 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BscProfiler.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_BSC_PROFILER_H__
+#define __IBEX_BSC_PROFILER_H__
+
+#include "ibex_Bsc.h"
+#include "ibex_Profiler.h"
+
+namespace ibex {
+
+/**
+ * \ingroup bisector
+ *
+ * \brief Profiling wrapper of a bisector.
+ *
+ * Forwards all the calls to a bisector and records in a profiler
+ * entry the number of calls and the time spent in choose_var(...).
+ * The precision is the same as the profiled bisector.
+ */
+class BscProfiler : public Bsc {
+public:
+
+	/**
+	 * \brief Wrap a bisector.
+	 *
+	 * \param bsc      - the profiled bisector
+	 * \param profiler - where a new entry is created for bsc
+	 * \param name     - name of the entry. By default: the name of the class of bsc.
+	 */
+	BscProfiler(Bsc& bsc, Profiler& profiler, const std::string& name="");
+
+	/**
+	 * \brief Return the variable chosen by the profiled bisector.
+	 */
+	virtual BisectionPoint choose_var(const Cell& cell);
+
+	/**
+	 * \brief Add the properties required by the profiled bisector.
+	 */
+	virtual void add_property(const IntervalVector& init_box, BoxProperties& map);
+
+	/**
+	 * \brief The profiled bisector.
+	 */
+	Bsc& bsc;
+
+	/**
+	 * \brief The counters.
+	 */
+	Profiler::Entry& entry;
+};
+
+} // end namespace ibex
+
+#endif // __IBEX_BSC_PROFILER_H__
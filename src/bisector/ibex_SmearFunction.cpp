@@ -9,6 +9,7 @@
 //============================================================================
 
 #include "ibex_SmearFunction.h"
+#include "ibex_BxpSystemCache.h"
 
 using namespace std;
 
@@ -24,7 +25,13 @@ BisectionPoint SmearFunction::choose_var(const Cell& cell) {
 
 	IntervalMatrix J(sys.f_ctrs.image_dim(), sys.nb_var);
 
-	sys.f_ctrs.jacobian(box,J);
+	const BxpSystemCache* cache=(const BxpSystemCache*) cell.prop[BxpSystemCache::get_id(sys)];
+
+	if (cache && cache->contains(box))
+		cache->ctrs_jacobian(J);
+	else
+		sys.f_ctrs.jacobian(box,J);
+
 	// in case of infinite derivatives  changing to round-robin bisection
 	for (int i=0; i<sys.f_ctrs.image_dim(); i++)
 		for (int j=0; j<sys.nb_var; j++)
@@ -70,6 +70,11 @@ public:
 
 	/**
 	 * \brief Add backtrackable data required by round robin.
+	 *
+	 * Note: no system cache (see #BxpSystemCache) is added. However, if
+	 * another operator working on the same system has added one (e.g.,
+	 * LinearizerXTaylor with the TAYLOR slope), the jacobian matrix is taken
+	 * from this cache when it corresponds to the current box.
 	 */
 	virtual void add_property(const IntervalVector& init_box, BoxProperties& map);
 
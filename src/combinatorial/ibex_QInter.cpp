@@ -180,4 +180,31 @@ IntervalVector qinter(const Array<IntervalVector>& _boxes, int q) {
 	return inner_box;
 }
 
+IntervalVector qinter(const Array<IntervalVector>& boxes, int q, QInterProjection& proj) {
+	assert(boxes.size()>0);
+
+	IntervalVector hull=proj.filter(boxes,q);
+
+	if (hull.is_empty()) return hull;
+
+	// the boxes discarded by the projection contain no point
+	// of the q-intersection and the other ones can be clipped
+	int p=0;
+	for (int i=0; i<boxes.size(); i++) {
+		if (!proj.discarded(i)) p++;
+	}
+
+	Array<IntervalVector> clipped(p);
+	int j=0;
+	for (int i=0; i<boxes.size(); i++) {
+		if (!proj.discarded(i)) clipped.set_ref(j++,*new IntervalVector(boxes[i] & hull));
+	}
+
+	IntervalVector res=qinter(clipped,q);
+
+	for (int i=0; i<p; i++) delete &clipped[i];
+
+	return res;
+}
+
 } // end namespace ibex
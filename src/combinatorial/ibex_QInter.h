@@ -19,6 +19,7 @@
 
 #include "ibex_Array.h"
 #include "ibex_IntStack.h"
+#include "ibex_QInterProjection.h"
 
 namespace ibex {
 
@@ -32,6 +33,19 @@ namespace ibex {
  */
 IntervalVector qinter(const Array<IntervalVector>& boxes, int q);
 
+/**
+ * \ingroup combinatorial
+ * \brief Q-intersection - EXACT - Grid algorithm, with projection filtering
+ *
+ * The boxes are first filtered by the projection (see QInterProjection::filter)
+ * and the remaining ones are clipped to it before running the grid algorithm,
+ * which is then applied to fewer and smaller boxes.
+ *
+ * The projection object keeps the sorted bounds of the boxes and should be
+ * reused from one call to the other with the same list of boxes.
+ */
+IntervalVector qinter(const Array<IntervalVector>& boxes, int q, QInterProjection& proj);
+
 } // end namespace ibex
 
 
@@ -0,0 +1,154 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_QInterProjection.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_QInterProjection.h"
+
+#include <algorithm>
+#include <cassert>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * Insertion sort, which is linear if the vector is almost sorted.
+ * Gives up (and returns false) after "budget" moves.
+ */
+template<class T, class Less>
+bool insertion_sort(vector<T>& v, long budget, Less less) {
+	long moves=0;
+	for (size_t i=1; i<v.size(); i++) {
+		T e=v[i];
+		size_t j=i;
+		while (j>0 && less(e,v[j-1])) {
+			v[j]=v[j-1];
+			j--;
+			if (++moves>budget) {
+				v[j]=e;
+				return false;
+			}
+		}
+		v[j]=e;
+	}
+	return true;
+}
+
+} // end anonymous namespace
+
+QInterProjection::QInterProjection() {
+
+}
+
+void QInterProjection::update(const Array<IntervalVector>& boxes) {
+	assert(boxes.size()>0);
+	int p=boxes.size();
+	int n=boxes[0].size();
+
+	if ((int) points.size()!=n || (int) points[0].size()!=2*p) {
+		// new list of boxes
+		points.assign(n, vector<Endpoint>(2*p));
+		for (int i=0; i<n; i++) {
+			for (int j=0; j<p; j++) {
+				points[i][2*j].ub=0;
+				points[i][2*j].box=j;
+				points[i][2*j+1].ub=1;
+				points[i][2*j+1].box=j;
+			}
+		}
+	}
+
+	_discarded.resize(p);
+	for (int j=0; j<p; j++)
+		_discarded[j]=boxes[j].is_empty();
+
+	for (int i=0; i<n; i++) {
+		vector<Endpoint>& x=points[i];
+		for (vector<Endpoint>::iterator it=x.begin(); it!=x.end(); ++it) {
+			const IntervalVector& b=boxes[it->box];
+			// the bounds of empty boxes are put at the end
+			if (_discarded[it->box]) it->x=POS_INFINITY;
+			else it->x=it->ub ? b[i].ub() : b[i].lb();
+		}
+
+		// the previous order is reused if the bounds have not changed much
+		if (!insertion_sort(x, 4*(long) x.size(), less))
+			sort(x.begin(), x.end(), less);
+	}
+}
+
+IntervalVector QInterProjection::sweep(int q) const {
+	int n=points.size();
+	IntervalVector res(n);
+
+	for (int i=0; i<n; i++) {
+		const vector<Endpoint>& x=points[i];
+		int size=x.size();
+
+		/* Find the left bound */
+		int c=0;
+		int k=0;
+		for (; k<size; k++) {
+			if (_discarded[x[k].box]) continue;
+			x[k].ub ? c-- : c++;
+			if (c==q) break;
+		}
+
+		if (k==size) {
+			res.set_empty();
+			return res;
+		}
+
+		double lb0=x[k].x;
+
+		/* Find the right bound */
+		c=0;
+		for (k=size-1; k>=0; k--) {
+			if (_discarded[x[k].box]) continue;
+			x[k].ub ? c++ : c--;
+			if (c==q) break;
+		}
+
+		assert(k>=0);
+		res[i]=Interval(lb0,x[k].x);
+	}
+	return res;
+}
+
+IntervalVector QInterProjection::project(const Array<IntervalVector>& boxes, int q) {
+	assert(q>0);
+	update(boxes);
+	return sweep(q);
+}
+
+IntervalVector QInterProjection::filter(const Array<IntervalVector>& boxes, int q) {
+	assert(q>0);
+	update(boxes);
+
+	IntervalVector res=sweep(q);
+
+	bool fixpoint=false;
+	while (!fixpoint && !res.is_empty()) {
+		fixpoint=true;
+		for (int j=0; j<boxes.size(); j++) {
+			if (!_discarded[j] && !boxes[j].intersects(res)) {
+				_discarded[j]=true;
+				fixpoint=false;
+			}
+		}
+		if (!fixpoint) res=sweep(q);
+	}
+
+	if (res.is_empty())
+		_discarded.assign(boxes.size(), true);
+
+	return res;
+}
+
+} // end namespace ibex
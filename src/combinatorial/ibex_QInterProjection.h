@@ -0,0 +1,117 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_QInterProjection.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_Q_INTER_PROJECTION_H__
+#define __IBEX_Q_INTER_PROJECTION_H__
+
+#include "ibex_IntervalVector.h"
+#include "ibex_Array.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup combinatorial
+ * \brief Incremental projection of the q-intersection (sweep line).
+ *
+ * In each dimension, the 2p bounds of the boxes are swept in increasing
+ * (resp. decreasing) order to find the first (resp. last) point covered
+ * by q intervals. This gives an outer approximation of the q-intersection
+ * in O(p log p) per dimension.
+ *
+ * The sorted bounds are kept from one call to the other, for the same
+ * list of boxes. If the boxes have only slightly changed (typically,
+ * the boxes returned by the same contractors on a contracted box), they
+ * are sorted again in linear time.
+ */
+class QInterProjection {
+public:
+	/**
+	 * \brief Create the projection engine.
+	 */
+	QInterProjection();
+
+	/**
+	 * \brief Projection of the q-intersection.
+	 *
+	 * The ith component of the result is the hull of the points covered by at
+	 * least q intervals in the ith dimension (empty boxes are ignored). The result
+	 * is empty if there is no such point in one dimension.
+	 */
+	IntervalVector project(const Array<IntervalVector>& boxes, int q);
+
+	/**
+	 * \brief Projection of the q-intersection, with filtering.
+	 *
+	 * Same as #project(const Array<IntervalVector>&, int) but the boxes that do
+	 * not intersect the result are then discarded (they contain no point of the
+	 * q-intersection) and the projection is calculated again with the remaining
+	 * boxes, until a fixpoint is reached.
+	 *
+	 * The discarded boxes can be retrieved with #discarded(int).
+	 */
+	IntervalVector filter(const Array<IntervalVector>& boxes, int q);
+
+	/**
+	 * \brief True if the ith box has been discarded by the last call to
+	 * #filter(const Array<IntervalVector>&, int) (or is empty).
+	 */
+	bool discarded(int i) const;
+
+protected:
+
+	/*
+	 * A bound of a box in one dimension.
+	 */
+	struct Endpoint {
+		double x;
+		int ub;   // 0 for a lower bound, 1 for an upper bound
+		int box;
+	};
+
+	/*
+	 * Order of the sweep (lower bounds first in case of equality, so
+	 * that intervals with a common bound intersect).
+	 */
+	static bool less(const Endpoint& e1, const Endpoint& e2);
+
+	/*
+	 * Load the bounds of the boxes and sort them.
+	 */
+	void update(const Array<IntervalVector>& boxes);
+
+	/*
+	 * Sweep the bounds with the current list of discarded boxes.
+	 */
+	IntervalVector sweep(int q) const;
+
+	/*
+	 * Sorted bounds in each dimension.
+	 */
+	std::vector<std::vector<Endpoint> > points;
+
+	/*
+	 * Discarded boxes.
+	 */
+	std::vector<bool> _discarded;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline bool QInterProjection::less(const Endpoint& e1, const Endpoint& e2) {
+	return e1.x<e2.x || (e1.x==e2.x && e1.ub<e2.ub);
+}
+
+inline bool QInterProjection::discarded(int i) const {
+	return _discarded[i];
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_Q_INTER_PROJECTION_H__
@@ -10,14 +10,30 @@
 //============================================================================
 
 #include "ibex_Ctc3BCid.h"
+#include "ibex_ThreadPool.h"
 
 using namespace std;
 namespace ibex {
 
+namespace {
+
+/*
+ * kth slice of x, when x is split into n slices of width w
+ * (the last slice is stretched up to x.ub()).
+ */
+Interval slice(const Interval& x, int k, int n, double w) {
+	double inf_k = x.lb() + k * w;
+	double sup_k = x.lb() + (k+1) * w;
+	if (sup_k > x.ub() || (k == n-1 && sup_k < x.ub())) sup_k = x.ub();
+	return Interval(inf_k, sup_k);
+}
+
+}
+
 Ctc3BCid::Ctc3BCid(const BitSet& cid_vars, Ctc& ctc, int s3b, int scid, int vhandled, double var_min_width) :
 									Ctc(ctc.nb_var), cid_vars(cid_vars), ctc(ctc), s3b(s3b), scid(scid),
 									vhandled(vhandled<=0? cid_vars.size():vhandled),
-									var_min_width(var_min_width), start_var(0) {
+									var_min_width(var_min_width), start_var(0), context(NULL), pool(NULL) {
 	assert(ctc.nb_var>0);
 	//	if (ctc.nb_var<=0)
 	//		ibex_error("Ctc3BCID : the contractor is non-dimensional, Please specify the dimension with: \n Ctc3BCid(int nb_var, const BoolMask& cid_vars, Ctc& ctc, int s3b, int scid, int vhandled, double var_min_width);");
@@ -27,7 +43,7 @@ Ctc3BCid::Ctc3BCid(const BitSet& cid_vars, Ctc& ctc, int s3b, int scid, int vhan
 Ctc3BCid::Ctc3BCid(Ctc& ctc, int s3b, int scid, int vhandled, double var_min_width) :
                     				Ctc(ctc.nb_var), cid_vars(BitSet::all(nb_var)), ctc(ctc), s3b(s3b), scid(scid),
 									vhandled(vhandled<=0? nb_var : vhandled),
-									var_min_width(var_min_width), start_var(0), context(NULL) {
+									var_min_width(var_min_width), start_var(0), context(NULL), pool(NULL) {
 
 	assert(ctc.nb_var>0);
 	//	if (ctc.nb_var<=0)
@@ -35,11 +51,31 @@ Ctc3BCid::Ctc3BCid(Ctc& ctc, int s3b, int scid, int vhandled, double var_min_wid
 }
 
 Ctc3BCid::~Ctc3BCid() {
-
+	delete pool;
 }
 
 void Ctc3BCid::add_property(const IntervalVector& init_box, BoxProperties& map) {
 	ctc.add_property(init_box, map);
+	for (vector<Ctc*>::iterator it=thread_ctcs.begin(); it!=thread_ctcs.end(); it++)
+		(*it)->add_property(init_box, map);
+}
+
+void Ctc3BCid::set_thread_ctcs(const Array<Ctc>& ctcs) {
+#ifdef _IBEX_WITH_THREADS_
+	thread_ctcs.clear();
+	delete pool;
+	pool = NULL;
+	if (ctcs.size()<2) return; // sequential mode
+	for (int i=0; i<ctcs.size(); i++) {
+		assert(ctcs[i].nb_var==nb_var);
+		thread_ctcs.push_back(&ctcs[i]);
+	}
+	pool = new ThreadPool(ctcs.size());
+#endif
+}
+
+int Ctc3BCid::slice_batch() const {
+	return thread_ctcs.empty() ? 1 : (int) thread_ctcs.size();
 }
 
 int Ctc3BCid::limitCIDDichotomy ()  {
@@ -177,6 +213,46 @@ void Ctc3BCid::update_and_contract(IntervalVector& box, int var) {
 	ctc.contract(box,sub_context);
 }
 
+void Ctc3BCid::contract_slices(const IntervalVector& box, int var, const Interval& x, int k0, int nk, int n, double w, vector<IntervalVector>& slices) {
+
+	slices.assign(nk, box);
+	for (int i=0; i<nk; i++)
+		slices[i][var] = slice(x, k0+i, n, w);
+
+	if (nk==1 || thread_ctcs.empty()) {
+		for (int i=0; i<nk; i++)
+			update_and_contract(slices[i], var);
+		return;
+	}
+
+	// The sub-contexts (copies of the properties) are built
+	// in the calling thread. See update_and_contract.
+	vector<ContractContext*> sub_contexts(nk);
+	for (int i=0; i<nk; i++) {
+		sub_contexts[i] = new ContractContext(slices[i], *context);
+		sub_contexts[i]->impact.clear();
+		sub_contexts[i]->impact.add(var);
+		sub_contexts[i]->prop.update(BoxEvent(slices[i], BoxEvent::CONTRACT, BitSet::singleton(nb_var,var)));
+	}
+
+	int nb_threads = pool->size();
+
+	try {
+		// the ith slice is contracted by the (i mod nb_threads)th thread
+		pool->run([&](int t) {
+			for (int i=t; i<nk; i+=nb_threads)
+				thread_ctcs[t]->contract(slices[i], *sub_contexts[i]);
+		});
+	} catch(...) {
+		for (int i=0; i<nk; i++)
+			delete sub_contexts[i];
+		throw;
+	}
+
+	for (int i=0; i<nk; i++)
+		delete sub_contexts[i];
+}
+
 bool Ctc3BCid::shave_bound_dicho(IntervalVector& box, int var, double wv, bool left) {
 
 	IntervalVector initbox = box;
@@ -271,39 +347,41 @@ bool Ctc3BCid::shave_bound_dicho(IntervalVector& box, int var, double wv, bool l
 bool Ctc3BCid::var3BCID_slices(IntervalVector& box, int var, int locs3b, double w_DC, Interval& dom) {
 
 	IntervalVector savebox(box);
+	const Interval x(dom);
+
+	int batch = slice_batch();       // number of slices contracted together
+	vector<IntervalVector> slices;   // the contracted slices
 
 	// Reduce left bound by shaving:
 
 	bool stopLeft = false;
-	double leftBound = dom.lb();
-	double rightBound = dom.ub();
+	double leftBound = x.lb();
+	double rightBound = x.ub();
 	double leftCID=0.;
 
 	int k=0;
 
 	while (k < locs3b && ! stopLeft) {
 
-		// Compute a slice 'dom'
-		if (k > 0) box = savebox;
-		double inf_k = dom.lb()+k*w_DC;
-		double sup_k = dom.lb()+(k+1)*w_DC;
-		if (sup_k > dom.ub() || (k == locs3b - 1 && sup_k<dom.ub())) sup_k = dom.ub();
-		dom = Interval(inf_k, sup_k);
+		// Try to refute the next slices
+		int nk = locs3b-k < batch ? locs3b-k : batch;
 
-		// Try to refute this slice
+		contract_slices(savebox, var, x, k, nk, locs3b, w_DC, slices);
 
-		update_and_contract(box, var);
+		for (int i=0; i<nk && !stopLeft; i++) {
+			box = slices[i];
 
-		if (box.is_empty()) {
-			leftBound = sup_k;
+			if (box.is_empty()) {
+				leftBound = slice(x, k, locs3b, w_DC).ub();
+				k++;
+				continue;
+			}
+			//non empty box
+			stopLeft = true;
+			leftCID = slice(x, k, locs3b, w_DC).ub();
+			leftBound = box[var].lb();
 			k++;
-			continue;
 		}
-		//non empty box
-		stopLeft = true;
-		leftCID = sup_k;
-		leftBound = dom.lb();
-		k++;
 	}
 
 	if (!stopLeft) {                                   // all slices give an empty box
@@ -325,30 +403,26 @@ bool Ctc3BCid::var3BCID_slices(IntervalVector& box, int var, int locs3b, double
 
 		while (k2 > kLeft && ! stopRight) {
 
-			// Compute slice
-			box = savebox;
-			double inf_k = dom.lb() + k2 * w_DC;
-			double sup_k = dom.lb() + (k2+1) * w_DC;
-			if (sup_k > dom.ub() || (k2 == locs3b - 1 && sup_k < dom.ub())) sup_k = dom.ub();
+			// Try to refute the next slices (from right to left)
+			int nk = k2-kLeft < batch ? k2-kLeft : batch;
 
-			dom = Interval(inf_k, sup_k);
+			contract_slices(savebox, var, x, k2-nk+1, nk, locs3b, w_DC, slices);
 
-			// Try to refute the slice
+			for (int i=nk-1; i>=0 && !stopRight; i--) {
+				box = slices[i];
 
-			update_and_contract(box, var);
+				if (box.is_empty()) {
+					rightBound = slice(x, k2, locs3b, w_DC).ub();
+					k2--;
+					continue;
+				}
+
+				stopRight = true;
+				lastInf_k = slice(x, k2, locs3b, w_DC).lb();
+				rightBound = box[var].ub();
 
-			if (box.is_empty()) {
-				rightBound = sup_k;
 				k2--;
-				continue;
 			}
-
-			stopRight = true;
-			lastInf_k = inf_k;
-			rightBound = dom.ub();
-
-			k2--;
-
 		}
 
 		if (!stopRight) {                              // All the boxes visited in the second loop give an empty box
@@ -386,27 +460,27 @@ bool Ctc3BCid::varCID(int var, IntervalVector &varcid_box, IntervalVector &var3B
 
 	if(scid==0 || equalBoxes (var, varcid_box, var3Bcid_box)) return false;
 
-	IntervalVector box=varcid_box;
-	Interval& dom(box[var]);
+	const Interval x(varcid_box[var]);
 
-	double w_DC = dom.diam() / scid;
-	for (int k = 0 ; k < scid ; k++) {
-		if(k>0) box=varcid_box;
-		// compute slice:
-		double inf_k = dom.lb() + k * w_DC;
-		double sup_k = dom.lb() + (k+1) * w_DC;
-		if (sup_k > dom.ub() || (k == scid-1 && sup_k < dom.ub())) sup_k = dom.ub();
-		dom = Interval(inf_k, sup_k);
+	double w_DC = x.diam() / scid;
 
-		update_and_contract(box, var);
+	int batch = slice_batch();
+	vector<IntervalVector> slices;
 
-		if (box.is_empty()) {
-			continue;                                  // the current slice is infeasible : nothing to add to the hull
-		}
+	for (int k = 0 ; k < scid ; k+=batch) {
+		int nk = scid-k < batch ? scid-k : batch;
+
+		contract_slices(varcid_box, var, x, k, nk, scid, w_DC, slices);
 
-		var3Bcid_box |= box;                           // add box to the hull
-		if(equalBoxes (var, varcid_box, var3Bcid_box))
-			return false;                              // VarCID was useless
+		for (int i=0; i<nk; i++) {
+			if (slices[i].is_empty()) {
+				continue;                              // the current slice is infeasible : nothing to add to the hull
+			}
+
+			var3Bcid_box |= slices[i];                 // add box to the hull
+			if(equalBoxes (var, varcid_box, var3Bcid_box))
+				return false;                          // VarCID was useless
+		}
 	}
 
 	return true;
@@ -14,9 +14,13 @@
 
 #include "ibex_Ctc.h"
 #include "ibex_BitSet.h"
+#include "ibex_Array.h"
+
+#include <vector>
 
 namespace ibex {
 
+class ThreadPool;
 
 /**
  * \ingroup contractor
@@ -128,6 +132,29 @@ public:
 	 */
 	virtual void contract(IntervalVector& box, ContractContext& context);
 
+	/**
+	 * \brief Enable parallel shaving.
+	 *
+	 * The slices of a variable are then contracted by groups of n slices
+	 * in parallel, where n is the size of \a ctcs: the ith thread
+	 * contracts its slices with \a ctcs[i]. The groups are processed in the
+	 * same order as in the sequential algorithm (with early termination) so
+	 * that the contracted box is the same. Only the "linear" shaving and
+	 * the CID slices are parallelized (the dichotomic shaving is sequential).
+	 *
+	 * \param ctcs - Copies of the sub-contractor, one per thread. Each
+	 *               copy must give the same result as #ctc on the same box
+	 *               and must be built on its own copy of the functions
+	 *               (e.g., a copy of the System), as function evaluation
+	 *               is not thread safe.
+	 *
+	 * The threads are created by this function and reused by all the calls
+	 * to contract (see #ibex::ThreadPool).
+	 *
+	 * Has no effect if Ibex is built without thread support.
+	 */
+	void set_thread_ctcs(const Array<Ctc>& ctcs);
+
 	/** The variables to which var3BCID is applied **/
 	BitSet cid_vars;
 
@@ -221,6 +248,18 @@ protected:
 
 	void update_and_contract(IntervalVector& box, int var);
 
+	/**
+	 * Build the slices k0,...,k0+nk-1 of \a box (the domain \a x of \a var
+	 * being split into n slices of width w) and contract them with the
+	 * sub-contractor (in parallel, if enabled).
+	 */
+	void contract_slices(const IntervalVector& box, int var, const Interval& x, int k0, int nk, int n, double w, std::vector<IntervalVector>& slices);
+
+	/**
+	 * Number of slices contracted together (number of threads).
+	 */
+	int slice_batch() const;
+
 	/**
 	 * Returns true iff \a box1 and \a box2 are equal, excepting the current interval (\a var )
 	 */
@@ -249,6 +288,17 @@ protected:
 	 */
 	ContractContext* context;
 
+	/**
+	 * Copies of the sub-contractor (one per thread).
+	 * Empty in sequential mode.
+	 */
+	std::vector<Ctc*> thread_ctcs;
+
+	/**
+	 * Worker threads (NULL in sequential mode).
+	 */
+	ThreadPool* pool;
+
 	virtual int limitCIDDichotomy();
 };
 
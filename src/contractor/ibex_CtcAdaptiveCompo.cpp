@@ -0,0 +1,179 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CtcAdaptiveCompo.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_CtcAdaptiveCompo.h"
+#include "ibex_Profiler.h"
+#include "ibex_Counters.h"
+
+#include <cmath>
+
+using namespace std;
+
+namespace ibex {
+
+const int CtcAdaptiveCompo::min_calls = 10;
+
+const int CtcAdaptiveCompo::nb_levels = 16;
+
+CtcAdaptiveCompo::CtcAdaptiveCompo(const Array<Ctc>& list, double min_gain) :
+		Ctc(list), list(list), min_gain(min_gain), has_root(false), root(nb_var),
+		stats(list.size()*nb_levels), nb_boxes(nb_levels,0) {
+	assert(check_nb_var_ctc_list(list));
+}
+
+CtcAdaptiveCompo::CtcAdaptiveCompo(Ctc& c1, Ctc& c2, double min_gain) :
+		Ctc(c1.nb_var), list(Array<Ctc>(c1,c2)), min_gain(min_gain), has_root(false), root(nb_var),
+		stats(2*nb_levels), nb_boxes(nb_levels,0) {
+	assert(check_nb_var_ctc_list(list));
+}
+
+CtcAdaptiveCompo::CtcAdaptiveCompo(Ctc& c1, Ctc& c2, Ctc& c3, double min_gain) :
+		Ctc(c1.nb_var), list(Array<Ctc>(c1,c2,c3)), min_gain(min_gain), has_root(false), root(nb_var),
+		stats(3*nb_levels), nb_boxes(nb_levels,0) {
+	assert(check_nb_var_ctc_list(list));
+}
+
+void CtcAdaptiveCompo::add_property(const IntervalVector& init_box, BoxProperties& map) {
+	if (!has_root) {
+		root = init_box;
+		has_root = true;
+	}
+
+	for (int i=0; i<list.size(); i++)
+		list[i].add_property(init_box, map);
+}
+
+void CtcAdaptiveCompo::reset() {
+	has_root = false;
+	stats.assign(stats.size(), Stat());
+	nb_boxes.assign(nb_levels, 0);
+}
+
+long CtcAdaptiveCompo::nb_calls(int i) const {
+	long n=0;
+	for (int lev=0; lev<nb_levels; lev++)
+		n += stat(i,lev).nb_calls;
+	return n;
+}
+
+long CtcAdaptiveCompo::nb_skips(int i) const {
+	long n=0;
+	for (int lev=0; lev<nb_levels; lev++)
+		n += stat(i,lev).nb_skips;
+	return n;
+}
+
+int CtcAdaptiveCompo::level(const IntervalVector& box) const {
+	if (box.is_empty()) return 0;
+
+	// number of halvings from the root box
+	double d=0;
+	for (int j=0; j<nb_var; j++) {
+		double r=root[j].diam();
+		double b=box[j].diam();
+		if (r>0 && r<POS_INFINITY && b>0 && b<r)
+			d += std::log2(r/b);
+	}
+
+	int lev=0;
+	while (d>=1 && lev<nb_levels-1) {
+		d /= 2;
+		lev++;
+	}
+	return lev;
+}
+
+bool CtcAdaptiveCompo::must_call(int i, int lev) const {
+	const Stat& s=stat(i,lev);
+
+	if (s.nb_calls<min_calls) return true;
+
+	double total_cost=0;
+	for (int j=0; j<list.size(); j++) {
+		const Stat& sj=stat(j,lev);
+		if (sj.nb_calls>0) total_cost += sj.sum_cost/sj.nb_calls;
+	}
+
+	if (total_cost<=0) return true;
+
+	double rel_cost=(s.sum_cost/s.nb_calls)/total_cost;
+
+	double bonus=min_gain*std::sqrt(2*std::log((double) nb_boxes[lev])/s.nb_calls);
+
+	return s.sum_gain/s.nb_calls + bonus >= min_gain*rel_cost;
+}
+
+double CtcAdaptiveCompo::nb_operations() const {
+	return (double) Counters::total(Counters::EVAL) + ((double) nb_var)*Counters::total(Counters::LP_SOLVE);
+}
+
+void CtcAdaptiveCompo::contract(IntervalVector& box) {
+	ContractContext context(box);
+	contract(box,context);
+}
+
+void CtcAdaptiveCompo::contract(IntervalVector& box, ContractContext& context) {
+
+	if (!has_root) {
+		root = box;
+		has_root = true;
+	}
+
+	int lev=level(box);
+	nb_boxes[lev]++;
+
+	bool inactive = true;
+
+	BitSet input_impact = context.impact;
+
+	context.impact.fill(0,nb_var-1);
+
+	IntervalVector before(nb_var);
+
+	for (int i=0; i<list.size(); i++) {
+
+		Stat& s=stat(i,lev);
+
+		if (!must_call(i,lev)) {
+			s.nb_skips++;
+			// the constraints of the skipped contractor
+			// may not be inactive
+			inactive=false;
+			continue;
+		}
+
+		before = box;
+
+		if (inactive)
+			context.output_flags.clear();
+
+		double start=nb_operations();
+
+		list[i].contract(box, context);
+
+		s.nb_calls++;
+		s.sum_cost += 1 + nb_operations()-start;
+		s.sum_gain += Profiler::volume_reduction(before, box);
+
+		if (inactive && !context.output_flags[INACTIVE])
+			inactive=false;
+
+		if (box.is_empty()) {
+			context.output_flags.clear();
+			context.output_flags.add(FIXPOINT);
+			context.impact = input_impact;
+			return;
+		}
+	}
+
+	if (inactive) context.output_flags.add(INACTIVE);
+
+	context.impact = input_impact;
+}
+
+} // end namespace ibex
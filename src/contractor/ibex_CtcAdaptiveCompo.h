@@ -0,0 +1,177 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CtcAdaptiveCompo.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_CTC_ADAPTIVE_COMPO_H__
+#define __IBEX_CTC_ADAPTIVE_COMPO_H__
+
+#include "ibex_Ctc.h"
+#include "ibex_Array.h"
+
+#include <vector>
+
+namespace ibex {
+
+/** \ingroup contractor
+ * \brief Composition of contractors with adaptive scheduling
+ *
+ * Same as CtcCompo except that a contractor may be skipped when
+ * its expected gain does not pay off its cost.
+ *
+ * For each contractor and each level of depth in the search tree,
+ * the average gain (relative reduction of the volume of the box,
+ * 1 if the box is emptied) and the average cost of a call
+ * are recorded. The ith contractor is called if
+ *
+ *    mean_gain + min_gain*sqrt(2*log(N)/n) >= min_gain*relative_cost
+ *
+ * where N is the number of boxes contracted at this depth, n the
+ * number of calls to the ith contractor at this depth and
+ * relative_cost the ratio between the average cost of the ith
+ * contractor and the sum of the average costs of all contractors.
+ * This is the "upper confidence bound" policy of multi-armed bandits:
+ * a skipped contractor is regularly tried again, so that its
+ * statistics remain up to date.
+ *
+ * Cheap contractors (like HC4) are therefore always called while
+ * an expensive contractor (like a polytope hull) that rarely
+ * contracts is mostly skipped.
+ *
+ * The cost of a call is not a running time but a count of operations:
+ * 1 (the call itself) + the number of function evaluations + n times
+ * the number of LP solves (see #ibex::Counters), where n is the number
+ * of variables (a simplex pivot costs about as much as a pass over the
+ * constraints). The decisions are therefore reproducible: two runs
+ * give the same search tree, whatever the load of the machine.
+ *
+ * Skipping a contractor is always rigorous (the contracted box is
+ * only larger) so no solution can be lost.
+ *
+ * The depth of a box is not the depth of the cell but the number of
+ * halvings from the root box, i.e., the sum over the components of
+ * log2(diam(root_i)/diam(box_i)). The root box is the box given to
+ * the first call to add_property(..) (or, by default, the first box
+ * contracted). Depths are grouped by powers of 2 (0, 1, 2-3, 4-7, etc.).
+ */
+class CtcAdaptiveCompo : public Ctc {
+public:
+	/**
+	 * \brief Build an adaptive composition.
+	 *
+	 * \param list     - the contractors, in the order they are called
+	 * \param min_gain - gain (relative volume reduction) below which
+	 *                   the most expensive contractors are skipped.
+	 */
+	CtcAdaptiveCompo(const Array<Ctc>& list, double min_gain=default_min_gain);
+
+	/**
+	 * \brief Build the adaptive composition of c1 and c2.
+	 */
+	CtcAdaptiveCompo(Ctc& c1, Ctc& c2, double min_gain=default_min_gain);
+
+	/**
+	 * \brief Build the adaptive composition of c1, c2 and c3.
+	 */
+	CtcAdaptiveCompo(Ctc& c1, Ctc& c2, Ctc& c3, double min_gain=default_min_gain);
+
+	/**
+	 * \brief Contract a box.
+	 */
+	virtual void contract(IntervalVector& box);
+
+	/**
+	 * \brief Contract a box.
+	 */
+	virtual void contract(IntervalVector& box, ContractContext& context);
+
+	/**
+	 * \brief Add sub-contractors properties to the map
+	 *
+	 * The first call also sets the root box.
+	 */
+	virtual void add_property(const IntervalVector& init_box, BoxProperties& map);
+
+	/**
+	 * \brief Forget the statistics and the root box.
+	 */
+	void reset();
+
+	/**
+	 * \brief Number of calls to the ith contractor.
+	 */
+	long nb_calls(int i) const;
+
+	/**
+	 * \brief Number of times the ith contractor has been skipped.
+	 */
+	long nb_skips(int i) const;
+
+	/** The list of sub-contractors */
+	Array<Ctc> list;
+
+	/** Gain below which the most expensive contractors are skipped. */
+	double min_gain;
+
+	/** Default gain: 0.005. */
+	static constexpr double default_min_gain = 0.005;
+
+	/** Number of calls at a given depth before a contractor can be skipped: 10. */
+	static const int min_calls;
+
+	/** Number of levels of depth: 16. */
+	static const int nb_levels;
+
+protected:
+
+	/*
+	 * Statistics of a contractor at a given level.
+	 */
+	struct Stat {
+		Stat() : nb_calls(0), nb_skips(0), sum_gain(0), sum_cost(0) { }
+		long nb_calls;
+		long nb_skips;
+		double sum_gain;
+		double sum_cost;
+	};
+
+	/* number of operations done so far (see the cost of a call) */
+	double nb_operations() const;
+
+	/* level of depth of a box */
+	int level(const IntervalVector& box) const;
+
+	/* whether the ith contractor has to be called at this level */
+	bool must_call(int i, int lev) const;
+
+	Stat& stat(int i, int lev);
+
+	const Stat& stat(int i, int lev) const;
+
+	bool has_root;
+
+	IntervalVector root;
+
+	/* statistics, indexed by i*nb_levels+level */
+	std::vector<Stat> stats;
+
+	/* number of boxes contracted, per level */
+	std::vector<long> nb_boxes;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline CtcAdaptiveCompo::Stat& CtcAdaptiveCompo::stat(int i, int lev) {
+	return stats[i*nb_levels+lev];
+}
+
+inline const CtcAdaptiveCompo::Stat& CtcAdaptiveCompo::stat(int i, int lev) const {
+	return stats[i*nb_levels+lev];
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_CTC_ADAPTIVE_COMPO_H__
@@ -26,13 +26,19 @@ CtcExist::CtcExist(Ctc& ctc, const BitSet& vars, const IntervalVector& init_box,
 	CtcQuantif(ctc, VarSet(ctc.nb_var,vars,true), init_box, prec, own_ctc) {
 }
 
-bool CtcExist::proceed(const IntervalVector& x_init, const IntervalVector& x_current, IntervalVector& x_res, IntervalVector& y, ContractContext& context) {
+bool CtcExist::proceed(const IntervalVector& x_init, const IntervalVector& x_current, IntervalVector& x_res, IntervalVector& y,
+		ContractContext& context, vector<IntervalVector>* kept, bool& inactive_all) {
 	IntervalVector x = x_current;
 
+	// the parameter box is stored uncontracted in the paving (so
+	// that the two halves of a bisection can be merged again)
+	const IntervalVector y_bisected(kept? y : IntervalVector(1));
+
 	// TODO: handle impact!
 	bool inactive = CtcQuantif::contract(x, y);
 
 	if (x.is_empty()) {
+		// y is irrelevant (also for any sub-box of x_init)
 		return false;
 	}
 
@@ -42,9 +48,11 @@ bool CtcExist::proceed(const IntervalVector& x_init, const IntervalVector& x_cur
 		if (x==x_init) {
 			x_res =x_init;
 			context.output_flags.add(INACTIVE);
+			inactive_all = true;
 			return true;
 		} else {
 			x_res |= x;
+			if (kept) kept->push_back(y_bisected);
 			return false;
 		}
 	}
@@ -52,6 +60,7 @@ bool CtcExist::proceed(const IntervalVector& x_init, const IntervalVector& x_cur
 	if (!x.is_subset(x_res)) {
 		if (y.max_diam()<=prec) {
 			x_res |= x;
+			if (kept) kept->push_back(y_bisected);
 			if (x_res==x_init) return true;
 		}
 		else {
@@ -72,6 +81,7 @@ bool CtcExist::proceed(const IntervalVector& x_init, const IntervalVector& x_cur
 
 				if (inactive && (x==x_init)) {
 					context.output_flags.add(INACTIVE);
+					inactive_all = true;
 					return true;
 				}
 
@@ -81,6 +91,9 @@ bool CtcExist::proceed(const IntervalVector& x_init, const IntervalVector& x_cur
 			}
 			// =======================================================================
 		}
+	} else {
+		// y is not explored further but it may be relevant in a sub-box
+		if (kept) kept->push_back(y_bisected);
 	}
 	return false;
 }
@@ -93,21 +106,42 @@ void CtcExist::contract(IntervalVector& box) {
 void CtcExist::contract(IntervalVector& box, ContractContext& context) {
 	assert(box.size()==vars.nb_var);
 
+	// the paving of parameters inherited from the father box (if any)
+	BxpParamPaving* pav=paving(context);
+	bool reuse=pav && pav->is_uptodate(box, y_init);
+
+	if (reuse && pav->inactive()) {
+		context.output_flags.add(INACTIVE);
+		return;
+	}
+
 	// the returned box, initially empty
 	IntervalVector res=IntervalVector::empty(vars.nb_var);
 
 	assert(l.empty()); // old?--> even when an exception is thrown by this function, l is empty.
 
-	l.push(pair<IntervalVector,IntervalVector>(box, y_init));
-	
-	IntervalVector x_save(vars.nb_var);
-	IntervalVector x(vars.nb_var);
-
-	IntervalVector y(vars.nb_param);
-	IntervalVector y_mid(vars.nb_param); // for sampling
+	// the parameter boxes that remain relevant
+	vector<IntervalVector> kept;
+	vector<IntervalVector>* _kept = pav ? &kept : NULL;
+	bool inactive=false;
 
 	bool stop=false;
 
+	if (reuse) {
+		const vector<IntervalVector>& boxes=pav->boxes();
+		for (vector<IntervalVector>::const_iterator it=boxes.begin(); it!=boxes.end(); ++it) {
+			if (stop)
+				kept.push_back(*it);
+			else {
+				IntervalVector y=*it;
+				stop=proceed(box, box, res, y, context, _kept, inactive);
+			}
+		}
+	} else
+		l.push(pair<IntervalVector,IntervalVector>(box, y_init));
+	
+	IntervalVector x_save(vars.nb_var);
+
 	while ((!stop) && (!l.empty())) {
 
 		// get the domain of variables
@@ -118,14 +152,20 @@ void CtcExist::contract(IntervalVector& box, ContractContext& context) {
 		l.pop();
 
 		// proceed with the two sub-boxes for y
-		stop=proceed(box, x_save, res, cut.first, context);
-		if (!stop) stop=proceed(box, x_save, res, cut.second, context);
+		stop=proceed(box, x_save, res, cut.first, context, _kept, inactive);
+		if (!stop) stop=proceed(box, x_save, res, cut.second, context, _kept, inactive);
+		else if (pav) kept.push_back(cut.second);
 	}
 
-	while (!l.empty()) l.pop();
+	while (!l.empty()) {
+		if (pav) kept.push_back(l.top().second);
+		l.pop();
+	}
 
 	box &= res;
 
+	if (pav) set_paving(*pav, box, kept, inactive);
+
 	if (box.is_empty()) {
 		context.output_flags.add(FIXPOINT);
 	}
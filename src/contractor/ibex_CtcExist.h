@@ -14,6 +14,7 @@
 
 #include <stack>
 #include <list>
+#include <vector>
 
 namespace ibex {
 
@@ -27,6 +28,10 @@ namespace ibex {
  *    exists y in[y] |  c(x,y).
  *
  * where y is a vector of "parameters".
+ *
+ * When used in a search, the parameter boxes proven irrelevant for a box
+ * (no x in the box satisfies the constraint) are not explored again in
+ * the sub-boxes (see #CtcQuantif::add_property).
  */
 class CtcExist : public CtcQuantif {
 public:
@@ -73,8 +78,12 @@ private:
 	 * \param x_res:     the current state of the overall result (proj-union). Corresponds, at the end, to the result
 	 *                   of the contraction
 	 * \param y:         the current box "y"
+	 * \param kept:      if not NULL, the parameter boxes that have not been proven irrelevant
+	 *                   (see #BxpParamPaving) are added to this list.
+	 * \param inactive:  set to true if the constraint is satisfied for all x in x_init
 	 */
-	bool proceed(const IntervalVector& x_init, const IntervalVector& x_current, IntervalVector& x_res, IntervalVector& y, ContractContext& context);
+	bool proceed(const IntervalVector& x_init, const IntervalVector& x_current, IntervalVector& x_res, IntervalVector& y,
+			ContractContext& context, std::vector<IntervalVector>* kept, bool& inactive);
 
 	/**
 	 * Stack of pairs (x,y)
@@ -34,7 +34,7 @@ CtcForAll::CtcForAll(Ctc& ctc, const BitSet& vars, const IntervalVector& init_bo
 	CtcQuantif(ctc, VarSet(ctc.nb_var,vars,true), init_box, prec, own_ctc) {
 }
 
-void CtcForAll::proceed(IntervalVector& x, const IntervalVector& y, bool& is_inactive) {
+void CtcForAll::proceed(IntervalVector& x, const IntervalVector& y, bool& is_inactive, vector<IntervalVector>* kept) {
 
 	IntervalVector y_tmp = y.mid();
 
@@ -46,6 +46,20 @@ void CtcForAll::proceed(IntervalVector& x, const IntervalVector& y, bool& is_ina
 	if (y.max_diam()>prec) {
 		assert(y.is_bisectable());
 		l.push(y);
+	} else if (kept) {
+		// The parameter box is removed from the paving if
+		// the constraint is satisfied for all y in [y].
+		bool y_inactive = false;
+
+		if (tmp_inactive) {
+			y_tmp = y;
+			y_inactive = CtcQuantif::contract(x, y_tmp);
+			if (x.is_empty()) throw ForAllEmptyBox();
+		}
+
+		if (!y_inactive) kept->push_back(y);
+
+		is_inactive &= y_inactive;
 	} else {
 
 		if (is_inactive && tmp_inactive) {
@@ -66,12 +80,30 @@ void CtcForAll::contract(IntervalVector& box) {
 void CtcForAll::contract(IntervalVector& box, ContractContext& context) {
 	assert(box.size()==vars.nb_var);
 
+	// the paving of parameters inherited from the father box (if any)
+	BxpParamPaving* pav=paving(context);
+	bool reuse=pav && pav->is_uptodate(box, y_init);
+
+	if (reuse && pav->inactive()) {
+		context.output_flags.add(INACTIVE);
+		return;
+	}
+
 	assert(l.empty()); // old?--> when an exception is thrown by this function, l is flushed.
 
-	l.push(y_init);
+	// the parameter boxes where the constraint is not proven to be satisfied
+	vector<IntervalVector> kept;
+	vector<IntervalVector>* _kept = pav ? &kept : NULL;
 
 	bool is_inactive = true;
 	try {
+		if (reuse) {
+			const vector<IntervalVector>& boxes=pav->boxes();
+			for (vector<IntervalVector>::const_iterator it=boxes.begin(); it!=boxes.end(); ++it)
+				proceed(box, *it, is_inactive, _kept);
+		} else
+			l.push(y_init);
+
 		while (!l.empty()) {
 
 			// get and immediately bisect the domain of parameters (strategy inspired by Optimizer)
@@ -81,10 +113,10 @@ void CtcForAll::contract(IntervalVector& box, ContractContext& context) {
 				l.pop();
 
 				// proceed with the two sub-boxes for y
-				proceed(box, cut.first, is_inactive);
-				proceed(box, cut.second, is_inactive);
+				proceed(box, cut.first, is_inactive, _kept);
+				proceed(box, cut.second, is_inactive, _kept);
 			} catch(NoBisectableVariableException& e) { // e.g.: if y_init is degenerated
-				proceed(box, l.top(), is_inactive); // nothing should be pushed in the queue
+				proceed(box, l.top(), is_inactive, _kept); // nothing should be pushed in the queue
 				l.pop();
 			}
 		}
@@ -97,6 +129,9 @@ void CtcForAll::contract(IntervalVector& box, ContractContext& context) {
 		return;
 	}
 
+	// note: the paving is valid for the contracted box
+	if (pav) set_paving(*pav, box, kept, is_inactive);
+
 	if (is_inactive) context.output_flags.add(INACTIVE);
 
 }
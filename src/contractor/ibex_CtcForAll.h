@@ -13,6 +13,7 @@
 #include "ibex_CtcQuantif.h"
 
 #include <stack>
+#include <vector>
 
 namespace ibex {
 
@@ -26,6 +27,10 @@ namespace ibex {
  *    y in[y] =>  c(x,y).
  *
  * where y is a vector of "parameters".
+ *
+ * When used in a search, the parameter boxes for which the constraint is
+ * proven to be satisfied in a box are not explored again in the sub-boxes
+ * (see #CtcQuantif::add_property).
  */
 class CtcForAll : public CtcQuantif {
 public:
@@ -69,8 +74,10 @@ private:
 	 *
 	 * \param x:   the current box "x". Corresponds, at the end, to the result of the contraction
 	 * \param y:   the current box "y"
+	 * \param kept: if not NULL, the parameter boxes (of size <= prec) for which the constraint
+	 *             has not been proven to be satisfied are added to this list (see #BxpParamPaving).
 	 */
-	void proceed(IntervalVector& x, const IntervalVector& y, bool& is_inactive);
+	void proceed(IntervalVector& x, const IntervalVector& y, bool& is_inactive, std::vector<IntervalVector>* kept);
 
 	/**
 	 * Stack of y
@@ -27,8 +27,13 @@ class CtcLinearRelax : public CtcPolytopeHull {
 public:
 	/**
 	 * \brief Build the contractor.
+	 *
+	 * \param cut_pool - If true, the cuts are reused in sub-boxes as long as
+	 *                   the domains are not significantly reduced (see #BxpCutPool).
+	 *                   Reused cuts are less tight than new ones so this may
+	 *                   increase the number of cells (false by default).
 	 */
-	CtcLinearRelax(const ExtendedSystem& sys);
+	CtcLinearRelax(const ExtendedSystem& sys, bool cut_pool=false);
 
 	/**
 	 * \brief Delete this.
@@ -12,6 +12,8 @@
 
 #include "ibex_LinearizerFixed.h"
 
+#include "ibex_ThreadPool.h"
+
 using namespace std;
 
 namespace ibex {
@@ -28,7 +30,8 @@ CtcPolytopeHull::CtcPolytopeHull(Linearizer& lr, int max_iter, int time_out, dou
 		Ctc(lr.nb_var()), lr(lr),
 		limit_diam_box(eps>limit_diam.lb()? eps : limit_diam.lb(), limit_diam.ub()),
 		mylinearsolver(nb_var, max_iter, time_out, eps),
-		contracted_vars(BitSet::all(nb_var)), own_lr(false), primal_sols(2*nb_var, nb_var),
+		contracted_vars(BitSet::all(nb_var)), dual_tightening_enabled(false), dual_gap(default_dual_gap),
+		nb_threads(1), pool(NULL), own_lr(false), max_iter(max_iter), time_out(time_out), primal_sols(2*nb_var, nb_var),
 		primal_sol_found(2*nb_var) {
 
 }
@@ -37,12 +40,16 @@ CtcPolytopeHull::CtcPolytopeHull(const Matrix& A, const Vector& b, int max_iter,
 		Ctc(A.nb_cols()), lr(*new LinearizerFixed(A,b)),
 		limit_diam_box(eps>limit_diam.lb()? eps : limit_diam.lb(), limit_diam.ub()),
 		mylinearsolver(nb_var, max_iter, time_out, eps),
-		contracted_vars(BitSet::all(nb_var)), own_lr(true), primal_sols(2*nb_var, nb_var),
+		contracted_vars(BitSet::all(nb_var)), dual_tightening_enabled(false), dual_gap(default_dual_gap),
+		nb_threads(1), pool(NULL), own_lr(true), max_iter(max_iter), time_out(time_out), primal_sols(2*nb_var, nb_var),
 		primal_sol_found(2*nb_var) {
 
 }
 
 CtcPolytopeHull::~CtcPolytopeHull() {
+	for (vector<LPSolver*>::iterator it=thread_linearsolvers.begin(); it!=thread_linearsolvers.end(); it++)
+		delete *it;
+	delete pool;
 	if (own_lr) delete &lr;
 }
 
@@ -96,11 +103,30 @@ void CtcPolytopeHull::set_contracted_vars(const BitSet& vars) {
 	contracted_vars = vars;
 }
 
+void CtcPolytopeHull::set_dual_tightening(bool enable, double gap) {
+	if (enable && !LPSolver::has_basis_dual_var()) {
+		ibex_warning("CtcPolytopeHull: dual tightening not supported by the LP library (option ignored)");
+		enable = false;
+	}
+	dual_tightening_enabled = enable;
+	dual_gap = gap;
+}
+
+void CtcPolytopeHull::set_nb_threads(int n) {
+#ifdef _IBEX_WITH_THREADS_
+	nb_threads = n<1 ? 1 : n;
+	while ((int) thread_linearsolvers.size() < nb_threads-1)
+		thread_linearsolvers.push_back(new LPSolver(nb_var, max_iter, time_out, mylinearsolver.get_epsilon()));
+	delete pool;
+	pool = nb_threads>1 ? new ThreadPool(nb_threads) : NULL;
+#endif
+}
+
 void CtcPolytopeHull::optimizer(IntervalVector& box) {
 
-	Interval opt(0.0);
-	int* inf_bound = new int[nb_var]; // indicator inf_bound = 1 means the inf bound is feasible or already contracted, call to simplex useless (cf Baharev)
-	int* sup_bound = new int[nb_var]; // indicator sup_bound = 1 means the sup bound is feasible or already contracted, call to simplex useless
+	vector<int> inf_bound(nb_var); // indicator inf_bound = 1 means the inf bound is feasible or already contracted, call to simplex useless (cf Baharev)
+	vector<int> sup_bound(nb_var); // indicator sup_bound = 1 means the sup bound is feasible or already contracted, call to simplex useless
+	vector<char> sol_found(2*nb_var, 0);
 
 	for (int i=0; i<nb_var; i++) {
 
@@ -113,12 +139,105 @@ void CtcPolytopeHull::optimizer(IntervalVector& box) {
 		}
 	}
 
+	try {
+#ifdef _IBEX_WITH_THREADS_
+		if (nb_threads>1)
+			parallel_optimizer(box, &inf_bound[0], &sup_bound[0], &sol_found[0]);
+		else
+#endif
+		{
+			// Update the bounds the variables
+			mylinearsolver.set_bounds(box);
+			optimizer(mylinearsolver, box, &inf_bound[0], &sup_bound[0], &sol_found[0]);
+		}
+	} catch(LPException&) {
+		for (int k=0; k<2*nb_var; k++)
+			if (sol_found[k]) primal_sol_found.add(k);
+		throw;
+	}
+
+	for (int k=0; k<2*nb_var; k++)
+		if (sol_found[k]) primal_sol_found.add(k);
+}
+
+#ifdef _IBEX_WITH_THREADS_
+
+void CtcPolytopeHull::parallel_optimizer(IntervalVector& box, int* inf_bound, int* sup_bound, char* sol_found) {
+
+	// Copy the linear relaxation into the LP solvers of the other threads
+	// (the first thread uses mylinearsolver). The first nb_var rows are
+	// the bounds of the variables.
+	Matrix A = mylinearsolver.get_rows();
+	IntervalVector B = mylinearsolver.get_lhs_rhs();
+
+	for (int t=0; t<nb_threads-1; t++) {
+		LPSolver& lp = *thread_linearsolvers[t];
+		lp.clean_ctrs();
+		for (int r=nb_var; r<A.nb_rows(); r++) {
+			if (B[r].ub() < LPSolver::default_max_bound)
+				lp.add_constraint(A[r], LEQ, B[r].ub());
+			if (B[r].lb() > -LPSolver::default_max_bound)
+				lp.add_constraint(A[r], GEQ, B[r].lb());
+		}
+	}
+
+	// Distribute the bounds to be contracted among the threads
+	// (a bound marked 1 for a thread is not optimized by this thread).
+	vector<vector<int> > inf_bounds(nb_threads, vector<int>(nb_var,1));
+	vector<vector<int> > sup_bounds(nb_threads, vector<int>(nb_var,1));
+	int k=0;
+	for (int i=0; i<nb_var; i++) {
+		if (inf_bound[i]==0) inf_bounds[(k++)%nb_threads][i]=0;
+		if (sup_bound[i]==0) sup_bounds[(k++)%nb_threads][i]=0;
+	}
+
+	vector<IntervalVector> boxes(nb_threads, box);
+	vector<char> empty(nb_threads, 0);
+
+	// the rounding mode and the exceptions are handled by the pool
+	pool->run([&](int t) {
+		LPSolver& lp = t==0 ? mylinearsolver : *thread_linearsolvers[t-1];
+		try {
+			lp.set_bounds(boxes[t]);
+			optimizer(lp, boxes[t], &inf_bounds[t][0], &sup_bounds[t][0], sol_found);
+		} catch(PolytopeHullEmptyBoxException&) {
+			empty[t]=1;
+		} catch(LPException&) {
+			// keep the bounds contracted so far
+		}
+	});
+
+	for (int t=0; t<nb_threads; t++) {
+		if (empty[t]) throw PolytopeHullEmptyBoxException();
+		box &= boxes[t];
+	}
+
+	if (box.is_empty()) throw PolytopeHullEmptyBoxException();
+}
+
+#else
+
+void CtcPolytopeHull::parallel_optimizer(IntervalVector& box, int* inf_bound, int* sup_bound, char* sol_found) {
+	mylinearsolver.set_bounds(box);
+	optimizer(mylinearsolver, box, inf_bound, sup_bound, sol_found);
+}
+
+#endif
+
+void CtcPolytopeHull::optimizer(LPSolver& lp, IntervalVector& box, int* inf_bound, int* sup_bound, char* sol_found) {
+
+	Interval opt(0.0);
+
 	int nexti=-1;   // the next variable to be contracted
 	int infnexti=0; // the bound to be contracted contract  infnexti=0 for the lower bound, infnexti=1 for the upper bound
 	LPSolver::Status_Sol stat=LPSolver::UNKNOWN;
 
-	// Update the bounds the variables
-	mylinearsolver.set_bounds(box);
+	// start with the first bound to be contracted
+	for (int j=0; j<nb_var && nexti==-1; j++) {
+		if (inf_bound[j]==0) { nexti=j; infnexti=0; }
+		else if (sup_bound[j]==0) { nexti=j; infnexti=1; }
+	}
+	if (nexti==-1) return;
 
 	for(int ii=0; ii<(2*nb_var); ii++) {  // at most 2*n calls
 
@@ -129,29 +248,29 @@ void CtcPolytopeHull::optimizer(IntervalVector& box) {
 		if (infnexti==0 && inf_bound[i]==0)  // computing the left bound : minimizing x_i
 		{
 			inf_bound[i]=1;
-			stat = mylinearsolver.solve_var(LPSolver::MINIMIZE, i, opt);
+			stat = lp.solve_var(LPSolver::MINIMIZE, i, opt);
 			//cout << "[polytope-hull]->[optimize] simplex for left bound returns stat:" << stat <<  " opt: " << opt << endl;
 			if (stat == LPSolver::OPTIMAL_PROVED) {
 				if(opt.lb()>box[i].ub()) {
-					delete[] inf_bound;
-					delete[] sup_bound;
 					throw PolytopeHullEmptyBoxException();
 				}
-				primal_sols[2*i]=mylinearsolver.get_primal_sol();
-				primal_sol_found.add(2*i);
+				primal_sols[2*i]=lp.get_primal_sol();
+				sol_found[2*i]=1;
 
 				if(opt.lb() > box[i].lb()) {
 					box[i]=Interval(opt.lb(),box[i].ub());
-					mylinearsolver.set_bounds_var(i,box[i]);
+					lp.set_bounds_var(i,box[i]);
 				}
 
-				if (!choose_next_variable(box,nexti,infnexti, inf_bound, sup_bound)) {
+				if (dual_tightening_enabled && !dual_tightening(lp, box, inf_bound, sup_bound)) {
+					throw PolytopeHullEmptyBoxException();
+				}
+
+				if (!choose_next_variable(lp, box,nexti,infnexti, inf_bound, sup_bound)) {
 					break;
 				}
 			}
 			else if (stat == LPSolver::INFEASIBLE_PROVED) {
-				delete[] inf_bound;
-				delete[] sup_bound;
 				// the infeasibility is proved, the EmptyBox exception is raised
 				throw PolytopeHullEmptyBoxException();
 			}
@@ -179,30 +298,30 @@ void CtcPolytopeHull::optimizer(IntervalVector& box) {
 		}
 		else if (infnexti==1 && sup_bound[i]==0) { // computing the right bound :  maximizing x_i
 			sup_bound[i]=1;
-			stat= mylinearsolver.solve_var(LPSolver::MAXIMIZE, i, opt);
+			stat= lp.solve_var(LPSolver::MAXIMIZE, i, opt);
 			//cout << "[polytope-hull]->[optimize] simplex for right bound returns stat=" << stat << " opt=" << opt << endl;
 			if( stat == LPSolver::OPTIMAL_PROVED) {
 				if(opt.ub() <box[i].lb()) {
-					delete[] inf_bound;
-					delete[] sup_bound;
 					throw PolytopeHullEmptyBoxException();
 				}
 
-				primal_sols[2*i+1]=mylinearsolver.get_primal_sol();
-				primal_sol_found.add(2*i+1);
+				primal_sols[2*i+1]=lp.get_primal_sol();
+				sol_found[2*i+1]=1;
 
 				if (opt.ub() < box[i].ub()) {
 					box[i] =Interval( box[i].lb(), opt.ub());
-					mylinearsolver.set_bounds_var(i,box[i]);
+					lp.set_bounds_var(i,box[i]);
 				}
 
-				if (!choose_next_variable(box,nexti,infnexti, inf_bound, sup_bound)) {
+				if (dual_tightening_enabled && !dual_tightening(lp, box, inf_bound, sup_bound)) {
+					throw PolytopeHullEmptyBoxException();
+				}
+
+				if (!choose_next_variable(lp, box,nexti,infnexti, inf_bound, sup_bound)) {
 					break;
 				}
 			}
 			else if(stat == LPSolver::INFEASIBLE_PROVED) {
-				delete[] inf_bound;
-				delete[] sup_bound;
 				// the infeasibility is proved,  the EmptyBox exception is raised
 				throw PolytopeHullEmptyBoxException();
 			}
@@ -228,24 +347,91 @@ void CtcPolytopeHull::optimizer(IntervalVector& box) {
 		}
 		else break; // in case of stat==MAX_ITER  we do not recall the simplex on a another variable  (for efficiency reason)
 	}
-	delete[] inf_bound;
-	delete[] sup_bound;
 }
 
-bool CtcPolytopeHull::choose_next_variable(IntervalVector & box, int & nexti, int & infnexti, int* inf_bound, int* sup_bound) {
+bool CtcPolytopeHull::dual_tightening(LPSolver& lp, IntervalVector& box, int* inf_bound, int* sup_bound) {
+
+	Vector primal_solution(nb_var);
+	Matrix A_trans(1,1);
+	IntervalVector B(1);
+
+	try {
+		primal_solution = lp.get_primal_sol();
+		A_trans = lp.get_rows_trans();
+		B = lp.get_lhs_rhs();
+	} catch (LPException&) {
+		return true;
+	}
+
+	for (int j=0; j<nb_var; j++) {
+
+		// Note: if the LP solution is already close to the bound, there
+		// is nothing to gain (see choose_next_variable). This test comes
+		// first because computing the multipliers is expensive.
+		double gap = dual_gap*box[j].diam();
+
+		bool try_lb = inf_bound[j]==0 && primal_solution[j] - box[j].lb() > gap;
+		bool try_ub = sup_bound[j]==0 && box[j].ub() - primal_solution[j] > gap;
+
+		if (!try_lb && !try_ub) continue;
+
+		// multipliers for minimizing x_j (the opposite for maximizing x_j)
+		Vector dual(1);
+		try {
+			dual = lp.get_basis_dual_var(j);
+		} catch (LPException&) {
+			return true; // basis not available: the bounds will be optimized one by one
+		}
+
+		// Non-rigorous estimates of the minimum and maximum of x_j, assuming
+		// that the transposed rows combined by the multipliers give exactly x_j
+		// (the rigorous bounds are only computed if the estimates are useful).
+		double est_min=0, est_max=0;
+		for (int i=0; i<dual.size(); i++) {
+			if (dual[i]>0) { est_min += dual[i]*B[i].lb(); est_max += dual[i]*B[i].ub(); }
+			else if (dual[i]<0) { est_min += dual[i]*B[i].ub(); est_max += dual[i]*B[i].lb(); }
+		}
+
+		if (try_lb && (est_min > box[j].lb() || primal_solution[j] - est_min <= gap)) {
+			double lb = lp.neumaier_shcherbina_postprocessing_var(j, LPSolver::MINIMIZE, dual, A_trans, B).lb();
+			if (lb > box[j].ub()) return false;
+			if (lb > box[j].lb()) {
+				box[j] = Interval(lb, box[j].ub());
+				lp.set_bounds_var(j,box[j]);
+			}
+			// the minimum of x_j lies between lb and the current LP solution
+			if (!box[j].is_unbounded() && primal_solution[j] - box[j].lb() <= gap)
+				inf_bound[j]=1;
+		}
+
+		if (try_ub && (est_max < box[j].ub() || est_max - primal_solution[j] <= gap)) {
+			double ub = lp.neumaier_shcherbina_postprocessing_var(j, LPSolver::MAXIMIZE, -dual, A_trans, B).ub();
+			if (ub < box[j].lb()) return false;
+			if (ub < box[j].ub()) {
+				box[j] = Interval(box[j].lb(), ub);
+				lp.set_bounds_var(j,box[j]);
+			}
+			if (!box[j].is_unbounded() && box[j].ub() - primal_solution[j] <= gap)
+				sup_bound[j]=1;
+		}
+	}
+	return true;
+}
+
+bool CtcPolytopeHull::choose_next_variable(LPSolver& lp, IntervalVector & box, int & nexti, int & infnexti, int* inf_bound, int* sup_bound) {
 
 	bool found = false;
 
 	try {
 		// the primal solution : used by choose_next_variable
-		Vector primal_solution = mylinearsolver.get_primal_sol();
+		Vector primal_solution = lp.get_primal_sol();
 		//cout << " primal " << primal_solution << endl;
 
 		// The Achterberg heuristic for choosing the next variable (nexti) and its bound (infnexti) to be contracted (cf Baharev paper)
 		// and updating the indicators if a bound has been found feasible (with the precision prec_bound)
 		// called only when a primal solution is found by the LP solver (use of primal_solution)
 
-		// double prec_bound = mylinearsolver.getEpsilon(); // relative precision for the indicators TODO change with the precision of the optimizer ??
+		// double prec_bound = lp.getEpsilon(); // relative precision for the indicators TODO change with the precision of the optimizer ??
 		double prec_bound = 1.e-8; // relative precision for the indicators      :  compatibility for testing  BNE
 		double delta=1.e100;
 		double deltaj=delta;
@@ -307,6 +493,10 @@ CtcPolytopeHull::~CtcPolytopeHull() { }
 
 void CtcPolytopeHull::set_contracted_vars(const BitSet& vars) { }
 
+void CtcPolytopeHull::set_dual_tightening(bool enable, double gap) { }
+
+void CtcPolytopeHull::set_nb_threads(int n) { }
+
 void CtcPolytopeHull::contract(IntervalVector& box) { }
 
 #endif /// end _IBEX_WITH_NOLP_
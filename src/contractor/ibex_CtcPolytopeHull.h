@@ -16,8 +16,12 @@
 #include "ibex_LPSolver.h"
 #include "ibex_BitSet.h"
 
+#include <vector>
+
 namespace ibex {
 
+class ThreadPool;
+
 /**
  * \brief Contract the bounds of a box with respect to a polytope.
  *
@@ -90,6 +94,39 @@ public:
 	 */
 	void set_contracted_vars(const BitSet& vars);
 
+	/**
+	 * \brief Enable dual-based bound tightening (disabled by default).
+	 *
+	 * After each LP resolution, the multipliers of the current basis
+	 * (see LPSolver::get_basis_dual_var) give a rigorous bound for every
+	 * variable at once. A bound is then optimized individually only if this
+	 * estimate is too loose, that is, if its distance to the current LP
+	 * solution exceeds \a gap times the diameter of the domain.
+	 *
+	 * Only available with the builtin LP library: with other libraries (see
+	 * LPSolver::has_basis_dual_var), a warning is issued and the option
+	 * remains disabled.
+	 */
+	void set_dual_tightening(bool enable, double gap=default_dual_gap);
+
+	/**
+	 * \brief Default relative gap for dual-based bound tightening.
+	 */
+	static constexpr double default_dual_gap = 1e-3;
+
+	/**
+	 * \brief Set the number of threads (1 by default).
+	 *
+	 * With n>1 threads, the bounds to be contracted are distributed among
+	 * the n threads of a pool created once for all (see #ibex::ThreadPool).
+	 * Each thread owns its LP solver, filled at each call to
+	 * contract(...) with a copy of the linear relaxation. The box is then
+	 * intersected with the bounds obtained by all the threads.
+	 *
+	 * Has no effect if Ibex is built without thread support.
+	 */
+	void set_nb_threads(int n);
+
 	/**
 	 * \brief Return the argmin of one LP problem
 	 *
@@ -112,13 +149,34 @@ protected:
 	/**
 	 * Achterberg heuristic for choosing the next variable  and which bound to optimize
 	 */
-	bool choose_next_variable(IntervalVector &box,  int & nexti, int & infnexti, int* inf_bound, int* sup_bound);
+	bool choose_next_variable(LPSolver& lp, IntervalVector &box,  int & nexti, int & infnexti, int* inf_bound, int* sup_bound);
 
 	/**
 	 * TODO: add comment.
 	 */
 	void optimizer(IntervalVector &box);
 
+	/**
+	 * Optimize with the LP solver \a lp the bounds not already
+	 * marked in \a inf_bound and \a sup_bound. The kth primal solution
+	 * found is marked in \a sol_found.
+	 */
+	void optimizer(LPSolver& lp, IntervalVector &box, int* inf_bound, int* sup_bound, char* sol_found);
+
+	/**
+	 * Same as the previous function but the bounds are distributed
+	 * among several threads (see #set_nb_threads).
+	 */
+	void parallel_optimizer(IntervalVector &box, int* inf_bound, int* sup_bound, char* sol_found);
+
+	/**
+	 * Tighten all the bounds not yet contracted using the multipliers
+	 * of the current basis (see #set_dual_tightening).
+	 *
+	 * \return false if the box is proved to be empty.
+	 */
+	bool dual_tightening(LPSolver& lp, IntervalVector &box, int* inf_bound, int* sup_bound);
+
 	/**
 	 * \brief The linearization technique
 	 */
@@ -139,9 +197,37 @@ protected:
 	 */
 	BitSet contracted_vars;
 
+	/**
+	 * \brief Whether dual-based bound tightening is enabled.
+	 */
+	bool dual_tightening_enabled;
+
+	/**
+	 * \brief Relative gap for dual-based bound tightening.
+	 */
+	double dual_gap;
+
+	/**
+	 * \brief Number of threads.
+	 */
+	int nb_threads;
+
+	/**
+	 * \brief The linear solvers of the threads (except the first one, which
+	 * uses #mylinearsolver).
+	 */
+	std::vector<LPSolver*> thread_linearsolvers;
+
+	/**
+	 * \brief The pool of threads (NULL in sequential mode).
+	 */
+	ThreadPool* pool;
+
 private:
 	bool own_lr; // for memory cleanup
 
+	int max_iter, time_out; // for building the linear solvers of the threads
+
 	/*
 	 * 2*n primal solutions (row by row).
 	 * The argmin of minimizing xi is at the (2*i)th row
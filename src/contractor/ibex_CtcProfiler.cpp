@@ -0,0 +1,43 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CtcProfiler.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_CtcProfiler.h"
+
+using namespace std;
+
+namespace ibex {
+
+CtcProfiler::CtcProfiler(Ctc& ctc, Profiler& profiler, const string& name) : Ctc(ctc.nb_var), ctc(ctc),
+		entry(profiler.add(name.empty() ? Profiler::class_name(typeid(ctc)) : name)) {
+	input = ctc.input;
+	output = ctc.output;
+}
+
+void CtcProfiler::contract(IntervalVector& box) {
+	IntervalVector before(box);
+	{
+		Profiler::Measure m(entry);
+		ctc.contract(box);
+	}
+	entry.add_reduction(before,box);
+}
+
+void CtcProfiler::contract(IntervalVector& box, ContractContext& context) {
+	IntervalVector before(box);
+	{
+		Profiler::Measure m(entry);
+		ctc.contract(box,context);
+	}
+	entry.add_reduction(before,box);
+}
+
+void CtcProfiler::add_property(const IntervalVector& init_box, BoxProperties& prop) {
+	ctc.add_property(init_box,prop);
+}
+
+} // end namespace ibex
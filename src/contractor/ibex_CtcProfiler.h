@@ -0,0 +1,66 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CtcProfiler.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_CTC_PROFILER_H__
+#define __IBEX_CTC_PROFILER_H__
+
+#include "ibex_Ctc.h"
+#include "ibex_Profiler.h"
+
+namespace ibex {
+
+/**
+ * \ingroup contractor
+ *
+ * \brief Profiling wrapper of a contractor.
+ *
+ * Forwards all the calls to a contractor and records in a profiler
+ * entry the number of calls, the time spent and the reduction of
+ * the box (see #ibex::Profiler).
+ */
+class CtcProfiler : public Ctc {
+public:
+
+	/**
+	 * \brief Wrap a contractor.
+	 *
+	 * \param ctc      - the profiled contractor
+	 * \param profiler - where a new entry is created for ctc
+	 * \param name     - name of the entry. By default: the name of the class of ctc.
+	 */
+	CtcProfiler(Ctc& ctc, Profiler& profiler, const std::string& name="");
+
+	/**
+	 * \brief Contract a box.
+	 */
+	virtual void contract(IntervalVector& box);
+
+	/**
+	 * \brief Contract a box (the context is forwarded).
+	 */
+	virtual void contract(IntervalVector& box, ContractContext& context);
+
+	/**
+	 * \brief Add the properties required by the profiled contractor.
+	 */
+	virtual void add_property(const IntervalVector& init_box, BoxProperties& prop);
+
+	/**
+	 * \brief The profiled contractor.
+	 */
+	Ctc& ctc;
+
+	/**
+	 * \brief The counters.
+	 */
+	Profiler::Entry& entry;
+};
+
+} // end namespace ibex
+
+#endif // __IBEX_CTC_PROFILER_H__
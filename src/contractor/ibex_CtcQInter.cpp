@@ -38,7 +38,7 @@ void CtcQInter::contract(IntervalVector& box, ContractContext& context) {
 		refs.set_ref(i,boxes[i]);
 	}
 
-	box = qinter(refs,q);
+	box = qinter(refs,q,proj);
 
 	context.prop.update(BoxEvent(box,BoxEvent::CONTRACT));
 
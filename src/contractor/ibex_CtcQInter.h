@@ -14,6 +14,7 @@
 #include "ibex_Ctc.h"
 #include "ibex_Array.h"
 #include "ibex_IntervalMatrix.h"
+#include "ibex_QInterProjection.h"
 
 namespace ibex {
 
@@ -59,6 +60,7 @@ public:
 
 protected:
 	IntervalMatrix boxes; // store boxes for each contraction
+	QInterProjection proj; // sorted bounds of the boxes, kept between two contractions
 };
 
 } // end namespace ibex
@@ -9,16 +9,20 @@
 
 #include "ibex_CtcQuantif.h"
 #include "ibex_CtcFwdBwd.h"
+#include "ibex_Id.h"
 
 #include <cassert>
 
+using namespace std;
+
 namespace ibex {
 
+const int CtcQuantif::default_paving_size = 256;
 
 CtcQuantif::CtcQuantif(const NumConstraint& ctr, const VarSet& _vars, const IntervalVector& init_box, double prec) :
 				Ctc(_vars.nb_var), y_init(init_box),
-				ctc(new CtcFwdBwd(ctr)), bsc(new LargestFirst(prec)),
-				vars(_vars), prec(prec), _own_ctc(true) {
+				paving_size(default_paving_size), ctc(new CtcFwdBwd(ctr)), bsc(new LargestFirst(prec)),
+				vars(_vars), prec(prec), paving_id(next_id()), _own_ctc(true) {
 
 	assert(vars.nb_var>0);
 	assert(vars.nb_param>0); // sure?
@@ -28,8 +32,8 @@ CtcQuantif::CtcQuantif(const NumConstraint& ctr, const VarSet& _vars, const Inte
 
 CtcQuantif::CtcQuantif(Ctc& ctc, const VarSet& _vars, const IntervalVector& init_box, double prec, bool own_ctc) :
 			   Ctc(_vars.nb_var), y_init(init_box),
-			   ctc(&ctc), bsc(new LargestFirst(prec)),
-			   vars(_vars), prec(prec), _own_ctc(own_ctc) {
+			   paving_size(default_paving_size), ctc(&ctc), bsc(new LargestFirst(prec)),
+			   vars(_vars), prec(prec), paving_id(next_id()), _own_ctc(own_ctc) {
 
 	assert(ctc.nb_var==_vars.nb_var+_vars.nb_param);
 
@@ -55,4 +59,60 @@ bool CtcQuantif::contract(IntervalVector& x, IntervalVector& y) {
 	return slice_context.output_flags[INACTIVE];
 }
 
+void CtcQuantif::add_property(const IntervalVector& init_box, BoxProperties& prop) {
+	if (paving_size>0 && !prop[paving_id])
+		prop.add(new BxpParamPaving(paving_id));
+}
+
+BxpParamPaving* CtcQuantif::paving(ContractContext& context) {
+	if (paving_size<=0) return NULL;
+	return (BxpParamPaving*) context.prop[paving_id];
+}
+
+namespace {
+
+/*
+ * Whether the union of a and b is a box, i.e., a and b
+ * are the two halves of a bisection.
+ */
+bool mergeable(const IntervalVector& a, const IntervalVector& b) {
+	int k=-1;
+	for (int i=0; i<a.size(); i++) {
+		if (a[i]==b[i]) continue;
+		if (k!=-1 || (a[i].ub()!=b[i].lb() && b[i].ub()!=a[i].lb()))
+			return false;
+		k=i;
+	}
+	return true;
+}
+
+}
+
+void CtcQuantif::set_paving(BxpParamPaving& p, const IntervalVector& x, vector<IntervalVector>& boxes, bool inactive) {
+	// The boxes are produced by a depth-first exploration so
+	// the two halves of a bisection are often consecutive.
+	bool merged=true;
+	while ((int) boxes.size()>paving_size && merged) {
+		merged=false;
+		size_t k=0;
+		for (size_t i=0; i<boxes.size(); i++, k++) {
+			if (i+1<boxes.size() && mergeable(boxes[i],boxes[i+1])) {
+				boxes[k] = boxes[i] | boxes[i+1];
+				merged=true;
+				i++;
+			} else if (k<i)
+				boxes[k] = boxes[i];
+		}
+		boxes.resize(k, IntervalVector(y_init.size()));
+	}
+
+	if ((int) boxes.size()>paving_size)
+		// Merging boxes that do not form a partition would
+		// make parameter boxes overlap (which is correct
+		// but causes redundant work in sub-boxes).
+		p.clear();
+	else
+		p.set(x, y_init, boxes, inactive);
+}
+
 } // namespace ibex
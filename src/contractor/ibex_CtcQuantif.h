@@ -16,6 +16,9 @@
 #include "ibex_NumConstraint.h"
 #include "ibex_BitSet.h"
 #include "ibex_VarSet.h"
+#include "ibex_BxpParamPaving.h"
+
+#include <vector>
 
 namespace ibex {
 
@@ -63,11 +66,35 @@ public:
 	 */
 	virtual ~CtcQuantif();
 
+	/**
+	 * \brief Add the paving of parameters to the properties.
+	 *
+	 * In a search (solver, optimizer, etc.), the parameter boxes that
+	 * are irrelevant or already decided for a box are not explored
+	 * again in its sub-boxes (see #BxpParamPaving).
+	 */
+	virtual void add_property(const IntervalVector& init_box, BoxProperties& prop);
+
 	/**
 	 * \brief Initial box of the parameters (can be set dynamically)
 	 */
 	IntervalVector y_init;
 
+	/**
+	 * \brief Maximal number of parameter boxes in the paving property.
+	 *
+	 * Beyond this size, the two halves of a bisection are merged (and the
+	 * paving is not stored if this is not enough). If set to 0,
+	 * the paving is not stored (parameters are explored from y_init at
+	 * each call). Default value: #default_paving_size.
+	 */
+	int paving_size;
+
+	/**
+	 * \brief Default maximal number of parameter boxes in the paving: 256.
+	 */
+	static const int default_paving_size;
+
 protected:
 	/**
 	 * \brief Contract the "full" box (x,y)
@@ -79,6 +106,19 @@ protected:
 	 */
 	bool contract(IntervalVector& x, IntervalVector& y);
 
+	/**
+	 * \brief The paving property of the box (NULL if none or disabled).
+	 */
+	BxpParamPaving* paving(ContractContext& context);
+
+	/**
+	 * \brief Store a paving calculated for the box x.
+	 *
+	 * The two halves of a bisection are merged if there are more than
+	 * #paving_size boxes. If this is not enough, the paving is removed.
+	 */
+	void set_paving(BxpParamPaving& p, const IntervalVector& x, std::vector<IntervalVector>& boxes, bool inactive);
+
 	/**
 	 * \brief The Contractor.
 	 */
@@ -100,6 +140,11 @@ protected:
 	 */
 	double prec;
 
+	/**
+	 * \brief Id of the paving property.
+	 */
+	const long paving_id;
+
 private:
 
 	/* Information for cleanup only */
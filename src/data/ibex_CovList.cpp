@@ -95,20 +95,26 @@ IntervalVector CovList::read_box(ifstream& f, size_t n) {
 
 	IntervalVector box(n);
 
+	// read all the bounds at once
+	vector<double> bounds(2*n);
+	f.read((char*) bounds.data(), bounds.size()*sizeof(double));
+	if (f.eof()) ibex_error("[CovList]: unexpected end of file.");
+
 	for (unsigned int j=0; j<n; j++) {
-		double lb=read_double(f);
-		double ub=read_double(f);
-		box[j]=Interval(lb,ub);
+		box[j]=Interval(bounds[2*j],bounds[2*j+1]);
 	}
 
 	return box;
 }
 
 void CovList::write_box(ofstream& f, const IntervalVector& box) {
+	// write all the bounds at once
+	vector<double> bounds(2*box.size());
 	for (int i=0; i<box.size(); i++) {
-		write_double(f,box[i].lb());
-		write_double(f,box[i].ub());
+		bounds[2*i]=box[i].lb();
+		bounds[2*i+1]=box[i].ub();
 	}
+	f.write((const char*) bounds.data(), bounds.size()*sizeof(double));
 }
 
 ifstream* CovList::read(const char* filename, CovList& cov, std::stack<unsigned int>& format_id, std::stack<unsigned int>& format_version) {
@@ -11,6 +11,7 @@
 
 #include "ibex_Function.h"
 #include "ibex_Eval.h"
+#include "ibex_Counters.h"
 
 #include <typeinfo>
 
@@ -46,6 +47,8 @@ Eval::~Eval() {
 
 Domain& Eval::eval(const Array<const Domain>& d2) {
 
+	Counters::incr(Counters::EVAL);
+
 	d.write_arg_domains(d2);
 
 	//------------- for debug
@@ -64,6 +67,8 @@ Domain& Eval::eval(const Array<const Domain>& d2) {
 
 Domain& Eval::eval(const Array<Domain>& d2) {
 
+	Counters::incr(Counters::EVAL);
+
 	d.write_arg_domains(d2);
 
 	try {
@@ -76,6 +81,8 @@ Domain& Eval::eval(const Array<Domain>& d2) {
 
 Domain& Eval::eval(const IntervalVector& box) {
 
+	Counters::incr(Counters::EVAL);
+
 	d.write_arg_domains(box);
 
 	try {
@@ -118,6 +125,8 @@ IntervalVector Eval::eval(const IntervalVector& box, const BitSet& components) {
 		return res;
 	}
 
+	Counters::incr(Counters::EVAL);
+
 	// merge all the agendas
 	int c;
 	Agenda a(f.nodes.size()); // the global agenda initialized with the maximal possible value
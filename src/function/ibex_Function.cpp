@@ -55,6 +55,7 @@ Function::~Function() {
 
 	if (_eval!=NULL) {
 		delete _eval;
+		delete _point_eval;
 		delete _hc4revise;
 		delete _grad;
 		delete _inhc4revise;
@@ -29,6 +29,7 @@ namespace ibex {
 class System;
 class VarSet;
 class Eval;
+class PointEval;
 class HC4Revise;
 class Gradient;
 class InHC4Revise;
@@ -802,6 +803,13 @@ public:
 	 */
 	Eval& basic_evaluator() const;
 
+	/*
+	 * \brief Get a reference to the floating-point evaluator.
+	 *
+	 * For internal purposes.
+	 */
+	PointEval& point_evaluator() const;
+
 	/*
 	 * \brief Get a reference to the evaluator.
 	 *
@@ -919,6 +927,7 @@ private:
 	Function *zero;
 
 	Eval *_eval;
+	PointEval *_point_eval;
 	HC4Revise *_hc4revise;
 	// TODO: actually never used if f is vector/matrix valued
 	Gradient *_grad;
@@ -928,6 +937,7 @@ private:
 } // end namespace
 
 #include "ibex_Eval.h"
+#include "ibex_PointEval.h"
 #include "ibex_Gradient.h"
 #include "ibex_HC4Revise.h"
 #include "ibex_InHC4Revise.h"
@@ -1143,6 +1153,10 @@ inline Eval& Function::basic_evaluator() const {
 	return *_eval;
 }
 
+inline PointEval& Function::point_evaluator() const {
+	return *_point_eval;
+}
+
 inline Gradient& Function::deriv_calculator() const {
 	return *_grad;
 }
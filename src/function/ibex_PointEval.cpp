@@ -0,0 +1,828 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_PointEval.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_PointEval.h"
+#include "ibex_Function.h"
+#include "ibex_Counters.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// cth component of a domain (matrices are read row by row)
+Interval& comp(Domain& d, int c) {
+	switch (d.dim.type()) {
+	case Dim::SCALAR:     return d.i();
+	case Dim::ROW_VECTOR:
+	case Dim::COL_VECTOR: return d.v()[c];
+	default:              return d.m()[c/d.dim.nb_cols()][c%d.dim.nb_cols()];
+	}
+}
+
+} // end anonymous namespace
+
+PointEval::PointEval(Function& f) : f(f), K(0), offset(f.nb_nodes()), nb_comp(0), first_var(f.nb_arg()) {
+	for (int i=0; i<f.nb_nodes(); i++) {
+		offset[i]=nb_comp;
+		nb_comp+=f.node(i).dim.size();
+	}
+
+	int n=0;
+	for (int s=0; s<f.nb_arg(); s++) {
+		first_var[s]=n;
+		n+=f.arg(s).dim.size();
+	}
+}
+
+void PointEval::resize(int K) {
+	if (this->K==K) return;
+	this->K=K;
+	data.resize(((size_t) nb_comp)*K);
+	if (!grad.empty()) grad.resize(data.size());
+}
+
+void PointEval::write_args(const Matrix& pts) {
+	assert(pts.nb_cols()==f.nb_var());
+
+	resize(pts.nb_rows());
+
+	for (int s=0; s<f.nb_arg(); s++) {
+		int x=f.nodes.rank(f.arg(s));
+		for (int c=0; c<f.arg(s).dim.size(); c++) {
+			double* v=val(x,c);
+			for (int k=0; k<K; k++)
+				v[k]=pts[k][first_var[s]+c];
+		}
+	}
+}
+
+void PointEval::write_args(const Vector& x) {
+	assert(x.size()==f.nb_var());
+
+	resize(1);
+
+	for (int s=0; s<f.nb_arg(); s++)
+		std::copy(&x[first_var[s]], &x[first_var[s]]+f.arg(s).dim.size(), val(f.nodes.rank(f.arg(s))));
+}
+
+void PointEval::eval(const Matrix& pts, Matrix& res) {
+	int m=f.image_dim();
+
+	if (res.nb_rows()!=pts.nb_rows() || res.nb_cols()!=m)
+		res.resize(pts.nb_rows(),m);
+
+	if (pts.nb_rows()==0) return;
+
+	write_args(pts);
+
+	f.forward<PointEval>(*this);
+	Counters::incr(Counters::EVAL, K);
+
+	for (int c=0; c<m; c++) {
+		const double* v=val(0,c);
+		for (int k=0; k<K; k++)
+			res[k][c]=v[k];
+	}
+}
+
+double PointEval::eval(const Vector& x) {
+	assert(f.image_dim()==1);
+
+	write_args(x);
+	f.forward<PointEval>(*this);
+	Counters::incr(Counters::EVAL, K);
+	return *val(0);
+}
+
+Vector PointEval::eval_vector(const Vector& x) {
+	write_args(x);
+	f.forward<PointEval>(*this);
+	Counters::incr(Counters::EVAL, K);
+	return Vector(f.image_dim(), val(0));
+}
+
+void PointEval::backward() {
+	if (grad.size()!=data.size()) grad.resize(data.size());
+
+	// the root node comes first
+	std::fill(grad.begin()+f.expr().dim.size()*K, grad.end(), 0.0);
+
+	f.cf.backward<PointEval>(*this);
+}
+
+void PointEval::read_gradient(Vector& g, int k) {
+	for (int s=0; s<f.nb_arg(); s++) {
+		int x=f.nodes.rank(f.arg(s));
+		for (int c=0; c<f.arg(s).dim.size(); c++)
+			g[first_var[s]+c]=adj(x,c)[k];
+	}
+}
+
+void PointEval::gradient(const Matrix& pts, Matrix& g) {
+	assert(f.image_dim()==1);
+
+	if (g.nb_rows()!=pts.nb_rows() || g.nb_cols()!=f.nb_var())
+		g.resize(pts.nb_rows(),f.nb_var());
+
+	if (pts.nb_rows()==0) return;
+
+	write_args(pts);
+	f.forward<PointEval>(*this);
+	Counters::incr(Counters::EVAL, K);
+
+	if (grad.size()!=data.size()) grad.resize(data.size());
+	std::fill(adj(0),adj(0)+K,1.0);
+	backward();
+
+	for (int k=0; k<K; k++)
+		read_gradient(g[k],k);
+}
+
+void PointEval::gradient(const Vector& x, Vector& g) {
+	assert(f.image_dim()==1);
+	assert(g.size()==f.nb_var());
+
+	write_args(x);
+	f.forward<PointEval>(*this);
+	Counters::incr(Counters::EVAL, K);
+
+	if (grad.size()!=data.size()) grad.resize(data.size());
+	*adj(0)=1.0;
+	backward();
+
+	read_gradient(g);
+}
+
+void PointEval::jacobian(const Vector& x, Matrix& J) {
+	int m=f.image_dim();
+
+	if (J.nb_rows()!=m || J.nb_cols()!=f.nb_var())
+		J.resize(m,f.nb_var());
+
+	write_args(x);
+	f.forward<PointEval>(*this);
+	Counters::incr(Counters::EVAL, K);
+
+	if (grad.size()!=data.size()) grad.resize(data.size());
+
+	for (int i=0; i<m; i++) {
+		std::fill(adj(0),adj(0)+m,0.0);
+		*adj(0,i)=1.0;
+		backward();
+		read_gradient(J[i]);
+	}
+}
+
+Domain PointEval::to_domain(int x, int k, bool adjoint) {
+	Domain d(f.node(x).dim);
+	for (int c=0; c<d.dim.size(); c++)
+		comp(d,c)=adjoint? adj(x,c)[k] : val(x,c)[k];
+	return d;
+}
+
+void PointEval::copy_block(int x, int nb_cols, int r1, int c1, int nr, int nc, int y, int y_nb_cols, int yr1, int yc1, bool bwd) {
+	for (int i=0; i<nr; i++)
+		for (int j=0; j<nc; j++) {
+			int cx=(r1+i)*nb_cols+c1+j;
+			int cy=(yr1+i)*y_nb_cols+yc1+j;
+			if (bwd) {
+				const double* a=adj(y,cy);
+				double* r=adj(x,cx);
+				for (int k=0; k<K; k++)
+					r[k]+=a[k];
+			} else {
+				const double* a=val(x,cx);
+				std::copy(a,a+K,val(y,cy));
+			}
+		}
+}
+
+void PointEval::idx_fwd(int x, int y) {
+	idx_cp_fwd(x,y);
+}
+
+void PointEval::idx_cp_fwd(int x, int y) {
+	assert(dynamic_cast<const ExprIndex*> (&f.node(y)));
+
+	const ExprIndex& e = (const ExprIndex&) f.node(y);
+	const DoubleIndex& idx=e.index;
+
+	copy_block(x, f.node(x).dim.nb_cols(), idx.first_row(), idx.first_col(), idx.nb_rows(), idx.nb_cols(), y, idx.nb_cols(), 0, 0);
+}
+
+void PointEval::symbol_fwd(int) {
+	/* nothing to do (already written by eval) */
+}
+
+void PointEval::cst_fwd(int y) {
+	const ExprConstant& c = (const ExprConstant&) f.node(y);
+	const Dim& dim=c.dim;
+
+	for (int i=0; i<dim.size(); i++) {
+		double v;
+		switch (dim.type()) {
+		case Dim::SCALAR:     v=c.get_value().mid(); break;
+		case Dim::ROW_VECTOR:
+		case Dim::COL_VECTOR: v=c.get_vector_value()[i].mid(); break;
+		default:              v=c.get_matrix_value()[i/dim.nb_cols()][i%dim.nb_cols()].mid(); break;
+		}
+		std::fill(val(y,i),val(y,i)+K,v);
+	}
+}
+
+void PointEval::vector_fwd(int* x, int y) {
+	assert(dynamic_cast<const ExprVector*>(&(f.node(y))));
+
+	const ExprVector& v = (const ExprVector&) f.node(y);
+
+	int j=0;
+
+	if (v.dim.is_vector()) {
+		// concatenation
+		for (int i=0; i<v.length(); i++) {
+			int size=v.arg(i).dim.size();
+			std::copy(val(x[i]),val(x[i])+size*K,val(y,j));
+			j+=size;
+		}
+	} else {
+		int nb_cols=v.dim.nb_cols();
+		for (int i=0; i<v.length(); i++) {
+			const Dim& d=v.arg(i).dim;
+			if (v.row_vector()) {
+				// arguments are columns
+				int nc=d.is_matrix() ? d.nb_cols() : 1;
+				copy_block(x[i], nc, 0, 0, v.dim.nb_rows(), nc, y, nb_cols, 0, j);
+				j+=nc;
+			} else {
+				// arguments are rows
+				int nr=d.is_matrix() ? d.nb_rows() : 1;
+				copy_block(x[i], nb_cols, 0, 0, nr, nb_cols, y, nb_cols, j, 0);
+				j+=nr;
+			}
+		}
+	}
+}
+
+void PointEval::apply_fwd(int* x, int y) {
+	assert(dynamic_cast<const ExprApply*> (&f.node(y)));
+
+	const ExprApply& a = (const ExprApply&) f.node(y);
+
+	assert(&a.func!=&f); // recursive calls not allowed
+
+	Matrix pts(K, a.func.nb_var());
+	int j=0;
+	for (int i=0; i<a.func.nb_arg(); i++) {
+		for (int c=0; c<a.arg(i).dim.size(); c++, j++) {
+			const double* v=val(x[i],c);
+			for (int k=0; k<K; k++)
+				pts[k][j]=v[k];
+		}
+	}
+
+	Matrix res(K, a.func.image_dim());
+	a.func.point_evaluator().eval(pts,res);
+
+	for (int c=0; c<a.dim.size(); c++) {
+		double* v=val(y,c);
+		for (int k=0; k<K; k++)
+			v[k]=res[k][c];
+	}
+}
+
+void PointEval::gen1_fwd(int x, int y) {
+	assert(dynamic_cast<const ExprGenericUnaryOp*>(&(f.node(y))));
+
+	// no point version: resort to interval arithmetic
+	const ExprGenericUnaryOp& e = (const ExprGenericUnaryOp&) f.node(y);
+	for (int k=0; k<K; k++) {
+		Domain dy=e.eval(to_domain(x,k));
+		for (int c=0; c<e.dim.size(); c++)
+			val(y,c)[k]=comp(dy,c).is_empty() ? NAN : comp(dy,c).mid();
+	}
+}
+
+void PointEval::gen2_fwd(int x1, int x2, int y) {
+	assert(dynamic_cast<const ExprGenericBinaryOp*>(&(f.node(y))));
+
+	const ExprGenericBinaryOp& e = (const ExprGenericBinaryOp&) f.node(y);
+	for (int k=0; k<K; k++) {
+		Domain dy=e.eval(to_domain(x1,k),to_domain(x2,k));
+		for (int c=0; c<e.dim.size(); c++)
+			val(y,c)[k]=comp(dy,c).is_empty() ? NAN : comp(dy,c).mid();
+	}
+}
+
+void PointEval::chi_fwd(int x1, int x2, int x3, int y) {
+	const double* a=val(x1);
+	const double* b=val(x2);
+	const double* c=val(x3);
+	double* r=val(y);
+	for (int k=0; k<K; k++)
+		r[k]= a[k]<=0 ? b[k] : c[k];
+}
+
+void PointEval::add_fwd(int x1, int x2, int y)   { binary(x1,x2,y,1,[](double a, double b) { return a+b; }); }
+void PointEval::mul_fwd(int x1, int x2, int y)   { binary(x1,x2,y,1,[](double a, double b) { return a*b; }); }
+void PointEval::sub_fwd(int x1, int x2, int y)   { binary(x1,x2,y,1,[](double a, double b) { return a-b; }); }
+void PointEval::div_fwd(int x1, int x2, int y)   { binary(x1,x2,y,1,[](double a, double b) { return a/b; }); }
+void PointEval::max_fwd(int x1, int x2, int y)   { binary(x1,x2,y,1,[](double a, double b) { return a>b? a : b; }); }
+void PointEval::min_fwd(int x1, int x2, int y)   { binary(x1,x2,y,1,[](double a, double b) { return a<b? a : b; }); }
+void PointEval::atan2_fwd(int x1, int x2, int y) { binary(x1,x2,y,1,[](double a, double b) { return ::atan2(a,b); }); }
+
+void PointEval::minus_fwd(int x, int y)          { unary(x,y,1,[](double a) { return -a; }); }
+void PointEval::minus_V_fwd(int x, int y)        { unary(x,y,f.node(y).dim.size(),[](double a) { return -a; }); }
+void PointEval::minus_M_fwd(int x, int y)        { unary(x,y,f.node(y).dim.size(),[](double a) { return -a; }); }
+void PointEval::sign_fwd(int x, int y)           { unary(x,y,1,[](double a) { return a>0? 1.0 : (a<0? -1.0 : 0.0); }); }
+void PointEval::abs_fwd(int x, int y)            { unary(x,y,1,[](double a) { return ::fabs(a); }); }
+void PointEval::power_fwd(int x, int y, int p)   { unary(x,y,1,[p](double a) { return ::pow(a,p); }); }
+void PointEval::sqr_fwd(int x, int y)            { unary(x,y,1,[](double a) { return a*a; }); }
+void PointEval::sqrt_fwd(int x, int y)           { unary(x,y,1,[](double a) { return ::sqrt(a); }); }
+void PointEval::exp_fwd(int x, int y)            { unary(x,y,1,[](double a) { return ::exp(a); }); }
+void PointEval::log_fwd(int x, int y)            { unary(x,y,1,[](double a) { return ::log(a); }); }
+void PointEval::cos_fwd(int x, int y)            { unary(x,y,1,[](double a) { return ::cos(a); }); }
+void PointEval::sin_fwd(int x, int y)            { unary(x,y,1,[](double a) { return ::sin(a); }); }
+void PointEval::tan_fwd(int x, int y)            { unary(x,y,1,[](double a) { return ::tan(a); }); }
+void PointEval::cosh_fwd(int x, int y)           { unary(x,y,1,[](double a) { return ::cosh(a); }); }
+void PointEval::sinh_fwd(int x, int y)           { unary(x,y,1,[](double a) { return ::sinh(a); }); }
+void PointEval::tanh_fwd(int x, int y)           { unary(x,y,1,[](double a) { return ::tanh(a); }); }
+void PointEval::acos_fwd(int x, int y)           { unary(x,y,1,[](double a) { return ::acos(a); }); }
+void PointEval::asin_fwd(int x, int y)           { unary(x,y,1,[](double a) { return ::asin(a); }); }
+void PointEval::atan_fwd(int x, int y)           { unary(x,y,1,[](double a) { return ::atan(a); }); }
+void PointEval::acosh_fwd(int x, int y)          { unary(x,y,1,[](double a) { return ::acosh(a); }); }
+void PointEval::asinh_fwd(int x, int y)          { unary(x,y,1,[](double a) { return ::asinh(a); }); }
+void PointEval::atanh_fwd(int x, int y)          { unary(x,y,1,[](double a) { return ::atanh(a); }); }
+
+void PointEval::trans_V_fwd(int x, int y)        { unary(x,y,f.node(y).dim.size(),[](double a) { return a; }); }
+
+void PointEval::trans_M_fwd(int x, int y) {
+	const Dim& d=f.node(x).dim;
+	for (int i=0; i<d.nb_rows(); i++)
+		for (int j=0; j<d.nb_cols(); j++)
+			std::copy(val(x,i*d.nb_cols()+j),val(x,i*d.nb_cols()+j)+K,val(y,j*d.nb_rows()+i));
+}
+
+void PointEval::add_V_fwd(int x1, int x2, int y) { binary(x1,x2,y,f.node(y).dim.size(),[](double a, double b) { return a+b; }); }
+void PointEval::add_M_fwd(int x1, int x2, int y) { binary(x1,x2,y,f.node(y).dim.size(),[](double a, double b) { return a+b; }); }
+void PointEval::sub_V_fwd(int x1, int x2, int y) { binary(x1,x2,y,f.node(y).dim.size(),[](double a, double b) { return a-b; }); }
+void PointEval::sub_M_fwd(int x1, int x2, int y) { binary(x1,x2,y,f.node(y).dim.size(),[](double a, double b) { return a-b; }); }
+
+void PointEval::mul_SV_fwd(int x1, int x2, int y) {
+	const double* a=val(x1);
+	for (int c=0; c<f.node(y).dim.size(); c++) {
+		const double* b=val(x2,c);
+		double* r=val(y,c);
+		for (int k=0; k<K; k++)
+			r[k]=a[k]*b[k];
+	}
+}
+
+void PointEval::mul_SM_fwd(int x1, int x2, int y) {
+	mul_SV_fwd(x1,x2,y);
+}
+
+void PointEval::mul_VV_fwd(int x1, int x2, int y) {
+	double* r=val(y);
+	std::fill(r,r+K,0.0);
+	for (int c=0; c<f.node(x1).dim.size(); c++) {
+		const double* a=val(x1,c);
+		const double* b=val(x2,c);
+		for (int k=0; k<K; k++)
+			r[k]+=a[k]*b[k];
+	}
+}
+
+void PointEval::mul_MV_fwd(int x1, int x2, int y) {
+	const Dim& d=f.node(x1).dim;
+	for (int i=0; i<d.nb_rows(); i++) {
+		double* r=val(y,i);
+		std::fill(r,r+K,0.0);
+		for (int j=0; j<d.nb_cols(); j++) {
+			const double* a=val(x1,i*d.nb_cols()+j);
+			const double* b=val(x2,j);
+			for (int k=0; k<K; k++)
+				r[k]+=a[k]*b[k];
+		}
+	}
+}
+
+void PointEval::mul_VM_fwd(int x1, int x2, int y) {
+	const Dim& d=f.node(x2).dim;
+	for (int j=0; j<d.nb_cols(); j++) {
+		double* r=val(y,j);
+		std::fill(r,r+K,0.0);
+		for (int i=0; i<d.nb_rows(); i++) {
+			const double* a=val(x1,i);
+			const double* b=val(x2,i*d.nb_cols()+j);
+			for (int k=0; k<K; k++)
+				r[k]+=a[k]*b[k];
+		}
+	}
+}
+
+void PointEval::mul_MM_fwd(int x1, int x2, int y) {
+	const Dim& d1=f.node(x1).dim;
+	const Dim& d2=f.node(x2).dim;
+	for (int i=0; i<d1.nb_rows(); i++)
+		for (int j=0; j<d2.nb_cols(); j++) {
+			double* r=val(y,i*d2.nb_cols()+j);
+			std::fill(r,r+K,0.0);
+			for (int l=0; l<d1.nb_cols(); l++) {
+				const double* a=val(x1,i*d1.nb_cols()+l);
+				const double* b=val(x2,l*d2.nb_cols()+j);
+				for (int k=0; k<K; k++)
+					r[k]+=a[k]*b[k];
+			}
+		}
+}
+
+/*================================== backward ========================================*/
+
+// For all k: adj(x)[k] += adj(y)[k]*(expr)
+#define UNARY_BWD(expr) \
+	const double* gy=adj(y); \
+	double* gx=adj(x); \
+	for (int k=0; k<K; k++) \
+		gx[k]+=gy[k]*(expr);
+
+// Same, where "a" is the value of x
+#define UNARY_BWD_ARG(expr) \
+	const double* a=val(x); \
+	UNARY_BWD(expr)
+
+// Same, where "r" is the value of y
+#define UNARY_BWD_RES(expr) \
+	const double* r=val(y); \
+	UNARY_BWD(expr)
+
+void PointEval::idx_bwd(int x, int y) {
+	idx_cp_bwd(x,y);
+}
+
+void PointEval::idx_cp_bwd(int x, int y) {
+	const ExprIndex& e = (const ExprIndex&) f.node(y);
+	const DoubleIndex& idx=e.index;
+
+	copy_block(x, f.node(x).dim.nb_cols(), idx.first_row(), idx.first_col(), idx.nb_rows(), idx.nb_cols(), y, idx.nb_cols(), 0, 0, true);
+}
+
+void PointEval::symbol_bwd(int) {
+	/* nothing to do */
+}
+
+void PointEval::cst_bwd(int) {
+	/* nothing to do */
+}
+
+void PointEval::vector_bwd(int* x, int y) {
+	const ExprVector& v = (const ExprVector&) f.node(y);
+
+	int j=0;
+
+	if (v.dim.is_vector()) {
+		for (int i=0; i<v.length(); i++) {
+			int size=v.arg(i).dim.size();
+			const double* gy=adj(y,j);
+			double* gx=adj(x[i]);
+			for (int l=0; l<size*K; l++)
+				gx[l]+=gy[l];
+			j+=size;
+		}
+	} else {
+		int nb_cols=v.dim.nb_cols();
+		for (int i=0; i<v.length(); i++) {
+			const Dim& d=v.arg(i).dim;
+			if (v.row_vector()) {
+				int nc=d.is_matrix() ? d.nb_cols() : 1;
+				copy_block(x[i], nc, 0, 0, v.dim.nb_rows(), nc, y, nb_cols, 0, j, true);
+				j+=nc;
+			} else {
+				int nr=d.is_matrix() ? d.nb_rows() : 1;
+				copy_block(x[i], nb_cols, 0, 0, nr, nb_cols, y, nb_cols, j, 0, true);
+				j+=nr;
+			}
+		}
+	}
+}
+
+void PointEval::apply_bwd(int* x, int y) {
+	const ExprApply& a = (const ExprApply&) f.node(y);
+
+	PointEval& sub=a.func.point_evaluator();
+
+	// the sub-function may have been evaluated
+	// since on other arguments.
+	Matrix pts(K, a.func.nb_var());
+	int j=0;
+	for (int i=0; i<a.func.nb_arg(); i++) {
+		for (int c=0; c<a.arg(i).dim.size(); c++, j++) {
+			const double* v=val(x[i],c);
+			for (int k=0; k<K; k++)
+				pts[k][j]=v[k];
+		}
+	}
+	sub.write_args(pts);
+	a.func.forward<PointEval>(sub);
+
+	if (sub.grad.size()!=sub.data.size()) sub.grad.resize(sub.data.size());
+	std::copy(adj(y), adj(y)+a.dim.size()*K, sub.adj(0));
+	sub.backward();
+
+	for (int i=0; i<a.func.nb_arg(); i++) {
+		const double* gs=sub.adj(a.func.nodes.rank(a.func.arg(i)));
+		double* gx=adj(x[i]);
+		for (int l=0; l<a.arg(i).dim.size()*K; l++)
+			gx[l]+=gs[l];
+	}
+}
+
+void PointEval::gen1_bwd(int x, int y) {
+	const ExprGenericUnaryOp& e = (const ExprGenericUnaryOp&) f.node(y);
+
+	// no point version: resort to interval arithmetic
+	for (int k=0; k<K; k++) {
+		Domain gx=e.num_diff(to_domain(x,k),to_domain(y,k,true));
+		for (int c=0; c<gx.dim.size(); c++)
+			adj(x,c)[k]+=comp(gx,c).is_empty() ? NAN : comp(gx,c).mid();
+	}
+}
+
+void PointEval::gen2_bwd(int x1, int x2, int y) {
+	const ExprGenericBinaryOp& e = (const ExprGenericBinaryOp&) f.node(y);
+
+	for (int k=0; k<K; k++) {
+		Domain dx1=to_domain(x1,k);
+		Domain dx2=to_domain(x2,k);
+		Domain gy=to_domain(y,k,true);
+		Domain gx1=e.num_diff1(dx1,dx2,gy);
+		Domain gx2=e.num_diff2(dx1,dx2,gy);
+		for (int c=0; c<gx1.dim.size(); c++)
+			adj(x1,c)[k]+=comp(gx1,c).is_empty() ? NAN : comp(gx1,c).mid();
+		for (int c=0; c<gx2.dim.size(); c++)
+			adj(x2,c)[k]+=comp(gx2,c).is_empty() ? NAN : comp(gx2,c).mid();
+	}
+}
+
+void PointEval::chi_bwd(int x1, int x2, int x3, int y) {
+	const double* a=val(x1);
+	const double* gy=adj(y);
+	double* gb=adj(x2);
+	double* gc=adj(x3);
+	for (int k=0; k<K; k++) {
+		if (a[k]<=0) gb[k]+=gy[k];
+		else gc[k]+=gy[k];
+	}
+}
+
+void PointEval::add_bwd(int x1, int x2, int y) {
+	add_V_bwd(x1,x2,y);
+}
+
+void PointEval::sub_bwd(int x1, int x2, int y) {
+	sub_V_bwd(x1,x2,y);
+}
+
+void PointEval::mul_bwd(int x1, int x2, int y) {
+	const double* a=val(x1);
+	const double* b=val(x2);
+	const double* gy=adj(y);
+	double* ga=adj(x1);
+	double* gb=adj(x2);
+	for (int k=0; k<K; k++) {
+		ga[k]+=gy[k]*b[k];
+		gb[k]+=gy[k]*a[k];
+	}
+}
+
+void PointEval::div_bwd(int x1, int x2, int y) {
+	const double* b=val(x2);
+	const double* r=val(y);
+	const double* gy=adj(y);
+	double* ga=adj(x1);
+	double* gb=adj(x2);
+	for (int k=0; k<K; k++) {
+		ga[k]+=gy[k]/b[k];
+		gb[k]-=gy[k]*r[k]/b[k];
+	}
+}
+
+void PointEval::max_bwd(int x1, int x2, int y) {
+	const double* a=val(x1);
+	const double* b=val(x2);
+	const double* gy=adj(y);
+	double* ga=adj(x1);
+	double* gb=adj(x2);
+	for (int k=0; k<K; k++) {
+		if (a[k]>=b[k]) ga[k]+=gy[k];
+		else gb[k]+=gy[k];
+	}
+}
+
+void PointEval::min_bwd(int x1, int x2, int y) {
+	const double* a=val(x1);
+	const double* b=val(x2);
+	const double* gy=adj(y);
+	double* ga=adj(x1);
+	double* gb=adj(x2);
+	for (int k=0; k<K; k++) {
+		if (a[k]<=b[k]) ga[k]+=gy[k];
+		else gb[k]+=gy[k];
+	}
+}
+
+void PointEval::atan2_bwd(int x1, int x2, int y) {
+	const double* a=val(x1);
+	const double* b=val(x2);
+	const double* gy=adj(y);
+	double* ga=adj(x1);
+	double* gb=adj(x2);
+	for (int k=0; k<K; k++) {
+		double n=a[k]*a[k]+b[k]*b[k];
+		ga[k]+=gy[k]*b[k]/n;
+		gb[k]-=gy[k]*a[k]/n;
+	}
+}
+
+void PointEval::minus_bwd(int x, int y) {
+	minus_V_bwd(x,y);
+}
+
+void PointEval::minus_V_bwd(int x, int y) {
+	const double* gy=adj(y);
+	double* gx=adj(x);
+	for (int l=0; l<f.node(y).dim.size()*K; l++)
+		gx[l]-=gy[l];
+}
+
+void PointEval::minus_M_bwd(int x, int y) {
+	minus_V_bwd(x,y);
+}
+
+void PointEval::trans_V_bwd(int x, int y) {
+	const double* gy=adj(y);
+	double* gx=adj(x);
+	for (int l=0; l<f.node(y).dim.size()*K; l++)
+		gx[l]+=gy[l];
+}
+
+void PointEval::trans_M_bwd(int x, int y) {
+	const Dim& d=f.node(x).dim;
+	for (int i=0; i<d.nb_rows(); i++)
+		for (int j=0; j<d.nb_cols(); j++) {
+			const double* gy=adj(y,j*d.nb_rows()+i);
+			double* gx=adj(x,i*d.nb_cols()+j);
+			for (int k=0; k<K; k++)
+				gx[k]+=gy[k];
+		}
+}
+
+void PointEval::sign_bwd(int, int) {
+	/* derivative is zero (almost everywhere) */
+}
+
+void PointEval::abs_bwd(int x, int y)          { UNARY_BWD_ARG(a[k]>=0? 1.0 : -1.0) }
+void PointEval::power_bwd(int x, int y, int p) { UNARY_BWD_ARG(p*::pow(a[k],p-1)) }
+void PointEval::sqr_bwd(int x, int y)          { UNARY_BWD_ARG(2*a[k]) }
+void PointEval::sqrt_bwd(int x, int y)         { UNARY_BWD_RES(0.5/r[k]) }
+void PointEval::exp_bwd(int x, int y)          { UNARY_BWD_RES(r[k]) }
+void PointEval::log_bwd(int x, int y)          { UNARY_BWD_ARG(1.0/a[k]) }
+void PointEval::cos_bwd(int x, int y)          { UNARY_BWD_ARG(-::sin(a[k])) }
+void PointEval::sin_bwd(int x, int y)          { UNARY_BWD_ARG(::cos(a[k])) }
+void PointEval::tan_bwd(int x, int y)          { UNARY_BWD_RES(1.0+r[k]*r[k]) }
+void PointEval::cosh_bwd(int x, int y)         { UNARY_BWD_ARG(::sinh(a[k])) }
+void PointEval::sinh_bwd(int x, int y)         { UNARY_BWD_ARG(::cosh(a[k])) }
+void PointEval::tanh_bwd(int x, int y)         { UNARY_BWD_RES(1.0-r[k]*r[k]) }
+void PointEval::acos_bwd(int x, int y)         { UNARY_BWD_ARG(-1.0/::sqrt(1.0-a[k]*a[k])) }
+void PointEval::asin_bwd(int x, int y)         { UNARY_BWD_ARG(1.0/::sqrt(1.0-a[k]*a[k])) }
+void PointEval::atan_bwd(int x, int y)         { UNARY_BWD_ARG(1.0/(1.0+a[k]*a[k])) }
+void PointEval::acosh_bwd(int x, int y)        { UNARY_BWD_ARG(1.0/::sqrt(a[k]*a[k]-1.0)) }
+void PointEval::asinh_bwd(int x, int y)        { UNARY_BWD_ARG(1.0/::sqrt(1.0+a[k]*a[k])) }
+void PointEval::atanh_bwd(int x, int y)        { UNARY_BWD_ARG(1.0/(1.0-a[k]*a[k])) }
+
+void PointEval::add_V_bwd(int x1, int x2, int y) {
+	const double* gy=adj(y);
+	double* ga=adj(x1);
+	double* gb=adj(x2);
+	for (int l=0; l<f.node(y).dim.size()*K; l++) {
+		ga[l]+=gy[l];
+		gb[l]+=gy[l];
+	}
+}
+
+void PointEval::add_M_bwd(int x1, int x2, int y) {
+	add_V_bwd(x1,x2,y);
+}
+
+void PointEval::sub_V_bwd(int x1, int x2, int y) {
+	const double* gy=adj(y);
+	double* ga=adj(x1);
+	double* gb=adj(x2);
+	for (int l=0; l<f.node(y).dim.size()*K; l++) {
+		ga[l]+=gy[l];
+		gb[l]-=gy[l];
+	}
+}
+
+void PointEval::sub_M_bwd(int x1, int x2, int y) {
+	sub_V_bwd(x1,x2,y);
+}
+
+void PointEval::mul_SV_bwd(int x1, int x2, int y) {
+	const double* a=val(x1);
+	double* ga=adj(x1);
+	for (int c=0; c<f.node(y).dim.size(); c++) {
+		const double* b=val(x2,c);
+		const double* gy=adj(y,c);
+		double* gb=adj(x2,c);
+		for (int k=0; k<K; k++) {
+			ga[k]+=gy[k]*b[k];
+			gb[k]+=gy[k]*a[k];
+		}
+	}
+}
+
+void PointEval::mul_SM_bwd(int x1, int x2, int y) {
+	mul_SV_bwd(x1,x2,y);
+}
+
+void PointEval::mul_VV_bwd(int x1, int x2, int y) {
+	const double* gy=adj(y);
+	for (int c=0; c<f.node(x1).dim.size(); c++) {
+		const double* a=val(x1,c);
+		const double* b=val(x2,c);
+		double* ga=adj(x1,c);
+		double* gb=adj(x2,c);
+		for (int k=0; k<K; k++) {
+			ga[k]+=gy[k]*b[k];
+			gb[k]+=gy[k]*a[k];
+		}
+	}
+}
+
+void PointEval::mul_MV_bwd(int x1, int x2, int y) {
+	const Dim& d=f.node(x1).dim;
+	for (int i=0; i<d.nb_rows(); i++) {
+		const double* gy=adj(y,i);
+		for (int j=0; j<d.nb_cols(); j++) {
+			const double* a=val(x1,i*d.nb_cols()+j);
+			const double* b=val(x2,j);
+			double* ga=adj(x1,i*d.nb_cols()+j);
+			double* gb=adj(x2,j);
+			for (int k=0; k<K; k++) {
+				ga[k]+=gy[k]*b[k];
+				gb[k]+=gy[k]*a[k];
+			}
+		}
+	}
+}
+
+void PointEval::mul_VM_bwd(int x1, int x2, int y) {
+	const Dim& d=f.node(x2).dim;
+	for (int j=0; j<d.nb_cols(); j++) {
+		const double* gy=adj(y,j);
+		for (int i=0; i<d.nb_rows(); i++) {
+			const double* a=val(x1,i);
+			const double* b=val(x2,i*d.nb_cols()+j);
+			double* ga=adj(x1,i);
+			double* gb=adj(x2,i*d.nb_cols()+j);
+			for (int k=0; k<K; k++) {
+				ga[k]+=gy[k]*b[k];
+				gb[k]+=gy[k]*a[k];
+			}
+		}
+	}
+}
+
+void PointEval::mul_MM_bwd(int x1, int x2, int y) {
+	const Dim& d1=f.node(x1).dim;
+	const Dim& d2=f.node(x2).dim;
+	for (int i=0; i<d1.nb_rows(); i++)
+		for (int j=0; j<d2.nb_cols(); j++) {
+			const double* gy=adj(y,i*d2.nb_cols()+j);
+			for (int l=0; l<d1.nb_cols(); l++) {
+				const double* a=val(x1,i*d1.nb_cols()+l);
+				const double* b=val(x2,l*d2.nb_cols()+j);
+				double* ga=adj(x1,i*d1.nb_cols()+l);
+				double* gb=adj(x2,l*d2.nb_cols()+j);
+				for (int k=0; k<K; k++) {
+					ga[k]+=gy[k]*b[k];
+					gb[k]+=gy[k]*a[k];
+				}
+			}
+		}
+}
+
+#undef UNARY_BWD
+#undef UNARY_BWD_ARG
+#undef UNARY_BWD_RES
+
+} // namespace ibex
@@ -0,0 +1,327 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_PointEval.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_POINT_EVAL_H__
+#define __IBEX_POINT_EVAL_H__
+
+#include "ibex_FwdAlgorithm.h"
+#include "ibex_BwdAlgorithm.h"
+#include "ibex_Matrix.h"
+#include "ibex_Domain.h"
+
+#include <vector>
+#include <cmath>
+
+namespace ibex {
+
+class Function;
+
+/**
+ * \ingroup symbolic
+ *
+ * \brief Floating-point evaluator.
+ *
+ * Evaluates a function and its derivatives (reverse mode) on one or K
+ * points at once, with plain double-precision arithmetic (no rounding
+ * control, no empty-set handling). The result is only an approximation
+ * of f(x) and must be certified with interval arithmetic if a rigorous
+ * value is required.
+ *
+ * The values of each node of the DAG are stored component by component
+ * and, for each component, contiguously for the K points ("structure of
+ * arrays") so that every operation is a plain loop over the points that
+ * the compiler can vectorize.
+ *
+ * A point outside the definition domain (e.g., log(-1)) produces a NaN.
+ * At a point where the function is not differentiable (e.g., abs(0)),
+ * one of the one-sided derivatives is returned.
+ */
+class PointEval : public FwdAlgorithm, public BwdAlgorithm {
+
+public:
+	/**
+	 * \brief Build the evaluator for the function f.
+	 *
+	 * The memory is only allocated at the first evaluation.
+	 */
+	PointEval(Function& f);
+
+	/**
+	 * \brief Evaluate f on a set of points.
+	 *
+	 * \param pts - K x n matrix: one point per row (n=f.nb_var()).
+	 * \param res - (output) K x m matrix: the value of f at each
+	 *              point (m=f.image_dim()). Resized if necessary.
+	 */
+	void eval(const Matrix& pts, Matrix& res);
+
+	/**
+	 * \brief Evaluate a real-valued function on a point.
+	 */
+	double eval(const Vector& x);
+
+	/**
+	 * \brief Evaluate a vector-valued function on a point.
+	 */
+	Vector eval_vector(const Vector& x);
+
+	/**
+	 * \brief Gradient of a real-valued function at a set of points.
+	 *
+	 * \param pts - K x n matrix: one point per row.
+	 * \param g   - (output) K x n matrix: the gradient at each point.
+	 *              Resized if necessary.
+	 */
+	void gradient(const Matrix& pts, Matrix& g);
+
+	/**
+	 * \brief Gradient of a real-valued function at a point.
+	 */
+	void gradient(const Vector& x, Vector& g);
+
+	/**
+	 * \brief Jacobian matrix of a vector-valued function at a point.
+	 *
+	 * One backward pass per component.
+	 *
+	 * \param J - (output) m x n matrix.
+	 */
+	void jacobian(const Vector& x, Matrix& J);
+
+public: // because called from CompiledFunction
+
+	void vector_fwd (int* x, int y);
+	void apply_fwd  (int* x, int y);
+	void idx_fwd    (int x, int y);
+	void idx_cp_fwd (int x, int y);
+	void symbol_fwd (int y);
+	void cst_fwd    (int y);
+	void chi_fwd    (int x1, int x2, int x3, int y);
+	void gen2_fwd   (int x, int x2, int y);
+	void add_fwd    (int x1, int x2, int y);
+	void mul_fwd    (int x1, int x2, int y);
+	void sub_fwd    (int x1, int x2, int y);
+	void div_fwd    (int x1, int x2, int y);
+	void max_fwd    (int x1, int x2, int y);
+	void min_fwd    (int x1, int x2, int y);
+	void atan2_fwd  (int x1, int x2, int y);
+	void gen1_fwd   (int x, int y);
+	void minus_fwd  (int x, int y);
+	void minus_V_fwd(int x, int y);
+	void minus_M_fwd(int x, int y);
+	void trans_V_fwd(int x, int y);
+	void trans_M_fwd(int x, int y);
+	void sign_fwd   (int x, int y);
+	void abs_fwd    (int x, int y);
+	void power_fwd  (int x, int y, int p);
+	void sqr_fwd    (int x, int y);
+	void sqrt_fwd   (int x, int y);
+	void exp_fwd    (int x, int y);
+	void log_fwd    (int x, int y);
+	void cos_fwd    (int x, int y);
+	void sin_fwd    (int x, int y);
+	void tan_fwd    (int x, int y);
+	void cosh_fwd   (int x, int y);
+	void sinh_fwd   (int x, int y);
+	void tanh_fwd   (int x, int y);
+	void acos_fwd   (int x, int y);
+	void asin_fwd   (int x, int y);
+	void atan_fwd   (int x, int y);
+	void acosh_fwd  (int x, int y);
+	void asinh_fwd  (int x, int y);
+	void atanh_fwd  (int x, int y);
+	void add_V_fwd  (int x1, int x2, int y);
+	void add_M_fwd  (int x1, int x2, int y);
+	void mul_SV_fwd (int x1, int x2, int y);
+	void mul_SM_fwd (int x1, int x2, int y);
+	void mul_VV_fwd (int x1, int x2, int y);
+	void mul_MV_fwd (int x1, int x2, int y);
+	void mul_VM_fwd (int x1, int x2, int y);
+	void mul_MM_fwd (int x1, int x2, int y);
+	void sub_V_fwd  (int x1, int x2, int y);
+	void sub_M_fwd  (int x1, int x2, int y);
+
+	void vector_bwd (int* x, int y);
+	void apply_bwd  (int* x, int y);
+	void idx_bwd    (int x, int y);
+	void idx_cp_bwd (int x, int y);
+	void symbol_bwd (int y);
+	void cst_bwd    (int y);
+	void chi_bwd    (int x1, int x2, int x3, int y);
+	void gen2_bwd   (int x, int x2, int y);
+	void add_bwd    (int x1, int x2, int y);
+	void mul_bwd    (int x1, int x2, int y);
+	void sub_bwd    (int x1, int x2, int y);
+	void div_bwd    (int x1, int x2, int y);
+	void max_bwd    (int x1, int x2, int y);
+	void min_bwd    (int x1, int x2, int y);
+	void atan2_bwd  (int x1, int x2, int y);
+	void gen1_bwd   (int x, int y);
+	void minus_bwd  (int x, int y);
+	void minus_V_bwd(int x, int y);
+	void minus_M_bwd(int x, int y);
+	void trans_V_bwd(int x, int y);
+	void trans_M_bwd(int x, int y);
+	void sign_bwd   (int x, int y);
+	void abs_bwd    (int x, int y);
+	void power_bwd  (int x, int y, int p);
+	void sqr_bwd    (int x, int y);
+	void sqrt_bwd   (int x, int y);
+	void exp_bwd    (int x, int y);
+	void log_bwd    (int x, int y);
+	void cos_bwd    (int x, int y);
+	void sin_bwd    (int x, int y);
+	void tan_bwd    (int x, int y);
+	void cosh_bwd   (int x, int y);
+	void sinh_bwd   (int x, int y);
+	void tanh_bwd   (int x, int y);
+	void acos_bwd   (int x, int y);
+	void asin_bwd   (int x, int y);
+	void atan_bwd   (int x, int y);
+	void acosh_bwd  (int x, int y);
+	void asinh_bwd  (int x, int y);
+	void atanh_bwd  (int x, int y);
+	void add_V_bwd  (int x1, int x2, int y);
+	void add_M_bwd  (int x1, int x2, int y);
+	void mul_SV_bwd (int x1, int x2, int y);
+	void mul_SM_bwd (int x1, int x2, int y);
+	void mul_VV_bwd (int x1, int x2, int y);
+	void mul_MV_bwd (int x1, int x2, int y);
+	void mul_VM_bwd (int x1, int x2, int y);
+	void mul_MM_bwd (int x1, int x2, int y);
+	void sub_V_bwd  (int x1, int x2, int y);
+	void sub_M_bwd  (int x1, int x2, int y);
+
+	Function& f;
+
+protected:
+	/*
+	 * Values of the cth component of node y
+	 * (matrices are stored row by row).
+	 */
+	double* val(int y, int c=0);
+
+	/*
+	 * Adjoint (partial derivative of the output wrt to
+	 * the cth component of node y).
+	 */
+	double* adj(int y, int c=0);
+
+	/*
+	 * Allocate the memory for K points.
+	 */
+	void resize(int K);
+
+	/*
+	 * Load the arguments (one point per row).
+	 */
+	void write_args(const Matrix& pts);
+
+	/*
+	 * Load the arguments (K=1).
+	 */
+	void write_args(const Vector& x);
+
+	/*
+	 * Run the backward pass. The adjoint of the root
+	 * node must be set before (all the others are reset).
+	 */
+	void backward();
+
+	/*
+	 * Partial derivatives wrt the kth point (K=1 by default).
+	 */
+	void read_gradient(Vector& g, int k=0);
+
+	/*
+	 * y <- x[i][j] for all (i,j) in the block [r1..r1+nr-1]x[c1..c1+nc-1]
+	 * (x is assumed to have nb_cols columns).
+	 * If bwd is true, the reverse operation is done on the adjoints
+	 * (adj(x) += adj(y) on the block).
+	 */
+	void copy_block(int x, int nb_cols, int r1, int c1, int nr, int nc, int y, int y_nb_cols, int yr1, int yc1, bool bwd=false);
+
+	/*
+	 * Domain of node x at the kth point (for generic operators).
+	 */
+	Domain to_domain(int x, int k, bool adjoint=false);
+
+	/*
+	 * Binary componentwise operation.
+	 */
+	template<class Op>
+	void binary(int x1, int x2, int y, int size, Op op);
+
+	/*
+	 * Unary componentwise operation.
+	 */
+	template<class Op>
+	void unary(int x, int y, int size, Op op);
+
+	/*
+	 * Current number of points.
+	 */
+	int K;
+
+	/*
+	 * Offset of the first component of each node.
+	 */
+	std::vector<int> offset;
+
+	/*
+	 * Total number of components.
+	 */
+	int nb_comp;
+
+	/*
+	 * First variable of each argument.
+	 */
+	std::vector<int> first_var;
+
+	/*
+	 * Values of all the nodes (nb_comp x K).
+	 */
+	std::vector<double> data;
+
+	/*
+	 * Adjoints of all the nodes (nb_comp x K).
+	 * Only allocated if derivatives are calculated.
+	 */
+	std::vector<double> grad;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline double* PointEval::val(int y, int c) {
+	return &data[(offset[y]+c)*K];
+}
+
+inline double* PointEval::adj(int y, int c) {
+	return &grad[(offset[y]+c)*K];
+}
+
+template<class Op>
+inline void PointEval::binary(int x1, int x2, int y, int size, Op op) {
+	const double* a=val(x1);
+	const double* b=val(x2);
+	double* r=val(y);
+	for (int i=0; i<size*K; i++)
+		r[i]=op(a[i],b[i]);
+}
+
+template<class Op>
+inline void PointEval::unary(int x, int y, int size, Op op) {
+	const double* a=val(x);
+	double* r=val(y);
+	for (int i=0; i<size*K; i++)
+		r[i]=op(a[i]);
+}
+
+} // namespace ibex
+
+#endif // __IBEX_POINT_EVAL_H__
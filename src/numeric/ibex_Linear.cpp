@@ -10,14 +10,24 @@
 
 #include "ibex_Linear.h"
 #include "ibex_LinearException.h"
+#include "ibex_LinearWorkspace.h"
+#include "ibex_MidRadArith.h"
 
 #include <math.h>
 #include <float.h>
 #include <stack>
+#include <algorithm>
 
 #define TOO_LARGE 1e30
 #define TOO_SMALL 1e-10
 
+// minimal size of a system for using the midpoint-radius
+// formulation in Gauss-Seidel
+#define MIDRAD_MIN_SIZE 8
+
+// number of pivots per block in the LU decomposition
+#define LU_BLOCK_SIZE 32
+
 using namespace std;
 
 namespace ibex {
@@ -179,6 +189,258 @@ void LU_solve(const M& LU, const int* p, const V& b, V& x) {
     }
 }
 
+/*
+ * Blocked LU decomposition (with partial pivoting) of a real nxn
+ * matrix stored in a row-major array. The rows are physically
+ * swapped: row i of the result corresponds to row p[i] of A.
+ *
+ * The pivots are processed by blocks of LU_BLOCK_SIZE columns.
+ * Once a block (panel) is factorized, the rest of the matrix is
+ * updated with row operations on contiguous arrays, which is cache
+ * friendly and vectorized by the compiler.
+ */
+void blocked_LU(double* A, int n, int* p) {
+
+	// check the matrix has no "infinite" values
+	for (int i=0; i<n*n; i++)
+		if (fabs(A[i])>=TOO_LARGE) throw SingularMatrixException();
+
+	for (int i=0; i<n; i++) p[i]=i;
+
+	for (int kb=0; kb<n; kb+=LU_BLOCK_SIZE) {
+		int ke=std::min(kb+LU_BLOCK_SIZE,n);
+
+		// 1- factorization of the panel (columns kb..ke-1)
+		for (int j=kb; j<ke; j++) {
+			int swap=j;
+			for (int i=j+1; i<n; i++)
+				if (fabs(A[i*n+j])>fabs(A[swap*n+j])) swap=i;
+
+			if (swap!=j) {
+				std::swap_ranges(A+j*n, A+(j+1)*n, A+swap*n);
+				std::swap(p[j],p[swap]);
+			}
+
+			double pivot=A[j*n+j];
+			if (pivot==0) throw SingularMatrixException();
+			if (fabs(1/pivot)>=TOO_LARGE) throw SingularMatrixException();
+
+			const double* rj=A+j*n;
+			for (int i=j+1; i<n; i++) {
+				double* ri=A+i*n;
+				double l=(ri[j]/=pivot);
+				for (int k=j+1; k<ke; k++) ri[k]-=l*rj[k];
+			}
+		}
+
+		// 2- rows of U on the right of the panel
+		for (int j=kb; j<ke; j++) {
+			const double* rj=A+j*n;
+			for (int i=j+1; i<ke; i++) {
+				double* ri=A+i*n;
+				double l=ri[j];
+				for (int k=ke; k<n; k++) ri[k]-=l*rj[k];
+			}
+		}
+
+		// 3- trailing submatrix
+		for (int i=ke; i<n; i++) {
+			double* ri=A+i*n;
+			for (int j=kb; j<ke; j++) {
+				const double* rj=A+j*n;
+				double l=ri[j];
+				for (int k=ke; k<n; k++) ri[k]-=l*rj[k];
+			}
+		}
+	}
+}
+
+/*
+ * Inverse of a real nxn matrix stored in a row-major array.
+ * A is overwritten by its LU decomposition.
+ */
+void blocked_inverse(double* A, int n, double* invA, int* p) {
+
+	blocked_LU(A,n,p);
+
+	// invA = permutation of the identity matrix
+	std::fill(invA, invA+n*n, 0.0);
+	for (int i=0; i<n; i++) invA[i*n+p[i]]=1;
+
+	// solve LY=P
+	for (int i=1; i<n; i++) {
+		double* xi=invA+i*n;
+		for (int k=0; k<i; k++) {
+			double l=A[i*n+k];
+			if (l==0) continue;
+			const double* xk=invA+k*n;
+			for (int c=0; c<n; c++) xi[c]-=l*xk[c];
+		}
+	}
+
+	// solve UX=Y
+	for (int i=n-1; i>=0; i--) {
+		double u=A[i*n+i];
+		if (fabs(u)<=TOO_SMALL) throw SingularMatrixException();
+		double* xi=invA+i*n;
+		for (int k=i+1; k<n; k++) {
+			double a=A[i*n+k];
+			if (a==0) continue;
+			const double* xk=invA+k*n;
+			for (int c=0; c<n; c++) xi[c]-=a*xk[c];
+		}
+		for (int c=0; c<n; c++) xi[c]/=u;
+	}
+}
+
+/*
+ * Inverse of either Mid(A), Inf(A) or Sup(A) (in priority).
+ */
+void precond_matrix(const IntervalMatrix& A, double* C, LinearWorkspace::Frame& frame) {
+	int n=A.nb_rows();
+	double* M=frame.alloc(n*n);
+	int* p=frame.alloc_int(n);
+
+	for (int k=0; k<3; k++) {
+		for (int i=0; i<n; i++)
+			for (int j=0; j<n; j++)
+				M[i*n+j] = k==0? A[i][j].mid() : (k==1? A[i][j].lb() : A[i][j].ub());
+		try {
+			blocked_inverse(M,n,C,p);
+			return;
+		} catch (SingularMatrixException&) {
+			if (k==2) throw;
+		}
+	}
+}
+
+bool is_bounded(const IntervalMatrix& A) {
+	for (int i=0; i<A.nb_rows(); i++)
+		for (int j=0; j<A.nb_cols(); j++)
+			if (A[i][j].is_empty() || A[i][j].is_unbounded()) return false;
+	return true;
+}
+
+/*
+ * A <- C*A where C is real (nxn), with a midpoint-radius product.
+ *
+ * The product of a real number by an interval is exact in
+ * midpoint-radius so the only overestimation comes from
+ * roundings.
+ */
+void precond_mul(const double* C, IntervalMatrix& A, LinearWorkspace::Frame& frame) {
+	int n=A.nb_rows();
+
+	if (!is_bounded(A)) {
+		Matrix _C(n,n);
+		for (int i=0; i<n; i++)
+			for (int j=0; j<n; j++)
+				_C[i][j]=C[i*n+j];
+		A=_C*A;
+		return;
+	}
+
+	double* mA=frame.alloc(n*n);
+	double* rA=frame.alloc(n*n); // includes the bound of rounding errors
+	double* S=frame.alloc(n*n);
+	double* T=frame.alloc(n*n);
+	double* aC=frame.alloc(n*n); // |C|
+
+	double g=midrad_gamma(n);
+	for (int i=0; i<n; i++)
+		for (int j=0; j<n; j++) {
+			double& m=mA[i*n+j];
+			double& r=rA[i*n+j];
+			midrad(A[i][j],m,r);
+			r += 2*g*fabs(m);
+			aC[i*n+j]=fabs(C[i*n+j]);
+		}
+
+	std::fill(S, S+n*n, 0.0);
+	std::fill(T, T+n*n, 0.0);
+
+	real_gemm(n, n, n, C, mA, S);
+	real_gemm(n, n, n, aC, rA, T);
+
+	for (int i=0; i<n; i++)
+		for (int j=0; j<n; j++)
+			A[i][j]=midrad_enclosure(S[i*n+j],T[i*n+j],n);
+}
+
+/*
+ * b <- C*b where C is real (nxn).
+ */
+void precond_mul(const double* C, IntervalVector& b) {
+	int n=b.size();
+	IntervalVector Cb(n);
+	for (int i=0; i<n; i++) {
+		Cb[i]=0;
+		for (int k=0; k<n; k++) Cb[i]+=C[i*n+k]*b[k];
+	}
+	b=Cb;
+}
+
+/*
+ * Interval matrix A (mxn) in midpoint-radius form, for
+ * the Gauss-Seidel iteration. A sum of products is calculated
+ * with floating-point operations only (dot products on contiguous
+ * arrays) and the rounding errors are bounded a priori
+ * (see ibex_MidRadArith.h).
+ */
+struct MidRadGaussSeidel {
+
+	MidRadGaussSeidel(const IntervalMatrix& A, const IntervalVector& x, LinearWorkspace::Frame& frame) :
+		m(A.nb_rows()), n(A.nb_cols()), g(midrad_gamma(n)),
+		mA(frame.alloc(m*n)), aA(frame.alloc(m*n)), rA(frame.alloc(m*n)),
+		xm(frame.alloc(n)), xw(frame.alloc(n)), xv(frame.alloc(n)) {
+
+		for (int i=0; i<m; i++)
+			for (int j=0; j<n; j++) {
+				midrad(A[i][j],mA[i*n+j],rA[i*n+j]);
+				aA[i*n+j]=fabs(mA[i*n+j]);
+			}
+
+		for (int j=0; j<n; j++) set(j,x[j]);
+	}
+
+	/*
+	 * Set the jth component of x.
+	 */
+	void set(int j, const Interval& xj) {
+		double r;
+		midrad(xj,xm[j],r);
+		double a=fabs(xm[j]);
+		// radius of (A_rj*x_j) is |mA|*r + rA*(|xm|+r)
+		// plus the rounding error, bounded by gamma*|mA|*|xm|.
+		xw[j]=r+2*g*a;
+		xv[j]=a+r;
+	}
+
+	/*
+	 * Enclosure of sum_{j!=i} A[r][j]*x[j].
+	 */
+	Interval row(int r, int i) const {
+		const double* mr=mA+r*n;
+		const double* ar=aA+r*n;
+		const double* rr=rA+r*n;
+		double s=0, t=0;
+		for (int j=0; j<i; j++) {
+			s+=mr[j]*xm[j];
+			t+=ar[j]*xw[j]+rr[j]*xv[j];
+		}
+		for (int j=i+1; j<n; j++) {
+			s+=mr[j]*xm[j];
+			t+=ar[j]*xw[j]+rr[j]*xv[j];
+		}
+		return midrad_enclosure(s,t,2*n);
+	}
+
+	int m, n;
+	double g;
+	double *mA, *aA, *rA; // midpoints, their absolute values and radii of A
+	double *xm, *xw, *xv; // midpoints of x and auxiliary vectors (see set)
+};
+
 } // end anonymous namespace
 
 void real_LU(const Matrix& A, Matrix& _LU, int* p) {
@@ -208,27 +470,20 @@ void interval_LU_solve(const IntervalMatrix& LU, const int *p, const IntervalVec
 void real_inverse(const Matrix& A, Matrix& invA) {
 	int n = (A.nb_rows());
 
-	Matrix LU(n,n);
-	int* p= new int[n];
+	LinearWorkspace::Frame frame(LinearWorkspace::local());
+	double* LU=frame.alloc(n*n);
+	double* X=frame.alloc(n*n);
+	int* p=frame.alloc_int(n);
 
-	try {
-		real_LU(A, LU, p);
+	for (int i=0; i<n; i++)
+		for (int j=0; j<n; j++)
+			LU[i*n+j]=A[i][j];
 
-		Vector b(n,0.0);
-		Vector x(n);
+	blocked_inverse(LU, n, X, p); // may throw SingularMatrixException
 
-		for (int i=0; i<n; i++) {
-			b[i]=1;
-			real_LU_solve(LU, p, b, x);
-			invA.set_col(i, x);
-			b[i]=0;
-		}
-	}
-	catch(SingularMatrixException& e) {
-		delete[] p;
-		throw e;
-	}
-	delete[] p;
+	for (int i=0; i<n; i++)
+		for (int j=0; j<n; j++)
+			invA[i][j]=X[i*n+j];
 }
 
 Matrix real_inverse(const Matrix& A) {
@@ -305,16 +560,12 @@ void precond(IntervalMatrix& A) {
 	int n=(A.nb_rows());
 	assert(n == A.nb_cols()); //throw NotSquareMatrixException();  // not well-constraint problem
 
-	Matrix C(n,n);
-	try { real_inverse(A.mid(), C); }
-	catch (SingularMatrixException&) {
-		try { real_inverse(A.lb(), C); }
-		catch (SingularMatrixException&) {
-			real_inverse(A.ub(), C);
-		}
-	}
+	LinearWorkspace::Frame frame(LinearWorkspace::local());
+	double* C=frame.alloc(n*n);
+
+	precond_matrix(A, C, frame);
 
-	A = C*A;
+	precond_mul(C, A, frame);
 }
 
 void precond(IntervalMatrix& A, IntervalVector& b) {
@@ -322,20 +573,13 @@ void precond(IntervalMatrix& A, IntervalVector& b) {
 	assert(n == A.nb_cols()); //throw NotSquareMatrixException();  // not well-constraint problem
 	assert(n == b.size());
 
-	Matrix C(n,n);
-	try { real_inverse(A.mid(), C); }
-	catch (SingularMatrixException&) {
-		try { real_inverse(A.lb(), C); }
-		catch (SingularMatrixException&) {
-			real_inverse(A.ub(), C);
-		}
-	}
+	LinearWorkspace::Frame frame(LinearWorkspace::local());
+	double* C=frame.alloc(n*n);
+
+	precond_matrix(A, C, frame);
 
-	//   cout << "A=" << (A.nb_cols()) << "x" << (A.nb_rows()) << "  " << "b=" << (b.size()) << "  " << "C="
-	//        << (C.nb_cols()) << "x" << (C.nb_rows()) << endl;
-	//cout << "C=" << C << endl;
-	A = C*A;
-	b = C*b;
+	precond_mul(C, A, frame);
+	precond_mul(C, b);
 }
 
 void gauss_seidel(const IntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double ratio) {
@@ -348,6 +592,32 @@ void gauss_seidel(const IntervalMatrix& A, const IntervalVector& b, IntervalVect
 	Interval old, proj, tmp;
 	int i;
 
+	if (n>=MIDRAD_MIN_SIZE && !x.is_empty() && !x.is_unbounded() && is_bounded(A)) {
+
+		LinearWorkspace::Frame frame(LinearWorkspace::local());
+		MidRadGaussSeidel M(A, x, frame);
+
+		do {
+			red = 0;
+			for (int r=0; r<m; r++) {
+				i=r % n; // in case m>n
+				old = x[i];
+				proj = b[r] - M.row(r,i);
+				tmp=A[r][i];
+
+				bwd_mul(proj,tmp,x[i]);
+
+				if (x[i].is_empty()) { x.set_empty(); return; }
+
+				M.set(i,x[i]);
+
+				double gain=old.rel_distance(x[i]);
+				if (gain>red) red=gain;
+			}
+		} while (red >= ratio);
+		return;
+	}
+
 	do {
 		red = 0;
 		for (int r=0; r<m; r++) {
@@ -380,6 +650,27 @@ bool inflating_gauss_seidel(const IntervalMatrix& A, const IntervalVector& b, In
 	double d=DBL_MAX; // Hausdorff distances between 2 iterations
 	double dold;
 	double mu; // ratio of dist(x_k,x_{k-1)) / dist(x_{k-1},x_{k-2}).
+
+	if (n>=MIDRAD_MIN_SIZE && !x.is_empty() && !x.is_unbounded() && is_bounded(A)) {
+
+		LinearWorkspace::Frame frame(LinearWorkspace::local());
+		MidRadGaussSeidel M(A, x, frame);
+
+		do {
+			dold = d;
+			xold = x;
+			for (int i=0; i<n; i++) {
+				proj = b[i] - M.row(i,i);
+				x[i] = proj/A[i][i];
+				if (x[i].is_empty() || x[i].is_unbounded()) return false; // diverges
+				M.set(i,x[i]);
+			}
+			d=distance(xold,x);
+			mu=d/dold;
+		} while (mu<mu_max && d>min_dist);
+		return (mu<mu_max);
+	}
+
 	do {
 		dold = d;
 		xold = x;
@@ -107,6 +107,9 @@ void real_LU_solve(const Matrix &LU, const int* p, const Vector& b, Vector& x);
  *
  * \warning Since the result is a real matrix, no outwarding is performed.
  *
+ * \note The LU decomposition is blocked and the temporary arrays are
+ * taken from the #LinearWorkspace of the current thread.
+ *
  * \throw SingularMatrixException if either the matrix is singular or too large values appear
  * during computations.
  *
@@ -161,6 +164,8 @@ void precond_rohn_inverse(const IntervalMatrix& A, IntervalMatrix& invA);
  * \throw SingularMatrixException if no real matrix extracted from [A] could be inversed successfully.
  *                                In this case, A and b are not modified.
  *
+ * \note If [A] is bounded, the product \f$C^{-1}[A]\f$ is calculated in midpoint-radius
+ * arithmetic, with floating-point matrix products (the result is rigorous).
  */
 void precond(IntervalMatrix& A, IntervalVector& b);
 
@@ -193,6 +198,8 @@ void precond(IntervalMatrix& A);
  * \param ratio (optional) - Stopping criterion: the iteration is stopped when each dimension of x has not been reduced by more
  * than \a ratio \%. Default value is 0.1 (1\%).
  *
+ * \note For large systems (8 variables or more) with bounded [A] and [x], the sums
+ * of products are calculated in midpoint-radius arithmetic (the result is rigorous).
  */
 void gauss_seidel(const IntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double ratio=0.01);
 
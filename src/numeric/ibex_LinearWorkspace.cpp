@@ -0,0 +1,65 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_LinearWorkspace.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_LinearWorkspace.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// size of the first block (in number of doubles): 64KB
+const size_t min_block_size = 8192;
+
+}
+
+LinearWorkspace::LinearWorkspace() : block(0), top(0) {
+
+}
+
+LinearWorkspace::~LinearWorkspace() {
+	for (vector<Block>::iterator it=blocks.begin(); it!=blocks.end(); ++it)
+		delete[] it->data;
+}
+
+LinearWorkspace& LinearWorkspace::local() {
+	static thread_local LinearWorkspace w;
+	return w;
+}
+
+size_t LinearWorkspace::capacity() const {
+	size_t c=0;
+	for (vector<Block>::const_iterator it=blocks.begin(); it!=blocks.end(); ++it)
+		c += it->size;
+	return c;
+}
+
+double* LinearWorkspace::alloc(size_t n) {
+	// look for a block with enough free space, starting from the current one
+	while (block<blocks.size() && top+n>blocks[block].size) {
+		block++;
+		top=0;
+	}
+
+	if (block==blocks.size()) {
+		// the size of blocks grows geometrically
+		size_t size=blocks.empty() ? min_block_size : 2*blocks.back().size;
+		if (size<n) size=n;
+		Block b;
+		b.data = new double[size];
+		b.size = size;
+		blocks.push_back(b);
+	}
+
+	double* p=blocks[block].data+top;
+	top+=n;
+	return p;
+}
+
+} // end namespace ibex
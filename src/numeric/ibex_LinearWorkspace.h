@@ -0,0 +1,137 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_LinearWorkspace.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_LINEAR_WORKSPACE_H__
+#define __IBEX_LINEAR_WORKSPACE_H__
+
+#include <vector>
+#include <cstddef>
+
+namespace ibex {
+
+/** \ingroup numeric
+ *
+ * \brief Arena for the temporary arrays of linear algebra routines.
+ *
+ * Routines like precond or gauss_seidel are called at each node of a
+ * search with matrices of the same size. Instead of allocating their
+ * temporary matrices at each call, they take contiguous (row-major)
+ * arrays of doubles from this arena. The memory is never given back
+ * to the system: it is reused by the next calls.
+ *
+ * Allocation is stack-like: all the arrays obtained since a #Frame
+ * has been opened are released when the frame is closed. Frames can
+ * be nested and an array never moves (the arena is a list of blocks)
+ * so that nested routines can safely use the same arena.
+ *
+ * Each thread has its own arena (see #local()).
+ *
+ * Example:
+ * \code
+ * LinearWorkspace::Frame frame(LinearWorkspace::local());
+ * double* M = frame.alloc(n*n);
+ * ...
+ * \endcode   // M is released here
+ */
+class LinearWorkspace {
+public:
+
+	/**
+	 * \brief Create an empty arena.
+	 */
+	LinearWorkspace();
+
+	/**
+	 * \brief Delete this.
+	 */
+	~LinearWorkspace();
+
+	/**
+	 * \brief The arena of the current thread.
+	 */
+	static LinearWorkspace& local();
+
+	/**
+	 * \brief Allocation scope.
+	 */
+	class Frame {
+	public:
+		/**
+		 * \brief Open a frame.
+		 */
+		explicit Frame(LinearWorkspace& w);
+
+		/**
+		 * \brief Close the frame (release all the arrays allocated since).
+		 */
+		~Frame();
+
+		/**
+		 * \brief Array of n doubles (uninitialized).
+		 */
+		double* alloc(size_t n);
+
+		/**
+		 * \brief Array of n integers (uninitialized).
+		 */
+		int* alloc_int(size_t n);
+
+	private:
+		Frame(const Frame&);            // forbidden
+		Frame& operator=(const Frame&); // forbidden
+
+		LinearWorkspace& w;
+		size_t block;
+		size_t top;
+	};
+
+	/**
+	 * \brief Total size of the arena (in number of doubles).
+	 */
+	size_t capacity() const;
+
+private:
+	LinearWorkspace(const LinearWorkspace&);            // forbidden
+	LinearWorkspace& operator=(const LinearWorkspace&); // forbidden
+
+	double* alloc(size_t n);
+
+	struct Block {
+		double* data;
+		size_t size;
+	};
+
+	std::vector<Block> blocks;
+
+	// current block and first free position in this block
+	size_t block;
+	size_t top;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline LinearWorkspace::Frame::Frame(LinearWorkspace& w) : w(w), block(w.block), top(w.top) {
+
+}
+
+inline LinearWorkspace::Frame::~Frame() {
+	w.block = block;
+	w.top = top;
+}
+
+inline double* LinearWorkspace::Frame::alloc(size_t n) {
+	return w.alloc(n);
+}
+
+inline int* LinearWorkspace::Frame::alloc_int(size_t n) {
+	return (int*) w.alloc((n*sizeof(int)+sizeof(double)-1)/sizeof(double));
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_LINEAR_WORKSPACE_H__
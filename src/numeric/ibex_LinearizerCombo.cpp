@@ -12,7 +12,7 @@
 
 namespace ibex {
 
-LinearizerCombo::LinearizerCombo(const System& sys, linear_mode lmode1) :
+LinearizerCombo::LinearizerCombo(const System& sys, linear_mode lmode1, bool cut_pool) :
 			Linearizer(sys.nb_var),
 			lmode(lmode1),
 			myxnewton(NULL)
@@ -24,17 +24,17 @@ LinearizerCombo::LinearizerCombo(const System& sys, linear_mode lmode1) :
 	switch (lmode) {
 	case XNEWTON: {
 		// the default corner of XNewton linear relaxation
-		myxnewton = new LinearizerXTaylor(sys, LinearizerXTaylor::RELAX, LinearizerXTaylor::RANDOM_OPP, LinearizerXTaylor::HANSEN);
+		myxnewton = new LinearizerXTaylor(sys, LinearizerXTaylor::RELAX, LinearizerXTaylor::RANDOM_OPP, LinearizerXTaylor::HANSEN, cut_pool);
 		break;
 	}
 	case TAYLOR:{
 		// the default corner of XNewton linear relaxation
-		myxnewton = new LinearizerXTaylor(sys, LinearizerXTaylor::RELAX, LinearizerXTaylor::RANDOM_OPP, LinearizerXTaylor::TAYLOR);
+		myxnewton = new LinearizerXTaylor(sys, LinearizerXTaylor::RELAX, LinearizerXTaylor::RANDOM_OPP, LinearizerXTaylor::TAYLOR, cut_pool);
 		break;
 	}
 	case HANSEN: {
 		// the default corner of XNewton linear relaxation
-		myxnewton = new LinearizerXTaylor(sys, LinearizerXTaylor::RELAX, LinearizerXTaylor::RANDOM_OPP, LinearizerXTaylor::HANSEN);
+		myxnewton = new LinearizerXTaylor(sys, LinearizerXTaylor::RELAX, LinearizerXTaylor::RANDOM_OPP, LinearizerXTaylor::HANSEN, cut_pool);
 		break;
 	}
 
@@ -48,7 +48,7 @@ LinearizerCombo::LinearizerCombo(const System& sys, linear_mode lmode1) :
 
 		myart = new LinearizerAffine2(sys);
 		// the default corner of XNewton linear relaxation
-		myxnewton = new LinearizerXTaylor(sys, LinearizerXTaylor::RELAX, LinearizerXTaylor::RANDOM_OPP, LinearizerXTaylor::HANSEN);
+		myxnewton = new LinearizerXTaylor(sys, LinearizerXTaylor::RELAX, LinearizerXTaylor::RANDOM_OPP, LinearizerXTaylor::HANSEN, cut_pool);
 		break;
 	}
 #else
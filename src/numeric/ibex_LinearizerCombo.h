@@ -46,12 +46,14 @@ public:
 	 *
 	 * \param sys The system (the extended system in case of optimization)
 	 * \param lmode AFFINE2 | TAYLOR | HANSEN | COMPO: linear relaxation method.
+	 * \param cut_pool If true, the X-Taylor cuts are stored in a box property
+	 *                 and reused in sub-boxes (see #BxpCutPool).
 	 */
 
 #ifdef _IBEX_WITH_AFFINE_
-	LinearizerCombo(const System& sys, linear_mode lmode=COMPO);
+	LinearizerCombo(const System& sys, linear_mode lmode=COMPO, bool cut_pool=false);
 #else
-	LinearizerCombo(const System& sys, linear_mode lmode=XNEWTON);
+	LinearizerCombo(const System& sys, linear_mode lmode=XNEWTON, bool cut_pool=false);
 #endif
 
 
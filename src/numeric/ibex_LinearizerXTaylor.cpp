@@ -16,6 +16,7 @@
 #include "ibex_Exception.h"
 #include "ibex_NormalizedSystem.h"
 #include "ibex_BxpSystemCache.h"
+#include "ibex_Id.h"
 
 #include <vector>
 
@@ -29,14 +30,28 @@ class NoCornerPoint : public Exception { };
 
 class Unsatisfiability : public Exception { };
 
+/*
+ * Sets the current cut pool of the linearizer for the
+ * lifetime of this object (even if an exception is thrown).
+ */
+class PoolSetter {
+public:
+	PoolSetter(BxpCutPool*& pool, BxpCutPool& p) : pool(pool) { pool=&p; }
+	~PoolSetter() { pool=NULL; }
+private:
+	BxpCutPool*& pool;
+};
+
 }
 
 LinearizerXTaylor::LinearizerXTaylor(const System& _sys, approx_mode _mode, corner_policy policy,
-		slope_formula _slope):
+		slope_formula _slope, bool cut_pool):
 			Linearizer(_sys.nb_var), sys(_sys),
 			m(sys.f_ctrs.image_dim()), goal_ctr(-1 /*tmp*/),
 			mode(_mode), slope(_slope),
-			inf(new bool[n]), lp_solver(NULL), cache(NULL) {
+			inf(new bool[n]), lp_solver(NULL), cache(NULL),
+			cut_pool_id(cut_pool && _mode==RELAX ? next_id() : -1),
+			pool(NULL), current_ctr(-1) {
 
 	if (dynamic_cast<const ExtendedSystem*>(&sys)) {
 		((int&) goal_ctr)=((const ExtendedSystem&) sys).goal_ctr();
@@ -61,12 +76,16 @@ LinearizerXTaylor::~LinearizerXTaylor() {
 }
 
 void LinearizerXTaylor::add_property(const IntervalVector& init_box, BoxProperties& prop) {
-	//--------------------------------------------------------------------------
-	/* Using system cache seems not interesting. */
-	//	if (/*mode==RELAX && slope==TAYLOR && */!prop[BxpSystemCache::get_id(sys)]) {
-	//		prop.add(new BxpSystemCache(sys,BxpSystemCache::default_update_ratio));
-	//	}
-	//--------------------------------------------------------------------------
+	// The jacobian matrix is only used with the TAYLOR slope (Hansen matrices
+	// depend on the corner). It is then shared with other operators (e.g., the
+	// Smear bisectors) through the system cache. The update ratio is 0 so
+	// that the matrix is exactly the one of the current box.
+	if (mode==RELAX && slope==TAYLOR && !prop[BxpSystemCache::get_id(sys)]) {
+		prop.add(new BxpSystemCache(sys,0));
+	}
+	if (cut_pool_id!=-1 && !prop[cut_pool_id]) {
+		prop.add(new BxpCutPool(cut_pool_id, m));
+	}
 }
 
 int LinearizerXTaylor::linearize(const IntervalVector& box, LPSolver& _lp_solver)  {
@@ -81,24 +100,27 @@ int LinearizerXTaylor::linearize(const IntervalVector& box, LPSolver& _lp_solver
 	BitSet* active;
 
 	//--------------------------------------------------------------------------
-	/* Using system cache seems not interesting. */
-	//cache=(BxpSystemCache*) prop[BxpSystemCache::get_id(sys)];
-	cache=NULL;
+	/* Using system cache for active constraints seems not interesting. */
+	//	active = &cache->active_ctrs();
+	active = new BitSet(sys.active_ctrs(box));
+	// ============================================
+
+	// The jacobian matrix is shared with other operators
+	// (see add_property).
+	cache=(BxpSystemCache*) prop[BxpSystemCache::get_id(sys)];
+	if (slope!=TAYLOR || (cache && !cache->contains(box)))
+		cache=NULL;
 	//--------------------------------------------------------------------------
 
-	if (cache!=NULL) {
-		active = &cache->active_ctrs();
-//			if (active->size()<box.size()) {
-//				cout << "[xtaylor] inactive constraint!\n";
-//			}
-	} else {
-		active = new BitSet(sys.active_ctrs(box));
-	}
-	// ============================================
+	BxpCutPool* cut_pool = cut_pool_id==-1? NULL : (BxpCutPool*) prop[cut_pool_id];
 
-	int n = mode==RELAX ? linear_relax(box,*active) : linear_restrict(box,*active);
+	int n;
+	if (mode==RELAX)
+		n = cut_pool ? linear_relax(box,*active,*cut_pool) : linear_relax(box,*active);
+	else
+		n = linear_restrict(box,*active);
 
-	if (cache==NULL) delete active;
+	delete active;
 	return n;
 }
 
@@ -113,7 +135,7 @@ int LinearizerXTaylor::linear_relax(const IntervalVector& box, const BitSet& act
 	IntervalMatrix Df(ma,n); // derivatives over the box
 
 	if (slope == TAYLOR) { // compute derivatives once for all
-		Df=cache? cache->active_ctrs_jacobian() : sys.f_ctrs.jacobian(box,active);
+		Df=cache? cache->ctrs_jacobian(active) : sys.f_ctrs.jacobian(box,active);
 
 		if (Df.is_empty()) return -1;
 	}
@@ -152,6 +174,8 @@ int LinearizerXTaylor::linear_relax(const IntervalVector& box, const BitSet& act
 					continue;
 				}
 
+				current_ctr=c;
+
 				try {
 					if (sys.ops[c]==LEQ || sys.ops[c]==LT || sys.ops[c]==EQ)
 						count += linearize_leq_corner(box,corner,Df[i],g_corner[i]);
@@ -175,6 +199,64 @@ int LinearizerXTaylor::linear_relax(const IntervalVector& box, const BitSet& act
 	return count;
 }
 
+int LinearizerXTaylor::linear_relax(const IntervalVector& box, const BitSet& active, BxpCutPool& cut_pool) {
+
+	if (active.empty()) return 0;
+
+	int count=0; // total number of added constraint
+
+	BitSet todo(BitSet::empty(m)); // constraints to be linearized again
+
+	int c; // constraint number
+
+	for (int i=0; i<active.size(); i++) {
+		c=(i==0? active.min() : active.next(c));
+
+		if (cut_pool.is_uptodate(c, box, sys.f_ctrs[c].used_vars)) {
+			// the cuts generated for a superset of the box are still valid
+			for (int k=0; k<cut_pool.nb_cuts(c); k++) {
+				try {
+					count += check_and_add_constraint(box, cut_pool.row(c,k), cut_pool.rhs(c,k));
+				} catch (LPException&) {
+					continue;  // just skip this cut
+				} catch (Unsatisfiability&) {
+					return -1;
+				}
+			}
+		} else {
+			todo.add(c);
+		}
+	}
+
+	if (todo.empty()) return count;
+
+	// The new cuts are first stored in a temporary pool and only moved to
+	// the cut pool once the linearization has succeeded. Otherwise, after
+	// an exception, an incomplete set of cuts would be considered as up to
+	// date for this box.
+	BxpCutPool new_cuts(cut_pool.id, m);
+
+	for (int i=0; i<todo.size(); i++) {
+		c=(i==0? todo.min() : todo.next(c));
+		new_cuts.reset(c, box);
+	}
+
+	int count2;
+	{
+		PoolSetter setter(pool, new_cuts);
+		count2 = linear_relax(box, todo);
+	}
+
+	if (count2==-1) return -1;
+
+	for (int i=0; i<todo.size(); i++) {
+		c=(i==0? todo.min() : todo.next(c));
+		cut_pool.move(c, new_cuts);
+	}
+
+	return count + count2;
+}
+
 int LinearizerXTaylor::linear_restrict(const IntervalVector& box, const BitSet& active) {
 
 	if (active.empty()) return 0;
@@ -321,6 +403,7 @@ int LinearizerXTaylor::check_and_add_constraint(const IntervalVector& box, const
 	} else {
 		//cout << "add constraint " << a << "*x<=" << b << endl;
 		lp_solver->add_constraint(a, LEQ, b); // note: may throw LPException
+		if (pool) pool->add(current_ctr, a, b);
 		return 1;
 	}
 }
@@ -16,6 +16,7 @@
 #include "ibex_Linearizer.h"
 #include "ibex_System.h"
 #include "ibex_BxpSystemCache.h"
+#include "ibex_BxpCutPool.h"
 
 namespace ibex {
 
@@ -75,8 +76,12 @@ public:
 	 * \param slope           - Slope matrix formula (TAYLOR | HANSEN)
 	 * \param max_diam_deriv  - The maximum diameter of the box for the linear solver (default value 1.e6).
 	 * 	  				        Soplex may lose solutions when it is called with "big" domains.
+	 * \param cut_pool        - If true, the cuts are stored in a box property (see #BxpCutPool)
+	 *                          and the cuts of a constraint are only generated again when the
+	 *                          domain of one of its variables has been significantly reduced
+	 *                          (typically, by bisection). RELAX mode only.
 	 */
-	LinearizerXTaylor(const System& sys, approx_mode mode, corner_policy corners=RANDOM, slope_formula slope=HANSEN);
+	LinearizerXTaylor(const System& sys, approx_mode mode, corner_policy corners=RANDOM, slope_formula slope=HANSEN, bool cut_pool=false);
 
 	/**
 	 * \brief Deletes this.
@@ -94,10 +99,15 @@ public:
 	virtual int linearize(const IntervalVector& box, LPSolver& lp_solver, BoxProperties& prop);
 
 	/**
-	 * \brief Add BxpActiveCtrs
+	 * \brief Add BxpCutPool (if required)
 	 */
 	virtual void add_property(const IntervalVector& init_box, BoxProperties& prop);
 
+	/**
+	 * \brief Identifier of the BxpCutPool property (-1 if none).
+	 */
+	long get_cut_pool_id() const;
+
 private:
 
 	/**
@@ -110,6 +120,11 @@ private:
 	 */
 	int linear_relax(const IntervalVector& box, const BitSet& active);
 
+	/**
+	 * \brief Linearization (RELAX mode) with a cut pool
+	 */
+	int linear_relax(const IntervalVector& box, const BitSet& active, BxpCutPool& cut_pool);
+
 	/**
 	 * \brief Linearization (RESTRICT mode)
 	 */
@@ -187,8 +202,29 @@ private:
 	 * Current system cache (NULL if none)
 	 */
 	BxpSystemCache* cache;
+
+	/**
+	 * Identifier of the cut pool property (-1 if none).
+	 */
+	const long cut_pool_id;
+
+	/**
+	 * Current cut pool where new cuts are stored (NULL if none)
+	 */
+	BxpCutPool* pool;
+
+	/**
+	 * Constraint currently linearized
+	 */
+	int current_ctr;
 };
 
+/*================================== inline implementations ========================================*/
+
+inline long LinearizerXTaylor::get_cut_pool_id() const {
+	return cut_pool_id;
+}
+
 } // end namespace ibex
 
 #endif /* __IBEX_LINEARIZER_X_TAYLOR__ */
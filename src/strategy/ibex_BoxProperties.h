@@ -114,6 +114,23 @@ public:
 	 */
 	void update_bisect(const Bisection& b, BoxProperties& lprop, BoxProperties& rprop) const;
 
+	/**
+	 * \brief Iterator over the properties.
+	 *
+	 * The iterator points to a pair <id,Bxp*>.
+	 */
+	typedef Map<Bxp>::const_iterator const_iterator;
+
+	/**
+	 * \brief First property.
+	 */
+	const_iterator begin() const;
+
+	/**
+	 * \brief End of properties.
+	 */
+	const_iterator end() const;
+
 	/**
 	 * \brief The box.
 	 */
@@ -160,6 +177,16 @@ protected:
  */
 std::ostream& operator<<(std::ostream& os, const BoxProperties&);
 
+/*================================== inline implementations ========================================*/
+
+inline BoxProperties::const_iterator BoxProperties::begin() const {
+	return map.begin();
+}
+
+inline BoxProperties::const_iterator BoxProperties::end() const {
+	return map.end();
+}
+
 } /* namespace ibex */
 
 #endif /* __IBEX_BOX_PROPERTIES_H__ */
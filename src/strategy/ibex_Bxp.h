@@ -81,6 +81,34 @@ public:
 	 */
 	virtual std::string to_string() const;
 
+	/**
+	 * \brief Write the property value in a binary stream.
+	 *
+	 * Used to store a cell out of memory (see #ibex::CellSpill).
+	 * By default, nothing is written: when the cell is reloaded, the
+	 * property value is rebuilt by a CHANGE event on the same box.
+	 */
+	virtual void write(std::ostream& os) const;
+
+	/**
+	 * \brief Read the property value from a binary stream.
+	 *
+	 * Reads what #write(std::ostream&) has written. This function is
+	 * called after the property value has been updated with a CHANGE event.
+	 */
+	virtual void read(std::istream& is);
+
+	/**
+	 * \brief Whether the property value can be stored out of memory.
+	 *
+	 * Must return true if #write(std::ostream&) and #read(std::istream&)
+	 * are implemented, or if nothing needs to be written because the
+	 * value is entirely rebuilt by a CHANGE event.
+	 *
+	 * By default: false (#ibex::CellSpill refuses to store the cell).
+	 */
+	virtual bool storable() const;
+
 	/**
 	 * \brief Delete this.
 	 */
@@ -108,6 +136,16 @@ inline Bxp::Bxp(long id) : id(id) {
 inline Bxp::~Bxp() {
 }
 
+inline void Bxp::write(std::ostream& os) const {
+}
+
+inline void Bxp::read(std::istream& is) {
+}
+
+inline bool Bxp::storable() const {
+	return false;
+}
+
 inline std::string Bxp::to_string() const {
 	std::stringstream ss;
 	ss << '[' << id << ']';
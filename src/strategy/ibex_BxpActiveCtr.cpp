@@ -58,6 +58,10 @@ long BxpActiveCtr::get_id(const NumConstraint& ctr) {
 	}
 }
 
+bool BxpActiveCtr::storable() const {
+	return true;
+}
+
 std::string BxpActiveCtr::to_string() const {
 	stringstream ss;
 	ss << '[' << id << "] BxpActiveCtr Ctr n°" << ctr.id;
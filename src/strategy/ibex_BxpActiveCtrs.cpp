@@ -77,6 +77,10 @@ long BxpActiveCtrs::get_id(const System& sys) {
 	}
 }
 
+bool BxpActiveCtrs::storable() const {
+	return true;
+}
+
 std::string BxpActiveCtrs::to_string() const {
 	stringstream ss;
 	ss << '[' << id << "] BxpActiveCtrs System n°" << sys.id;
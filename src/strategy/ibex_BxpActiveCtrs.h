@@ -46,6 +46,11 @@ public:
 	 */
 	virtual void update(const BoxEvent& event, const BoxProperties& prop);
 
+	/**
+	 * \brief True (nothing is written: the activity is checked again).
+	 */
+	virtual bool storable() const;
+
 	/**
 	 * \brief To string
 	 *
@@ -0,0 +1,141 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BxpCutPool.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_BxpCutPool.h"
+
+#include <cmath>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * Largest absolute value of a coefficient.
+ */
+double max_abs(const Vector& a) {
+	double m=0;
+	for (int j=0; j<a.size(); j++)
+		if (fabs(a[j])>m) m=fabs(a[j]);
+	return m;
+}
+
+}
+
+BxpCutPool::Cuts::Cuts(const IntervalVector& box) : box(box), refs(1) {
+
+}
+
+BxpCutPool::BxpCutPool(long id, int nb_ctr, double update_ratio, double merge_tol) : Bxp(id),
+		update_ratio(update_ratio), merge_tol(merge_tol), cuts(nb_ctr, (Cuts*) NULL) {
+
+}
+
+BxpCutPool::~BxpCutPool() {
+	for (unsigned int c=0; c<cuts.size(); c++)
+		release(c);
+}
+
+BxpCutPool* BxpCutPool::copy(const IntervalVector& box, const BoxProperties& prop) const {
+	BxpCutPool* p = new BxpCutPool(id, cuts.size(), update_ratio, merge_tol);
+	for (unsigned int c=0; c<cuts.size(); c++) {
+		p->cuts[c] = cuts[c];
+		if (cuts[c]) cuts[c]->refs++;
+	}
+	return p;
+}
+
+void BxpCutPool::update(const BoxEvent& event, const BoxProperties& prop) {
+	if (event.type!=BoxEvent::CONTRACT) {
+		for (unsigned int c=0; c<cuts.size(); c++)
+			release(c);
+	}
+}
+
+bool BxpCutPool::storable() const {
+	return true;
+}
+
+string BxpCutPool::to_string() const {
+	stringstream ss;
+	int nb=0;
+	for (unsigned int c=0; c<cuts.size(); c++)
+		nb+=nb_cuts(c);
+	ss << '[' << id << "] BxpCutPool (" << nb << " cuts)";
+	return ss.str();
+}
+
+bool BxpCutPool::is_uptodate(int c, const IntervalVector& box, const vector<int>& vars) const {
+	if (!cuts[c] || !box.is_subset(cuts[c]->box)) return false;
+
+	for (vector<int>::const_iterator j=vars.begin(); j!=vars.end(); j++) {
+		if ((update_ratio==0 && cuts[c]->box[*j]!=box[*j])
+				|| cuts[c]->box[*j].rel_distance(box[*j])>update_ratio)
+			return false;
+	}
+	return true;
+}
+
+void BxpCutPool::reset(int c, const IntervalVector& box) {
+	release(c);
+	cuts[c] = new Cuts(box);
+}
+
+void BxpCutPool::add(int c, const Vector& a, double b) {
+	assert(cuts[c] && cuts[c]->refs==1);
+
+	double m=max_abs(a);
+	if (m==0 || std::isinf(m) || std::isnan(m)) return; // not a cut
+
+	// scaling by a power of 2 is exact (barring underflow)
+	int e;
+	frexp(m,&e);
+	Vector na=ldexp(1.0,-e)*a;
+	double nb=ldexp(b,-e);
+
+	vector<Vector>& rows=cuts[c]->a;
+	const IntervalVector& box=cuts[c]->box;
+
+	for (unsigned int k=0; k<rows.size(); k++) {
+		const Vector& r=rows[k];
+
+		if (r==na) { // duplicate (up to a power of 2)
+			if (nb<cuts[c]->b[k]) cuts[c]->b[k]=nb;
+			return;
+		}
+
+		// r = lambda*na + (r-lambda*na) with lambda>0
+		double lambda=max_abs(r)/max_abs(na);
+		if (max_abs(r-lambda*na)>merge_tol) continue;
+
+		// na*x<=nb implies r*x <= lambda*nb + (r-lambda*na)*x
+		Interval bound=Interval(lambda)*nb + (r-Interval(lambda)*na)*box;
+		if (bound.is_empty() || bound.ub()==POS_INFINITY)
+			continue; // cannot merge (unbounded box)
+
+		if (bound.ub()<cuts[c]->b[k]) cuts[c]->b[k]=bound.ub();
+		return;
+	}
+	rows.push_back(na);
+	cuts[c]->b.push_back(nb);
+}
+
+void BxpCutPool::move(int c, BxpCutPool& src) {
+	release(c);
+	cuts[c]=src.cuts[c];
+	src.cuts[c]=NULL;
+}
+
+void BxpCutPool::release(int c) {
+	if (cuts[c] && --cuts[c]->refs==0)
+		delete cuts[c];
+	cuts[c]=NULL;
+}
+
+} /* namespace ibex */
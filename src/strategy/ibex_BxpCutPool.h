@@ -0,0 +1,203 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BxpCutPool.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_BXP_CUT_POOL_H__
+#define __IBEX_BXP_CUT_POOL_H__
+
+#include "ibex_Bxp.h"
+#include "ibex_Vector.h"
+
+#include <vector>
+#include <atomic>
+
+namespace ibex {
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Pool of linear cuts.
+ *
+ * Stores, for each constraint of a system, the linear inequalities
+ * (cuts) a*x<=b generated by a linear relaxation technique, together
+ * with the box they have been generated for.
+ *
+ * A relaxation built on a box remains valid in any sub-box.
+ * The cuts are therefore inherited by the sub-boxes (the storage is shared
+ * between a box and its sub-boxes until the cuts of a constraint are
+ * generated again) and the linearization technique can decide to reuse
+ * them, see #is_uptodate(...).
+ *
+ * The cuts are normalized (scaled by a power of 2, which is exact, so that
+ * the largest coefficient lies in [0.5,1)) and nearly parallel cuts of a
+ * constraint are merged into a single one, see #add(...).
+ *
+ * \see #LinearizerXTaylor.
+ */
+class BxpCutPool : public Bxp {
+public:
+
+	/**
+	 * \brief Build an empty pool.
+	 *
+	 * \param id           - The property id (should be specific to the linearization technique)
+	 * \param nb_ctr       - The number of constraints
+	 * \param update_ratio - The cuts of a constraint are considered as out of date
+	 *                       as soon as one of its variables has been reduced by more
+	 *                       than this ratio. See Interval::rel_distance(...).
+	 * \param merge_tol    - Two cuts are merged if their normalized coefficients
+	 *                       (one being multiplied by the ratio of the largest
+	 *                       coefficients) differ by at most this value.
+	 */
+	BxpCutPool(long id, int nb_ctr, double update_ratio=default_update_ratio, double merge_tol=default_merge_tol);
+
+	/**
+	 * \brief Delete this.
+	 */
+	virtual ~BxpCutPool();
+
+	/**
+	 * \brief Copy the property.
+	 *
+	 * The cuts are shared (not duplicated).
+	 */
+	virtual BxpCutPool* copy(const IntervalVector& box, const BoxProperties& prop) const;
+
+	/**
+	 * \brief Update the property after box modification.
+	 *
+	 * The cuts are removed if the box is not contracted.
+	 */
+	virtual void update(const BoxEvent& event, const BoxProperties& prop);
+
+	/**
+	 * \brief True (nothing is written: the cuts are generated again).
+	 */
+	virtual bool storable() const;
+
+	/**
+	 * \brief To string
+	 */
+	virtual std::string to_string() const;
+
+	/**
+	 * \brief Whether the cuts of a constraint can be reused in a box.
+	 *
+	 * \param c    - The constraint number
+	 * \param box  - The current box
+	 * \param vars - The variables the constraint depends on
+	 *
+	 * \return true if the cuts have been generated for a superset of \a box
+	 *         and if the domains of \a vars have not been reduced too much
+	 *         since.
+	 */
+	bool is_uptodate(int c, const IntervalVector& box, const std::vector<int>& vars) const;
+
+	/**
+	 * \brief Remove the cuts of a constraint.
+	 *
+	 * The new cuts added after this call (see #add) will be
+	 * considered as generated for \a box.
+	 */
+	void reset(int c, const IntervalVector& box);
+
+	/**
+	 * \brief Add a cut a*x<=b to a constraint.
+	 *
+	 * The cut is first normalized. If there is already a cut r*x<=c with
+	 * nearly the same direction (see merge_tol), the new cut is not added;
+	 * instead, c is replaced by the bound that a*x<=b implies on r*x in the
+	 * box of the cuts, if it is tighter. This bound is computed with
+	 * interval arithmetic so the merge is rigorous.
+	 *
+	 * \pre reset(c,...) must have been called on this property value.
+	 */
+	void add(int c, const Vector& a, double b);
+
+	/**
+	 * \brief Move the cuts of a constraint from another pool.
+	 *
+	 * The cuts of \a c in this pool are replaced by the cuts of
+	 * \a c in \a src, which has no more cuts for \a c after the call.
+	 */
+	void move(int c, BxpCutPool& src);
+
+	/**
+	 * \brief Number of cuts of a constraint.
+	 */
+	int nb_cuts(int c) const;
+
+	/**
+	 * \brief Coefficients of the kth cut of a constraint.
+	 */
+	const Vector& row(int c, int k) const;
+
+	/**
+	 * \brief Right-hand side of the kth cut of a constraint.
+	 */
+	double rhs(int c, int k) const;
+
+	/**
+	 * Set to 0.1
+	 */
+	static constexpr double default_update_ratio = 0.1;
+
+	/**
+	 * Set to 1e-8
+	 */
+	static constexpr double default_merge_tol = 1e-8;
+
+protected:
+
+	/**
+	 * Cuts of a constraint (shared through the search tree).
+	 */
+	class Cuts {
+	public:
+		Cuts(const IntervalVector& box);
+		IntervalVector box; // the box the cuts have been generated for
+		std::vector<Vector> a;
+		std::vector<double> b;
+		std::atomic<int> refs; // number of pools sharing these cuts (possibly in different threads)
+	};
+
+	/**
+	 * Update ratio.
+	 */
+	double update_ratio;
+
+	/**
+	 * Merge tolerance.
+	 */
+	double merge_tol;
+
+	/**
+	 * Cuts of each constraint (NULL if none).
+	 */
+	std::vector<Cuts*> cuts;
+
+private:
+	void release(int c);
+};
+
+/*================================== inline implementations ========================================*/
+
+inline int BxpCutPool::nb_cuts(int c) const {
+	return cuts[c]? (int) cuts[c]->b.size() : 0;
+}
+
+inline const Vector& BxpCutPool::row(int c, int k) const {
+	return cuts[c]->a[k];
+}
+
+inline double BxpCutPool::rhs(int c, int k) const {
+	return cuts[c]->b[k];
+}
+
+} /* namespace ibex */
+
+#endif /* __IBEX_BXP_CUT_POOL_H__ */
@@ -62,6 +62,10 @@ void BxpLinearRelaxArgMin::update(const BoxEvent& event, const BoxProperties& pr
 	}
 }
 
+bool BxpLinearRelaxArgMin::storable() const {
+	return true;
+}
+
 string BxpLinearRelaxArgMin::to_string() const {
 	stringstream ss;
 	ss << '[' << id << "] BxpLinearRelaxArgmin Sys n°";
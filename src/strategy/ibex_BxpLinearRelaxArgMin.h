@@ -43,6 +43,11 @@ public:
 	 */
 	virtual void update(const BoxEvent& event, const BoxProperties& prop);
 
+	/**
+	 * \brief True (nothing is written: the argmin is forgotten).
+	 */
+	virtual bool storable() const;
+
 	/**
 	 * \brief To string
 	 */
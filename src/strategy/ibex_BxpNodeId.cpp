@@ -0,0 +1,47 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BxpNodeId.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_BxpNodeId.h"
+#include "ibex_SearchLog.h"
+#include "ibex_Id.h"
+
+using namespace std;
+
+namespace ibex {
+
+const long BxpNodeId::id = next_id();
+
+BxpNodeId::BxpNodeId(SearchLog& log, unsigned long node, unsigned long parent) : Bxp(id), log(log), node(node), parent(parent) {
+
+}
+
+BxpNodeId* BxpNodeId::copy(const IntervalVector& box, const BoxProperties& prop) const {
+	return new BxpNodeId(log, node, parent);
+}
+
+void BxpNodeId::write(ostream& os) const {
+	os.write((const char*) &node, sizeof(node));
+	os.write((const char*) &parent, sizeof(parent));
+}
+
+void BxpNodeId::read(istream& is) {
+	is.read((char*) &node, sizeof(node));
+	is.read((char*) &parent, sizeof(parent));
+}
+
+bool BxpNodeId::storable() const {
+	return true;
+}
+
+string BxpNodeId::to_string() const {
+	stringstream ss;
+	ss << '[' << id << "] node " << node << " (parent=" << parent << ")";
+	return ss.str();
+}
+
+} /* namespace ibex */
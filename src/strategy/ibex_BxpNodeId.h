@@ -0,0 +1,100 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BxpNodeId.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_BXP_NODE_ID_H__
+#define __IBEX_BXP_NODE_ID_H__
+
+#include "ibex_Bxp.h"
+
+namespace ibex {
+
+class SearchLog;
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Number of a node in the search tree.
+ *
+ * A copy of the property (e.g., in a contraction context) is the
+ * same node. The children of a bisected cell get new numbers from the
+ * search log when the strategy reports the bisection (see
+ * #ibex::SearchLog::bisected) and record the number of their parent.
+ *
+ * See #ibex::SearchLog.
+ */
+class BxpNodeId : public Bxp {
+public:
+	/**
+	 * \brief Create the property value of a node.
+	 *
+	 * \param log    - the search log that numbers the nodes.
+	 * \param node   - the number of the node.
+	 * \param parent - the number of the parent node (0 if none).
+	 */
+	BxpNodeId(SearchLog& log, unsigned long node, unsigned long parent=0);
+
+	/**
+	 * \brief Create a copy (same numbers).
+	 */
+	virtual BxpNodeId* copy(const IntervalVector& box, const BoxProperties& prop) const;
+
+	/**
+	 * \brief Does nothing.
+	 */
+	virtual void update(const BoxEvent& event, const BoxProperties& prop);
+
+	/**
+	 * \brief Write the numbers (the node keeps its numbers when the cell is spilled).
+	 */
+	virtual void write(std::ostream& os) const;
+
+	/**
+	 * \brief Read the numbers.
+	 */
+	virtual void read(std::istream& is);
+
+	/**
+	 * \brief True.
+	 */
+	virtual bool storable() const;
+
+	/**
+	 * \brief To string.
+	 */
+	virtual std::string to_string() const;
+
+	/**
+	 * \brief The search log.
+	 */
+	SearchLog& log;
+
+	/**
+	 * \brief Number of the node.
+	 */
+	unsigned long node;
+
+	/**
+	 * \brief Number of the parent node (0 if none).
+	 */
+	unsigned long parent;
+
+	/**
+	 * \brief Id of the property.
+	 */
+	static const long id;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline void BxpNodeId::update(const BoxEvent& event, const BoxProperties& prop) {
+
+}
+
+} /* namespace ibex */
+
+#endif /* __IBEX_BXP_NODE_ID_H__ */
@@ -0,0 +1,68 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BxpParamPaving.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_BxpParamPaving.h"
+
+using namespace std;
+
+namespace ibex {
+
+BxpParamPaving::Paving::Paving(const IntervalVector& x, const IntervalVector& y_init, const vector<IntervalVector>& boxes, bool inactive) :
+		x(x), y_init(y_init), boxes(boxes), inactive(inactive), refs(1) {
+}
+
+BxpParamPaving::BxpParamPaving(long id) : Bxp(id), paving(NULL) {
+
+}
+
+BxpParamPaving::~BxpParamPaving() {
+	clear();
+}
+
+BxpParamPaving* BxpParamPaving::copy(const IntervalVector& box, const BoxProperties& prop) const {
+	BxpParamPaving* p = new BxpParamPaving(id);
+	p->paving = paving;
+	if (paving) paving->refs++;
+	return p;
+}
+
+void BxpParamPaving::update(const BoxEvent& event, const BoxProperties& prop) {
+	if (event.type!=BoxEvent::CONTRACT)
+		clear();
+}
+
+bool BxpParamPaving::storable() const {
+	return true;
+}
+
+string BxpParamPaving::to_string() const {
+	stringstream ss;
+	ss << '[' << id << "] BxpParamPaving (";
+	if (!paving) ss << "none";
+	else if (paving->inactive) ss << "inactive";
+	else ss << paving->boxes.size() << " boxes";
+	ss << ")";
+	return ss.str();
+}
+
+bool BxpParamPaving::is_uptodate(const IntervalVector& x, const IntervalVector& y_init) const {
+	return paving && x.is_subset(paving->x) && y_init==paving->y_init;
+}
+
+void BxpParamPaving::set(const IntervalVector& x, const IntervalVector& y_init, const vector<IntervalVector>& boxes, bool inactive) {
+	clear();
+	paving = new Paving(x, y_init, boxes, inactive);
+}
+
+void BxpParamPaving::clear() {
+	if (paving && --paving->refs==0)
+		delete paving;
+	paving=NULL;
+}
+
+} /* namespace ibex */
@@ -0,0 +1,150 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BxpParamPaving.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_BXP_PARAM_PAVING_H__
+#define __IBEX_BXP_PARAM_PAVING_H__
+
+#include "ibex_Bxp.h"
+
+#include <vector>
+#include <atomic>
+
+namespace ibex {
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Paving of the parameters of a quantified constraint.
+ *
+ * A contractor for a quantified constraint (CtcExist, CtcForAll)
+ * explores the domain of the parameters by bisection. Some parameter
+ * boxes are found to be irrelevant for the current box [x] (no x in [x]
+ * satisfies the constraint, for CtcExist) or already decided (the
+ * constraint is satisfied for all x in [x], for CtcForAll). This remains
+ * true for any sub-box of [x].
+ *
+ * This property stores the parameter boxes that remain to be considered
+ * (a paving of the domain of the parameters, minus the irrelevant or
+ * decided parts), together with the box [x] it has been calculated for.
+ * The paving is inherited by the sub-boxes (the storage is shared between
+ * a box and its sub-boxes until the paving is calculated again).
+ *
+ * \see #CtcQuantif.
+ */
+class BxpParamPaving : public Bxp {
+public:
+
+	/**
+	 * \brief Build an empty property value (no paving).
+	 *
+	 * \param id - The property id (specific to a contractor)
+	 */
+	BxpParamPaving(long id);
+
+	/**
+	 * \brief Delete this.
+	 */
+	virtual ~BxpParamPaving();
+
+	/**
+	 * \brief Copy the property.
+	 *
+	 * The paving is shared (not duplicated).
+	 */
+	virtual BxpParamPaving* copy(const IntervalVector& box, const BoxProperties& prop) const;
+
+	/**
+	 * \brief Update the property after box modification.
+	 *
+	 * The paving is removed if the box is not contracted.
+	 */
+	virtual void update(const BoxEvent& event, const BoxProperties& prop);
+
+	/**
+	 * \brief True (nothing is written: the paving is calculated again).
+	 */
+	virtual bool storable() const;
+
+	/**
+	 * \brief To string
+	 */
+	virtual std::string to_string() const;
+
+	/**
+	 * \brief Whether the paving can be reused.
+	 *
+	 * \return true if the paving has been calculated for a superset of
+	 *         \a x and for the same initial domain of parameters.
+	 */
+	bool is_uptodate(const IntervalVector& x, const IntervalVector& y_init) const;
+
+	/**
+	 * \brief Set the paving.
+	 *
+	 * \param x        - The box the paving is calculated for
+	 * \param y_init   - The initial domain of parameters
+	 * \param boxes    - The parameter boxes that remain to be considered
+	 * \param inactive - Whether the quantified constraint is satisfied
+	 *                   everywhere in x (the parameter boxes are then
+	 *                   useless).
+	 */
+	void set(const IntervalVector& x, const IntervalVector& y_init, const std::vector<IntervalVector>& boxes, bool inactive);
+
+	/**
+	 * \brief Remove the paving.
+	 */
+	void clear();
+
+	/**
+	 * \brief The parameter boxes.
+	 *
+	 * \pre the paving is up to date.
+	 */
+	const std::vector<IntervalVector>& boxes() const;
+
+	/**
+	 * \brief Whether the quantified constraint is satisfied everywhere.
+	 *
+	 * \pre the paving is up to date.
+	 */
+	bool inactive() const;
+
+protected:
+
+	/**
+	 * Paving (shared through the search tree).
+	 */
+	class Paving {
+	public:
+		Paving(const IntervalVector& x, const IntervalVector& y_init, const std::vector<IntervalVector>& boxes, bool inactive);
+		IntervalVector x;      // the box the paving has been calculated for
+		IntervalVector y_init; // the initial domain of parameters
+		std::vector<IntervalVector> boxes;
+		bool inactive;
+		std::atomic<int> refs; // number of property values sharing this paving (possibly in different threads)
+	};
+
+	/**
+	 * The paving (NULL if none).
+	 */
+	Paving* paving;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline const std::vector<IntervalVector>& BxpParamPaving::boxes() const {
+	return paving->boxes;
+}
+
+inline bool BxpParamPaving::inactive() const {
+	return paving->inactive;
+}
+
+} /* namespace ibex */
+
+#endif /* __IBEX_BXP_PARAM_PAVING_H__ */
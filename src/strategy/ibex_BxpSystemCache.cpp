@@ -35,23 +35,32 @@ BxpSystemCache::BxpSystemCache(const System& sys, double update_ratio/*, int goa
 		goal_eval_updated(false), _goal_gradient(sys.nb_var), goal_gradient_updated(false),
 		_ctrs_eval(sys.f_ctrs.image_dim() /* note: =1 if unconstrained */), ctr_eval_updated(false),
 		_ctrs_jacobian(sys.f_ctrs.image_dim(), exists(sys.f_ctrs)? sys.nb_var : 1),
-		ctr_jacobian_updated(false),
+		_ctrs_jacobian_box(sys.f_ctrs.image_dim(), exists(sys.f_ctrs)? sys.nb_var : 1),
+		ctr_jacobian_calculated(BitSet::empty(sys.f_ctrs.image_dim())),
 		active(BitSet::empty(sys.f_ctrs.image_dim())), // default value (empty bitset) important for unconstrained systems
-		active_ctr_updated(false), active_ctr_jacobian_updated(false) /*, goal_var(goal_var) */ {
+		active_ctr_updated(false) /*, goal_var(goal_var) */ {
 
 	if (!exists(sys.f_ctrs)) {
 		// avoid functions like ctr_eval to be called:
 		active_ctr_updated = true;
 		ctr_eval_updated = true;
-		ctr_jacobian_updated  = true;
-		active_ctr_jacobian_updated = true;
+		// note: update_jacobian(...) is never called
+		// as the number of constraints is 0.
 	}
 
 	//assert((goal_var==-1 && init_box.size()==sys.nb_var) || (goal_var!=-1 && init_box.size()==sys.nb_var+1));
 }
 
 BxpSystemCache* BxpSystemCache::copy(const IntervalVector& box, const BoxProperties& prop) const {
-	return new BxpSystemCache(sys, update_ratio);
+	BxpSystemCache* c=new BxpSystemCache(sys, update_ratio);
+	if (!ctr_jacobian_calculated.empty()) {
+		// the rows that do not depend on the variable
+		// the box is bisected on will be reused.
+		c->_ctrs_jacobian = _ctrs_jacobian;
+		c->_ctrs_jacobian_box = _ctrs_jacobian_box;
+		c->ctr_jacobian_calculated = ctr_jacobian_calculated;
+	}
+	return c;
 }
 
 long BxpSystemCache::get_id(const System& sys) {
@@ -64,6 +73,10 @@ long BxpSystemCache::get_id(const System& sys) {
 	}
 }
 
+bool BxpSystemCache::storable() const {
+	return true;
+}
+
 std::string BxpSystemCache::to_string() const {
 	stringstream ss;
 	ss << '[' << id << "] BxpSystemCache System n°" << sys.id;
@@ -120,8 +133,8 @@ void BxpSystemCache::update(const BoxEvent& e, const BoxProperties& prop) {
 		}
 		if (exists(sys.f_ctrs)) {
 			ctr_eval_updated=false;
-			ctr_jacobian_updated=false;
-			active_ctr_jacobian_updated=false;
+			// note: the rows of the jacobian matrix are
+			// checked individually (see is_jacobian_uptodate)
 		}
 
 		if (exists(sys.f_ctrs)) {
@@ -194,13 +207,68 @@ IntervalMatrix BxpSystemCache::ctrs_jacobian() const {
 }
 
 void BxpSystemCache::ctrs_jacobian(IntervalMatrix& J) const {
-	if (!ctr_jacobian_updated) {
-		sys.f_ctrs.jacobian(cache,_ctrs_jacobian);
-		ctr_jacobian_updated=true;
-	}
+	if (exists(sys.f_ctrs))
+		update_jacobian(BitSet::all(sys.f_ctrs.image_dim()));
 	J=_ctrs_jacobian;
 }
 
+IntervalMatrix BxpSystemCache::ctrs_jacobian(const BitSet& rows) const {
+
+	assert(!rows.empty());
+
+	update_jacobian(rows);
+
+	IntervalMatrix J(rows.size(),nb_var);
+	int c;
+	for (int i=0; i<rows.size(); i++) {
+		c=(i==0? rows.min() : rows.next(c));
+		J[i] = _ctrs_jacobian[c];
+	}
+	return J;
+}
+
+bool BxpSystemCache::is_jacobian_uptodate(int c) const {
+	if (!ctr_jacobian_calculated[c]) return false;
+
+	const vector<int>& vars=sys.f_ctrs[c].used_vars;
+
+	for (vector<int>::const_iterator j=vars.begin(); j!=vars.end(); j++) {
+		if (_ctrs_jacobian_box[c][*j]!=cache[*j])
+			return false;
+	}
+	return true;
+}
+
+void BxpSystemCache::update_jacobian(const BitSet& rows) const {
+
+	BitSet todo=BitSet::empty(sys.f_ctrs.image_dim());
+
+	int c;
+	for (int i=0; i<rows.size(); i++) {
+		c=(i==0? rows.min() : rows.next(c));
+		if (!is_jacobian_uptodate(c)) todo.add(c);
+	}
+
+	if (todo.empty()) return;
+
+	IntervalMatrix J=sys.f_ctrs.jacobian(cache,todo);
+
+	for (int i=0; i<todo.size(); i++) {
+		c=(i==0? todo.min() : todo.next(c));
+		_ctrs_jacobian[c] = J[i];
+		_ctrs_jacobian_box[c] = cache;
+		ctr_jacobian_calculated.add(c);
+	}
+}
+
+bool BxpSystemCache::contains(const IntervalVector& box) const {
+	if (cache.is_empty()) return false;
+	for (int j=0; j<nb_var; j++) {
+		if (!box[j].is_subset(cache[j])) return false;
+	}
+	return true;
+}
+
 namespace {
 
 bool __is_inactive(const Interval& gx, CmpOp op) {
@@ -274,30 +342,7 @@ IntervalVector BxpSystemCache::active_ctrs_eval() const {
 
 IntervalMatrix BxpSystemCache::active_ctrs_jacobian() const {
 
-	BitSet b=active_ctrs();
-
-	assert(!b.empty());
-
-	IntervalMatrix J(b.size(),nb_var);
-
-	if (!active_ctr_jacobian_updated) {
-		J=sys.f_ctrs.jacobian(cache,b);
-
-		int c;
-		for (int i=0; i<b.size(); i++) {
-			c=(i==0? b.min() : b.next(c));
-			_ctrs_jacobian[c] = J[i];
-		}
-		active_ctr_jacobian_updated=true;
-	} else {
-		int c;
-		for (int i=0; i<b.size(); i++) {
-			c=(i==0? b.min() : b.next(c));
-			J[i] = _ctrs_jacobian[c];
-		}
-	}
-
-	return J;
+	return ctrs_jacobian(active_ctrs());
 }
 
 bool BxpSystemCache::is_inner() const {
@@ -50,6 +50,9 @@ public:
 
 	/**
 	 * \brief Copy the property
+	 *
+	 * The rows of the jacobian matrix already calculated are
+	 * transmitted to the copy (see #ctrs_jacobian()).
 	 */
 	virtual BxpSystemCache* copy(const IntervalVector& box, const BoxProperties& prop) const;
 
@@ -65,6 +68,11 @@ public:
 	 */
 	virtual void update(const BoxEvent& event, const BoxProperties& prop);
 
+	/**
+	 * \brief True (nothing is written: the values are calculated again).
+	 */
+	virtual bool storable() const;
+
 	/**
 	 * \brief To string
 	 *
@@ -105,6 +113,12 @@ public:
 
 	/**
 	 * \brief Get the jacobian matrix of the constraints.
+	 *
+	 * Each row is stored with the box it has been calculated on.
+	 * When the cache is updated, only the rows of the constraints
+	 * depending on a variable whose domain has changed are
+	 * recalculated. The other ones are kept, including those
+	 * inherited from the parent box (see #copy()).
 	 */
 	IntervalMatrix ctrs_jacobian() const;
 
@@ -115,6 +129,36 @@ public:
 	 */
 	void ctrs_jacobian(IntervalMatrix& J) const;
 
+	/**
+	 * \brief Get some rows of the jacobian matrix of the constraints.
+	 *
+	 * The ith row of the result is the gradient of the ith
+	 * constraint in the bitset. Only the rows that are not
+	 * up-to-date are recalculated.
+	 *
+	 * \pre \a rows must be non empty.
+	 */
+	IntervalMatrix ctrs_jacobian(const BitSet& rows) const;
+
+	/**
+	 * \brief Is a row of the jacobian matrix up-to-date?
+	 *
+	 * \return true if the gradient of the cth constraint has been
+	 *         calculated on a box that coincides with the current one
+	 *         on the variables the constraint depends on.
+	 */
+	bool is_jacobian_uptodate(int c) const;
+
+	/**
+	 * \brief Whether the cache can be used for a box.
+	 *
+	 * \return true if \a box is a subset of the box the current
+	 *         computations are (or will be) based on. Interval
+	 *         computations stored in the cache are then valid enclosures
+	 *         for \a box.
+	 */
+	bool contains(const IntervalVector& box) const;
+
 	/**
 	 * \brief Get the (potentially) active constraints.
 	 *
@@ -189,7 +233,8 @@ protected:
 	mutable bool ctr_eval_updated;
 
 	mutable IntervalMatrix _ctrs_jacobian;
-	mutable bool ctr_jacobian_updated;
+	mutable IntervalMatrix _ctrs_jacobian_box; // the box each row has been calculated on
+	mutable BitSet ctr_jacobian_calculated;     // the rows already calculated
 
 	mutable BitSet active;
 
@@ -198,13 +243,17 @@ protected:
 	// - the components of _ctrs_eval corresponding to active constraints is up-to-date
 	mutable bool active_ctr_updated;
 
-	mutable bool active_ctr_jacobian_updated;
-
 	// If <>-1 then the box will be extended but the system is not.
 	// Note: Not very clean. To be fixed at some point...
 	int goal_var;
 
 	static Map<long,false>& ids();
+
+private:
+	/*
+	 * Recalculate the rows of the jacobian that are out of date.
+	 */
+	void update_jacobian(const BitSet& rows) const;
 };
 
 /*================================== inline implementations ========================================*/
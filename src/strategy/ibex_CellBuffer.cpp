@@ -9,14 +9,32 @@
 //============================================================================
 
 #include "ibex_CellBuffer.h"
+#include "ibex_Exception.h"
+
+#include <cassert>
 
 using namespace std;
 
 namespace ibex {
 
-CellBuffer::CellBuffer() : capacity(-1), screen(1) { }
+CellBuffer::CellBuffer() : capacity(-1), spill(NULL), mem_capacity(-1), screen(1) { }
+
+CellBuffer::~CellBuffer() {
+	if (spill) delete spill;
+}
+
+void CellBuffer::set_spill(unsigned int mem_capacity, const std::string& filename) {
+	assert(empty());
+	if (mem_capacity<2)
+		ibex_error("[CellBuffer]: memory capacity must be at least 2.\n");
+	if (spill) delete spill;
+	spill = new CellSpill(filename);
+	this->mem_capacity = mem_capacity;
+}
 
-CellBuffer::~CellBuffer() { }
+void CellBuffer::check_spill(const BoxProperties& prop) const {
+	if (spill) CellSpill::check(prop);
+}
 
 std::ostream& CellBuffer::print(std::ostream& os) const{
 	os << "==============================================================================\n";
@@ -12,6 +12,7 @@
 #define __IBEX_CELL_BUFFER_H__
 
 #include "ibex_Cell.h"
+#include "ibex_CellSpill.h"
 
 namespace ibex {
 
@@ -54,6 +55,41 @@ class CellBuffer {
 	/** Delete *this. */
 	virtual ~CellBuffer();
 
+	/**
+	 * \brief Spill cells to disk beyond a memory limit.
+	 *
+	 * When the number of cells in memory exceeds \a mem_capacity,
+	 * the least promising half is written to disk (see #ibex::CellSpill)
+	 * and reloaded by batches, in priority order, when the cells in memory
+	 * are exhausted. The #capacity still bounds the total number of
+	 * cells (in memory and on disk).
+	 *
+	 * Supported by CellStack, CellList and CellDoubleHeap. Ignored
+	 * by the other buffers.
+	 *
+	 * \param mem_capacity - maximal number of cells in memory (at least 2)
+	 * \param filename     - the spill file (by default, an anonymous temporary file)
+	 * \pre the buffer is empty.
+	 */
+	void set_spill(unsigned int mem_capacity, const std::string& filename="");
+
+	/**
+	 * \brief Number of cells on disk (0 if no spilling).
+	 *
+	 * These cells are also counted by #size().
+	 */
+	unsigned int nb_spilled() const;
+
+	/**
+	 * \brief Check that cells with these properties can be spilled.
+	 *
+	 * Calls ibex_error(...) if spilling is enabled and a property
+	 * cannot be stored out of memory (see Bxp::storable()). A strategy
+	 * calls this function for the root cell, so that an unsupported
+	 * configuration is rejected before the search starts.
+	 */
+	void check_spill(const BoxProperties& prop) const;
+
 	/**
 	 * \brief Add properties required by this buffer.
 	 *
@@ -91,6 +127,16 @@ protected:
 
 	virtual std::ostream& print(std::ostream& os) const;
 
+	/**
+	 * \brief Cells on disk (NULL if no spilling).
+	 */
+	CellSpill* spill;
+
+	/**
+	 * \brief Maximal number of cells in memory (if spilling).
+	 */
+	unsigned int mem_capacity;
+
  private:
 
 	mutable int screen; // only for display (debug)
@@ -105,6 +151,10 @@ inline void CellBuffer::add_property(const IntervalVector& init_box, BoxProperti
 
 }
 
+inline unsigned int CellBuffer::nb_spilled() const {
+	return spill? spill->size() : 0;
+}
+
 } // end namespace ibex
 
 #endif // __IBEX_CELL_BUFFER_H__
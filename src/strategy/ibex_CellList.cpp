@@ -9,6 +9,8 @@
 
 #include "ibex_CellList.h"
 
+using namespace std;
+
 namespace ibex {
 
 void CellList::flush() {
@@ -16,24 +18,61 @@ void CellList::flush() {
 		delete clist.front();
 		clist.pop_front();
 	}
+	while (!ctail.empty()) {
+		delete ctail.front();
+		ctail.pop_front();
+	}
+	if (spill) spill->flush();
 }
 
 unsigned int CellList::size() const {
-	return clist.size();
+	return clist.size() + ctail.size() + (spill? spill->size() : 0);
 }
 
 bool CellList::empty() const {
+	// the head is refilled as soon as it is empty
 	return clist.empty();
 }
 
 void CellList::push(Cell* cell) {
 	if (capacity>0 && size()==capacity) throw CellBufferOverflow();
-	clist.push_back(cell);
+
+	if (!spill) {
+		clist.push_back(cell);
+	} else if (spill->empty() && ctail.empty()) {
+		clist.push_back(cell);
+		if (clist.size()>mem_capacity) {
+			// the back half of the list is written to disk
+			list<Cell*>::iterator it=clist.begin();
+			advance(it, clist.size()-clist.size()/2);
+			vector<Cell*> cells(it, clist.end());
+			clist.erase(it, clist.end());
+			spill->write(cells, (double) spill->nb_writes());
+		}
+	} else {
+		// the new cell comes after the cells on disk
+		ctail.push_back(cell);
+		if (ctail.size()>=mem_capacity/2) {
+			vector<Cell*> cells(ctail.begin(), ctail.end());
+			ctail.clear();
+			spill->write(cells, (double) spill->nb_writes());
+		}
+	}
 }
 
 Cell* CellList::pop() {
 	Cell* c = clist.front();
 	clist.pop_front();
+
+	if (clist.empty() && spill) {
+		if (!spill->empty()) {
+			// the first batch written is the first one to be read
+			vector<Cell*> cells;
+			spill->read(cells);
+			clist.assign(cells.begin(), cells.end());
+		} else
+			clist.swap(ctail);
+	}
 	return c;
 }
 
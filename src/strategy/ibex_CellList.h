@@ -20,6 +20,9 @@ namespace ibex {
  * \brief Cell List.
  *
  * For breadth-first search. \see #CellBuffer
+ *
+ * When spilling is enabled, the back of the list is written to
+ * disk and the exact breadth-first order is preserved.
  */
 class CellList : public CellBuffer {
  public:
@@ -43,8 +46,11 @@ class CellList : public CellBuffer {
   Cell* top() const;
 
  private:
-  /* List of cells */
+  /* List of cells (head, in memory) */
   std::list<Cell*> clist;
+
+  /* Cells pushed after the ones on disk (if spilling) */
+  std::list<Cell*> ctail;
 };
 
 } // end namespace ibex
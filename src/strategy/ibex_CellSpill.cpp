@@ -0,0 +1,283 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CellSpill.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_CellSpill.h"
+#include "ibex_Exception.h"
+
+#include <sstream>
+#include <limits>
+#include <cassert>
+#include <algorithm>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// 64-bit offsets (the file may exceed 2GB)
+int seek(FILE* f, long long offset) {
+#ifdef _WIN32
+	return _fseeki64(f, offset, SEEK_SET);
+#else
+	return fseeko(f, (off_t) offset, SEEK_SET);
+#endif
+}
+
+// truncate the file to the given size (return 0 on success)
+int truncate(FILE* f, long long size) {
+	if (fflush(f)!=0) return -1;
+#ifdef _WIN32
+	return _chsize_s(_fileno(f), size);
+#else
+	return ftruncate(fileno(f), (off_t) size);
+#endif
+}
+
+template<class T>
+void write_raw(ostream& os, const T& x) {
+	os.write((const char*) &x, sizeof(T));
+}
+
+template<class T>
+T read_raw(istream& is) {
+	T x;
+	is.read((char*) &x, sizeof(T));
+	return x;
+}
+
+} // end anonymous namespace
+
+CellSpill::CellSpill(const string& filename) : filename(filename), _size(0), end(0), _file_size(0), live(0), _nb_writes(0), proto(NULL) {
+	if (filename.empty())
+		file = tmpfile();
+	else
+		file = fopen(filename.c_str(), "w+b");
+
+	if (!file) ibex_error("[CellSpill]: cannot create file.\n");
+}
+
+CellSpill::~CellSpill() {
+	fclose(file);
+	if (!filename.empty()) remove(filename.c_str());
+	if (proto) delete proto;
+}
+
+double CellSpill::min_key() const {
+	return batches.empty()? numeric_limits<double>::infinity() : batches.begin()->first;
+}
+
+void CellSpill::write_cell(ostream& os, const Cell& cell) const {
+	const IntervalVector& box=cell.box;
+	char empty=box.is_empty();
+	write_raw(os, empty);
+	if (!empty) {
+		for (int i=0; i<box.size(); i++) {
+			write_raw(os, box[i].lb());
+			write_raw(os, box[i].ub());
+		}
+	}
+	write_raw(os, cell.bisected_var);
+	write_raw(os, cell.depth);
+
+	check(cell.prop);
+
+	// only the properties that write something are stored
+	for (BoxProperties::const_iterator it=cell.prop.begin(); it!=cell.prop.end(); ++it) {
+		stringstream ss;
+		it->second->write(ss);
+		string data=ss.str();
+		if (data.empty()) continue;
+		write_raw(os, it->first);
+		write_raw(os, (unsigned int) data.size());
+		os.write(data.c_str(), data.size());
+	}
+	write_raw(os, (long) -1); // end of properties
+}
+
+Cell* CellSpill::read_cell(istream& is) const {
+	Cell* cell=new Cell(*proto);
+
+	IntervalVector& box=cell->box;
+	if (read_raw<char>(is))
+		box.set_empty();
+	else {
+		for (int i=0; i<box.size(); i++) {
+			double lb=read_raw<double>(is);
+			double ub=read_raw<double>(is);
+			box[i]=Interval(lb,ub);
+		}
+	}
+	cell->bisected_var=read_raw<int>(is);
+	cell->depth=read_raw<unsigned int>(is);
+
+	// the properties inherited from the template are invalidated
+	cell->prop.update(BoxEvent(box, BoxEvent::CHANGE));
+
+	long id;
+	while ((id=read_raw<long>(is))!=-1) {
+		unsigned int length=read_raw<unsigned int>(is);
+		string data(length,'\0');
+		is.read(&data[0], length);
+		Bxp* p=cell->prop[id];
+		if (p) {
+			istringstream ss(data);
+			p->read(ss);
+		}
+	}
+	return cell;
+}
+
+void CellSpill::check(const BoxProperties& prop) {
+	for (BoxProperties::const_iterator it=prop.begin(); it!=prop.end(); ++it) {
+		if (!it->second->storable()) {
+			stringstream msg;
+			msg << "[CellSpill]: the property " << it->second->to_string() << " cannot be stored out of memory.\n";
+			ibex_error(msg.str().c_str());
+		}
+	}
+}
+
+void CellSpill::write(const vector<Cell*>& cells, double key) {
+	write(cells, vector<double>(cells.size(), key));
+}
+
+void CellSpill::write(const vector<Cell*>& cells, const vector<double>& keys) {
+	assert(keys.size()==cells.size());
+
+	if (cells.empty()) return;
+
+	if (!proto) proto = new Cell(*cells[0]);
+
+	stringstream ss;
+	for (vector<Cell*>::const_iterator it=cells.begin(); it!=cells.end(); ++it) {
+		assert((*it)->box.size()==proto->box.size());
+		write_cell(ss, **it);
+		delete *it;
+	}
+	string data=ss.str();
+
+	Batch b;
+	b.offset = end;
+	b.length = data.size();
+	b.keys = keys;
+	b.bound = numeric_limits<double>::infinity();
+	b.nb_cells = cells.size();
+
+	if (seek(file, end)!=0 || fwrite(data.c_str(), 1, data.size(), file)!=data.size())
+		ibex_error("[CellSpill]: cannot write file.\n");
+
+	end += data.size();
+	if (end>_file_size) _file_size=end;
+	live += data.size();
+	_size += b.nb_cells;
+	_nb_writes++;
+	batches.insert(make_pair(*min_element(keys.begin(), keys.end()), b));
+}
+
+void CellSpill::read(vector<Cell*>& cells) {
+	assert(!batches.empty());
+
+	Batch b=batches.begin()->second;
+	batches.erase(batches.begin());
+
+	string data(b.length,'\0');
+	if (seek(file, b.offset)!=0 || fread(&data[0], 1, b.length, file)!=b.length)
+		ibex_error("[CellSpill]: cannot read file.\n");
+
+	istringstream ss(data);
+	for (unsigned int i=0; i<b.keys.size(); i++) {
+		Cell* c=read_cell(ss);
+		if (b.keys[i]>b.bound)
+			delete c; // removed by contract
+		else
+			cells.push_back(c);
+	}
+
+	_size -= b.nb_cells;
+	live -= b.length;
+
+	// the file is rewritten from the beginning
+	if (batches.empty()) end=0;
+
+	check_compact();
+}
+
+void CellSpill::contract(double key) {
+	multimap<double,Batch>::iterator it=batches.upper_bound(key);
+	for (multimap<double,Batch>::iterator it2=it; it2!=batches.end(); ++it2) {
+		_size -= it2->second.nb_cells;
+		live -= it2->second.length;
+	}
+	batches.erase(it, batches.end());
+
+	// cells with a greater key in the remaining batches
+	for (multimap<double,Batch>::iterator it2=batches.begin(); it2!=batches.end(); ++it2) {
+		Batch& b=it2->second;
+		if (key>=b.bound) continue;
+		for (vector<double>::const_iterator k=b.keys.begin(); k!=b.keys.end(); ++k) {
+			if (*k>key && *k<=b.bound) {
+				b.nb_cells--;
+				_size--;
+			}
+		}
+		b.bound=key;
+	}
+
+	if (batches.empty()) end=0;
+
+	check_compact();
+}
+
+void CellSpill::flush() {
+	batches.clear();
+	_size=0;
+	end=0;
+	live=0;
+}
+
+void CellSpill::check_compact() {
+	if (_file_size>compact_min_size && live<compact_ratio*_file_size)
+		compact();
+}
+
+void CellSpill::compact() {
+	// the batches, by increasing offset
+	vector<Batch*> v;
+	for (multimap<double,Batch>::iterator it=batches.begin(); it!=batches.end(); ++it)
+		v.push_back(&it->second);
+	sort(v.begin(), v.end(), [](const Batch* b1, const Batch* b2) { return b1->offset < b2->offset; });
+
+	// each batch is moved backward (or stays in place)
+	long long pos=0;
+	string data;
+	for (vector<Batch*>::iterator it=v.begin(); it!=v.end(); ++it) {
+		Batch& b=**it;
+		if (b.offset!=pos) {
+			data.resize(b.length);
+			if (seek(file, b.offset)!=0 || fread(&data[0], 1, b.length, file)!=b.length)
+				ibex_error("[CellSpill]: cannot read file.\n");
+			if (seek(file, pos)!=0 || fwrite(data.c_str(), 1, b.length, file)!=b.length)
+				ibex_error("[CellSpill]: cannot write file.\n");
+			b.offset=pos;
+		}
+		pos+=b.length;
+	}
+	end=pos;
+
+	// if the file cannot be truncated, the space after end is reused
+	if (truncate(file, end)==0) _file_size=end;
+}
+
+} // end namespace ibex
@@ -0,0 +1,277 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CellSpill.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_CELL_SPILL_H__
+#define __IBEX_CELL_SPILL_H__
+
+#include "ibex_Cell.h"
+
+#include <cstdio>
+#include <map>
+#include <vector>
+#include <string>
+
+namespace ibex {
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Out-of-core storage of cells.
+ *
+ * Cells are written by batches at the end of a binary file and read
+ * back by batches, in increasing order of a key given
+ * by the cell buffer (e.g., the best cost of the batch or a
+ * sequence number). Only an index is kept in memory: the location of
+ * each batch and the key of each cell (one double per cell).
+ *
+ * For each cell, the box, the last bisected variable, the depth and
+ * the data written by Bxp::write(...) are stored. When a cell is
+ * reloaded, its properties are copied from the first cell ever written,
+ * updated with a CHANGE event and then read with Bxp::read(...).
+ * All the properties must support this (see Bxp::storable()).
+ *
+ * The disk space is reused when all the batches have been read. Besides,
+ * when the batches left on disk occupy less than #compact_ratio of the
+ * file, they are moved to the beginning of the file and the file is
+ * truncated (see #compact()).
+ *
+ * \see #CellBuffer::set_spill(unsigned int, const std::string&).
+ */
+class CellSpill {
+public:
+
+	/**
+	 * \brief Create an empty storage.
+	 *
+	 * \param filename - The file name. If empty (by default), an anonymous
+	 *                   temporary file is used. Otherwise, the file is removed
+	 *                   by the destructor.
+	 *
+	 * Calls ibex_error(...) if the file cannot be created.
+	 */
+	CellSpill(const std::string& filename="");
+
+	/**
+	 * \brief Delete this (and all the cells on disk).
+	 */
+	~CellSpill();
+
+	/**
+	 * \brief Store a batch of cells.
+	 *
+	 * The cells are *deleted*.
+	 *
+	 * \param cells - The cells (must all have the same number of variables)
+	 * \param key   - The key of the batch (and of all its cells).
+	 *
+	 * Calls ibex_error(...) if a property of a cell cannot be
+	 * stored (see Bxp::storable()).
+	 */
+	void write(const std::vector<Cell*>& cells, double key);
+
+	/**
+	 * \brief Store a batch of cells with one key per cell.
+	 *
+	 * The key of the batch is the lowest key.
+	 *
+	 * \see #write(const std::vector<Cell*>&, double).
+	 */
+	void write(const std::vector<Cell*>& cells, const std::vector<double>& keys);
+
+	/**
+	 * \brief Reload the batch with the lowest key.
+	 *
+	 * The cells are appended to \a cells in the order they were written
+	 * (except the cells removed by #contract(double)).
+	 *
+	 * \pre the storage is not empty.
+	 */
+	void read(std::vector<Cell*>& cells);
+
+	/**
+	 * \brief Remove all the cells with a key greater than \a key.
+	 *
+	 * The batches with only such cells are removed from the index.
+	 * The other cells are dropped when their batch is reloaded
+	 * but they are no longer counted by #size().
+	 *
+	 * Complexity: linear in the number of cells on disk.
+	 */
+	void contract(double key);
+
+	/**
+	 * \brief Remove all the batches.
+	 */
+	void flush();
+
+	/**
+	 * \brief Move the batches to the beginning of the file.
+	 *
+	 * The file is truncated to the size of the batches.
+	 *
+	 * Complexity: linear in the size of the batches.
+	 */
+	void compact();
+
+	/**
+	 * \brief Check that the properties can be stored.
+	 *
+	 * Calls ibex_error(...) if a property cannot be stored
+	 * (see Bxp::storable()).
+	 */
+	static void check(const BoxProperties& prop);
+
+	/**
+	 * \brief Number of cells on disk.
+	 */
+	unsigned int size() const;
+
+	/**
+	 * \brief True if there is no cell on disk.
+	 */
+	bool empty() const;
+
+	/**
+	 * \brief Number of batches on disk.
+	 */
+	unsigned int nb_batches() const;
+
+	/**
+	 * \brief Number of batches written so far.
+	 */
+	unsigned long nb_writes() const;
+
+	/**
+	 * \brief The lowest key (+oo if empty).
+	 */
+	double min_key() const;
+
+	/**
+	 * \brief Size of the file (in bytes).
+	 */
+	long long file_size() const;
+
+	/**
+	 * \brief Size of the batches on disk (in bytes).
+	 */
+	long long live_size() const;
+
+	/**
+	 * \brief Ratio of live data under which the file is compacted.
+	 */
+	static constexpr double compact_ratio = 0.5;
+
+	/**
+	 * \brief Size (in bytes) under which the file is never compacted.
+	 */
+	static constexpr long long compact_min_size = 1<<20;
+
+protected:
+
+	/*
+	 * Location of a batch in the file.
+	 */
+	struct Batch {
+		long long offset;
+		size_t length;
+		std::vector<double> keys; // key of each cell (in writing order)
+		double bound;             // cells with a key greater than bound are removed
+		unsigned int nb_cells;    // number of cells not removed
+	};
+
+	/*
+	 * Compact the file if the batches occupy less than
+	 * compact_ratio of it.
+	 */
+	void check_compact();
+
+	/*
+	 * Serialize a cell.
+	 */
+	void write_cell(std::ostream& os, const Cell& cell) const;
+
+	/*
+	 * Deserialize a cell.
+	 */
+	Cell* read_cell(std::istream& is) const;
+
+	/*
+	 * The file.
+	 */
+	FILE* file;
+
+	/*
+	 * The file name (empty if anonymous).
+	 */
+	const std::string filename;
+
+	/*
+	 * Batches on disk, sorted by key.
+	 */
+	std::multimap<double,Batch> batches;
+
+	/*
+	 * Number of cells on disk.
+	 */
+	unsigned int _size;
+
+	/*
+	 * End of the data in the file.
+	 */
+	long long end;
+
+	/*
+	 * Size of the file (the data after #end is garbage).
+	 */
+	long long _file_size;
+
+	/*
+	 * Size of the batches on disk.
+	 */
+	long long live;
+
+	/*
+	 * Number of batches written so far.
+	 */
+	unsigned long _nb_writes;
+
+	/*
+	 * The first cell ever written (properties template).
+	 */
+	Cell* proto;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline unsigned int CellSpill::size() const {
+	return _size;
+}
+
+inline bool CellSpill::empty() const {
+	return _size==0;
+}
+
+inline unsigned int CellSpill::nb_batches() const {
+	return batches.size();
+}
+
+inline unsigned long CellSpill::nb_writes() const {
+	return _nb_writes;
+}
+
+inline long long CellSpill::file_size() const {
+	return _file_size;
+}
+
+inline long long CellSpill::live_size() const {
+	return live;
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_CELL_SPILL_H__
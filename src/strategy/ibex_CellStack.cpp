@@ -10,36 +10,55 @@
 
 #include "ibex_CellStack.h"
 
+using namespace std;
+
 namespace ibex {
 
 void CellStack::flush() {
 	while (!cstack.empty()) {
-		delete cstack.top();
-		cstack.pop();
+		delete cstack.back();
+		cstack.pop_back();
 	}
+	if (spill) spill->flush();
 }
 
 unsigned int CellStack::size() const {
-	return cstack.size();
+	return cstack.size() + (spill? spill->size() : 0);
 }
 
 bool CellStack::empty() const {
+	// cells on disk are reloaded as soon as the stack is empty
 	return cstack.empty();
 }
 
 void CellStack::push(Cell* cell) {
 	if (capacity>0 && size()==capacity) throw CellBufferOverflow();
-	cstack.push(cell);
+	cstack.push_back(cell);
+
+	if (spill && cstack.size()>mem_capacity) {
+		// the bottom half of the stack is written to disk.
+		// The last batch written is the first one to be read.
+		deque<Cell*>::iterator end=cstack.begin()+cstack.size()/2;
+		vector<Cell*> cells(cstack.begin(), end);
+		cstack.erase(cstack.begin(), end);
+		spill->write(cells, -((double) spill->nb_writes()));
+	}
 }
 
 Cell* CellStack::pop() {
-	Cell* c = cstack.top();
-	cstack.pop();
+	Cell* c = cstack.back();
+	cstack.pop_back();
+
+	if (cstack.empty() && spill && !spill->empty()) {
+		vector<Cell*> cells;
+		spill->read(cells);
+		cstack.assign(cells.begin(), cells.end());
+	}
 	return c;
 }
 
 Cell* CellStack::top() const {
-	return cstack.top();
+	return cstack.back();
 }
 
 } // end namespace ibex
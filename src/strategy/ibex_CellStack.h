@@ -12,7 +12,7 @@
 #define __IBEX_CELL_STACK_H__
 
 #include "ibex_CellBuffer.h"
-#include <stack>
+#include <deque>
 
 namespace ibex {
 
@@ -21,6 +21,9 @@ namespace ibex {
  * \brief Cell Stack.
  *
  * For depth-first search. \see #CellBuffer
+ *
+ * When spilling is enabled, the bottom of the stack is written to
+ * disk and the exact depth-first order is preserved.
  */
 class CellStack : public CellBuffer {
  public:
@@ -44,8 +47,8 @@ class CellStack : public CellBuffer {
   Cell* top() const;
 
  private:
-  /* Stack of cells */
-  std::stack<Cell*> cstack;
+  /* Stack of cells in memory (the top is at the back) */
+  std::deque<Cell*> cstack;
 };
 
 } // end namespace ibex
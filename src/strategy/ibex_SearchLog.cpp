@@ -0,0 +1,368 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SearchLog.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_SearchLog.h"
+#include "ibex_BxpNodeId.h"
+#include "ibex_Exception.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <iomanip>
+
+#ifdef _IBEX_WITH_THREADS_
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+const int SearchLog::default_capacity=4096;
+
+const char SearchLog::magic[8] = { 'I','B','E','X','S','L','O','G' };
+
+const uint32_t SearchLog::version=1;
+
+#ifdef _IBEX_WITH_THREADS_
+
+/*
+ * The writer thread waits until the ring buffer is half full (or until
+ * a flush is requested) and writes the records outside of the lock.
+ */
+struct SearchLog::Writer {
+	Writer(SearchLog& log) : log(log), closing(false), flushing(false), writing(false), thread(&Writer::run, this) { }
+
+	void run() {
+		vector<Record> chunk;
+		unique_lock<mutex> lock(m);
+		while (true) {
+			cv.wait(lock, [this] { return closing || (flushing && log.count>0) || log.count>=log.ring.size()/2; });
+
+			if (log.count==0) {
+				if (closing) return;
+				continue;
+			}
+
+			// copy the records and release the space
+			chunk.clear();
+			while (log.count>0) {
+				chunk.push_back(log.ring[log.first]);
+				log.first=(log.first+1)%log.ring.size();
+				log.count--;
+			}
+			writing=true;
+			cv.notify_all();
+
+			lock.unlock();
+			log.write(&chunk[0], chunk.size());
+			lock.lock();
+
+			writing=false;
+			cv.notify_all();
+		}
+	}
+
+	SearchLog& log;
+	mutex m;
+	condition_variable cv;
+	bool closing;
+	bool flushing;
+	bool writing;
+	std::thread thread;
+};
+
+#endif
+
+SearchLog::SearchLog(const string& filename, int capacity) : filename(filename), ring(capacity), first(0), count(0),
+		_nb_records(0), last_node(0), box_before(1), t_begin(0), t0(0), writer(NULL) {
+
+	if (capacity<2) ibex_error("[SearchLog]: capacity must be at least 2.");
+
+	file=fopen(filename.c_str(), "wb");
+	if (!file) ibex_error("[SearchLog]: cannot create file.");
+
+	uint32_t size=sizeof(Record);
+	fwrite(magic, 1, sizeof(magic), file);
+	fwrite(&version, sizeof(version), 1, file);
+	fwrite(&size, sizeof(size), 1, file);
+
+	t0=now();
+
+#ifdef _IBEX_WITH_THREADS_
+	writer=new Writer(*this);
+#endif
+}
+
+SearchLog::~SearchLog() {
+	close();
+}
+
+double SearchLog::now() const {
+	return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count() - t0;
+}
+
+void SearchLog::add_property(BoxProperties& prop) {
+	if (!prop[BxpNodeId::id])
+		prop.add(new BxpNodeId(*this, new_node_id()));
+}
+
+void SearchLog::bisected(const Cell& c, Cell& left, Cell& right) {
+	const BxpNodeId* id=(const BxpNodeId*) c.prop[BxpNodeId::id];
+	if (!id) return;
+	BxpNodeId* l=(BxpNodeId*) left.prop[BxpNodeId::id];
+	BxpNodeId* r=(BxpNodeId*) right.prop[BxpNodeId::id];
+	if (l) { l->node=new_node_id(); l->parent=id->node; }
+	if (r) { r->node=new_node_id(); r->parent=id->node; }
+}
+
+void SearchLog::begin(const Cell& c) {
+	if (box_before.size()!=c.box.size())
+		box_before.resize(c.box.size());
+	box_before=c.box;
+	t_begin=now();
+}
+
+void SearchLog::end(const Cell& c, Outcome outcome, double loup, double uplo) {
+	Record r;
+	memset(&r, 0, sizeof(r));
+
+	const BxpNodeId* id=(const BxpNodeId*) c.prop[BxpNodeId::id];
+	if (id) {
+		r.node=id->node;
+		r.parent=id->parent;
+	}
+	r.depth=c.depth;
+	r.var=c.bisected_var;
+	r.outcome=outcome;
+	log_volumes(box_before, c.box, r.log_volume_before, r.log_volume_after);
+	r.start=t_begin;
+	r.duration=now()-t_begin;
+	r.loup=loup;
+	r.uplo=uplo;
+
+	append(r);
+}
+
+void SearchLog::append(const Record& r) {
+	if (!file) ibex_error("[SearchLog]: log closed.");
+
+#ifdef _IBEX_WITH_THREADS_
+	unique_lock<mutex> lock(writer->m);
+	writer->cv.wait(lock, [this] { return count<ring.size(); });
+#else
+	if (count==ring.size()) write_all();
+#endif
+
+	ring[(first+count)%ring.size()]=r;
+	count++;
+	_nb_records++;
+
+#ifdef _IBEX_WITH_THREADS_
+	if (count>=ring.size()/2) writer->cv.notify_all();
+#endif
+}
+
+void SearchLog::write(const Record* r, size_t n) {
+	if (fwrite(r, sizeof(Record), n, file)!=n)
+		ibex_warning("[SearchLog]: write error (log truncated).");
+}
+
+void SearchLog::write_all() {
+	while (count>0) {
+		// contiguous part of the ring buffer
+		size_t n=std::min(count, ring.size()-first);
+		write(&ring[first], n);
+		first=(first+n)%ring.size();
+		count-=n;
+	}
+}
+
+void SearchLog::flush() {
+	if (!file) return;
+#ifdef _IBEX_WITH_THREADS_
+	unique_lock<mutex> lock(writer->m);
+	writer->flushing=true;
+	writer->cv.notify_all();
+	writer->cv.wait(lock, [this] { return count==0 && !writer->writing; });
+	writer->flushing=false;
+#else
+	write_all();
+#endif
+	fflush(file);
+}
+
+void SearchLog::close() {
+	if (!file) return;
+#ifdef _IBEX_WITH_THREADS_
+	{
+		lock_guard<mutex> lock(writer->m);
+		writer->closing=true;
+	}
+	writer->cv.notify_all();
+	writer->thread.join();
+	delete writer;
+	writer=NULL;
+#else
+	write_all();
+#endif
+	fclose(file);
+	file=NULL;
+}
+
+void SearchLog::log_volumes(const IntervalVector& before, const IntervalVector& after, double& log_before, double& log_after) {
+	log_before=0;
+	log_after=0;
+	if (before.is_empty()) {
+		log_after=NEG_INFINITY;
+		return;
+	}
+	bool empty=after.is_empty();
+	for (int i=0; i<before.size(); i++) {
+		double d=before[i].diam();
+		if (d==0 || d==POS_INFINITY) continue;
+		log_before+=::log(d);
+		if (!empty) log_after+=::log(after[i].diam());
+	}
+	if (empty) log_after=NEG_INFINITY;
+}
+
+void SearchLog::read(const string& filename, vector<Record>& records) {
+	FILE* f=fopen(filename.c_str(), "rb");
+	if (!f) ibex_error("[SearchLog]: cannot open file.");
+
+	char m[sizeof(magic)];
+	uint32_t v, size;
+	if (fread(m, 1, sizeof(m), f)!=sizeof(m) || memcmp(m, magic, sizeof(m))!=0
+			|| fread(&v, sizeof(v), 1, f)!=1 || fread(&size, sizeof(size), 1, f)!=1) {
+		fclose(f);
+		ibex_error("[SearchLog]: not a search log.");
+	}
+	if (v!=version || size!=sizeof(Record)) {
+		fclose(f);
+		ibex_error("[SearchLog]: unsupported version of the log format.");
+	}
+
+	records.clear();
+	Record r;
+	while (fread(&r, sizeof(Record), 1, f)==1)
+		records.push_back(r);
+
+	fclose(f);
+}
+
+const char* SearchLog::outcome_name(int outcome) {
+	switch(outcome) {
+	case BISECTED: return "bisected";
+	case KEPT:     return "kept";
+	case EMPTY:    return "empty";
+	case PRUNED:   return "pruned";
+	case EPS_BOX:  return "eps-box";
+	case SOLUTION: return "solution";
+	case BOUNDARY: return "boundary";
+	case UNKNOWN:  return "unknown";
+	default:       return "?";
+	}
+}
+
+void SearchLog::report(const vector<Record>& records, ostream& os) {
+	int n=records.size();
+
+	os << " number of nodes:\t\t" << n << endl;
+	if (n==0) return;
+
+	double total_time=0;
+	int max_depth=0;
+	long by_outcome[NB_OUTCOMES]={};
+	for (int i=0; i<n; i++) {
+		total_time+=records[i].duration;
+		max_depth=std::max(max_depth, (int) records[i].depth);
+		if (records[i].outcome>=0 && records[i].outcome<NB_OUTCOMES)
+			by_outcome[records[i].outcome]++;
+	}
+
+	os << " maximal depth:\t\t\t" << max_depth << endl;
+	os << " time in nodes:\t\t\t" << total_time << "s" << endl;
+	os << " outcomes:" << endl;
+	for (int k=0; k<NB_OUTCOMES; k++)
+		if (by_outcome[k]>0)
+			os << "   " << setw(10) << left << outcome_name(k) << right << setw(10) << by_outcome[k] << endl;
+
+	/*===================== per depth ====================*/
+	vector<long> nb(max_depth+1,0);
+	vector<double> time(max_depth+1,0);
+	vector<double> reduction(max_depth+1,0);
+	for (int i=0; i<n; i++) {
+		const Record& r=records[i];
+		nb[r.depth]++;
+		time[r.depth]+=r.duration;
+		reduction[r.depth]+=(r.log_volume_after==NEG_INFINITY)? 1 : 1-::exp(r.log_volume_after-r.log_volume_before);
+	}
+
+	os << " per depth:" << endl;
+	os << "   " << setw(6) << "depth" << setw(10) << "nodes" << setw(14) << "time(s)" << setw(14) << "reduction" << endl;
+	for (int d=0; d<=max_depth; d++) {
+		if (nb[d]==0) continue;
+		os << "   " << setw(6) << d << setw(10) << nb[d] << setw(14) << time[d]
+		   << setw(14) << reduction[d]/nb[d] << endl;
+	}
+
+	/*===================== wasted work ====================*/
+	// the number of a node is always greater than the number of its parent,
+	// so that the productivity is propagated upward in decreasing order.
+	map<uint64_t,int> index;
+	for (int i=0; i<n; i++)
+		index[records[i].node]=i;
+
+	vector<bool> productive(n,false);
+	vector<bool> has_child(n,false);
+	for (int i=0; i<n; i++) {
+		map<uint64_t,int>::const_iterator p=index.find(records[i].parent);
+		if (records[i].parent!=0 && p!=index.end()) has_child[p->second]=true;
+	}
+
+	for (map<uint64_t,int>::const_reverse_iterator it=index.rbegin(); it!=index.rend(); ++it) {
+		int i=it->second;
+		const Record& r=records[i];
+		switch (r.outcome) {
+		case EPS_BOX: case SOLUTION: case BOUNDARY: case UNKNOWN: productive[i]=true; break;
+		case KEPT: if (!has_child[i]) productive[i]=true; break;
+		default: break;
+		}
+		if (productive[i]) {
+			map<uint64_t,int>::const_iterator p=index.find(r.parent);
+			if (r.parent!=0 && p!=index.end()) productive[p->second]=true;
+		}
+	}
+
+	// a subtree is wasted if its root is not productive but has
+	// been bisected, and its parent is productive (or it is a root)
+	long nb_subtrees=0, nb_wasted=0;
+	double wasted_time=0;
+	vector<bool> wasted(n,false);
+	for (map<uint64_t,int>::const_iterator it=index.begin(); it!=index.end(); ++it) {
+		int i=it->second;
+		if (productive[i]) continue;
+		map<uint64_t,int>::const_iterator p=index.find(records[i].parent);
+		bool in_wasted=records[i].parent!=0 && p!=index.end() && wasted[p->second];
+		if (in_wasted || has_child[i]) {
+			if (!in_wasted) nb_subtrees++;
+			wasted[i]=true;
+			nb_wasted++;
+			wasted_time+=records[i].duration;
+		}
+	}
+
+	os << " wasted work:\t\t\t" << nb_wasted << " nodes in " << nb_subtrees << " subtrees ("
+	   << wasted_time << "s, " << (total_time>0? 100*wasted_time/total_time : 0) << "% of the time)" << endl;
+}
+
+} /* namespace ibex */
@@ -0,0 +1,274 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SearchLog.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_SEARCH_LOG_H__
+#define __IBEX_SEARCH_LOG_H__
+
+#include "ibex_Cell.h"
+
+#include <stdint.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <iostream>
+#include <atomic>
+
+namespace ibex {
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Binary log of the search tree.
+ *
+ * A search log records one fixed-size record per node processed by a strategy
+ * (Optimizer, Solver, etc.): the node and parent numbers, the depth, the
+ * variable bisected to create the node, the volume of the box before and after
+ * contraction, the time spent, the current bounds of the objective and what
+ * happened to the node (the outcome). The nodes are numbered through a
+ * box property (see #ibex::BxpNodeId).
+ *
+ * The records are appended into a ring buffer and written to the file by a
+ * background thread (if Ibex is compiled with threads; otherwise, the buffer is
+ * written when it is full), so that the overhead for the strategy is only a
+ * few copies. The log can be read back with #read(const std::string&, std::vector<Record>&)
+ * and summarized with #report(const std::vector<Record>&, std::ostream&) (see the
+ * ibexlog program).
+ *
+ * The file starts with a header (magic string, version and size of a record)
+ * followed by the records, in the native byte order.
+ */
+class SearchLog {
+public:
+
+	/**
+	 * \brief What happened to a node.
+	 */
+	typedef enum {
+		BISECTED,  // the node has been bisected
+		KEPT,      // the node has been stored in the buffer (and is bisected later, unless pruned)
+		EMPTY,     // the box has been contracted to the empty set
+		PRUNED,    // the node has been discarded by the bound of the objective
+		EPS_BOX,   // the box is too small to be bisected (and is discarded)
+		SOLUTION,  // the box is a solution (or is inside the feasible set)
+		BOUNDARY,  // the box is a boundary box
+		UNKNOWN    // the box is too small to be bisected (and is kept as "unknown")
+	} Outcome;
+
+	/**
+	 * \brief Number of outcomes.
+	 */
+	static const int NB_OUTCOMES=8;
+
+	/**
+	 * \brief Record of a node (80 bytes).
+	 */
+	struct Record {
+		/** Number of the node (0 if unknown). */
+		uint64_t node;
+		/** Number of the parent node (0 if none). */
+		uint64_t parent;
+		/** Depth of the node. */
+		int32_t depth;
+		/** Variable bisected to create the node (-1 for a root). */
+		int32_t var;
+		/** Outcome (see #Outcome). */
+		int32_t outcome;
+		int32_t reserved;
+		/**
+		 * Logarithm of the volume of the box before contraction.
+		 * To avoid overflow/underflow, only the dimensions where the box
+		 * is bounded and not degenerated are taken into account.
+		 */
+		double log_volume_before;
+		/**
+		 * Logarithm of the volume after contraction, on the same
+		 * dimensions (-oo if the box is empty).
+		 */
+		double log_volume_after;
+		/** Start time (in seconds, from the creation of the log). */
+		double start;
+		/** Time spent in the node (seconds). */
+		double duration;
+		/** Upper bound of the objective (+oo if none). */
+		double loup;
+		/** Lower bound of the objective (-oo if none). */
+		double uplo;
+	};
+
+	/**
+	 * \brief Create a log.
+	 *
+	 * \param filename - the file (overwritten).
+	 * \param capacity - the number of records of the ring buffer.
+	 */
+	SearchLog(const std::string& filename, int capacity=default_capacity);
+
+	/**
+	 * \brief Close the log (if not already done) and delete this.
+	 */
+	~SearchLog();
+
+	/**
+	 * \brief Add the node number property to a root cell.
+	 *
+	 * Each root gets a new number, without parent.
+	 */
+	void add_property(BoxProperties& prop);
+
+	/**
+	 * \brief Start the measure of a node (before contraction).
+	 */
+	void begin(const Cell& c);
+
+	/**
+	 * \brief Record a node (after contraction).
+	 *
+	 * The volume reduction and the time are calculated from the last
+	 * call to #begin(const Cell&).
+	 */
+	void end(const Cell& c, Outcome outcome, double loup=POS_INFINITY, double uplo=NEG_INFINITY);
+
+	/**
+	 * \brief Append a record.
+	 *
+	 * Blocks only if the ring buffer is full.
+	 */
+	void append(const Record& r);
+
+	/**
+	 * \brief Write all the appended records to the file.
+	 */
+	void flush();
+
+	/**
+	 * \brief Flush and close the file.
+	 *
+	 * No record can be appended afterwards.
+	 */
+	void close();
+
+	/**
+	 * \brief Number of records appended so far.
+	 */
+	long nb_records() const;
+
+	/**
+	 * \brief A new node number (numbers start from 1).
+	 *
+	 * Can be called by several threads.
+	 */
+	unsigned long new_node_id();
+
+	/**
+	 * \brief Number the children of a bisected cell.
+	 *
+	 * Must be called by the strategy each time a cell \a c is bisected
+	 * into \a left and \a right (before the children are handled).
+	 */
+	void bisected(const Cell& c, Cell& left, Cell& right);
+
+	/**
+	 * \brief Read all the records of a log file.
+	 */
+	static void read(const std::string& filename, std::vector<Record>& records);
+
+	/**
+	 * \brief Print a summary of a log.
+	 *
+	 * Shape of the tree (number of nodes per outcome and per depth), time per depth
+	 * and wasted work. A node is "productive" if it is a solution, boundary,
+	 * unknown or epsilon box, if it has been kept in the buffer and never bisected
+	 * or if one of its descendants is productive. The wasted work is the set of
+	 * subtrees with no productive node: they have been bisected for nothing (a stronger
+	 * contraction, or a better bound of the objective, would have discarded their roots).
+	 */
+	static void report(const std::vector<Record>& records, std::ostream& os);
+
+	/**
+	 * \brief Name of an outcome.
+	 */
+	static const char* outcome_name(int outcome);
+
+	/**
+	 * \brief Logarithms of the volumes of two boxes.
+	 *
+	 * Only the dimensions where "before" is bounded and not degenerated
+	 * are taken into account. log_after is -oo if "after" is empty.
+	 */
+	static void log_volumes(const IntervalVector& before, const IntervalVector& after, double& log_before, double& log_after);
+
+	/**
+	 * \brief Default capacity of the ring buffer (number of records).
+	 */
+	static const int default_capacity;
+
+	/**
+	 * \brief Magic string at the beginning of a log file.
+	 */
+	static const char magic[8];
+
+	/**
+	 * \brief Version of the file format.
+	 */
+	static const uint32_t version;
+
+protected:
+
+	/*
+	 * Time from the creation of the log (seconds).
+	 */
+	double now() const;
+
+	/*
+	 * Write records to the file.
+	 */
+	void write(const Record* r, size_t n);
+
+	/*
+	 * Write all the records of the ring buffer (without thread).
+	 */
+	void write_all();
+
+	const std::string filename;
+	FILE* file;
+
+	/* Ring buffer: "count" records starting from "first". */
+	std::vector<Record> ring;
+	size_t first;
+	size_t count;
+
+	long _nb_records;
+	std::atomic<unsigned long> last_node;
+
+	/* Measure of the current node */
+	IntervalVector box_before;
+	double t_begin;
+
+	/* Origin of times */
+	double t0;
+
+	/* Background writer (see the .cpp) */
+	struct Writer;
+	Writer* writer;
+
+	friend struct Writer;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline long SearchLog::nb_records() const {
+	return _nb_records;
+}
+
+inline unsigned long SearchLog::new_node_id() {
+	return ++last_node;
+}
+
+} /* namespace ibex */
+
+#endif /* __IBEX_SEARCH_LOG_H__ */
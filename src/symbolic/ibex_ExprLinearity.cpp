@@ -195,25 +195,35 @@ void ExprLinearity::visit(const ExprMul& e) {
 
 	Domain non_linear(Dim::scalar()); // =ALL_REALS
 
-	// can be in O(n^4) :-(
-	for (int i=0; i<n+1; i++) {
-		for (int j=0; j<n+1; j++) {
-
-			if (i<n && j<n) {
-				// we introduce the "non_linear" coefficient so that
-				// a non-null term x_i*x_j will have its corresponding
-				// entry set to [-oo,oo]
-				Domain prod=non_linear*l[i]*r[j];
-				(*d)[i] = (*d)[i]+prod; //TODO: implement += in TemplateDomain
-				(*d)[j] = (*d)[j]+prod;
-			} else {
-				if (i<n) (*d)[i] = (*d)[i] + l[i]*r[n];
-				else if (j<n) (*d)[j] = (*d)[j] + (l[n]*r[j]);
-				else (*d)[n] = l[n]*r[n];
-			}
+	// A non-null term x_i*x_j must have its corresponding
+	// entries (i and j) set to [-oo,oo]. Instead of enumerating
+	// all the pairs (i,j) we use the "non-linear" sums:
+	//    sum_l = sum_{j<n} non_linear*l[j]
+	//    sum_r = sum_{j<n} non_linear*r[j]
+	// so that the entry i receives
+	//    (non_linear*l[i])*sum_r + sum_l*r[i]
+	// which is 0 or [-oo,oo] exactly when one of the terms
+	// l[i]*r[j] or l[j]*r[i] is non-null.
+	Domain sum_l(e.left.dim);
+	Domain sum_r(e.right.dim);
+	sum_l.clear();
+	sum_r.clear();
+
+	if (left_type!=CONSTANT && right_type!=CONSTANT) {
+		for (int j=0; j<n; j++) {
+			if (!l[j].is_zero()) sum_l = sum_l + non_linear*l[j];
+			if (!r[j].is_zero()) sum_r = sum_r + non_linear*r[j];
 		}
 	}
 
+	for (int i=0; i<n; i++) {
+		if (left_type!=CONSTANT && right_type!=CONSTANT)
+			(*d)[i] = (non_linear*l[i])*sum_r + sum_l*r[i];
+		(*d)[i] = (*d)[i] + l[i]*r[n] + l[n]*r[i];
+	}
+
+	(*d)[n] = l[n]*r[n];
+
 	for (int i=0; i<n; i++) {
 		if (type==CONSTANT && !(*d)[i].is_zero()) type=LINEAR;
 		if (type==LINEAR && (*d)[i].is_unbounded()) {
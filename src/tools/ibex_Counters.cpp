@@ -0,0 +1,96 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Counters.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#include "ibex_Counters.h"
+#include "ibex_Setting.h"
+
+#include <set>
+
+#ifdef _IBEX_WITH_THREADS_
+#include <mutex>
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+typedef atomic<unsigned long> Count;
+
+/*
+ * The counters of the living threads and the counts of the
+ * terminated ones.
+ */
+struct Registry {
+	set<Count*> threads;
+	unsigned long retired[Counters::NB_COUNTERS];
+#ifdef _IBEX_WITH_THREADS_
+	mutex m;
+#endif
+	Registry() {
+		for (int c=0; c<Counters::NB_COUNTERS; c++) retired[c]=0;
+	}
+};
+
+// built on first use and never destroyed (a thread may terminate
+// after the static objects are destroyed)
+Registry& registry() {
+	static Registry* r=new Registry();
+	return *r;
+}
+
+/*
+ * The counters of a thread.
+ */
+struct Local {
+	Count counts[Counters::NB_COUNTERS];
+
+	Local() {
+		for (int c=0; c<Counters::NB_COUNTERS; c++) counts[c]=0;
+		Registry& r=registry();
+#ifdef _IBEX_WITH_THREADS_
+		lock_guard<mutex> lock(r.m);
+#endif
+		r.threads.insert(counts);
+	}
+
+	~Local() {
+		Registry& r=registry();
+#ifdef _IBEX_WITH_THREADS_
+		lock_guard<mutex> lock(r.m);
+#endif
+		for (int c=0; c<Counters::NB_COUNTERS; c++)
+			r.retired[c]+=counts[c].load(memory_order_relaxed);
+		r.threads.erase(counts);
+	}
+};
+
+} // end anonymous namespace
+
+Count* Counters::local_counts() {
+#ifdef _IBEX_WITH_THREADS_
+	static thread_local Local l;
+#else
+	static Local l;
+#endif
+	return l.counts;
+}
+
+unsigned long Counters::total(counter c) {
+	Registry& r=registry();
+#ifdef _IBEX_WITH_THREADS_
+	lock_guard<mutex> lock(r.m);
+#endif
+	unsigned long n=r.retired[c];
+	for (set<Count*>::const_iterator it=r.threads.begin(); it!=r.threads.end(); it++)
+		n+=(*it)[c].load(memory_order_relaxed);
+	return n;
+}
+
+} // end namespace ibex
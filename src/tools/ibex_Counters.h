@@ -0,0 +1,67 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Counters.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_COUNTERS_H__
+#define __IBEX_COUNTERS_H__
+
+#include <atomic>
+
+namespace ibex {
+
+/**
+ * \ingroup tools
+ *
+ * \brief Process-wide counters of elementary operations.
+ *
+ * Each thread increments its own copy of the counters (no shared
+ * memory is written) and the copies are gathered when a total is read.
+ * The counts of a thread that has terminated are kept.
+ *
+ * These counters are read by the strategies at the end of a run
+ * (see #ibex::RunSummary).
+ */
+class Counters {
+public:
+
+	/**
+	 * \brief The counted operations.
+	 */
+	typedef enum {
+		EVAL,     // evaluation of a function at a box or a point (see #ibex::Eval and
+		          // #ibex::PointEval; the forward phase of HC4Revise and Gradient is an Eval)
+		LP_SOLVE, // call to the LP solver (see #ibex::LPSolver)
+		NB_COUNTERS
+	} counter;
+
+	/**
+	 * \brief Count n operations of type c in the current thread.
+	 */
+	static void incr(counter c, unsigned long n=1);
+
+	/**
+	 * \brief Number of operations of type c in all the threads since the
+	 * beginning of the process.
+	 */
+	static unsigned long total(counter c);
+
+private:
+	/* The counters of the current thread (one per type). */
+	static std::atomic<unsigned long>* local_counts();
+};
+
+/*================================== inline implementations ========================================*/
+
+inline void Counters::incr(counter c, unsigned long n) {
+	// only the current thread writes this counter: no atomic read-modify-write
+	std::atomic<unsigned long>& x=local_counts()[c];
+	x.store(x.load(std::memory_order_relaxed)+n, std::memory_order_relaxed);
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_COUNTERS_H__
@@ -14,6 +14,8 @@
 #include "ibex_SharedHeap.h"
 #include "ibex_Random.h"
 
+#include <algorithm>
+
 namespace ibex {
 
 /**
@@ -112,12 +114,45 @@ public:
 	 *
 	 * The costs of the first heap are assumed to be up-to-date.
 	 *
+	 * Complexity: O(nb_nodes)
+	 *
 	 * TODO: in principle we should implement the symmetric
 	 * case where the contraction is performed with respect
 	 * to the cost of the second heap.
 	 */
 	void contract(double loup1);
 
+	/**
+	 * \brief Contract the heap without deleting data
+	 *
+	 * Same as #contract(double) except that the removed data
+	 * are not deleted but appended to \a removed.
+	 */
+	void contract(double loup1, std::vector<T*>& removed);
+
+	/**
+	 * \brief Keep only the k data with the lowest costs (first heap)
+	 *
+	 * The other data are removed from the two heaps and appended to
+	 * \a removed (they are not deleted). Data with the same cost are
+	 * separated arbitrarily, so that exactly size()-k data are removed.
+	 *
+	 * The costs of the first heap are assumed to be up-to-date.
+	 *
+	 * Complexity: O(nb_nodes)
+	 */
+	void contract_rank1(unsigned int k, std::vector<T*>& removed);
+
+	/**
+	 * \brief Return the cost (for the first heap) of rank \a k
+	 *
+	 * The rank is the position in increasing order (0 for
+	 * the minimum).
+	 *
+	 * Complexity: O(nb_nodes)
+	 */
+	double kth_minimum1(unsigned int k) const;
+
 	/**
 	 * \brief Delete this
 	 */
@@ -144,29 +179,11 @@ protected:
 	/** Current selected heap. */
 	mutable int current_heap_id;
 
-	/**
-	 * Used in the contract function by recursivity
-	 *
-	 * \param heap: the new heap1 under construction (will
-	 *        eventually replace the current heap1).
-	 */
-	void contract_rec(double new_loup, HeapNode<T>* node, SharedHeap<T>& heap, bool percolate);
-
 private:
-	/**
-	 * Erase all the subnodes of node (including itself) in the first heap
-	 * and manage the impact on the second heap.
-	 * If "percolate" is true, the second heap is left in a correct state.
-	 * Otherwise, the second heap has a binary tree structure but not sorted
-	 * anymore. Therefore, "sort" should be called on the second heap.
-	 *
-	 * So the heap structure is maintained for the second heap
-	 * but not the first one. The reason is that this function is called
-	 * either by "contract" or "flush". "contract" will build a new heap from scratch.
-	 */
-	void erase_subnodes(HeapNode<T>* node, bool percolate);
-
 	std::ostream& print(std::ostream& os) const;
+
+	/* Remove elements from the two heaps (the data are appended to removed_data) */
+	void erase(const std::vector<HeapElt<T>*>& removed, std::vector<T*>& removed_data);
 };
 
 
@@ -183,13 +200,18 @@ DoubleHeap<T>::DoubleHeap(CostFunc<T>& cost1, bool update_cost1_when_sorting, Co
 template<class T>
 DoubleHeap<T>::DoubleHeap(const DoubleHeap &dhcp, bool deep_copy) :
 nb_nodes(dhcp.nb_nodes), heap1(NULL), heap2(NULL), critpr(dhcp.critpr), current_heap_id(dhcp.current_heap_id) {
-	heap1 = new SharedHeap<T>(*dhcp.heap1, 2, deep_copy);
-	std::vector<HeapElt<T>*> p = heap1->elt();
+	heap1 = new SharedHeap<T>(dhcp.heap1->costf, dhcp.heap1->update_cost_when_sorting, dhcp.heap1->heap_id);
 	heap2 = new SharedHeap<T>(dhcp.heap2->costf, dhcp.heap2->update_cost_when_sorting, dhcp.heap2->heap_id);
 
-	while(!p.empty()) {
-		heap2->push_elt(p.back());
-		p.pop_back();
+	// the copied elements have the same positions as the original ones in both heaps
+	heap1->nodes.resize(nb_nodes);
+	heap2->nodes.resize(nb_nodes);
+
+	for (unsigned int i=0; i<nb_nodes; i++) {
+		HeapElt<T>* elt=dhcp.heap1->nodes[i];
+		HeapElt<T>* copy=new HeapElt<T>(*elt, deep_copy);
+		heap1->set_node(i, copy);
+		heap2->set_node(elt->holder[1], copy);
 	}
 }
 
@@ -227,61 +249,95 @@ unsigned int DoubleHeap<T>::size() const {
 
 template<class T>
 void DoubleHeap<T>::contract(double new_loup1) {
+	std::vector<T*> removed;
+	contract(new_loup1, removed);
+	for (typename std::vector<T*>::iterator it=removed.begin(); it!=removed.end(); it++)
+		delete *it;
+}
+
+template<class T>
+void DoubleHeap<T>::contract(double new_loup1, std::vector<T*>& removed_data) {
 
 	if (nb_nodes==0) return;
 
-	SharedHeap<T>* copy1 = new SharedHeap<T>(heap1->costf, heap1->update_cost_when_sorting, 0);
+	// the cost are assumed to be up-to-date for the 1st heap
+	std::vector<HeapElt<T>*> removed;
+	for (unsigned int i=0; i<nb_nodes; i++) {
+		if (heap1->nodes[i]->is_sup(new_loup1, 0))
+			removed.push_back(heap1->nodes[i]);
+	}
 
-	contract_rec(new_loup1, heap1->root, *copy1, !heap2->update_cost_when_sorting);
+	if (removed.empty()) return;
 
-	heap1->root = copy1->root;
-	heap1->nb_nodes = copy1->size();
-	nb_nodes = copy1->size();
-	copy1->root = NULL;
-	copy1->nb_nodes=0;// avoid to delete heap1 with copy1
-	delete copy1;
+	erase(removed, removed_data);
+}
 
-	if (heap2->update_cost_when_sorting) heap2->sort();
+template<class T>
+void DoubleHeap<T>::contract_rank1(unsigned int k, std::vector<T*>& removed_data) {
 
-	assert(nb_nodes==heap2->size());
-	assert(nb_nodes==heap1->size());
-	assert(heap1->heap_state());
-	assert(!heap2 || heap2->heap_state());
-}
+	if (k>=nb_nodes) return;
 
+	// the cost are assumed to be up-to-date for the 1st heap
+	std::vector<HeapElt<T>*> removed(heap1->nodes.begin(), heap1->nodes.begin()+nb_nodes);
+	std::nth_element(removed.begin(), removed.begin()+k, removed.end(),
+			[](const HeapElt<T>* e1, const HeapElt<T>* e2) { return e1->crit[0] < e2->crit[0]; });
+	removed.erase(removed.begin(), removed.begin()+k);
+
+	erase(removed, removed_data);
+}
 
 template<class T>
-void DoubleHeap<T>::contract_rec(double new_loup1, HeapNode<T>* node, SharedHeap<T>& heap, bool percolate) {
+void DoubleHeap<T>::erase(const std::vector<HeapElt<T>*>& removed, std::vector<T*>& removed_data) {
+
+	// Removing the elements one by one takes O(log(nb_nodes)) each
+	// while restoring the order of a whole heap takes O(nb_nodes).
+	unsigned int log_n=1;
+	for (unsigned int n=nb_nodes; n>1; n/=SharedHeap<T>::arity) log_n++;
+
+	// if the costs of the second heap have to be recalculated,
+	// there is no need to maintain the order now.
+	bool rebuild = removed.size()*log_n > nb_nodes;
+	bool percolate2 = !rebuild && !heap2->update_cost_when_sorting;
+
+	for (typename std::vector<HeapElt<T>*>::const_iterator it=removed.begin(); it!=removed.end(); it++) {
+		HeapElt<T>* elt=*it;
+		if (rebuild)
+			heap1->erase_elt_no_percolate(elt);
+		else
+			heap1->erase_elt(elt);
+
+		if (heap2) {
+			if (percolate2)
+				heap2->erase_elt(elt);
+			else
+				heap2->erase_elt_no_percolate(elt);
+		}
+		removed_data.push_back(elt->data);
+		delete elt;
+	}
 
-	// the cost are assumed to be up-to-date for the 1st heap
-	if (node->is_sup(new_loup1, 0)) {
-		// we must remove from the other heap all the sub-nodes
-		if (heap2) erase_subnodes(node, percolate);
-	} else {
-		heap.push_elt(node->elt);
-		if (node->left)	 contract_rec(new_loup1, node->left, heap, percolate);
-		if (node->right) contract_rec(new_loup1, node->right, heap, percolate);
+	nb_nodes = heap1->size();
 
-		delete node;
+	if (rebuild) heap1->heapify();
+
+	if (heap2) {
+		if (heap2->update_cost_when_sorting) heap2->sort();
+		else if (!percolate2) heap2->heapify();
 	}
+
+	assert(nb_nodes==heap2->size());
+	assert(heap1->heap_state());
+	assert(!heap2 || heap2->heap_state());
 }
 
 template<class T>
-void DoubleHeap<T>::erase_subnodes(HeapNode<T>* node, bool percolate) {
-	if (node->left)	erase_subnodes(node->left, percolate);
-	if (node->right) erase_subnodes(node->right, percolate);
-
-	if (!percolate)
-		// there is no need to update the order now in the second heap
-		// since all costs will have to be recalculated.
-		// The heap2 will be sorted at the end (see contract)
-		heap2->erase_node_no_percolate(node->elt->holder[1]);
-	else
-		heap2->erase_node(node->elt->holder[1]);
-
-	if (node->elt->data) delete node->elt->data;
-	delete node->elt;
-	delete node;
+double DoubleHeap<T>::kth_minimum1(unsigned int k) const {
+	assert(k<nb_nodes);
+	std::vector<double> crit(nb_nodes);
+	for (unsigned int i=0; i<nb_nodes; i++)
+		crit[i]=heap1->nodes[i]->crit[0];
+	std::nth_element(crit.begin(), crit.begin()+k, crit.end());
+	return crit[k];
 }
 
 template<class T>
@@ -316,10 +372,10 @@ T* DoubleHeap<T>::pop() {
 	HeapElt<T>* elt;
 	if (current_heap_id==0) {
 		elt = heap1->pop_elt();
-		if (heap2) heap2->erase_node(elt->holder[1]);
+		if (heap2) heap2->erase_elt(elt);
 	} else {
 		elt = heap2->pop_elt();
-		heap1->erase_node(elt->holder[0]);
+		heap1->erase_elt(elt);
 	}
 	T* data = elt->data;
 	elt->data=NULL; // avoid the data to be deleted with the element
@@ -400,10 +456,10 @@ std::ostream& DoubleHeap<T>::print(std::ostream& os) const{
 		os<<std::endl;
 	} else {
 		os << "First Heap:  "<<std::endl;
-		heap1->print(os);
+		os << *heap1;
 		os<<std::endl;
 		os << "Second Heap: "<<std::endl;
-		heap2->print(os);
+		os << *heap2;
 		os<<std::endl;
 	}
 	return os;
@@ -0,0 +1,204 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Profiler.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_Profiler.h"
+#include "ibex_Exception.h"
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <cmath>
+#include <cstdlib>
+
+#ifdef __GNUG__
+#include <cxxabi.h>
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * Write a string in JSON (with quotes).
+ */
+void json_string(ostream& os, const string& s) {
+	os << '"';
+	for (size_t i=0; i<s.size(); i++) {
+		switch (s[i]) {
+		case '"':  os << "\\\""; break;
+		case '\\': os << "\\\\"; break;
+		case '\n': os << "\\n"; break;
+		case '\t': os << "\\t"; break;
+		default:   os << s[i];
+		}
+	}
+	os << '"';
+}
+
+/*
+ * Ratios diam(after[i])/diam(before[i]) over the dimensions
+ * where before[i] is bounded and not degenerated.
+ */
+void diam_ratios(const IntervalVector& before, const IntervalVector& after, vector<double>& ratios) {
+	for (int i=0; i<before.size(); i++) {
+		double d=before[i].diam();
+		if (d>0 && d<POS_INFINITY) ratios.push_back(after[i].diam()/d);
+	}
+}
+
+} // end anonymous namespace
+
+void Profiler::Entry::reset() {
+	nb_calls=0;
+	cpu_time=0;
+	wall_time=0;
+	nb_reductions=0;
+	sum_volume_reduction=0;
+	sum_width_reduction=0;
+	nb_empty=0;
+	nb_success=0;
+}
+
+void Profiler::Entry::add_reduction(const IntervalVector& before, const IntervalVector& after) {
+	nb_reductions++;
+	if (after.is_empty()) {
+		nb_empty++;
+		sum_volume_reduction+=1;
+		sum_width_reduction+=1;
+	} else {
+		sum_volume_reduction+=volume_reduction(before,after);
+		sum_width_reduction+=width_reduction(before,after);
+	}
+}
+
+Profiler::Profiler() {
+
+}
+
+Profiler::~Profiler() {
+	for (vector<Entry*>::iterator it=entries.begin(); it!=entries.end(); it++)
+		delete *it;
+}
+
+Profiler::Entry& Profiler::add(const string& name) {
+	string new_name=name;
+	for (int k=2; ; k++) {
+		bool used=false;
+		for (vector<Entry*>::iterator it=entries.begin(); !used && it!=entries.end(); it++)
+			used = (*it)->name==new_name;
+		if (!used) break;
+		stringstream ss;
+		ss << name << '#' << k;
+		new_name=ss.str();
+	}
+	entries.push_back(new Entry(new_name));
+	return *entries.back();
+}
+
+void Profiler::reset() {
+	for (vector<Entry*>::iterator it=entries.begin(); it!=entries.end(); it++)
+		(*it)->reset();
+}
+
+double Profiler::volume_reduction(const IntervalVector& before, const IntervalVector& after) {
+	if (after.is_empty()) return 1;
+	vector<double> ratios;
+	diam_ratios(before,after,ratios);
+	double log_ratio=0;
+	for (vector<double>::iterator it=ratios.begin(); it!=ratios.end(); it++) {
+		if (*it==0) return 1; // degenerated
+		log_ratio+=std::log(*it);
+	}
+	return 1-std::exp(log_ratio);
+}
+
+double Profiler::width_reduction(const IntervalVector& before, const IntervalVector& after) {
+	if (after.is_empty()) return 1;
+	vector<double> ratios;
+	diam_ratios(before,after,ratios);
+	if (ratios.empty()) return 0;
+	double sum=0;
+	for (vector<double>::iterator it=ratios.begin(); it!=ratios.end(); it++)
+		sum+=1-*it;
+	return sum/ratios.size();
+}
+
+string Profiler::class_name(const type_info& type) {
+	string name=type.name();
+#ifdef __GNUG__
+	int status;
+	char* demangled=abi::__cxa_demangle(type.name(),NULL,NULL,&status);
+	if (status==0) name=demangled;
+	free(demangled);
+#endif
+	if (name.compare(0,6,"ibex::")==0) name=name.substr(6);
+	return name;
+}
+
+void Profiler::report(ostream& os) const {
+	if (entries.empty()) return;
+
+	size_t width=4;
+	for (vector<Entry*>::const_iterator it=entries.begin(); it!=entries.end(); it++)
+		if ((*it)->name.size()>width) width=(*it)->name.size();
+
+	ios_base::fmtflags flags=os.flags();
+	streamsize precision=os.precision();
+
+	os << " " << left << setw(width) << "name"
+	   << right << setw(12) << "calls" << setw(12) << "cpu (s)" << setw(12) << "wall (s)"
+	   << setw(10) << "vol.red" << setw(10) << "wid.red" << setw(10) << "empty" << setw(10) << "success" << endl;
+
+	os << fixed;
+	for (vector<Entry*>::const_iterator it=entries.begin(); it!=entries.end(); it++) {
+		const Entry& e=**it;
+		os << " " << left << setw(width) << e.name << right
+		   << setw(12) << e.nb_calls
+		   << setprecision(4) << setw(12) << e.cpu_time << setw(12) << e.wall_time;
+		if (e.nb_reductions>0)
+			os << setprecision(3) << setw(10) << e.avg_volume_reduction() << setw(10) << e.avg_width_reduction() << setw(10) << e.nb_empty;
+		else
+			os << setw(10) << "--" << setw(10) << "--" << setw(10) << "--";
+		os << setw(10) << e.nb_success << endl;
+	}
+
+	os.flags(flags);
+	os.precision(precision);
+}
+
+void Profiler::to_json(ostream& os) const {
+	streamsize precision=os.precision(12);
+	os << '[';
+	for (vector<Entry*>::const_iterator it=entries.begin(); it!=entries.end(); it++) {
+		const Entry& e=**it;
+		if (it!=entries.begin()) os << ',';
+		os << "\n  {\"name\": ";
+		json_string(os,e.name);
+		os << ", \"calls\": " << e.nb_calls
+		   << ", \"cpu_time\": " << e.cpu_time
+		   << ", \"wall_time\": " << e.wall_time
+		   << ", \"reductions\": " << e.nb_reductions
+		   << ", \"avg_volume_reduction\": " << e.avg_volume_reduction()
+		   << ", \"avg_width_reduction\": " << e.avg_width_reduction()
+		   << ", \"empty\": " << e.nb_empty
+		   << ", \"success\": " << e.nb_success << '}';
+	}
+	os << "\n]" << endl;
+	os.precision(precision);
+}
+
+void Profiler::to_json(const string& filename) const {
+	ofstream file(filename.c_str());
+	if (!file.is_open())
+		ibex_error(("[Profiler] cannot open file " + filename).c_str());
+	to_json(file);
+}
+
+} // end namespace ibex
@@ -0,0 +1,224 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Profiler.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_PROFILER_H__
+#define __IBEX_PROFILER_H__
+
+#include "ibex_IntervalVector.h"
+
+#include <string>
+#include <vector>
+#include <ctime>
+#include <iostream>
+#include <typeinfo>
+#include <chrono>
+
+namespace ibex {
+
+/**
+ * \ingroup tools
+ *
+ * \brief Profiling counters.
+ *
+ * A profiler gathers a list of counters ("entries"), one for each
+ * profiled operator (contractor, bisector, loup finder). The counters
+ * are fed by the profiling wrappers (see #ibex::CtcProfiler,
+ * #ibex::BscProfiler) and displayed at the end of a strategy
+ * (see Optimizer::report() and Solver::report()) or exported in JSON.
+ *
+ * Profiling is opt-in: nothing is measured if the operators are
+ * not wrapped.
+ */
+class Profiler {
+public:
+
+	/**
+	 * \brief Counters of a single operator.
+	 */
+	class Entry {
+	public:
+		/** Create counters set to zero. */
+		explicit Entry(const std::string& name);
+
+		/** Name of the operator. */
+		std::string name;
+
+		/** Number of calls. */
+		long nb_calls;
+
+		/** Total CPU time (in seconds). */
+		double cpu_time;
+
+		/** Total wall-clock time (in seconds). */
+		double wall_time;
+
+		/** Number of calls where a reduction has been measured. */
+		long nb_reductions;
+
+		/** Sum of the relative volume reductions (see #Profiler::volume_reduction). */
+		double sum_volume_reduction;
+
+		/** Sum of the relative width reductions (see #Profiler::width_reduction). */
+		double sum_width_reduction;
+
+		/** Number of calls that resulted in an empty box. */
+		long nb_empty;
+
+		/** Number of successful calls (loup finder: a new loup has been found; bisector: a variable has been chosen). */
+		long nb_success;
+
+		/** Average relative volume reduction (0 if no reduction measured). */
+		double avg_volume_reduction() const;
+
+		/** Average relative width reduction (0 if no reduction measured). */
+		double avg_width_reduction() const;
+
+		/** Record the reduction from a box to another (after contraction). */
+		void add_reduction(const IntervalVector& before, const IntervalVector& after);
+
+		/** Reset all the counters. */
+		void reset();
+	};
+
+	/**
+	 * \brief Measure the time spent in a scope.
+	 *
+	 * The times are added to the entry when the object is destroyed,
+	 * including when an exception is thrown.
+	 */
+	class Measure {
+	public:
+		/** Start the measure (increments the number of calls). */
+		explicit Measure(Entry& entry);
+
+		/** Stop the measure. */
+		~Measure();
+
+	private:
+		Entry& entry;
+		std::clock_t cpu_start;
+		std::chrono::steady_clock::time_point wall_start;
+	};
+
+	/**
+	 * \brief Create a profiler with no entry.
+	 */
+	Profiler();
+
+	/**
+	 * \brief Delete this.
+	 */
+	~Profiler();
+
+	/**
+	 * \brief Add a new entry.
+	 *
+	 * If the name is already used, a suffix "#2", "#3", etc. is appended.
+	 * The reference remains valid until the profiler is destroyed.
+	 */
+	Entry& add(const std::string& name);
+
+	/**
+	 * \brief Number of entries.
+	 */
+	int size() const;
+
+	/**
+	 * \brief The ith entry (in order of creation).
+	 */
+	const Entry& operator[](int i) const;
+
+	/**
+	 * \brief Reset all the counters.
+	 */
+	void reset();
+
+	/**
+	 * \brief Display the counters (one line per entry).
+	 */
+	void report(std::ostream& os=std::cout) const;
+
+	/**
+	 * \brief Export the counters in JSON.
+	 *
+	 * The output is an array of objects, one for each entry.
+	 */
+	void to_json(std::ostream& os) const;
+
+	/**
+	 * \brief Export the counters in a JSON file.
+	 */
+	void to_json(const std::string& filename) const;
+
+	/**
+	 * \brief Relative volume reduction from a box to another.
+	 *
+	 * Calculated as 1-prod(diam(after[i])/diam(before[i])) over the
+	 * dimensions where before[i] is bounded and not degenerated (so that
+	 * the result does not underflow with many dimensions).
+	 * Return 1 if "after" is empty.
+	 */
+	static double volume_reduction(const IntervalVector& before, const IntervalVector& after);
+
+	/**
+	 * \brief Relative width reduction from a box to another.
+	 *
+	 * Average of 1-diam(after[i])/diam(before[i]) over the same dimensions
+	 * as #volume_reduction(const IntervalVector&, const IntervalVector&).
+	 * Return 1 if "after" is empty.
+	 */
+	static double width_reduction(const IntervalVector& before, const IntervalVector& after);
+
+	/**
+	 * \brief Readable name of a class (from the RTTI).
+	 *
+	 * The namespace prefix "ibex::" is removed.
+	 */
+	static std::string class_name(const std::type_info& type);
+
+private:
+	Profiler(const Profiler&); // forbidden
+
+	std::vector<Entry*> entries;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline Profiler::Entry::Entry(const std::string& name) : name(name) {
+	reset();
+}
+
+inline double Profiler::Entry::avg_volume_reduction() const {
+	return nb_reductions==0 ? 0 : sum_volume_reduction/nb_reductions;
+}
+
+inline double Profiler::Entry::avg_width_reduction() const {
+	return nb_reductions==0 ? 0 : sum_width_reduction/nb_reductions;
+}
+
+inline Profiler::Measure::Measure(Entry& entry) : entry(entry), cpu_start(std::clock()),
+		wall_start(std::chrono::steady_clock::now()) {
+	entry.nb_calls++;
+}
+
+inline Profiler::Measure::~Measure() {
+	entry.cpu_time += ((double) (std::clock()-cpu_start))/CLOCKS_PER_SEC;
+	entry.wall_time += std::chrono::duration<double>(std::chrono::steady_clock::now()-wall_start).count();
+}
+
+inline int Profiler::size() const {
+	return (int) entries.size();
+}
+
+inline const Profiler::Entry& Profiler::operator[](int i) const {
+	return *entries[i];
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_PROFILER_H__
@@ -0,0 +1,108 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_RunSummary.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_RunSummary.h"
+#include "ibex_Exception.h"
+
+#include <fstream>
+#include <sstream>
+#include <cmath>
+
+#ifndef _WIN32
+#include <sys/time.h>
+#include <sys/resource.h>
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * Write a string in JSON (with quotes).
+ */
+string json_string(const string& s) {
+	stringstream ss;
+	ss << '"';
+	for (size_t i=0; i<s.size(); i++) {
+		switch (s[i]) {
+		case '"':  ss << "\\\""; break;
+		case '\\': ss << "\\\\"; break;
+		case '\n': ss << "\\n"; break;
+		case '\t': ss << "\\t"; break;
+		default:   ss << s[i];
+		}
+	}
+	ss << '"';
+	return ss.str();
+}
+
+} // end anonymous namespace
+
+void RunSummary::add_real(const string& key, double value) {
+	if (std::isfinite(value)) {
+		stringstream ss;
+		ss.precision(12);
+		ss << value;
+		metrics.push_back(make_pair(key,ss.str()));
+	} else
+		metrics.push_back(make_pair(key,string("null")));
+}
+
+void RunSummary::add_int(const string& key, unsigned long value) {
+	stringstream ss;
+	ss << value;
+	metrics.push_back(make_pair(key,ss.str()));
+}
+
+void RunSummary::add_string(const string& key, const string& value) {
+	metrics.push_back(make_pair(key,json_string(value)));
+}
+
+void RunSummary::add_search(double time, unsigned long nb_cells, unsigned long nb_evals, unsigned long nb_lp_solves) {
+	add_real("time", time);
+	add_int("nb_cells", nb_cells);
+	// the time may be 0 for tiny problems (timer resolution)
+	add_real("cells_per_s", time>0 ? nb_cells/time : NAN);
+	add_int("nb_evals", nb_evals);
+	add_int("nb_lp_solves", nb_lp_solves);
+	add_int("peak_rss_kb", peak_rss());
+}
+
+void RunSummary::to_json(ostream& os) const {
+	os << '{';
+	for (vector<pair<string,string> >::const_iterator it=metrics.begin(); it!=metrics.end(); it++) {
+		if (it!=metrics.begin()) os << ", ";
+		os << json_string(it->first) << ": " << it->second;
+	}
+	os << '}' << endl;
+}
+
+void RunSummary::to_json(const string& filename) const {
+	ofstream file(filename.c_str());
+	if (!file.is_open())
+		ibex_error(("[RunSummary] cannot open file " + filename).c_str());
+	to_json(file);
+}
+
+unsigned long RunSummary::peak_rss() {
+#ifndef _WIN32
+	struct rusage r;
+	if (getrusage(RUSAGE_SELF, &r)!=0) return 0;
+#ifdef __APPLE__
+	return r.ru_maxrss/1024; // in bytes on macOS
+#else
+	return r.ru_maxrss;
+#endif
+#else
+	return 0;
+#endif
+}
+
+} // end namespace ibex
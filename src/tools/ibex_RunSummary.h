@@ -0,0 +1,118 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_RunSummary.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_RUN_SUMMARY_H__
+#define __IBEX_RUN_SUMMARY_H__
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <iostream>
+
+#include "ibex_Counters.h"
+
+namespace ibex {
+
+/**
+ * \ingroup tools
+ *
+ * \brief Machine-readable summary of a run.
+ *
+ * A summary is a flat list of named metrics (time, number of cells,
+ * throughput, etc.) filled by a strategy at the end of a run (see
+ * Optimizer::summary(), Solver::summary() and OptimizerMOP::summary())
+ * and exported as a single JSON object. The waf benchmark harness
+ * aggregates these objects over a suite of instances.
+ *
+ * The numbers of function evaluations and LP solves of a run are
+ * read from the process-wide counters (see #ibex::Counters): a
+ * strategy reports the difference between the end and the beginning
+ * of a run.
+ */
+class RunSummary {
+public:
+
+	/**
+	 * \brief Create an empty summary.
+	 */
+	RunSummary();
+
+	/**
+	 * \brief Add a real-valued metric.
+	 *
+	 * Non-finite values are exported as null.
+	 */
+	void add_real(const std::string& key, double value);
+
+	/**
+	 * \brief Add an integer metric.
+	 */
+	void add_int(const std::string& key, unsigned long value);
+
+	/**
+	 * \brief Add a string.
+	 */
+	void add_string(const std::string& key, const std::string& value);
+
+	/**
+	 * \brief Add the common metrics of a search.
+	 *
+	 * Add "time", "nb_cells", "cells_per_s", "nb_evals",
+	 * "nb_lp_solves" and "peak_rss_kb".
+	 */
+	void add_search(double time, unsigned long nb_cells, unsigned long nb_evals, unsigned long nb_lp_solves);
+
+	/**
+	 * \brief Export the summary in JSON (one object, one line).
+	 */
+	void to_json(std::ostream& os) const;
+
+	/**
+	 * \brief Export the summary in a JSON file.
+	 */
+	void to_json(const std::string& filename) const;
+
+	/**
+	 * \brief Number of function evaluations since the beginning of the process.
+	 */
+	static unsigned long nb_evals();
+
+	/**
+	 * \brief Number of LP solves since the beginning of the process.
+	 */
+	static unsigned long nb_lp_solves();
+
+	/**
+	 * \brief Peak resident memory of the process (in kilobytes).
+	 *
+	 * Return 0 if not available on this platform.
+	 */
+	static unsigned long peak_rss();
+
+private:
+	/* (key, value in JSON) */
+	std::vector<std::pair<std::string,std::string> > metrics;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline RunSummary::RunSummary() {
+
+}
+
+inline unsigned long RunSummary::nb_evals() {
+	return Counters::total(Counters::EVAL);
+}
+
+inline unsigned long RunSummary::nb_lp_solves() {
+	return Counters::total(Counters::LP_SOLVE);
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_RUN_SUMMARY_H__
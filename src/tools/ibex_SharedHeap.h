@@ -1,5 +1,5 @@
 //============================================================================
-//                                  I B E X                                   
+//                                  I B E X
 // File        : ibex_SharedHeap.h
 // Author      : Gilles Chabert, Jordan Ninin, Dominique Monnet
 // Copyright   : IMT Atlantique (France)
@@ -14,11 +14,11 @@
 #include <iostream>
 #include <cassert>
 #include <stack>
+#include <vector>
 #include "ibex_Heap.h" // just for the declaration of CostFunc<T>
 
 namespace ibex {
 
-template<class T> class HeapNode;
 template<class T> class HeapElt;
 template<class T> class DoubleHeap;
 
@@ -35,6 +35,11 @@ template<class T> class DoubleHeap;
  * It is the role of DoubleHeap to manage shared heap
  * synchronization.
  *
+ * The heap is an implicit d-ary tree stored in an array
+ * (the children of the ith node are the nodes d*i+1,...,d*i+d).
+ * Each element stores its position in each heap it belongs to
+ * so that it can be removed from one heap when popped from the
+ * other one.
  *
  * The heap is built so that:
  *  <ul>
@@ -57,9 +62,6 @@ public:
 	 */
 	SharedHeap(CostFunc<T>& cost, bool update_cost_when_sorting, int id);
 
-	/** Constructor by copy */
-	SharedHeap(const SharedHeap<T>& heap, int nb_crit, bool deep_copy);
-
 	/** \brief Delete this.
 	 *
 	 * Data is not deleted. Call #clear(NODE_ELT_DATA) before. */
@@ -97,17 +99,13 @@ public:
 
 	/**
 	 * \brief update the cost and sort all the heap
-	 * complexity: o(nb_nodes*log(nb_nodes))
 	 *
-	 * \param update_cost: if true, costs are all recalculated
+	 * The costs are all recalculated if update_cost_when_sorting is true.
+	 *
+	 * Complexity: o(nb_nodes)
 	 */
 	void sort();
 
-	/**
-	 * \brief Count the number of nodes pushed since
-	 *         the object is created. */
-	unsigned int nb_nodes;
-
 	/**
 	 * \brief Cost function associated to this heap
 	 */
@@ -116,6 +114,11 @@ public:
 	/**  \brief Identifier of this heap */
 	const int heap_id;
 
+	/**
+	 * \brief Arity of the tree (number of children of a node).
+	 */
+	static constexpr unsigned int arity = 4;
+
 protected:
 
 	friend class DoubleHeap<T>;
@@ -123,8 +126,8 @@ protected:
 	/** The "cost" of an element. */
 	double cost(const T& data) const;
 
-	/** The root of the heap */
-	HeapNode<T>* root;
+	/** The nodes, in breadth-first order. */
+	std::vector<HeapElt<T>*> nodes;
 
 	/** Whether the cost function is called again inside sort. */
 	bool update_cost_when_sorting;
@@ -144,41 +147,41 @@ protected:
 	void push_elt(HeapElt<T>* elt);
 
 	/**
-	 * Percolate (or "heapify") from the node \var node downto the bottom.
+	 * Percolate (or "heapify") from the ith node downto the bottom.
 	 */
-	void percolate_down(HeapNode<T>* node);
+	void percolate_down(unsigned int i);
 
 	/**
-	 * Percolate (or "heapify") from the node \var node upto the root.
+	 * Percolate (or "heapify") from the ith node upto the root.
 	 */
-	void percolate_up(HeapNode<T>* node);
+	void percolate_up(unsigned int i);
 
 	/**
-	 * \brief Remove a node and update the heap in consequence.
+	 * \brief Remove an element and update the heap in consequence.
 	 *
-	 * (call percolate_down and percolate_up).
+	 * Complexity: O(log(nb_nodes))
 	 */
-	void erase_node(HeapNode<T>* node);
+	void erase_elt(HeapElt<T>* elt);
 
 	/**
-	 * \brief Remove a node.
+	 * \brief Remove an element.
 	 *
-	 * The last node is actually removed and its element is put in place
-	 * of the node element, except if the node is the last.
+	 * The last element is put in place of the removed one.
 	 *
-	 * The heap is not updated after (the new node is not at its right place
-	 * anymore and the heap is in undefined state).
+	 * The heap is not updated after (the moved element is not at its
+	 * right place anymore and the heap is in undefined state) until
+	 * #heapify() is called.
 	 *
 	 * Complexity: O(1)
 	 */
-	HeapNode<T>* erase_node_no_percolate(HeapNode<T>* node);
+	void erase_elt_no_percolate(HeapElt<T>* elt);
 
 	/**
-	 * \brief Access to the ith node, rank by largest-first order.
+	 * \brief Restore the heap order of all the nodes.
 	 *
-	 * \param i - the node number
+	 * Complexity: O(nb_nodes)
 	 */
-	HeapNode<T>* get_node(unsigned int i) const;
+	void heapify();
 
 	/**
 	 * \brief Streams out the heap
@@ -191,75 +194,20 @@ protected:
 	/**
 	 * \brief Check if the heap is well-formed
 	 */
-	bool heap_state();
+	bool heap_state() const;
 
 	/** Return a list of all the elements */
-	std::vector<HeapElt<T>*> elt();
+	const std::vector<HeapElt<T>*>& elt() const;
 
 private:
+	/** Whether the ith node is "greater" than the jth node. */
+	bool is_sup(unsigned int i, unsigned int j) const;
 
-	/** Used in the sort function (proceed by recursivity) */
-	void sort_rec(HeapNode<T>* node, SharedHeap<T>& heap);
-
-	void elt_rec(HeapNode<T>* cur, std::vector<HeapElt<T>*>& elm_vect);
-
-	void clear_subnodes(HeapNode<T>* node, clear_mode mode);
+	/** Put the element elt at the ith node. */
+	void set_node(unsigned int i, HeapElt<T>* elt);
 };
 
 
-
-/**
- * \ingroup strategy
- *
- * \brief Shared heap node (internal)
- *
- * Class to be used by DoubleHeap only.
- */
-template<class T>
-class HeapNode {
-
-private:
-	friend class SharedHeap<T>;
-	friend class DoubleHeap<T>;
-
-	/** Create a node from an element and the father node. */
-	explicit HeapNode(HeapElt<T>* elt, int heap_id, HeapNode<T>* father);
-
-	/** Constructor by copy. */
-	explicit HeapNode(const HeapNode& node, HeapNode<T>* father, int heap_id, int nb_crit, bool deep_copy);
-
-	/** Delete the node and all its sons */
-	//~HeapNode() ;
-
-	/** the stored element. */
-	HeapElt<T>* elt;
-
-	/** Right sub-node */
-	HeapNode<T>* right;
-
-	/** Left sub-node */
-	HeapNode<T>* left;
-
-	/** Father node. */
-	HeapNode<T>* father;
-
-	/** Compare the heap_id-cost of this node to "node". */
-	bool is_sup(HeapNode<T>* node, int heap_id) const;
-
-	/** Compare the heap_id-cost of this node to the value "d". */
-	bool is_sup(double d, int heap_id) const;
-
-	/** Switch the elements between *this and node */
-	void switch_elt(HeapNode<T>* node, int heap_id);
-
-	template<class U>
-	friend std::ostream& operator<<(std::ostream& os, const HeapNode<U>& node);
-
-	template<class U>
-	friend std::ostream& operator<<(std::ostream& os, const SharedHeap<U>& heap);
-
-};
-
 /**
  * \ingroup strategy
  *
@@ -271,13 +219,9 @@ template<class T>
 class HeapElt {
 
 private:
-	friend class HeapNode<T>;
 	friend class SharedHeap<T>;
 	friend class DoubleHeap<T>;
 
-	/** Create an CellHeapElt with a data and its criteria */
-	//CellHeapElt(int nb_crit, T* elt, double *crit);
-
 	/** Create an HeapElt with a data and one criterion */
 	explicit HeapElt(T* data, double crit_1);
 
@@ -285,10 +229,7 @@ private:
 	explicit HeapElt(T* data, double crit_1, double crit_2);
 
     /** Copy constructor (not holders) **/
-	explicit HeapElt(const HeapElt<T>& elt, int nb_crit, bool deep_copy);
-
-	/** Delete the element (*not the data*) */
-	~HeapElt() ;
+	explicit HeapElt(const HeapElt<T>& elt, bool deep_copy);
 
 	/**
 	 * Compare the criterion of a given heap with the value d.
@@ -299,15 +240,12 @@ private:
 	/** the stored data. */
 	T* data;
 
-//	/** The number of different heaps this element belongs to */
-//	int nb_heaps;
-
 	/** the criteria of the stored data (one for each heap this
 	 * element belongs to). */
-	double *crit;
+	double crit[2];
 
-	/** The node that holds this element, for each heap. */
-	HeapNode<T>** holder;
+	/** The position of this element, for each heap. */
+	unsigned int holder[2];
 
 	template<class U>
 	friend std::ostream& operator<<(std::ostream& os, const HeapElt<U>& node) ;
@@ -322,31 +260,13 @@ private:
 
 
 template<class T>
-SharedHeap<T>::SharedHeap(CostFunc<T>& cost, bool update_cost, int id) : nb_nodes(0), costf(cost), heap_id(id), root(NULL), update_cost_when_sorting(update_cost) {
-
-}
-
-template<class T>
-SharedHeap<T>::SharedHeap(const SharedHeap<T>& heap, int nb_crit, bool deep_copy) :
- nb_nodes(heap.nb_nodes), costf(heap.costf), heap_id(heap.heap_id), root(NULL), update_cost_when_sorting(heap.update_cost_when_sorting) {
-	if (heap.root != NULL)
-		root = new HeapNode<T>(*(heap.root), NULL, heap_id, nb_crit, deep_copy);
-}
+SharedHeap<T>::SharedHeap(CostFunc<T>& cost, bool update_cost, int id) : costf(cost), heap_id(id), update_cost_when_sorting(update_cost) {
 
-template<class T>
-std::vector<HeapElt<T>*> SharedHeap<T>::elt() {
-    std::vector<HeapElt<T>*> elm_vect;
-    elt_rec(root, elm_vect);
-    return elm_vect;
 }
 
 template<class T>
-void SharedHeap<T>::elt_rec(HeapNode<T>* cur, std::vector<HeapElt<T>*> &elm_vect) {
-    if(cur != NULL) {
-    	elm_vect.push_back(cur->elt);
-        elt_rec(cur->right, elm_vect);
-        elt_rec(cur->left, elm_vect);
-    }
+const std::vector<HeapElt<T>*>& SharedHeap<T>::elt() const {
+    return nodes;
 }
 
 template<class T>
@@ -356,66 +276,52 @@ SharedHeap<T>::~SharedHeap() {
 
 template<class T>
 void SharedHeap<T>::clear(clear_mode mode) {
-	if (nb_nodes>0) {
-		clear_subnodes(root, mode);
-		nb_nodes=0;
-		root=NULL;
-	}
-}
-
-template<class T>
-void SharedHeap<T>::clear_subnodes(HeapNode<T>* node, clear_mode mode) {
-	if (node->left)	clear_subnodes(node->left, mode);
-	if (node->right) clear_subnodes(node->right, mode);
-
-	if (mode==NODE_ELT)
-		delete node->elt;
-	else if (mode==NODE_ELT_DATA) {
-		if (node->elt->data)
-			delete node->elt->data;
-		delete node->elt;
+	if (mode!=NODE) {
+		for (typename std::vector<HeapElt<T>*>::iterator it=nodes.begin(); it!=nodes.end(); it++) {
+			if (mode==NODE_ELT_DATA && (*it)->data)
+				delete (*it)->data;
+			delete *it;
+		}
 	}
-
-	delete node;
+	nodes.clear();
 }
 
 template<class T>
 inline double SharedHeap<T>::minimum() const {
-	return root->elt->crit[heap_id];
+	return nodes[0]->crit[heap_id];
 }
 
 template<class T>
-unsigned int SharedHeap<T>::size() const {
-	return nb_nodes;
+inline unsigned int SharedHeap<T>::size() const {
+	return nodes.size();
 }
 
 template<class T>
-bool SharedHeap<T>::empty() const {
-	return (nb_nodes==0);
+inline bool SharedHeap<T>::empty() const {
+	return nodes.empty();
 }
 
 template<class T>
-T* SharedHeap<T>::top() const {
-	return root->elt->data;
+inline T* SharedHeap<T>::top() const {
+	return nodes[0]->data;
 }
 
-
 template<class T>
 void SharedHeap<T>::sort() {
-	if (nb_nodes==0) return;
-
-	SharedHeap<T>* heap_tmp = new SharedHeap<T>(costf, update_cost_when_sorting, heap_id);
-
-	// recursive sort : o(n*log(n))
-	sort_rec(root, *heap_tmp);
+	if (update_cost_when_sorting)
+		for (typename std::vector<HeapElt<T>*>::iterator it=nodes.begin(); it!=nodes.end(); it++)
+			(*it)->crit[heap_id] = cost(*((*it)->data));
 
-	root = heap_tmp->root;
-	nb_nodes = heap_tmp->size();
+	heapify();
+}
 
-	heap_tmp->root = NULL;
-	heap_tmp->nb_nodes=0;
-	delete heap_tmp; 	// warning: delete all sub-nodes
+template<class T>
+void SharedHeap<T>::heapify() {
+	if (nodes.size()<2) return;
 
+	// Floyd's algorithm: percolate down all the internal nodes, from the last one
+	for (unsigned int i=(nodes.size()-2)/arity+1; i>0; i--)
+		percolate_down(i-1);
 }
 
 template<class T>
@@ -424,317 +330,128 @@ inline double SharedHeap<T>::cost(const T& data) const {
 }
 
 template<class T>
-void SharedHeap<T>::sort_rec(HeapNode<T>* node, SharedHeap<T>& heap) {
-
-	if (update_cost_when_sorting)
-		node->elt->crit[heap_id] = cost(*(node->elt->data));
-
-	heap.push_elt(node->elt);
-	if (node->left)	 sort_rec(node->left, heap);
-	if (node->right) sort_rec(node->right, heap);
-
-	delete node;
+inline bool SharedHeap<T>::is_sup(unsigned int i, unsigned int j) const {
+	return nodes[i]->is_sup(nodes[j]->crit[heap_id], heap_id);
 }
 
 template<class T>
-void SharedHeap<T>::push_elt(HeapElt<T>* elt) {
-
-	if (nb_nodes==0) {
-		root = new HeapNode<T>(elt,heap_id,NULL);
-		nb_nodes++;
-	} else {
-		nb_nodes++;
-		// calculate height
-		int height = 0;
-		int aux = nb_nodes;
-		while(aux>1) { aux /= 2; height++;	}
-
-		// pt = pointer on the current element
-		HeapNode<T> * pt = root;
-		for (int pos=height-1; pos>0; pos--) {
-			if ( nb_nodes & (1 << pos)) {  // test the "pos"th bit of the integer nb_nodes
-				pt = pt->right;
-			} else {
-				pt = pt->left;
-			}
-		}
-		HeapNode<T>* tmp= new HeapNode<T>(elt,heap_id,pt);
-		if (nb_nodes%2==0) { pt->left =tmp; }
-		else               { pt->right=tmp; }
-
-		percolate_up(tmp);
-	}
+inline void SharedHeap<T>::set_node(unsigned int i, HeapElt<T>* elt) {
+	nodes[i] = elt;
+	elt->holder[heap_id] = i;
 }
 
 template<class T>
-HeapNode<T> * SharedHeap<T>::get_node(unsigned int i) const {
-	assert(i<nb_nodes);
-	assert(nb_nodes>0);
-
-	// GET THE LAST ELEMENT and delete the associated node
-	// calculate height
-	int height = 0;
-	unsigned int aux = i+1;
-	while(aux>1) { aux /= 2; height++; }
-	//std::cout << "height of "<<i<<"  = " << height <<std::endl;
-	// pt = pointer on the current element
-	HeapNode<T>* pt = root;
-	for (int pos=height-1; pos>=0; pos--) {
-		if ( (i+1) & (1 << pos)) {  // test the "pos"th bit of the integer nb_nodes
-			//std::cout << "Right ";
-			pt = pt->right;
-		} else {
-			//std::cout << "Left ";
-			pt = pt->left;
-		}
-	}
-	return pt;
+void SharedHeap<T>::push_elt(HeapElt<T>* elt) {
+	nodes.push_back(elt);
+	elt->holder[heap_id] = nodes.size()-1;
+	percolate_up(nodes.size()-1);
 }
 
 template<class T>
 HeapElt<T>* SharedHeap<T>::pop_elt() {
-	assert(nb_nodes>0);
-	HeapElt<T>* c_return = root->elt;
-	erase_node(root);
+	assert(!nodes.empty());
+	HeapElt<T>* c_return = nodes[0];
+	erase_elt(c_return);
 	return c_return;
 }
 
-// erase a node and update the order
 template<class T>
-void SharedHeap<T>::erase_node(HeapNode<T>* node) {
-	assert(node);
-	assert(nb_nodes>0);
+void SharedHeap<T>::erase_elt(HeapElt<T>* elt) {
+	unsigned int i=elt->holder[heap_id];
+	assert(i<nodes.size() && nodes[i]==elt);
 
-	if (erase_node_no_percolate(node)) {
-		percolate_down(node);
-		percolate_up(node);
-	}
-}
+	erase_elt_no_percolate(elt);
 
-// erase a node without updating the order
-template<class T>
-HeapNode<T>* SharedHeap<T>::erase_node_no_percolate(HeapNode<T>* node) {
-	assert(nb_nodes>0);
-
-	if (nb_nodes==1) {
-		assert(node==root);
-		root->elt=NULL;
-		delete root;
-		root = NULL;
-		node = NULL; // return NULL
-	} else {
-		// Get the last element and delete the associated node without destroying the HeapElt
-		HeapNode<T>* last = get_node(nb_nodes-1);
-
-		// elt points on the last node data, that we will put in place of the deleted node
-		HeapElt<T>* elt = last->elt;
-
-		if (nb_nodes%2==0)	{ last->father->left =NULL; }
-		else 				{ last->father->right=NULL; }
-
-		// to avoid the element to be deleted with the node pt
-		last->elt = NULL;
-
-		if (node!=last) { // if the node to be deleted is not the last
-			node->elt = elt;
-			node->elt->holder[heap_id] = node;
-		} else {
-			node = NULL; // return NULL
-		}
-		delete last;
+	if (i<nodes.size()) { // the last node has been moved to i
+		percolate_down(i);
+		percolate_up(i);
 	}
-	nb_nodes--;
-	return node;
 }
 
 template<class T>
-void SharedHeap<T>::percolate_up(HeapNode<T>* node) {
-	assert(node);
+void SharedHeap<T>::erase_elt_no_percolate(HeapElt<T>* elt) {
+	unsigned int i=elt->holder[heap_id];
+	assert(i<nodes.size() && nodes[i]==elt);
 
-	while (node->father && node->father->is_sup(node,heap_id)) {
-		node->switch_elt(node->father,heap_id);
-		node = node->father;
-	}
+	HeapElt<T>* last=nodes.back();
+	nodes.pop_back();
+	if (last!=elt)
+		set_node(i, last);
 }
 
 template<class T>
-void SharedHeap<T>::percolate_down(HeapNode<T>* node) {
-	assert(node);
-
-	// PERMUTATION to maintain the order in the heap when going down
-	bool b=true;
-	while (b && (node->left)) {
-		if (node->right) {
-			if (node->is_sup(node->left,heap_id)) {
-				if (node->right->is_sup(node->left,heap_id)) {
-					// left is the smallest
-					node->switch_elt(node->left,heap_id);
-					node = node->left;  // next
-				} else {
-					// right is the smallest
-					node->switch_elt(node->right,heap_id);
-					node = node->right;  // next
-				}
-			} else {
-				if (node->is_sup(node->right,heap_id)) {
-					// right is the smallest
-					node->switch_elt(node->right,heap_id);
-					node = node->right;  // next
-				} else { // current node is the smallest among the 3: stop
-					b=false;
-				}
-			}
-		} else { // no more right child but there is a left child
-			if (node->is_sup(node->left,heap_id)) {
-				// left is the smallest
-				node->switch_elt(node->left,heap_id);
-				node = node->left;  // next
-			} else { // current node is the smallest among the 3: stop (and we must have reached the bottom of the heap)
-				b=false;
-			}
-		}
-	}
-}
+void SharedHeap<T>::percolate_up(unsigned int i) {
+	HeapElt<T>* elt=nodes[i];
+	double c=elt->crit[heap_id];
 
-template<class T>
-bool SharedHeap<T>::heap_state() {
-
-	if (empty()) return true;
-
-	std::stack<HeapNode<T>* > s;
-	s.push(root);
-	while (!s.empty()) {
-		HeapNode<T>* node=s.top();
-		s.pop();
-		if (node->right && (!node->left)) {
-			//std::cerr << "node with only right child" << std::endl;
-			return false;
-		}
-		if (node->left) {
-			if (node->is_sup(node->left,heap_id)) {
-				//std::cerr << "node elt:" << node->elt->crit[heap_id] << " node left:" <<  node->left->elt->crit[heap_id] << std::endl;
-				return false;
-			}
-			else s.push(node->left);
-		}
-		if (node->right) {
-			if (node->is_sup(node->right,heap_id)) {
-				//std::cerr << "node elt:" << node->elt->crit[heap_id] << " node left:" <<  node->right->elt->crit[heap_id] << std::endl;
-				return false;
-			}
-			else s.push(node->right);
-		}
+	// the element goes up while its father is greater
+	while (i>0) {
+		unsigned int father=(i-1)/arity;
+		if (!nodes[father]->is_sup(c, heap_id)) break;
+		set_node(i, nodes[father]);
+		i = father;
 	}
-	return true;
+	set_node(i, elt);
 }
 
 template<class T>
-HeapNode<T>::HeapNode(HeapElt<T>* elt, int heap_id, HeapNode<T>* father): elt(elt), right(NULL), left(NULL), father(father) {
-	elt->holder[heap_id] = this;
-}
-
+void SharedHeap<T>::percolate_down(unsigned int i) {
+	unsigned int n=nodes.size();
+	HeapElt<T>* elt=nodes[i];
 
+	while (true) {
+		unsigned int first=arity*i+1;
+		if (first>=n) break;
 
-template<class T>
-HeapNode<T>::HeapNode(const HeapNode& node, HeapNode<T>* father, int heap_id, int nb_crit, bool deep_copy) :
-	elt(new HeapElt<T>(*(node.elt), nb_crit, deep_copy)),
-	right(NULL), left(NULL), father(father) {
-
-	elt->holder[heap_id] = this;
+		// look for the smallest child
+		unsigned int last=first+arity < n ? first+arity : n;
+		unsigned int min=first;
+		for (unsigned int j=first+1; j<last; j++)
+			if (is_sup(min,j)) min=j;
 
-	if (node.right != NULL) {
-		right = new HeapNode(*(node.right), this, heap_id, nb_crit, deep_copy);
-	}
-	if (node.left != NULL) {
-		left = new HeapNode(*(node.left), this, heap_id, nb_crit, deep_copy);
+		if (!elt->is_sup(nodes[min]->crit[heap_id], heap_id)) break;
+		set_node(i, nodes[min]);
+		i = min;
 	}
+	set_node(i, elt);
 }
 
-//template<class T>
-//HeapNode<T>::~HeapNode() {
-//	// warning: delete all sub-nodes
-//
-//	if (elt) {
-//		// Next loop will allow us to call the destructor
-//		// on other holders of the same element "elt"
-//		// They will not try to delete twice "elt".
-//		for (int i=0; i<elt->nb_heaps; i++) {
-//			if (elt->holder[i]!=this) // skip myself
-//				elt->holder[i]->elt=NULL;
-//		}
-//		delete elt;
-//	}
-//
-//	if (right) 	delete right;
-//	if (left)  	delete left;
-//}
-
 template<class T>
-bool HeapNode<T>::is_sup(HeapNode<T>* node, int heap_id) const {
-	return elt->is_sup(node->elt->crit[heap_id],heap_id);
-}
-
-template<class T>
-bool HeapNode<T>::is_sup(double d, int heap_id) const {
-	return elt->is_sup(d,heap_id);
-}
-
-template<class T>
-void HeapNode<T>::switch_elt(HeapNode<T>* node, int heap_id) {
-
-	elt->holder[heap_id] = node;
-	node->elt->holder[heap_id] = this;
-
-	HeapElt<T> * elt_tmp = elt;
-	elt = node->elt;
-	node->elt = elt_tmp;
+bool SharedHeap<T>::heap_state() const {
 
+	for (unsigned int i=0; i<nodes.size(); i++) {
+		if (nodes[i]->holder[heap_id]!=i)
+			return false;
+		if (i>0 && is_sup((i-1)/arity, i))
+			return false;
+	}
+	return true;
 }
 
-//////////////////////////////////////////////////////////////////////////////////////
-/** create an node with a data and its criterion */
-//CellHeapElt::CellHeapElt(int nb_crit,T* data, double *crit_in) : data(data), crit(new double[nb_crit]), indice(new unsigned int[nb_crit]){
-//	for (int i=0;i<nb_crit;i++) {
-//		crit[i] = crit_in[i];
-//		indice[i] = 0;
-//	}
-//}
-
 template<class T>
-HeapElt<T>::HeapElt(T* data, double crit_1) : data(data), /*nb_heaps(1),*/ crit(new double[1]), holder(new HeapNode<T>*[1]){
+HeapElt<T>::HeapElt(T* data, double crit_1) : data(data) {
 	crit[0] = crit_1;
-	holder[0] = NULL;
+	crit[1] = 0;
+	holder[0] = holder[1] = 0;
 }
 
 template<class T>
-HeapElt<T>::HeapElt(T* data, double crit_1, double crit_2) : data(data), /*nb_heaps(2),*/ crit(new double[2]), holder(new HeapNode<T>*[2]){
+HeapElt<T>::HeapElt(T* data, double crit_1, double crit_2) : data(data) {
 	crit[0] = crit_1;
 	crit[1] = crit_2;
-	holder[0] = NULL;
-	holder[1] = NULL;
+	holder[0] = holder[1] = 0;
 }
 
 template<class T>
-HeapElt<T>::HeapElt(const HeapElt<T>& elt, int nb_crit, bool deep) : data(NULL), crit(new double[nb_crit]), holder(new HeapNode<T>*[nb_crit]) {
-	for(int i=0; i<nb_crit; i++) {
+HeapElt<T>::HeapElt(const HeapElt<T>& elt, bool deep) : data(deep ? new T(*(elt.data)) : elt.data) {
+	for(int i=0; i<2; i++) {
         crit[i] = elt.crit[i];
-        holder[i] = NULL;
-    }
-    if (deep) {
-    	data = new T(*(elt.data));
-    } else {
-    	data = elt.data;
+        holder[i] = 0;
     }
 }
 
 template<class T>
-HeapElt<T>::~HeapElt() {
-	delete [] crit;
-	delete [] holder;
-}
-
-template<class T>
-bool HeapElt<T>::is_sup(double d, int ind_crit) const {
+inline bool HeapElt<T>::is_sup(double d, int ind_crit) const {
 	return (crit[ind_crit] > d);
 }
 
@@ -744,27 +461,21 @@ std::ostream& operator<<(std::ostream& os, const HeapElt<T>& elt) {
 	return os;
 }
 
-template<class T>
-std::ostream& operator<<(std::ostream& os, const HeapNode<T>& node) {
-	os  <<*(node.elt) << " ";
-	if (node.left)  os <<  *(node.left);
-	if (node.right) os <<  *(node.right);
-	return os;
-}
-
 template<class T>
 std::ostream& operator<<(std::ostream& os, const SharedHeap<T>& heap) {
-	if (!heap.root) return os << "(empty heap)";
+	if (heap.empty()) return os << "(empty heap)";
 	os << std::endl;
-	std::stack<std::pair<HeapNode<T>*,int> > s;
-	s.push(std::pair<HeapNode<T>*,int>(heap.root,0));
+	std::stack<std::pair<unsigned int,int> > s;
+	s.push(std::pair<unsigned int,int>(0,0));
 	while (!s.empty()) {
-		std::pair<HeapNode<T>*,int> p=s.top();
+		std::pair<unsigned int,int> p=s.top();
 		s.pop();
 		for (int i=0; i<p.second; i++) os << "   ";
-		os  << (p.first->elt->crit[heap.heap_id]) << std::endl;
-		if (p.first->right) s.push(std::pair<HeapNode<T>*,int>(p.first->right,p.second+1));
-		if (p.first->left) s.push(std::pair<HeapNode<T>*,int>(p.first->left,p.second+1));
+		os  << (heap.nodes[p.first]->crit[heap.heap_id]) << std::endl;
+		for (unsigned int j=SharedHeap<T>::arity; j>0; j--) {
+			unsigned int child=SharedHeap<T>::arity*p.first+j;
+			if (child<heap.size()) s.push(std::pair<unsigned int,int>(child,p.second+1));
+		}
 	}
 	return os;
 }
@@ -0,0 +1,153 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ThreadPool.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#include "ibex_ThreadPool.h"
+#include "ibex_Setting.h"
+
+#include <vector>
+#include <exception>
+
+#ifdef _IBEX_WITH_THREADS_
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <cfenv>
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+#ifdef _IBEX_WITH_THREADS_
+
+struct ThreadPool::Workers {
+
+	Workers(int n);
+
+	void loop(int t);
+
+	vector<thread> threads;
+
+	mutex m;
+	condition_variable start;  // signals a new task (or the end) to the workers
+	condition_variable done;   // signals the end of the task to the caller
+
+	const function<void(int)>* task;
+	fenv_t env;                // floating-point environment of the caller
+	unsigned long generation;  // number of tasks started
+	int pending;               // number of jobs of the current task not over
+	bool stop;
+
+	vector<exception_ptr> errors;
+};
+
+ThreadPool::Workers::Workers(int n) : task(NULL), generation(0), pending(0), stop(false), errors(n) {
+
+}
+
+void ThreadPool::Workers::loop(int t) {
+	unsigned long last=0; // last task run by this worker
+
+	while (true) {
+		fenv_t task_env;
+		const function<void(int)>* f;
+		{
+			unique_lock<mutex> lock(m);
+			start.wait(lock, [&]() { return stop || generation!=last; });
+			if (stop) return;
+			last = generation;
+			f = task;
+			task_env = env;
+		}
+
+		fesetenv(&task_env);
+
+		try {
+			(*f)(t);
+		} catch(...) {
+			errors[t] = current_exception();
+		}
+
+		{
+			lock_guard<mutex> lock(m);
+			if (--pending==0) done.notify_one();
+		}
+	}
+}
+
+ThreadPool::ThreadPool(int n) : n(n<1 ? 1 : n), workers(NULL) {
+	if (this->n==1) return;
+
+	workers = new Workers(this->n);
+	for (int t=1; t<this->n; t++)
+		workers->threads.push_back(thread(&Workers::loop, workers, t));
+}
+
+ThreadPool::~ThreadPool() {
+	if (!workers) return;
+	{
+		lock_guard<mutex> lock(workers->m);
+		workers->stop = true;
+	}
+	workers->start.notify_all();
+	for (vector<thread>::iterator it=workers->threads.begin(); it!=workers->threads.end(); ++it)
+		it->join();
+	delete workers;
+}
+
+void ThreadPool::run(const function<void(int)>& task) {
+	if (!workers) {
+		task(0);
+		return;
+	}
+
+	{
+		lock_guard<mutex> lock(workers->m);
+		workers->task = &task;
+		fegetenv(&workers->env);
+		workers->errors.assign(n, exception_ptr());
+		workers->pending = n-1;
+		workers->generation++;
+	}
+	workers->start.notify_all();
+
+	try {
+		task(0);
+	} catch(...) {
+		workers->errors[0] = current_exception();
+	}
+
+	{
+		unique_lock<mutex> lock(workers->m);
+		workers->done.wait(lock, [&]() { return workers->pending==0; });
+	}
+
+	for (int t=0; t<n; t++)
+		if (workers->errors[t]) rethrow_exception(workers->errors[t]);
+}
+
+#else
+
+struct ThreadPool::Workers { };
+
+ThreadPool::ThreadPool(int n) : n(n<1 ? 1 : n), workers(NULL) {
+
+}
+
+ThreadPool::~ThreadPool() {
+
+}
+
+void ThreadPool::run(const function<void(int)>& task) {
+	for (int t=0; t<n; t++)
+		task(t);
+}
+
+#endif // _IBEX_WITH_THREADS_
+
+} // end namespace ibex
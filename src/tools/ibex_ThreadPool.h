@@ -0,0 +1,80 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ThreadPool.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_THREAD_POOL_H__
+#define __IBEX_THREAD_POOL_H__
+
+#include <functional>
+
+namespace ibex {
+
+/** \ingroup tools
+ *
+ * \brief Pool of persistent worker threads.
+ *
+ * Operators that work in parallel at each node of a search (e.g., the
+ * slices of Ctc3BCid) run many short tasks. Instead of creating and
+ * joining threads for each of them, the threads of the pool are created
+ * once and wait for the next task.
+ *
+ * A pool of size n runs a task as n jobs: job 0 is run by the calling
+ * thread and the other ones by the n-1 worker threads. The floating-point
+ * environment (rounding mode) of the calling thread is set in the workers
+ * before each task.
+ *
+ * If Ibex is built without thread support, the jobs are run sequentially
+ * by the calling thread.
+ */
+class ThreadPool {
+public:
+
+	/**
+	 * \brief Create a pool of size n (n-1 worker threads).
+	 */
+	explicit ThreadPool(int n);
+
+	/**
+	 * \brief Stop the workers and delete this.
+	 */
+	~ThreadPool();
+
+	/**
+	 * \brief Size of the pool.
+	 */
+	int size() const;
+
+	/**
+	 * \brief Run task(0),...,task(n-1) in parallel and wait for them.
+	 *
+	 * If a job throws an exception, it is rethrown once all the
+	 * jobs are over (the one of the smallest job number).
+	 *
+	 * \warning Not reentrant: a job cannot use the same pool.
+	 */
+	void run(const std::function<void(int)>& task);
+
+private:
+	ThreadPool(const ThreadPool&);            // forbidden
+	ThreadPool& operator=(const ThreadPool&); // forbidden
+
+	struct Workers;
+
+	const int n;
+
+	Workers* workers; // NULL if n=1 or without thread support
+};
+
+/*================================== inline implementations ========================================*/
+
+inline int ThreadPool::size() const {
+	return n;
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_THREAD_POOL_H__
@@ -18,7 +18,7 @@ static int ____IGNORE___ = (StaticTimer::start(), 0);
 
 StaticTimer::Time StaticTimer::local_time = 0;
 
-Timer::Timer(): start_time(0.0), active(false) {
+Timer::Timer(bool per_thread): start_time(0.0), active(false), per_thread(per_thread) {
 }
 
 
@@ -27,21 +27,21 @@ Timer::Timer(): start_time(0.0), active(false) {
 void Timer::start(){
 	if (active==false) {
 		active = true;
-		start_time = StaticTimer::get_localtime();
+		start_time = StaticTimer::get_localtime(per_thread);
 	}
 }
 
 void Timer::stop(){
 	active = false;
-	start_time = (StaticTimer::get_localtime() - start_time);
+	start_time = (StaticTimer::get_localtime(per_thread) - start_time);
 }
 void Timer::restart() {
-	start_time= StaticTimer::get_localtime();
+	start_time= StaticTimer::get_localtime(per_thread);
 	active =true;
 }
 double Timer::get_time() {
 	if (active) {
-		return (StaticTimer::get_localtime() - start_time);
+		return (StaticTimer::get_localtime(per_thread) - start_time);
 	} else {
 		return start_time;
 	}
@@ -198,12 +198,8 @@ StaticTimer::Time StaticTimer::real_time = 0;
 
 #else
 
-struct rusage StaticTimer::res;
-StaticTimer::Time StaticTimer::virtual_ulapse = 0;
-StaticTimer::Time StaticTimer::virtual_slapse = 0;
 StaticTimer::Time StaticTimer::virtual_utime = 0;
 StaticTimer::Time StaticTimer::virtual_stime = 0;
-long StaticTimer::resident_memory = 0;
 
 #endif // _WIN32     _MSC_VER
 
@@ -216,7 +212,7 @@ long StaticTimer::resident_memory = 0;
  */
 void StaticTimer::start() {
 #ifndef _WIN32
-	//    res = std::clock();
+	struct rusage res;
 	getrusage( RUSAGE_SELF, &res );
 
 	virtual_utime = (Time) res.ru_utime.tv_sec +
@@ -234,29 +230,34 @@ void StaticTimer::start() {
 }
 
 
-StaticTimer::Time StaticTimer::get_localtime () {
+StaticTimer::Time StaticTimer::get_localtime (bool per_thread) {
 
 #ifndef _WIN32
 
-
-
-
-	getrusage( RUSAGE_SELF, &res );
-	virtual_ulapse = (Time) res.ru_utime.tv_sec +
-			(Time) res.ru_utime.tv_usec / 1000000.0
+	// The time is computed from local variables so that
+	// timers can be read concurrently by different threads.
+	struct rusage r;
+#ifdef RUSAGE_THREAD
+	// note: the offset (virtual_utime, virtual_stime) is irrelevant
+	// since a timer only calculates differences of times.
+	getrusage( per_thread? RUSAGE_THREAD : RUSAGE_SELF, &r );
+#else
+	getrusage( RUSAGE_SELF, &r );
+#endif
+	Time ulapse = (Time) r.ru_utime.tv_sec +
+			(Time) r.ru_utime.tv_usec / 1000000.0
 			- virtual_utime;
-	virtual_slapse = (Time) res.ru_stime.tv_sec +
-			(Time) res.ru_stime.tv_usec / 1000000.0
+	Time slapse = (Time) r.ru_stime.tv_sec +
+			(Time) r.ru_stime.tv_usec / 1000000.0
 			- virtual_stime;
-	resident_memory = res.ru_ixrss;
 
-	if (resident_memory > 100000) ibex_error(" Timer: memory limit, out of resident memory "  );
+	if (r.ru_ixrss > 100000) ibex_error(" Timer: memory limit, out of resident memory "  );
 
 	//virtual_utime =virtual_ulapse ;
 	//virtual_stime =virtual_slapse ;
 	//local_time += (virtual_ulapse + virtual_slapse);
 
-	local_time = (virtual_ulapse + virtual_slapse);
+	return ulapse + slapse;
 
 #else
 	mygettimeofday( &tp);
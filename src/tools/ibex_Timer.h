@@ -41,10 +41,18 @@ class TimeOutException : public Exception { };
 /** \ingroup tools
  *
  * \brief Timer.
+ *
+ * By default, the time is the CPU time of the whole process. A timer
+ * built with per_thread=true measures instead the CPU time of the thread
+ * that reads it (it must then be started and read by the same thread).
+ * This is the right clock for the time limits of a task run in parallel
+ * with others (e.g., an LP resolution), since the CPU time of the process
+ * grows N times faster with N active threads. On platforms that do not
+ * give access to per-thread times, the CPU time of the process is used.
  */
 class Timer {
  public:
-	Timer();
+	Timer(bool per_thread=false);
 
 	void start();
 	void stop();
@@ -54,6 +62,7 @@ class Timer {
 private:
 	  double start_time;
 	  bool active;
+	  bool per_thread;
 };
 
 /** \ingroup tools
@@ -69,7 +78,7 @@ class StaticTimer {
 
   typedef double Time;
 
-  static Time get_localtime();
+  static Time get_localtime(bool per_thread=false);
 
   static Time local_time;
 
@@ -79,12 +88,8 @@ class StaticTimer {
   static Time real_time;
 
 #else
-  static struct rusage res;
-  static Time virtual_ulapse;
-  static Time virtual_slapse;
   static Time virtual_utime;
   static Time virtual_stime;
-  static long resident_memory;
 #endif
 };
 
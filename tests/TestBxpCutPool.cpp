@@ -0,0 +1,230 @@
+/* ============================================================================
+ * I B E X - Cut Pool Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestBxpCutPool.h"
+
+#include "ibex_BxpCutPool.h"
+#include "ibex_BoxProperties.h"
+#include "ibex_SystemFactory.h"
+
+using namespace std;
+
+namespace ibex {
+
+void TestBxpCutPool::add01() {
+	IntervalVector box(2,Interval(0,1));
+	BxpCutPool pool(next_id(),2);
+	CPPUNIT_ASSERT(pool.nb_cuts(0)==0);
+
+	pool.reset(0,box);
+	pool.add(0,Vector::ones(2),1);
+	pool.add(0,Vector::ones(2),0.5); // duplicate
+	pool.add(0,Vector::ones(2),2);   // duplicate
+	pool.add(0,-Vector::ones(2),1);
+	CPPUNIT_ASSERT(pool.nb_cuts(0)==2);
+	CPPUNIT_ASSERT(pool.nb_cuts(1)==0);
+	// normalized (scaled by 1/2)
+	CPPUNIT_ASSERT(pool.row(0,0)==0.5*Vector::ones(2));
+	CPPUNIT_ASSERT(pool.rhs(0,0)==0.25);
+	CPPUNIT_ASSERT(pool.rhs(0,1)==0.5);
+}
+
+void TestBxpCutPool::add02() {
+	IntervalVector box(2,Interval(0,1));
+	BxpCutPool pool(next_id(),1,0.1,1e-6);
+	pool.reset(0,box);
+
+	double _a[]={1,3};
+	Vector a(2,_a);
+	pool.add(0,a,2);
+	CPPUNIT_ASSERT(pool.nb_cuts(0)==1);
+
+	// same direction, different scaling (x+3y<=1)
+	pool.add(0,3*a,3);
+	CPPUNIT_ASSERT(pool.nb_cuts(0)==1);
+	double rhs=pool.rhs(0,0)/pool.row(0,0)[0];
+	CPPUNIT_ASSERT(rhs>=1 && rhs<1+1e-12);
+
+	// nearly the same direction: x+(3+1e-10)y<=0.5 implies x+3y<=0.5 in the box
+	double _a2[]={1,3+1e-10};
+	pool.add(0,Vector(2,_a2),0.5);
+	CPPUNIT_ASSERT(pool.nb_cuts(0)==1);
+	rhs=pool.rhs(0,0)/pool.row(0,0)[0];
+	CPPUNIT_ASSERT(rhs>=0.5 && rhs<0.5+1e-8);
+
+	// a different direction
+	double _a3[]={1,2};
+	pool.add(0,Vector(2,_a3),1);
+	CPPUNIT_ASSERT(pool.nb_cuts(0)==2);
+
+	// null row
+	pool.add(0,Vector::zeros(2),1);
+	CPPUNIT_ASSERT(pool.nb_cuts(0)==2);
+}
+
+void TestBxpCutPool::add03() {
+	// unbounded box: nearly parallel cuts cannot be merged
+	IntervalVector box(2);
+	BxpCutPool pool(next_id(),1,0.1,1e-6);
+	pool.reset(0,box);
+
+	double _a[]={1,3};
+	pool.add(0,Vector(2,_a),1);
+	double _a2[]={1,3+1e-10};
+	pool.add(0,Vector(2,_a2),0.5);
+	CPPUNIT_ASSERT(pool.nb_cuts(0)==2);
+
+	// duplicates up to a power of 2 can
+	pool.add(0,2*Vector(2,_a),1);
+	CPPUNIT_ASSERT(pool.nb_cuts(0)==2);
+	CPPUNIT_ASSERT(pool.rhs(0,0)/pool.row(0,0)[0]==0.5);
+}
+
+void TestBxpCutPool::copy01() {
+	IntervalVector box(2,Interval(0,1));
+	BoxProperties prop(box);
+	BxpCutPool pool(next_id(),2);
+	pool.reset(0,box);
+	pool.add(0,Vector::ones(2),1);
+
+	BxpCutPool* pool2=pool.copy(box,prop);
+	CPPUNIT_ASSERT(pool2->id==pool.id);
+	CPPUNIT_ASSERT(pool2->nb_cuts(0)==1);
+
+	// new cuts in the copy do not affect the original
+	pool2->reset(0,box);
+	CPPUNIT_ASSERT(pool2->nb_cuts(0)==0);
+	CPPUNIT_ASSERT(pool.nb_cuts(0)==1);
+
+	BxpCutPool* pool3=pool.copy(box,prop);
+	delete pool2;
+	CPPUNIT_ASSERT(pool3->nb_cuts(0)==1);
+	CPPUNIT_ASSERT(pool3->rhs(0,0)==0.5);
+
+	// cuts are removed if the box is not contracted
+	pool3->update(BoxEvent(box,BoxEvent::CHANGE),prop);
+	CPPUNIT_ASSERT(pool3->nb_cuts(0)==0);
+	CPPUNIT_ASSERT(pool.nb_cuts(0)==1);
+	delete pool3;
+}
+
+void TestBxpCutPool::is_uptodate01() {
+	IntervalVector box(2,Interval(0,100));
+	BxpCutPool pool(next_id(),1,0.1);
+	vector<int> vars;
+	vars.push_back(0);
+
+	CPPUNIT_ASSERT(!pool.is_uptodate(0,box,vars));
+	pool.reset(0,box);
+	CPPUNIT_ASSERT(pool.is_uptodate(0,box,vars));
+
+	box[0]=Interval(0,91);
+	CPPUNIT_ASSERT(pool.is_uptodate(0,box,vars));
+
+	box[0]=Interval(0,89);
+	CPPUNIT_ASSERT(!pool.is_uptodate(0,box,vars));
+
+	// the constraint does not depend on the second variable
+	box[0]=Interval(0,100);
+	box[1]=Interval(0,1);
+	CPPUNIT_ASSERT(pool.is_uptodate(0,box,vars));
+
+	// not a subset
+	box[1]=Interval(0,101);
+	CPPUNIT_ASSERT(!pool.is_uptodate(0,box,vars));
+}
+
+void TestBxpCutPool::xtaylor01() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_ctr(sqr(x)+sqr(y)<=1);
+	fac.add_ctr(sqr(x)-y<=0);
+	System sys(fac);
+
+	LinearizerXTaylor lr(sys, LinearizerXTaylor::RELAX, LinearizerXTaylor::INF, LinearizerXTaylor::HANSEN, true);
+	LPSolver lp(2);
+
+	IntervalVector box(2,Interval(-2,2));
+	BoxProperties prop(box);
+	lr.add_property(box,prop);
+	CPPUNIT_ASSERT(prop[lr.get_cut_pool_id()]!=NULL);
+	BxpCutPool& pool=*((BxpCutPool*) prop[lr.get_cut_pool_id()]);
+
+	int n1=lr.linearize(box,lp,prop);
+	CPPUNIT_ASSERT(n1==2);
+	CPPUNIT_ASSERT(pool.nb_cuts(0)==1);
+	CPPUNIT_ASSERT(pool.nb_cuts(1)==1);
+	Vector a0=pool.row(0,0);
+	Vector a1=pool.row(1,0);
+
+	// slight contraction: the same cuts are used
+	box[0]=Interval(-1.9,2);
+	lp.clean_ctrs();
+	CPPUNIT_ASSERT(lr.linearize(box,lp,prop)==2);
+	CPPUNIT_ASSERT(pool.row(0,0)==a0);
+	CPPUNIT_ASSERT(pool.row(1,0)==a1);
+	CPPUNIT_ASSERT(lp.get_nb_rows()==2+2);
+
+	// large contraction on x: both constraints are linearized again
+	box[0]=Interval(0,2);
+	lp.clean_ctrs();
+	CPPUNIT_ASSERT(lr.linearize(box,lp,prop)==2);
+	CPPUNIT_ASSERT(pool.row(0,0)!=a0);
+	CPPUNIT_ASSERT(pool.row(1,0)!=a1);
+	a0=pool.row(0,0);
+	a1=pool.row(1,0);
+
+	// large contraction on y: the new cuts (from the corner (0,0))
+	// are satisfied in the whole box and not stored.
+	box[1]=Interval(0,2);
+	lp.clean_ctrs();
+	CPPUNIT_ASSERT(lr.linearize(box,lp,prop)==0);
+	CPPUNIT_ASSERT(pool.nb_cuts(0)==0);
+	CPPUNIT_ASSERT(pool.nb_cuts(1)==0);
+}
+
+void TestBxpCutPool::combo01() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_ctr(sqr(x)+sqr(y)<=1);
+	System sys(fac);
+
+	LinearizerCombo lr(sys, LinearizerCombo::XNEWTON, true);
+	LPSolver lp(2);
+
+	IntervalVector box(2,Interval(-2,2));
+	BoxProperties prop(box);
+	lr.add_property(box,prop);
+
+	BxpCutPool* pool=NULL;
+	for (BoxProperties::const_iterator it=prop.begin(); it!=prop.end(); it++) {
+		if (dynamic_cast<BxpCutPool*>(it->second)) pool=(BxpCutPool*) it->second;
+	}
+	CPPUNIT_ASSERT(pool!=NULL);
+
+	int n1=lr.linearize(box,lp,prop);
+	CPPUNIT_ASSERT(n1>0);
+	CPPUNIT_ASSERT(pool->nb_cuts(0)==n1);
+
+	// slight contraction: the cuts are reused
+	Vector a0=pool->row(0,0);
+	box[0]=Interval(-1.9,2);
+	lp.clean_ctrs();
+	CPPUNIT_ASSERT(lr.linearize(box,lp,prop)>0);
+	CPPUNIT_ASSERT(pool->row(0,0)==a0);
+}
+
+} // end namespace
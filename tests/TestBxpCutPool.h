@@ -0,0 +1,52 @@
+/* ============================================================================
+ * I B E X - Cut Pool Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_BXP_CUT_POOL_H__
+#define __TEST_BXP_CUT_POOL_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "ibex_LinearizerXTaylor.h"
+#include "ibex_LinearizerCombo.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestBxpCutPool : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestBxpCutPool);
+	CPPUNIT_TEST(add01);
+	CPPUNIT_TEST(add02);
+	CPPUNIT_TEST(add03);
+	CPPUNIT_TEST(copy01);
+	CPPUNIT_TEST(is_uptodate01);
+#ifndef __IBEX_NO_LP_SOLVER__
+	CPPUNIT_TEST(xtaylor01);
+	CPPUNIT_TEST(combo01);
+#endif
+	CPPUNIT_TEST_SUITE_END();
+
+	void add01();
+	void add02();
+	void add03();
+	void copy01();
+	void is_uptodate01();
+	void xtaylor01();
+	void combo01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestBxpCutPool);
+
+} // end namespace
+
+#endif // __TEST_BXP_CUT_POOL_H__
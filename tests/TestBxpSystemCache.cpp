@@ -13,6 +13,9 @@
 
 #include "ibex_BxpSystemCache.h"
 #include "ibex_SystemFactory.h"
+#include "ibex_Bisection.h"
+#include "ibex_LinearizerXTaylor.h"
+#include "ibex_SmearFunction.h"
 
 using namespace std;
 
@@ -169,6 +172,86 @@ void TestBxpSystemCache::ctrs_jacobian() {
 	CPPUNIT_ASSERT(res[1][1]==Interval(200,2*189));
 }
 
+void TestBxpSystemCache::ctrs_jacobian_rows() {
+	const ExprSymbol& x=ExprSymbol::new_();
+	const ExprSymbol& y=ExprSymbol::new_();
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_ctr(sqr(x)=0);
+	fac.add_ctr(sqr(y)=0);
+	fac.add_ctr(x*y=0);
+	System sys(fac);
+
+	BxpSystemCache cache(sys,0);
+	IntervalVector box(sys.nb_var);
+	BoxProperties prop(box);
+
+	box[0]=Interval(0,10);
+	box[1]=Interval(1,2);
+	cache.update(BoxEvent(box,BoxEvent::CONTRACT),prop);
+	CPPUNIT_ASSERT(!cache.is_jacobian_uptodate(0));
+
+	BitSet rows=BitSet::singleton(3,1);
+	IntervalMatrix J=cache.ctrs_jacobian(rows);
+	CPPUNIT_ASSERT(J.nb_rows()==1);
+	CPPUNIT_ASSERT(J[0][1]==Interval(2,4));
+	CPPUNIT_ASSERT(!cache.is_jacobian_uptodate(0));
+	CPPUNIT_ASSERT(cache.is_jacobian_uptodate(1));
+	CPPUNIT_ASSERT(!cache.is_jacobian_uptodate(2));
+
+	J=cache.ctrs_jacobian();
+	CPPUNIT_ASSERT(cache.is_jacobian_uptodate(0));
+	CPPUNIT_ASSERT(cache.is_jacobian_uptodate(2));
+
+	// only the rows depending on x are out of date
+	box[0]=Interval(0,5);
+	cache.update(BoxEvent(box,BoxEvent::CONTRACT),prop);
+	CPPUNIT_ASSERT(!cache.is_jacobian_uptodate(0));
+	CPPUNIT_ASSERT(cache.is_jacobian_uptodate(1));
+	CPPUNIT_ASSERT(!cache.is_jacobian_uptodate(2));
+
+	J=cache.ctrs_jacobian();
+	CPPUNIT_ASSERT(J[0][0]==Interval(0,10));
+	CPPUNIT_ASSERT(J[1][1]==Interval(2,4));
+	CPPUNIT_ASSERT(J[2][0]==Interval(1,2));
+	CPPUNIT_ASSERT(J[2][1]==Interval(0,5));
+	CPPUNIT_ASSERT(J==sys.f_ctrs.jacobian(box));
+}
+
+void TestBxpSystemCache::ctrs_jacobian_bisect() {
+	const ExprSymbol& x=ExprSymbol::new_();
+	const ExprSymbol& y=ExprSymbol::new_();
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_ctr(sqr(x)=0);
+	fac.add_ctr(sqr(y)=0);
+	System sys(fac);
+
+	IntervalVector box(2,Interval(1,3));
+	BoxProperties prop(box);
+	prop.add(new BxpSystemCache(sys,0));
+	prop.update(BoxEvent(box,BoxEvent::CHANGE));
+
+	BxpSystemCache* cache=(BxpSystemCache*) prop[BxpSystemCache::get_id(sys)];
+	cache->ctrs_jacobian();
+
+	std::pair<IntervalVector,IntervalVector> p=box.bisect(0);
+	BoxProperties lprop(p.first);
+	BoxProperties rprop(p.second);
+	prop.update_bisect(Bisection(box,BisectionPoint(0,0.5,true),p.first,p.second),lprop,rprop);
+
+	BxpSystemCache* lcache=(BxpSystemCache*) lprop[BxpSystemCache::get_id(sys)];
+	CPPUNIT_ASSERT(lcache!=NULL);
+	CPPUNIT_ASSERT(!lcache->is_jacobian_uptodate(0));
+	CPPUNIT_ASSERT(lcache->is_jacobian_uptodate(1));
+
+	IntervalMatrix J=lcache->ctrs_jacobian();
+	CPPUNIT_ASSERT(J[0][0]==Interval(2,4));
+	CPPUNIT_ASSERT(J[1][1]==Interval(2,6));
+}
+
 void TestBxpSystemCache::active_ctrs() {
 	const ExprSymbol& x=ExprSymbol::new_();
 	SystemFactory fac;
@@ -321,5 +404,31 @@ void TestBxpSystemCache::active_ctrs_jacobian() {
 	CPPUNIT_ASSERT(J[1][1]==2*Interval(0,8));
 }
 
-} // end namespace
+void TestBxpSystemCache::consumers() {
+	const ExprSymbol& x=ExprSymbol::new_();
+	const ExprSymbol& y=ExprSymbol::new_();
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_ctr(sqr(x)+sqr(y)<=1);
+	System sys(fac);
+
+	IntervalVector box(sys.nb_var,Interval(-1,1));
 
+	// the smear bisector only reads the cache
+	SmearMax smear(sys,1e-8);
+	BoxProperties prop(box);
+	smear.add_property(box,prop);
+	CPPUNIT_ASSERT(!prop[BxpSystemCache::get_id(sys)]);
+
+	// the jacobian matrix is not used with the Hansen slope
+	LinearizerXTaylor lr_hansen(sys, LinearizerXTaylor::RELAX, LinearizerXTaylor::RANDOM, LinearizerXTaylor::HANSEN);
+	lr_hansen.add_property(box,prop);
+	CPPUNIT_ASSERT(!prop[BxpSystemCache::get_id(sys)]);
+
+	LinearizerXTaylor lr_taylor(sys, LinearizerXTaylor::RELAX, LinearizerXTaylor::RANDOM, LinearizerXTaylor::TAYLOR);
+	lr_taylor.add_property(box,prop);
+	CPPUNIT_ASSERT(prop[BxpSystemCache::get_id(sys)]);
+}
+
+} // end namespace
@@ -28,20 +28,26 @@ public:
 	CPPUNIT_TEST(goal_gradient01);
 	CPPUNIT_TEST(ctrs_eval);
 	CPPUNIT_TEST(ctrs_jacobian);
+	CPPUNIT_TEST(ctrs_jacobian_rows);
+	CPPUNIT_TEST(ctrs_jacobian_bisect);
 	CPPUNIT_TEST(active_ctrs);
 	CPPUNIT_TEST(is_inner);
 	CPPUNIT_TEST(active_ctrs_eval);
 	CPPUNIT_TEST(active_ctrs_jacobian);
+	CPPUNIT_TEST(consumers);
 	CPPUNIT_TEST_SUITE_END();
 
 	void goal_eval01();
 	void goal_gradient01();
 	void ctrs_eval();
 	void ctrs_jacobian();
+	void ctrs_jacobian_rows();
+	void ctrs_jacobian_bisect();
 	void active_ctrs();
 	void is_inner();
 	void active_ctrs_eval();
 	void active_ctrs_jacobian();
+	void consumers();
 
 };
 
@@ -0,0 +1,167 @@
+/* ============================================================================
+ * I B E X - CellSpill Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestCellSpill.h"
+#include "ibex_CellStack.h"
+#include "ibex_CellList.h"
+#include "ibex_CellSpill.h"
+#include "ibex_Id.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// a property that is stored on disk
+class BxpCounter : public Bxp {
+public:
+	BxpCounter() : Bxp(id), n(0) { }
+
+	Bxp* copy(const IntervalVector& box, const BoxProperties& prop) const {
+		BxpCounter* b=new BxpCounter();
+		b->n=n;
+		return b;
+	}
+
+	void update(const BoxEvent& event, const BoxProperties& prop) { }
+
+	void write(std::ostream& os) const {
+		os.write((char*) &n, sizeof(n));
+	}
+
+	void read(std::istream& is) {
+		is.read((char*) &n, sizeof(n));
+	}
+
+	bool storable() const {
+		return true;
+	}
+
+	int n;
+	static const long id;
+};
+
+const long BxpCounter::id = next_id();
+
+// push/pop the same sequence in two buffers
+// and check the cells are popped in the same order
+void check_same_order(CellBuffer& b1, CellBuffer& b2) {
+	int k=0;
+	for (int i=0; i<500; i++) {
+		// more pushes than pops in the first half
+		int nb_push = i<250? 3 : (i%3==0? 1 : 0);
+		for (int j=0; j<nb_push; j++) {
+			Cell* c1=new Cell(IntervalVector(2,Interval(k,k+1)), k%2, k);
+			Cell* c2=new Cell(*c1);
+			b1.push(c1);
+			b2.push(c2);
+			k++;
+		}
+		CPPUNIT_ASSERT(b1.size()==b2.size());
+		if (!b1.empty()) {
+			Cell* c1=b1.pop();
+			Cell* c2=b2.pop();
+			CPPUNIT_ASSERT(c1->box==c2->box);
+			CPPUNIT_ASSERT(c1->bisected_var==c2->bisected_var);
+			CPPUNIT_ASSERT(c1->depth==c2->depth);
+			delete c1;
+			delete c2;
+		}
+	}
+	while (!b1.empty()) {
+		CPPUNIT_ASSERT(!b2.empty());
+		Cell* c1=b1.pop();
+		Cell* c2=b2.pop();
+		CPPUNIT_ASSERT(c1->box==c2->box);
+		delete c1;
+		delete c2;
+	}
+	CPPUNIT_ASSERT(b2.empty());
+	CPPUNIT_ASSERT(b1.size()==0);
+}
+
+} // end anonymous namespace
+
+void TestCellSpill::stack01() {
+	CellStack s1,s2;
+	s2.set_spill(10);
+	check_same_order(s1,s2);
+}
+
+void TestCellSpill::list01() {
+	CellList l1,l2;
+	l2.set_spill(10);
+	check_same_order(l1,l2);
+}
+
+void TestCellSpill::prop01() {
+	CellStack s;
+	s.set_spill(4);
+	for (int i=0; i<20; i++) {
+		Cell* c=new Cell(IntervalVector(3,Interval(i,i+1)));
+		c->prop.add(new BxpCounter());
+		((BxpCounter*) c->prop[BxpCounter::id])->n=i;
+		s.push(c);
+	}
+	CPPUNIT_ASSERT(s.size()==20);
+	for (int i=19; i>=0; i--) {
+		Cell* c=s.pop();
+		check(c->box, IntervalVector(3,Interval(i,i+1)));
+		BxpCounter* p=(BxpCounter*) c->prop[BxpCounter::id];
+		CPPUNIT_ASSERT(p!=NULL);
+		CPPUNIT_ASSERT(p->n==i);
+		delete c;
+	}
+	CPPUNIT_ASSERT(s.empty());
+}
+
+void TestCellSpill::compact01() {
+	CellSpill spill;
+	// about 3MB: 100 batches of 100 cells
+	for (int k=0; k<100; k++) {
+		vector<Cell*> cells;
+		for (int i=0; i<100; i++)
+			cells.push_back(new Cell(IntervalVector(20,Interval(k,k+i))));
+		spill.write(cells, k);
+	}
+	long long size=spill.file_size();
+	CPPUNIT_ASSERT(size>2*CellSpill::compact_min_size);
+	CPPUNIT_ASSERT(spill.live_size()==size);
+
+	// the batches at the beginning of the file are read first
+	vector<Cell*> cells;
+	for (int k=0; k<60; k++) {
+		spill.read(cells);
+		CPPUNIT_ASSERT(cells.size()==100);
+		CPPUNIT_ASSERT(cells[0]->box[0]==Interval(k,k));
+		for (vector<Cell*>::iterator it=cells.begin(); it!=cells.end(); ++it) delete *it;
+		cells.clear();
+	}
+	CPPUNIT_ASSERT(spill.live_size()==size*40/100);
+	// compacted once the live data is below half of the file
+	CPPUNIT_ASSERT(spill.file_size()<size);
+	CPPUNIT_ASSERT(spill.file_size()<spill.live_size()/CellSpill::compact_ratio);
+
+	// the moved batches are intact
+	for (int k=60; k<100; k++) {
+		spill.read(cells);
+		CPPUNIT_ASSERT(cells.size()==100);
+		for (int i=0; i<100; i++)
+			check(cells[i]->box, IntervalVector(20,Interval(k,k+i)));
+		for (vector<Cell*>::iterator it=cells.begin(); it!=cells.end(); ++it) delete *it;
+		cells.clear();
+	}
+	CPPUNIT_ASSERT(spill.empty());
+	CPPUNIT_ASSERT(spill.live_size()==0);
+	CPPUNIT_ASSERT(spill.file_size()<=CellSpill::compact_min_size);
+}
+
+} // namespace ibex
@@ -0,0 +1,41 @@
+/* ============================================================================
+ * I B E X - CellSpill Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_CELL_SPILL_H__
+#define __TEST_CELL_SPILL_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestCellSpill : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestCellSpill);
+	CPPUNIT_TEST(stack01);
+	CPPUNIT_TEST(list01);
+	CPPUNIT_TEST(prop01);
+	CPPUNIT_TEST(compact01);
+	CPPUNIT_TEST_SUITE_END();
+
+	void stack01();
+	void list01();
+	void prop01();
+	void compact01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCellSpill);
+
+} // namespace ibex
+
+#endif // __TEST_CELL_SPILL_H__
@@ -531,6 +531,26 @@ void TestCov::test_covSolverData(ScenarioType scenario, CovSolverData& cov) {
 	}
 }
 
+void TestCov::test_covSolverDataReader(const CovSolverData& cov, const CovSolverDataReader& reader) {
+	CPPUNIT_ASSERT(reader.n == cov.n);
+	CPPUNIT_ASSERT(reader.size() == cov.size());
+	CPPUNIT_ASSERT(reader.nb_eq() == cov.nb_eq());
+	CPPUNIT_ASSERT(reader.nb_ineq() == cov.nb_ineq());
+
+	for (size_t i=0; i<cov.size(); i++) {
+		CPPUNIT_ASSERT(reader.status(i) == cov.status(i));
+		CPPUNIT_ASSERT(reader[i] == cov[i]);
+	}
+
+	CPPUNIT_ASSERT(reader.nb_solution() == cov.nb_solution());
+	CPPUNIT_ASSERT(reader.nb_boundary() == cov.nb_boundary());
+	CPPUNIT_ASSERT(reader.nb_unknown() == cov.nb_unknown());
+	CPPUNIT_ASSERT(reader.nb_pending() == cov.nb_pending());
+	CPPUNIT_ASSERT(reader.solver_status() == cov.solver_status());
+	CPPUNIT_ASSERT(reader.time() == cov.time());
+	CPPUNIT_ASSERT(reader.nb_cells() == cov.nb_cells());
+}
+
 /*=============================================================================================*/
 
 Cov* TestCov::build_cov(ScenarioType scenario) {
@@ -1041,3 +1061,105 @@ void TestCov::write_covSolverDatafile(ScenarioType scenario) {
 
 	free(tmpname);
 }
+
+void TestCov::stream_covSolverDatafile(ScenarioType scenario) {
+	char *tmpname = strdup("/tmp/tmpfileXXXXXX");
+	mkstemp(tmpname);
+
+	size_t nb_eq = (scenario==INEQ_EQ_ONLY || scenario==INEQ_HALF_BALL) ? 0 : m;
+
+	CovManifold::BoundaryType boundary_type = (scenario==INEQ_EQ_ONLY || scenario==EQ_ONLY) ? CovManifold::EQU_ONLY : CovManifold::HALF_BALL;
+
+	vector<string> var_names;
+	for (size_t i=0; i<n; i++)
+		var_names.push_back(solver_var_names[i]);
+
+	CovSolverDataWriter* writer = new CovSolverDataWriter(tmpname, n, nb_eq, nb_ineq, boundary_type, var_names, 0);
+
+	// the file is valid from the beginning
+	CovSolverData cov0(tmpname);
+	CPPUNIT_ASSERT(cov0.size()==0);
+
+	vector<IntervalVector> b=boxes();
+
+	int isol=0;
+	int ibnd=0;
+	for (size_t i=0; i<N; i++) {
+		if (is_sol[i]) {
+			if (scenario==INEQ_EQ_ONLY || scenario==INEQ_HALF_BALL)
+				writer->add_inner(b[i]);
+			else {
+				BitSet bitset(n);
+				IntervalVector unicity=b[sol[isol]];
+				unicity.inflate(unicity_infl);
+
+				for (size_t j=0; j<n-m; j++)
+					bitset.add(varset_sol[isol][j]);
+				writer->add_solution(b[i], unicity, VarSet(n,bitset,false));
+				isol++;
+			}
+		} else if (is_bnd[i]) {
+			if (nb_eq>0 && m<n) {
+				BitSet bitset(n);
+				for (size_t j=0; j<n-m; j++)
+					bitset.add(varset_bnd[ibnd][j]);
+				writer->add_boundary(b[i], VarSet(n,bitset,false));
+				ibnd++;
+			} else
+				writer->add_boundary(b[i]);
+		} else if (is_pen[i]) {
+			writer->add_pending(b[i]);
+		} else
+			writer->add_unknown(b[i]);
+
+		CPPUNIT_ASSERT(writer->last()==b[i]);
+
+		if (i==N/2) {
+			writer->checkpoint();
+			CovSolverData cov1(tmpname);
+			CPPUNIT_ASSERT(cov1.size()==N/2+1);
+			for (size_t j=0; j<=N/2; j++)
+				CPPUNIT_ASSERT(cov1[j]==b[j]);
+		}
+	}
+
+	writer->set_time(solver_time);
+	writer->set_solver_status(solver_status);
+	writer->set_nb_cells(solver_nb_cells);
+	writer->close();
+
+	CPPUNIT_ASSERT(writer->size()==N);
+	CPPUNIT_ASSERT(writer->nb_pending()==npen);
+	CPPUNIT_ASSERT(writer->nb_unknown()==nunk);
+	delete writer;
+
+	CovSolverData cov2(tmpname);
+	test_covSolverData(scenario, cov2);
+
+	CovSolverDataReader reader(tmpname);
+	test_covSolverDataReader(cov2, reader);
+
+	free(tmpname);
+}
+
+void TestCov::map_covSolverDatafile(ScenarioType scenario) {
+	char *tmpname = strdup("/tmp/tmpfileXXXXXX");
+	mkstemp(tmpname);
+
+	CovSolverData* cov=build_covSolverData(scenario);
+	cov->save(tmpname);
+
+	CovSolverDataReader reader(tmpname);
+	test_covSolverDataReader(*cov, reader);
+
+	for (size_t i=0; i<n; i++)
+		CPPUNIT_ASSERT(reader.var_names()[i] == solver_var_names[i]);
+
+	// bounds are read in place
+	const double* x=reader.box(N-1);
+	CPPUNIT_ASSERT(x[0]==0 && x[1]==N-1);
+
+	delete cov;
+
+	free(tmpname);
+}
@@ -26,6 +26,8 @@
 #include "ibex_CovIBUList.h"
 #include "ibex_CovManifold.h"
 #include "ibex_CovSolverData.h"
+#include "ibex_CovSolverDataWriter.h"
+#include "ibex_CovSolverDataReader.h"
 #include "ibex_Solver.h"
 
 using namespace ibex;
@@ -63,6 +65,8 @@ public:
 	CPPUNIT_TEST(read_covSolverDatafile1_scenario1);
 	CPPUNIT_TEST(read_covSolverDatafile2_scenario1);
 	CPPUNIT_TEST(write_covSolverDatafile_scenario1);
+	CPPUNIT_TEST(stream_covSolverDatafile_scenario1);
+	CPPUNIT_TEST(map_covSolverDatafile_scenario1);
 
 	CPPUNIT_TEST(covfac_scenario2);
 	CPPUNIT_TEST(read_covfile_scenario2);
@@ -92,6 +96,8 @@ public:
 	CPPUNIT_TEST(read_covSolverDatafile1_scenario2);
 	CPPUNIT_TEST(read_covSolverDatafile2_scenario2);
 	CPPUNIT_TEST(write_covSolverDatafile_scenario2);
+	CPPUNIT_TEST(stream_covSolverDatafile_scenario2);
+	CPPUNIT_TEST(map_covSolverDatafile_scenario2);
 
 	CPPUNIT_TEST(covfac_scenario3);
 	CPPUNIT_TEST(read_covfile_scenario3);
@@ -121,6 +127,8 @@ public:
 	CPPUNIT_TEST(read_covSolverDatafile1_scenario3);
 	CPPUNIT_TEST(read_covSolverDatafile2_scenario3);
 	CPPUNIT_TEST(write_covSolverDatafile_scenario3);
+	CPPUNIT_TEST(stream_covSolverDatafile_scenario3);
+	CPPUNIT_TEST(map_covSolverDatafile_scenario3);
 
 	CPPUNIT_TEST(covfac_scenario4);
 	CPPUNIT_TEST(read_covfile_scenario4);
@@ -150,6 +158,8 @@ public:
 	CPPUNIT_TEST(read_covSolverDatafile1_scenario4);
 	CPPUNIT_TEST(read_covSolverDatafile2_scenario4);
 	CPPUNIT_TEST(write_covSolverDatafile_scenario4);
+	CPPUNIT_TEST(stream_covSolverDatafile_scenario4);
+	CPPUNIT_TEST(map_covSolverDatafile_scenario4);
 
 	CPPUNIT_TEST_SUITE_END();
 
@@ -174,6 +184,7 @@ private:
 	static void test_covIBUlist(ScenarioType scenario, CovIBUList& cov);
 	static void test_covManifold(ScenarioType scenario, CovManifold& cov);
 	static void test_covSolverData(ScenarioType scenario, CovSolverData& cov);
+	static void test_covSolverDataReader(const CovSolverData& cov, const CovSolverDataReader& reader);
 
 	static Cov* build_cov(ScenarioType scenario);
 	static CovList* build_covlist(ScenarioType scenario);
@@ -211,6 +222,8 @@ private:
 	static void read_covSolverDatafile1(ScenarioType scenario);
 	static void read_covSolverDatafile2(ScenarioType scenario);
 	static void write_covSolverDatafile(ScenarioType scenario);
+	static void stream_covSolverDatafile(ScenarioType scenario);
+	static void map_covSolverDatafile(ScenarioType scenario);
 
 	static void covfac_scenario1()                  { covfac(INEQ_EQ_ONLY); }
 	static void read_covfile_scenario1()            { read_covfile(INEQ_EQ_ONLY); }
@@ -241,6 +254,8 @@ private:
 	static void read_covSolverDatafile1_scenario1() { read_covSolverDatafile1(INEQ_EQ_ONLY); }
 	static void read_covSolverDatafile2_scenario1() { read_covSolverDatafile2(INEQ_EQ_ONLY); }
 	static void write_covSolverDatafile_scenario1() { write_covSolverDatafile(INEQ_EQ_ONLY); }
+	static void stream_covSolverDatafile_scenario1(){ stream_covSolverDatafile(INEQ_EQ_ONLY); }
+	static void map_covSolverDatafile_scenario1()   { map_covSolverDatafile(INEQ_EQ_ONLY); }
 
 	static void covfac_scenario2()                  { covfac(INEQ_HALF_BALL); }
 	static void read_covfile_scenario2()            { read_covfile(INEQ_HALF_BALL); }
@@ -271,6 +286,8 @@ private:
 	static void read_covSolverDatafile1_scenario2() { read_covSolverDatafile1(INEQ_HALF_BALL); }
 	static void read_covSolverDatafile2_scenario2() { read_covSolverDatafile2(INEQ_HALF_BALL); }
 	static void write_covSolverDatafile_scenario2() { write_covSolverDatafile(INEQ_HALF_BALL); }
+	static void stream_covSolverDatafile_scenario2(){ stream_covSolverDatafile(INEQ_HALF_BALL); }
+	static void map_covSolverDatafile_scenario2()   { map_covSolverDatafile(INEQ_HALF_BALL); }
 
 	static void covfac_scenario3()                  { covfac(EQ_ONLY); }
 	static void read_covfile_scenario3()            { read_covfile(EQ_ONLY); }
@@ -301,6 +318,8 @@ private:
 	static void read_covSolverDatafile1_scenario3() { read_covSolverDatafile1(EQ_ONLY); }
 	static void read_covSolverDatafile2_scenario3() { read_covSolverDatafile2(EQ_ONLY); }
 	static void write_covSolverDatafile_scenario3() { write_covSolverDatafile(EQ_ONLY); }
+	static void stream_covSolverDatafile_scenario3(){ stream_covSolverDatafile(EQ_ONLY); }
+	static void map_covSolverDatafile_scenario3()   { map_covSolverDatafile(EQ_ONLY); }
 
 	static void covfac_scenario4()                  { covfac(HALF_BALL); }
 	static void read_covfile_scenario4()            { read_covfile(HALF_BALL); }
@@ -331,6 +350,8 @@ private:
 	static void read_covSolverDatafile1_scenario4() { read_covSolverDatafile1(HALF_BALL); }
 	static void read_covSolverDatafile2_scenario4() { read_covSolverDatafile2(HALF_BALL); }
 	static void write_covSolverDatafile_scenario4() { write_covSolverDatafile(HALF_BALL); }
+	static void stream_covSolverDatafile_scenario4(){ stream_covSolverDatafile(HALF_BALL); }
+	static void map_covSolverDatafile_scenario4()   { map_covSolverDatafile(HALF_BALL); }
 
 	static const size_t n = 3;
 	static const size_t m = 1;
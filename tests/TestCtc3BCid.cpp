@@ -0,0 +1,146 @@
+/* ============================================================================
+ * I B E X - Ctc3BCid Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestCtc3BCid.h"
+#include "ibex_CtcAcid.h"
+#include "ibex_CtcHC4.h"
+#include "ibex_SystemFactory.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// x^2+y^2=1, y=x^2 (two solutions)
+System* circle_parabola() {
+	const ExprSymbol& x=ExprSymbol::new_();
+	const ExprSymbol& y=ExprSymbol::new_();
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_ctr(sqr(x)+sqr(y)=1);
+	fac.add_ctr(y=sqr(x));
+	return new System(fac);
+}
+
+// Brown-like system: x_i + sum x_j = n+1, prod x_j = 1
+System* brown(int n) {
+	const ExprSymbol& x=ExprSymbol::new_(Dim::col_vec(n));
+	SystemFactory fac;
+	fac.add_var(x);
+	for (int i=0; i<n-1; i++) {
+		const ExprNode* e=&x[0];
+		for (int j=1; j<n; j++) e=&(*e+x[j]);
+		fac.add_ctr(*e+x[i]=n+1);
+	}
+	const ExprNode* p=&x[0];
+	for (int j=1; j<n; j++) p=&(*p*x[j]);
+	fac.add_ctr(*p=1);
+	return new System(fac);
+}
+
+}
+
+void TestCtc3BCid::shave01() {
+	System* sys=circle_parabola();
+	CtcHC4 hc4(*sys);
+	Ctc3BCid cid(hc4);
+
+	IntervalVector box(2,Interval(-10,10));
+	IntervalVector box2(box);
+	hc4.contract(box2);
+	cid.contract(box);
+
+	double y0=(::sqrt(5)-1)/2;
+	Vector sol(2);
+	sol[0]=::sqrt(y0);
+	sol[1]=y0;
+	CPPUNIT_ASSERT(box.contains(sol));
+	sol[0]=-sol[0];
+	CPPUNIT_ASSERT(box.contains(sol));
+	CPPUNIT_ASSERT(box.is_strict_subset(box2));
+	CPPUNIT_ASSERT(box[1].lb()>0);
+
+	delete sys;
+}
+
+void TestCtc3BCid::threads01() {
+	System* sys=brown(5);
+	CtcHC4 hc4(*sys);
+	Ctc3BCid cid(hc4,10,3);
+
+	System* copies[3];
+	Array<Ctc> thread_ctcs(3);
+	for (int i=0; i<3; i++) {
+		copies[i]=new System(*sys);
+		thread_ctcs.set_ref(i, *new CtcHC4(*copies[i]));
+	}
+
+	Ctc3BCid pcid(hc4,10,3);
+	pcid.set_thread_ctcs(thread_ctcs);
+
+	srand(1);
+	for (int k=0; k<20; k++) {
+		IntervalVector box(5);
+		for (int i=0; i<5; i++) {
+			double a=-2+4*((double) rand()/RAND_MAX);
+			box[i]=Interval(a,a+1+2*((double) rand()/RAND_MAX));
+		}
+		IntervalVector box2(box);
+		cid.contract(box);
+		pcid.contract(box2);
+		CPPUNIT_ASSERT(box==box2 || (box.is_empty() && box2.is_empty()));
+	}
+
+	for (int i=0; i<3; i++) {
+		delete &thread_ctcs[i];
+		delete copies[i];
+	}
+	delete sys;
+}
+
+void TestCtc3BCid::threads02() {
+	System* sys=brown(4);
+	CtcHC4 hc4(*sys);
+	CtcAcid acid(*sys,hc4);
+
+	System* copies[2];
+	Array<Ctc> thread_ctcs(2);
+	for (int i=0; i<2; i++) {
+		copies[i]=new System(*sys);
+		thread_ctcs.set_ref(i, *new CtcHC4(*copies[i]));
+	}
+
+	CtcAcid pacid(*sys,hc4);
+	pacid.set_thread_ctcs(thread_ctcs);
+
+	IntervalVector box(4,Interval(-10,10));
+	IntervalVector box2(box);
+
+	// note: ACID adapts the number of handled variables
+	// to the previous calls; this is deterministic.
+	for (int k=0; k<60; k++) {
+		IntervalVector b(box);
+		b[k%4]=Interval(-10+0.1*k,10);
+		IntervalVector b2(b);
+		acid.contract(b);
+		pacid.contract(b2);
+		CPPUNIT_ASSERT(b==b2 || (b.is_empty() && b2.is_empty()));
+	}
+
+	for (int i=0; i<2; i++) {
+		delete &thread_ctcs[i];
+		delete copies[i];
+	}
+	delete sys;
+}
+
+} // namespace ibex
@@ -0,0 +1,121 @@
+//============================================================================
+//                                  I B E X
+// File        : TestCtcAdaptiveCompo.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "TestCtcAdaptiveCompo.h"
+#include "ibex_CtcAdaptiveCompo.h"
+#include "ibex_CtcFwdBwd.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * An expensive contractor (100 evaluations of f per call)
+ * that only bisects the first component if "halve" is true.
+ */
+class CtcSlow : public Ctc {
+public:
+	CtcSlow(Function& f, bool halve) : Ctc(f.nb_var()), f(f), halve(halve) { }
+
+	void contract(IntervalVector& box) {
+		for (int k=0; k<100; k++) f.eval(box);
+		if (halve) box[0] = Interval(box[0].lb(), box[0].mid());
+	}
+
+	Function& f;
+	bool halve;
+};
+
+}
+
+void TestCtcAdaptiveCompo::skip() {
+	Variable x,y;
+	Function f(x,y,x-y);
+	CtcFwdBwd c1(f);
+	CtcSlow c2(f,false);
+	CtcAdaptiveCompo c(c1,c2);
+
+	double _box[][2] = {{0,1},{0,2}};
+	for (int k=0; k<1000; k++) {
+		IntervalVector box(2,_box);
+		c.contract(box);
+		CPPUNIT_ASSERT(box[1]==Interval(0,1));
+	}
+
+	CPPUNIT_ASSERT(c.nb_calls(0)==1000);
+	CPPUNIT_ASSERT(c.nb_skips(0)==0);
+	CPPUNIT_ASSERT(c.nb_calls(1)+c.nb_skips(1)==1000);
+	// the useless contractor is only called for exploration
+	CPPUNIT_ASSERT(c.nb_calls(1)>=CtcAdaptiveCompo::min_calls);
+	CPPUNIT_ASSERT(c.nb_skips(1)>900);
+
+	c.reset();
+	CPPUNIT_ASSERT(c.nb_calls(1)==0);
+}
+
+void TestCtcAdaptiveCompo::no_skip() {
+	Variable x,y;
+	Function f(x,y,x-y);
+	CtcFwdBwd c1(f);
+	CtcSlow c2(f,true);
+	CtcAdaptiveCompo c(c1,c2);
+
+	double _box[][2] = {{0,1},{0,2}};
+	for (int k=0; k<200; k++) {
+		IntervalVector box(2,_box);
+		c.contract(box);
+		CPPUNIT_ASSERT(box[0]==Interval(0,0.5));
+	}
+
+	CPPUNIT_ASSERT(c.nb_calls(1)==200);
+	CPPUNIT_ASSERT(c.nb_skips(1)==0);
+}
+
+void TestCtcAdaptiveCompo::empty() {
+	Variable x,y;
+	Function f(x,y,x-y);
+	CtcFwdBwd c1(f);
+	CtcSlow c2(f,false);
+	CtcAdaptiveCompo c(c1,c2);
+
+	double _box[][2] = {{0,1},{2,3}};
+	IntervalVector box(2,_box);
+	ContractContext context(box);
+	c.contract(box,context);
+	CPPUNIT_ASSERT(box.is_empty());
+	CPPUNIT_ASSERT(context.output_flags[Ctc::FIXPOINT]);
+	// the second contractor is not called
+	CPPUNIT_ASSERT(c.nb_calls(1)==0);
+	CPPUNIT_ASSERT(c.nb_skips(1)==0);
+}
+
+void TestCtcAdaptiveCompo::reproducible() {
+	Variable x,y;
+	Function f(x,y,x-y);
+	CtcFwdBwd c1(f);
+	CtcSlow c2(f,false);
+	CtcAdaptiveCompo c(c1,c2);
+	CtcAdaptiveCompo d(c1,c2);
+
+	double _box[][2] = {{0,1},{0,2}};
+	for (int k=0; k<500; k++) {
+		IntervalVector box(2,_box);
+		c.contract(box);
+	}
+	for (int k=0; k<500; k++) {
+		IntervalVector box(2,_box);
+		d.contract(box);
+	}
+	// the decisions do not depend on the running times
+	CPPUNIT_ASSERT(c.nb_calls(1)==d.nb_calls(1));
+	CPPUNIT_ASSERT(c.nb_skips(1)==d.nb_skips(1));
+}
+
+} // namespace ibex
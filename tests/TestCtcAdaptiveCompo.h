@@ -0,0 +1,39 @@
+//============================================================================
+//                                  I B E X
+// File        : TestCtcAdaptiveCompo.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __TEST_CTC_ADAPTIVE_COMPO_H__
+#define __TEST_CTC_ADAPTIVE_COMPO_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestCtcAdaptiveCompo : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestCtcAdaptiveCompo);
+	CPPUNIT_TEST(skip);
+	CPPUNIT_TEST(no_skip);
+	CPPUNIT_TEST(empty);
+	CPPUNIT_TEST(reproducible);
+	CPPUNIT_TEST_SUITE_END();
+
+	void skip();
+	void no_skip();
+	void empty();
+	void reproducible();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCtcAdaptiveCompo);
+
+} // namespace ibex
+
+#endif // __TEST_CTC_ADAPTIVE_COMPO_H__
@@ -27,12 +27,14 @@ public:
 	
 
 		CPPUNIT_TEST(test01);
+		CPPUNIT_TEST(paving);
 		//CPPUNIT_TEST(test02);
 		//CPPUNIT_TEST(test03);
 		//CPPUNIT_TEST(test04);
 	CPPUNIT_TEST_SUITE_END();
 
 	void test01();
+	void paving();
 	//void test02();
 	//void test03();
 	//void test04();
@@ -14,11 +14,48 @@
 #include "ibex_Solver.h"
 #include "ibex_RoundRobin.h"
 #include "ibex_CellStack.h"
+#include "ibex_CtcFwdBwd.h"
+#include "ibex_CtcProfiler.h"
 
 using namespace std;
 
 namespace ibex {
 
+namespace {
+
+/*
+ * Depth-first search (right branch first) where the cells
+ * carry the properties of the contractor.
+ */
+IntervalVector search(Ctc& ctc) {
+	Cell* root=new Cell(IntervalVector(1,Interval(-10,10)));
+	ctc.add_property(root->box, root->prop);
+
+	stack<Cell*> cells;
+	cells.push(root);
+	IntervalVector sol=root->box;
+	while (!cells.empty() && sol.max_diam()>1e-03) {
+		Cell* cell=cells.top();
+		cells.pop();
+		ContractContext context(cell->prop);
+		ctc.contract(cell->box, context);
+		sol=cell->box;
+		if (!sol.is_empty()) {
+			pair<Cell*,Cell*> p=cell->bisect(BisectionPoint(0,0.5,true));
+			cells.push(p.first);
+			cells.push(p.second);
+		}
+		delete cell;
+	}
+	while (!cells.empty()) {
+		delete cells.top();
+		cells.pop();
+	}
+	return sol;
+}
+
+}
+
 void TestCtcForAll::test01() {
 
 	Variable x,y;
@@ -78,4 +115,31 @@ void TestCtcForAll::test01() {
 	CPPUNIT_ASSERT(sol[0].contains(right_bound));
 }
 
+void TestCtcForAll::paving() {
+
+	Variable x,y;
+	Function f(x,y,1.5*sqr(x)+1.5*sqr(y)-x*y-0.2);
+	NumConstraint c(f,LEQ);
+	CtcFwdBwd fwdbwd(c);
+
+	BitSet vars=BitSet::singleton(2,0);
+	double right_bound=+0.3616933019201018;
+
+	Profiler prof;
+	CtcProfiler ctc1(fwdbwd, prof);
+	CtcForAll q1(ctc1, vars, IntervalVector(1,Interval(-0.01,0.01)), 1e-05);
+	IntervalVector sol1=search(q1);
+
+	CtcProfiler ctc2(fwdbwd, prof);
+	CtcForAll q2(ctc2, vars, IntervalVector(1,Interval(-0.01,0.01)), 1e-05);
+	q2.paving_size=0;
+	IntervalVector sol2=search(q2);
+
+	CPPUNIT_ASSERT(sol1[0].contains(right_bound));
+	CPPUNIT_ASSERT(sol2[0].contains(right_bound));
+
+	// the parameter space is not explored again in sub-boxes
+	CPPUNIT_ASSERT(prof[0].nb_calls < prof[1].nb_calls);
+}
+
 } // end namespace
@@ -26,9 +26,11 @@ public:
 	
 
 		CPPUNIT_TEST(test01);
+		CPPUNIT_TEST(paving);
 	CPPUNIT_TEST_SUITE_END();
 
 	void test01();
+	void paving();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestCtcForAll);
@@ -0,0 +1,135 @@
+/* ============================================================================
+ * I B E X - CtcPolytopeHull Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestCtcPolytopeHull.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// The simplex -x<=0, -y<=0, x+y<=1
+void simplex(Matrix& A, Vector& b) {
+	double _A[3][2] = {{-1,0},{0,-1},{1,1}};
+	A = Matrix(3,2,(double*) _A);
+	b = Vector(3);
+	b[0]=0; b[1]=0; b[2]=1;
+}
+
+// A polytope in dimension n: |x_i - x_{i+1}| <= 1, sum x_i <= n, sum x_i >= -n
+void band(int n, Matrix& A, Vector& b) {
+	int m=2*(n-1)+2;
+	A = Matrix::zeros(m,n);
+	b = Vector(m);
+	int r=0;
+	for (int i=0; i<n-1; i++) {
+		A[r][i]=1;  A[r][i+1]=-1; b[r++]=1;
+		A[r][i]=-1; A[r][i+1]=1;  b[r++]=1;
+	}
+	for (int i=0; i<n; i++) { A[r][i]=1; A[r+1][i]=-1; }
+	b[r]=n; b[r+1]=n;
+}
+
+}
+
+void TestCtcPolytopeHull::simplex01() {
+	Matrix A(1,1); Vector b(1);
+	simplex(A,b);
+	CtcPolytopeHull c(A,b);
+	IntervalVector box(2,Interval(-10,10));
+	c.contract(box);
+	CPPUNIT_ASSERT(almost_eq(box, IntervalVector(2,Interval(0,1)), 1e-9));
+}
+
+void TestCtcPolytopeHull::empty01() {
+	Matrix A(1,1); Vector b(1);
+	simplex(A,b);
+	CtcPolytopeHull c(A,b);
+	IntervalVector box(2,Interval(0.6,10));
+	c.contract(box);
+	CPPUNIT_ASSERT(box.is_empty());
+}
+
+void TestCtcPolytopeHull::dual_tightening01() {
+	Matrix A(1,1); Vector b(1);
+	simplex(A,b);
+	CtcPolytopeHull c(A,b);
+	c.set_dual_tightening(true);
+	IntervalVector box(2,Interval(-10,10));
+	c.contract(box);
+	CPPUNIT_ASSERT(box.is_superset(IntervalVector(2,Interval(0,1))));
+	CPPUNIT_ASSERT(almost_eq(box, IntervalVector(2,Interval(0,1)), 20*CtcPolytopeHull::default_dual_gap));
+}
+
+void TestCtcPolytopeHull::dual_tightening02() {
+	// the dual tightening must not lose more than the relative gap
+	int n=10;
+	Matrix A(1,1); Vector b(1);
+	band(n,A,b);
+	IntervalVector init(n,Interval(-3,5));
+
+	CtcPolytopeHull c1(A,b);
+	IntervalVector box1(init);
+	c1.contract(box1);
+
+	CtcPolytopeHull c2(A,b);
+	c2.set_dual_tightening(true);
+	IntervalVector box2(init);
+	c2.contract(box2);
+
+	CPPUNIT_ASSERT(!box1.is_empty());
+	CPPUNIT_ASSERT(!box2.is_empty());
+	for (int i=0; i<n; i++) {
+		CPPUNIT_ASSERT(box2[i].lb() <= box1[i].lb()+1e-9);
+		CPPUNIT_ASSERT(box2[i].ub() >= box1[i].ub()-1e-9);
+		CPPUNIT_ASSERT(box1[i].lb()-box2[i].lb() <= CtcPolytopeHull::default_dual_gap*init[i].diam());
+		CPPUNIT_ASSERT(box2[i].ub()-box1[i].ub() <= CtcPolytopeHull::default_dual_gap*init[i].diam());
+	}
+}
+
+void TestCtcPolytopeHull::threads01() {
+	int n=10;
+	Matrix A(1,1); Vector b(1);
+	band(n,A,b);
+	IntervalVector init(n,Interval(-3,5));
+
+	CtcPolytopeHull c1(A,b);
+	IntervalVector box1(init);
+	c1.contract(box1);
+
+	CtcPolytopeHull c2(A,b);
+	c2.set_nb_threads(3);
+	IntervalVector box2(init);
+	c2.contract(box2);
+
+	CPPUNIT_ASSERT(!box1.is_empty());
+	CPPUNIT_ASSERT(almost_eq(box1, box2, 1e-9));
+
+	// a second call reuses the LP solvers of the threads
+	box2 = init;
+	c2.contract(box2);
+	CPPUNIT_ASSERT(almost_eq(box1, box2, 1e-9));
+}
+
+void TestCtcPolytopeHull::threads02() {
+	Matrix A(1,1); Vector b(1);
+	simplex(A,b);
+	CtcPolytopeHull c(A,b);
+	c.set_nb_threads(4);
+	IntervalVector box(2,Interval(-10,10));
+	c.contract(box);
+	CPPUNIT_ASSERT(almost_eq(box, IntervalVector(2,Interval(0,1)), 1e-9));
+	box = IntervalVector(2,Interval(0.6,10));
+	c.contract(box);
+	CPPUNIT_ASSERT(box.is_empty());
+}
+
+} // namespace ibex
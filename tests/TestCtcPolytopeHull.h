@@ -0,0 +1,49 @@
+/* ============================================================================
+ * I B E X - CtcPolytopeHull Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_CTC_POLYTOPE_HULL_H__
+#define __TEST_CTC_POLYTOPE_HULL_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "ibex_CtcPolytopeHull.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestCtcPolytopeHull : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestCtcPolytopeHull);
+#ifndef __IBEX_NO_LP_SOLVER__
+	CPPUNIT_TEST(simplex01);
+	CPPUNIT_TEST(empty01);
+	CPPUNIT_TEST(dual_tightening01);
+	CPPUNIT_TEST(dual_tightening02);
+	CPPUNIT_TEST(threads01);
+	CPPUNIT_TEST(threads02);
+#endif
+	CPPUNIT_TEST_SUITE_END();
+
+	void simplex01();
+	void empty01();
+	void dual_tightening01();
+	void dual_tightening02();
+	void threads01();
+	void threads02();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCtcPolytopeHull);
+
+} // namespace ibex
+
+#endif // __TEST_CTC_POLYTOPE_HULL_H__
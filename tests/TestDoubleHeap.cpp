@@ -11,6 +11,7 @@
 
 #include "TestDoubleHeap.h"
 #include "ibex_DoubleHeap.h"
+#include <set>
 
 using namespace std;
 
@@ -246,4 +247,49 @@ void TestDoubleHeap::test05() {
 }
 
 
+// push/pop/contract many intervals and compare with sorted sets
+void TestDoubleHeap::random01() {
+	TestCostFunc2 costf2; // lb
+	TestCostFunc1 costf1; // diam
+
+	DoubleHeap<Interval> h(costf2,false,costf1,false,50);
+
+	multiset<double> lb, diam;
+	srand(1);
+
+	for (int k=0; k<2000; k++) {
+		int r=rand()%10;
+		if (r<6 || h.empty()) {
+			double a=rand()%1000;
+			Interval* x=new Interval(a,a+rand()%1000);
+			lb.insert(x->lb());
+			diam.insert(x->diam());
+			h.push(x);
+		} else if (r<9) {
+			Interval* x= r<8 ? h.pop1() : h.pop2();
+			CPPUNIT_ASSERT(r<8 ? x->lb()==*lb.begin() : x->diam()==*diam.begin());
+			lb.erase(lb.find(x->lb()));
+			diam.erase(diam.find(x->diam()));
+			delete x;
+		} else {
+			double loup=*lb.rbegin() - rand()%100;
+			DoubleHeap<Interval> h2(h); // shallow copy
+			while (!h2.empty()) {
+				Interval* x=h2.pop1();
+				if (x->lb()>loup) {
+					lb.erase(lb.find(x->lb()));
+					diam.erase(diam.find(x->diam()));
+				}
+			}
+			h.contract(loup);
+		}
+		CPPUNIT_ASSERT(h.size()==lb.size());
+		if (!h.empty()) {
+			CPPUNIT_ASSERT(h.minimum1()==*lb.begin());
+			CPPUNIT_ASSERT(h.minimum2()==*diam.begin());
+		}
+	}
+	h.flush();
+}
+
 } // end namespace
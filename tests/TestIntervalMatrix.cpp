@@ -12,6 +12,9 @@
 #include "TestIntervalMatrix.h"
 #include "ibex_IntervalMatrix.h"
 #include "ibex_Random.h"
+#include "ibex_MidRadArith.h"
+
+#include <climits>
 #include "utils.h"
 
 using namespace std;
@@ -401,6 +404,62 @@ void TestIntervalMatrix::mul02() {
 	CPPUNIT_ASSERT((m2*=m1).is_empty());
 }
 
+namespace {
+
+IntervalMatrix random_matrix(int n, double rad) {
+	IntervalMatrix m(n,n);
+	for (int i=0; i<n; i++)
+		for (int j=0; j<n; j++)
+			m[i][j]=Interval(RNG::rand(-1,1)).inflate(RNG::rand(0,rad));
+	return m;
+}
+
+// product with interval operations only
+IntervalMatrix interval_mul(const Matrix& m1, const IntervalMatrix& m2) {
+	int min_size=midrad_mul_min_size;
+	midrad_mul_min_size=INT_MAX;
+	IntervalMatrix m3=m1*m2;
+	midrad_mul_min_size=min_size;
+	return m3;
+}
+
+IntervalMatrix interval_mul(const IntervalMatrix& m1, const IntervalMatrix& m2) {
+	int min_size=midrad_mul_min_size;
+	midrad_mul_min_size=INT_MAX;
+	IntervalMatrix m3=m1*m2;
+	midrad_mul_min_size=min_size;
+	return m3;
+}
+
+}
+
+void TestIntervalMatrix::mul03() {
+	int n=midrad_mul_min_size+4;
+	RNG::srand(1);
+	IntervalMatrix m1=random_matrix(n,0.1);
+	IntervalMatrix m2=random_matrix(n,0.1);
+	IntervalMatrix m3=m1*m2;
+	IntervalMatrix m4=interval_mul(m1,m2);
+
+	for (int k=0; k<10; k++)
+		CPPUNIT_ASSERT(m3.contains(m1.random()*m2.random()));
+
+	for (int i=0; i<n; i++)
+		for (int j=0; j<n; j++) {
+			CPPUNIT_ASSERT(m3[i][j].contains(m4[i][j].mid()));
+			CPPUNIT_ASSERT(m3[i][j].rad()<=1.5*m4[i][j].rad()+1e-12);
+		}
+}
+
+void TestIntervalMatrix::mul04() {
+	int n=midrad_mul_min_size+4;
+	RNG::srand(1);
+	Matrix m1=random_matrix(n,0).mid();
+	IntervalMatrix m2=random_matrix(n,0.1);
+
+	CPPUNIT_ASSERT(almost_eq(m1*m2, interval_mul(m1,m2), 1e-12));
+}
+
 void TestIntervalMatrix::put01() {
 
 	IntervalMatrix M1=2*Matrix::eye(3);
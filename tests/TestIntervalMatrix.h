@@ -71,6 +71,8 @@ public:
 
 	CPPUNIT_TEST(mul01);
 	CPPUNIT_TEST(mul02);
+	CPPUNIT_TEST(mul03);
+	CPPUNIT_TEST(mul04);
 
 	CPPUNIT_TEST(put01);
 	CPPUNIT_TEST(rad01);
@@ -168,6 +170,10 @@ public:
 	//  operator*=(const IntervalMatrix& x)
 	void mul01();
 	void mul02();
+	// midpoint-radius product
+	void mul03();
+	// midpoint-radius product (real matrix)
+	void mul04();
 
 	void put01();
 	void rad01();
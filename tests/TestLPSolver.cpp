@@ -143,4 +143,73 @@ void TestLinearSolver::kleemin30() {
 
 }
 
+void TestLinearSolver::bounded01() {
+	// min x+y s.t. x+y>=1, x-y<=0.5, (x,y) in [0,10]x[0,10]
+	LPSolver lp(2);
+	Vector c(2,1.0);
+	lp.set_obj(c);
+	lp.set_bounds(IntervalVector(2,Interval(0,10)));
+
+	Vector v(2,1.0);
+	lp.add_constraint(v,GEQ,1);
+	v[1]=-1;
+	lp.add_constraint(v,LEQ,0.5);
+
+	CPPUNIT_ASSERT(lp.solve_proved()==LPSolver::OPTIMAL_PROVED);
+	CPPUNIT_ASSERT(lp.get_obj_value().lb()<=1);
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0,lp.get_obj_value().lb(),1e-9);
+
+	Vector x = lp.get_primal_sol();
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0,x[0]+x[1],1e-9);
+}
+
+void TestLinearSolver::infeasible01() {
+	// x+y>=3 with (x,y) in [0,1]x[0,1]
+	LPSolver lp(2);
+	lp.set_obj(Vector(2,1.0));
+	lp.set_bounds(IntervalVector(2,Interval(0,1)));
+	lp.add_constraint(Vector(2,1.0),GEQ,3);
+
+	CPPUNIT_ASSERT(lp.solve_proved()==LPSolver::INFEASIBLE_PROVED);
+}
+
+void TestLinearSolver::infeasible02() {
+	// x+y<=1 with x in [2,1]
+	LPSolver lp(2);
+	lp.set_obj(Vector(2,1.0));
+	lp.set_bounds(IntervalVector(2,Interval(0,1)));
+	lp.set_bounds_var(0,Interval::EMPTY_SET);
+	lp.add_constraint(Vector(2,1.0),LEQ,1);
+
+	CPPUNIT_ASSERT(lp.solve_proved()==LPSolver::INFEASIBLE_PROVED);
+}
+
+void TestLinearSolver::warm_start01() {
+	// Successive optimizations of each variable over the
+	// simplex x>=0, y>=0, x+y<=1 (as in CtcPolytopeHull).
+	LPSolver lp(2);
+	lp.set_bounds(IntervalVector(2,Interval(-10,10)));
+	lp.add_constraint(Vector(2,1.0),LEQ,1);
+	Vector v=Vector::zeros(2);
+	v[0]=1;
+	lp.add_constraint(v,GEQ,0);
+	v[0]=0; v[1]=1;
+	lp.add_constraint(v,GEQ,0);
+
+	double expected[4] = { 0, 1, 0, 1 };
+	for (int k=0; k<4; k++) {
+		Vector c=Vector::zeros(2);
+		c[k/2] = (k%2==0) ? 1 : -1;
+		lp.set_obj(c);
+		CPPUNIT_ASSERT(lp.solve_proved()==LPSolver::OPTIMAL_PROVED);
+		CPPUNIT_ASSERT_DOUBLES_EQUAL(expected[k], (k%2==0 ? 1 : -1)*lp.get_obj_value().lb(), 1e-9);
+	}
+
+	// tightening the bounds keeps the basis usable
+	lp.set_bounds(IntervalVector(2,Interval(0.25,10)));
+	lp.set_obj(-Vector(2,1.0));
+	CPPUNIT_ASSERT(lp.solve_proved()==LPSolver::OPTIMAL_PROVED);
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(-1.0, lp.get_obj_value().lb(), 1e-9);
+}
+
 } // end namespace
@@ -30,6 +30,10 @@ public:
 	CPPUNIT_TEST(kleemin6);
 	CPPUNIT_TEST(kleemin8);
 	CPPUNIT_TEST(kleemin30);
+	CPPUNIT_TEST(bounded01);
+	CPPUNIT_TEST(infeasible01);
+	CPPUNIT_TEST(infeasible02);
+	CPPUNIT_TEST(warm_start01);
 #endif
 
 	CPPUNIT_TEST_SUITE_END();
@@ -40,6 +44,11 @@ public:
 	void kleemin6() {kleemin(6);};
 	void kleemin8() {kleemin(8);};
 	void kleemin30();
+	void bounded01();
+	void infeasible01();
+	// empty domain of a variable
+	void infeasible02();
+	void warm_start01();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestLinearSolver);
@@ -39,6 +39,17 @@ void TestLinear::lu_partial_underctr() {
 	CPPUNIT_ASSERT(almost_eq(LU_actual.row(2),LU_expected.row(2),1e-04));
 }
 
+void TestLinear::inverse01() {
+	int n=70;
+	Matrix A(n,n);
+	for (int i=0; i<n; i++)
+		for (int j=0; j<n; j++)
+			A[i][j]=(i==j)? 2 : 1.0/(i+j+1);
+
+	Matrix invA=real_inverse(A);
+	CPPUNIT_ASSERT(almost_eq(A*invA, Matrix::eye(n), 1e-12));
+}
+
 void TestLinear::lu_complete_underctr() {
 
 }
@@ -136,6 +147,29 @@ void TestLinear::gauss_seidel03() {
 	CPPUNIT_ASSERT(almost_eq(x[2],fxpt, 1e-6));
 }
 
+void TestLinear::gauss_seidel04() {
+	int n=20;
+	double eps=1e-3;
+	Matrix A(n,n);
+	for (int i=0; i<n; i++)
+		for (int j=0; j<n; j++)
+			A[i][j]=(i==j)? n : 1.0/(i+j+1)-0.1;
+
+	// the solution of the real system Ax=b
+	Vector sol(n);
+	for (int i=0; i<n; i++) sol[i]=i-n/2;
+	Vector b=A*sol;
+
+	IntervalMatrix _A=A+Interval(-eps,eps)*Matrix::ones(n);
+	IntervalVector _b(b);
+	IntervalVector x(n,Interval(-100,100));
+
+	precond(_A,_b);
+	gauss_seidel(_A,_b,x,1e-06);
+
+	CPPUNIT_ASSERT(x.contains(sol));
+	CPPUNIT_ASSERT(x.max_diam()<0.1);
+}
 
 void TestLinear::inflating_gauss_seidel01() {
 	int n=4;
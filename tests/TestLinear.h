@@ -24,9 +24,11 @@ public:
 
 	CPPUNIT_TEST_SUITE(TestLinear);
 	CPPUNIT_TEST(lu_partial_underctr);
+	CPPUNIT_TEST(inverse01);
 	CPPUNIT_TEST(gauss_seidel01);
 	CPPUNIT_TEST(gauss_seidel02);
 	CPPUNIT_TEST(gauss_seidel03);
+	CPPUNIT_TEST(gauss_seidel04);
 	CPPUNIT_TEST(inflating_gauss_seidel01);
 	CPPUNIT_TEST(inflating_gauss_seidel02);
 	CPPUNIT_TEST(inflating_gauss_seidel03);
@@ -41,12 +43,17 @@ public:
 	void lu_complete_underctr();
 	void lu_complete_overctr();
 
+	// blocked LU (several blocks)
+	void inverse01();
+
 	// m==n (square case)
 	void gauss_seidel01();
 	// m<n (under-constrained)
 	void gauss_seidel02();
 	// m>n (over-constrained)
 	void gauss_seidel03();
+	// preconditioned, midpoint-radius formulation
+	void gauss_seidel04();
 	// convergence, start with degenerated vector
 	void inflating_gauss_seidel01();
 	// convergence, start with thick vector
@@ -0,0 +1,169 @@
+/* ============================================================================
+ * I B E X - PointEval Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestPointEval.h"
+#include "ibex_Function.h"
+
+#include <cmath>
+
+using namespace std;
+
+namespace ibex {
+
+void TestPointEval::check_random(Function& f, int K) {
+	int n=f.nb_var();
+	int m=f.image_dim();
+
+	IntervalVector box(n,Interval(-2,2));
+	Matrix pts(K,n);
+	for (int k=0; k<K; k++)
+		pts[k]=box.random();
+
+	Matrix res(1,1); // should be resized
+	f.point_evaluator().eval(pts,res);
+	CPPUNIT_ASSERT(res.nb_rows()==K);
+	CPPUNIT_ASSERT(res.nb_cols()==m);
+
+	for (int k=0; k<K; k++) {
+		IntervalVector y=f.eval_vector(pts[k]);
+		for (int i=0; i<m; i++)
+			CPPUNIT_ASSERT(almost_eq(y[i],Interval(res[k][i]),1e-10));
+	}
+}
+
+void TestPointEval::check_grad(Function& f, int K) {
+	int n=f.nb_var();
+
+	IntervalVector box(n,Interval(-2,2));
+	Matrix pts(K,n);
+	for (int k=0; k<K; k++)
+		pts[k]=box.random();
+
+	Matrix G(K,n);
+	f.point_evaluator().gradient(pts,G);
+
+	Vector g(n);
+	for (int k=0; k<K; k++) {
+		IntervalVector ig=f.gradient(pts[k]);
+		f.point_evaluator().gradient(pts[k],g);
+		for (int i=0; i<n; i++) {
+			CPPUNIT_ASSERT(almost_eq(ig[i],Interval(G[k][i]),1e-10));
+			CPPUNIT_ASSERT(almost_eq(ig[i],Interval(g[i]),1e-10));
+		}
+	}
+}
+
+void TestPointEval::scalar01() {
+	const ExprSymbol& x = ExprSymbol::new_("x");
+	const ExprSymbol& y = ExprSymbol::new_("y");
+	const ExprSymbol& z = ExprSymbol::new_("z");
+	Function f(x,y,z,x*y+exp(z)-sin(x)/(1+sqr(y))+max(x,y)*abs(z)+atan2(y,x)+pow(-x,3));
+	check_random(f,10);
+	check_random(f,3); // K changes
+}
+
+void TestPointEval::vector01() {
+	const ExprSymbol& x = ExprSymbol::new_("x",Dim::col_vec(3));
+	const ExprSymbol& y = ExprSymbol::new_("y",Dim::col_vec(3));
+	Function f(x,y,Return(x*y, x[0]+y[2], -(x-y), 2*x+y));
+	check_random(f,7);
+}
+
+void TestPointEval::matrix01() {
+	const ExprSymbol& A = ExprSymbol::new_("A",Dim::matrix(2,3));
+	const ExprSymbol& x = ExprSymbol::new_("x",Dim::col_vec(3));
+	const ExprSymbol& y = ExprSymbol::new_("y",Dim::col_vec(2));
+	Function f(A,x,y,Return(A*x+y, transpose(transpose(y)*A), (A*transpose(A))*y, transpose(A)[1][0]));
+	check_random(f,5);
+}
+
+void TestPointEval::apply01() {
+	const ExprSymbol& x1 = ExprSymbol::new_("x1");
+	const ExprSymbol& y1 = ExprSymbol::new_("y1");
+	Function g(x1,y1,sqr(x1)-y1);
+
+	const ExprSymbol& x = ExprSymbol::new_("x",Dim::col_vec(2));
+	const ExprSymbol& z = ExprSymbol::new_("z");
+
+	Function f(x,z,ExprApply::new_(g, Array<const ExprNode>(x[1],z)));
+	check_random(f,4);
+}
+
+void TestPointEval::nan01() {
+	const ExprSymbol& x = ExprSymbol::new_("x");
+	const ExprSymbol& y = ExprSymbol::new_("y");
+	Function f(x,y,sqrt(x)+log(y));
+	Matrix pts(2,2);
+	pts[0][0]=4; pts[0][1]=1;
+	pts[1][0]=-1; pts[1][1]=1;
+	Matrix res(2,1);
+	f.point_evaluator().eval(pts,res);
+	CPPUNIT_ASSERT(res[0][0]==2);
+	CPPUNIT_ASSERT(std::isnan(res[1][0]));
+}
+
+void TestPointEval::point01() {
+	const ExprSymbol& x = ExprSymbol::new_("x",Dim::col_vec(2));
+	const ExprSymbol& y = ExprSymbol::new_("y");
+	const ExprSymbol& x2 = ExprSymbol::new_("x",Dim::col_vec(2));
+	const ExprSymbol& y2 = ExprSymbol::new_("y");
+	Function f(x,y,x[0]*exp(y)-x[1]);
+	Function g(x2,y2,Return(x2[0]*y2,x2[1]+1));
+
+	Vector pt(3);
+	pt[0]=2; pt[1]=3; pt[2]=0;
+	CPPUNIT_ASSERT(f.point_evaluator().eval(pt)==-1);
+
+	Vector v=g.point_evaluator().eval_vector(pt);
+	CPPUNIT_ASSERT(v.size()==2 && v[0]==0 && v[1]==4);
+}
+
+void TestPointEval::grad01() {
+	const ExprSymbol& x = ExprSymbol::new_("x");
+	const ExprSymbol& y = ExprSymbol::new_("y");
+	const ExprSymbol& z = ExprSymbol::new_("z");
+	Function f(x,y,z,x*y+exp(z)-sin(x)/(1+sqr(y))+atan2(y,x)+pow(-x,3)+cos(x*z)*sqrt(1+sqr(y))+tanh(z)/y);
+	check_grad(f,10);
+	check_grad(f,1);
+}
+
+void TestPointEval::grad02() {
+	const ExprSymbol& A = ExprSymbol::new_("A",Dim::matrix(2,3));
+	const ExprSymbol& x = ExprSymbol::new_("x",Dim::col_vec(3));
+	const ExprSymbol& y = ExprSymbol::new_("y",Dim::col_vec(2));
+	Function f(A,x,y,(transpose(y)*A)*x + y*((A*transpose(A))*y) + transpose(A)[1][0]*(x*x) - (2*x)[2]);
+	check_grad(f,5);
+}
+
+void TestPointEval::grad_apply01() {
+	const ExprSymbol& x1 = ExprSymbol::new_("x1");
+	const ExprSymbol& y1 = ExprSymbol::new_("y1");
+	Function g(x1,y1,sqr(x1)*y1);
+
+	const ExprSymbol& x = ExprSymbol::new_("x",Dim::col_vec(2));
+	const ExprSymbol& z = ExprSymbol::new_("z");
+
+	Function f(x,z,ExprApply::new_(g, Array<const ExprNode>(x[1],z)));
+	check_grad(f,3);
+}
+
+void TestPointEval::jac01() {
+	const ExprSymbol& x = ExprSymbol::new_("x",Dim::col_vec(3));
+	Function f(x,Return(x[0]*x[1],sin(x[2])-x[0],sqr(x[1])));
+
+	Vector pt(3);
+	pt[0]=1; pt[1]=2; pt[2]=0.5;
+
+	Matrix J(1,1);
+	f.point_evaluator().jacobian(pt,J);
+	CPPUNIT_ASSERT(almost_eq(f.jacobian(IntervalVector(pt)),IntervalMatrix(J),1e-10));
+}
+
+} // namespace ibex
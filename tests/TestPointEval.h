@@ -0,0 +1,62 @@
+/* ============================================================================
+ * I B E X - PointEval Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_POINT_EVAL_H__
+#define __TEST_POINT_EVAL_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestPointEval : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestPointEval);
+	CPPUNIT_TEST(scalar01);
+	CPPUNIT_TEST(vector01);
+	CPPUNIT_TEST(matrix01);
+	CPPUNIT_TEST(apply01);
+	CPPUNIT_TEST(nan01);
+	CPPUNIT_TEST(point01);
+	CPPUNIT_TEST(grad01);
+	CPPUNIT_TEST(grad02);
+	CPPUNIT_TEST(grad_apply01);
+	CPPUNIT_TEST(jac01);
+	CPPUNIT_TEST_SUITE_END();
+
+	void scalar01();
+	void vector01();
+	void matrix01();
+	void apply01();
+	void nan01();
+	void point01();
+	void grad01();
+	void grad02();
+	void grad_apply01();
+	void jac01();
+
+private:
+	// compare the batched evaluation with the midpoint
+	// of the interval evaluation on random points
+	void check_random(Function& f, int K);
+
+	// compare the (batched and single-point) gradient with
+	// the midpoint of the interval gradient on random points
+	void check_grad(Function& f, int K);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestPointEval);
+
+} // namespace ibex
+
+#endif // __TEST_POINT_EVAL_H__
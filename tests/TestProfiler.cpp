@@ -0,0 +1,109 @@
+//============================================================================
+//                                  I B E X
+// File        : TestProfiler.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "TestProfiler.h"
+#include "ibex_Profiler.h"
+#include "ibex_CtcProfiler.h"
+#include "ibex_BscProfiler.h"
+#include "ibex_CtcFwdBwd.h"
+#include "ibex_RoundRobin.h"
+
+#include <sstream>
+
+using namespace std;
+
+namespace ibex {
+
+void TestProfiler::reduction() {
+	double _before[][2] = {{0,2},{0,2},{1,1},{0,POS_INFINITY}};
+	double _after[][2]  = {{0,1},{0,2},{1,1},{0,1}};
+	IntervalVector before(4,_before);
+	IntervalVector after(4,_after);
+
+	// only the two first dimensions are measured
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(0.5,  Profiler::volume_reduction(before,after), 1e-12);
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(0.25, Profiler::width_reduction(before,after), 1e-12);
+
+	CPPUNIT_ASSERT(Profiler::volume_reduction(before,IntervalVector::empty(4))==1);
+	CPPUNIT_ASSERT(Profiler::width_reduction(before,IntervalVector::empty(4))==1);
+	CPPUNIT_ASSERT(Profiler::volume_reduction(before,before)==0);
+}
+
+void TestProfiler::names() {
+	Profiler p;
+	CPPUNIT_ASSERT(p.add("hc4").name=="hc4");
+	CPPUNIT_ASSERT(p.add("hc4").name=="hc4#2");
+	CPPUNIT_ASSERT(p.add("hc4").name=="hc4#3");
+	CPPUNIT_ASSERT(p.size()==3);
+	CPPUNIT_ASSERT(p[1].name=="hc4#2");
+	CPPUNIT_ASSERT(Profiler::class_name(typeid(Interval))=="Interval");
+}
+
+void TestProfiler::ctc() {
+	Variable x,y;
+	Function f(x,y,x-y);
+	CtcFwdBwd c(f);
+
+	Profiler p;
+	CtcProfiler ctc(c,p);
+	CPPUNIT_ASSERT(ctc.entry.name=="CtcFwdBwd");
+
+	double _box[][2] = {{0,1},{0,2}};
+	IntervalVector box(2,_box);
+	ctc.contract(box);
+	CPPUNIT_ASSERT(box[1]==Interval(0,1));
+
+	box[0]=Interval(3,4);
+	ctc.contract(box);
+	CPPUNIT_ASSERT(box.is_empty());
+
+	const Profiler::Entry& e=p[0];
+	CPPUNIT_ASSERT(e.nb_calls==2);
+	CPPUNIT_ASSERT(e.nb_reductions==2);
+	CPPUNIT_ASSERT(e.nb_empty==1);
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(0.75, e.avg_volume_reduction(), 1e-12);
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(0.625, e.avg_width_reduction(), 1e-12);
+	CPPUNIT_ASSERT(e.cpu_time>=0 && e.wall_time>=0);
+
+	p.reset();
+	CPPUNIT_ASSERT(p[0].nb_calls==0);
+}
+
+void TestProfiler::bsc() {
+	RoundRobin rr(0.5);
+	Profiler p;
+	BscProfiler bsc(rr,p,"rr");
+
+	IntervalVector box(2,Interval(0,1));
+	CPPUNIT_ASSERT(bsc.prec(0)==0.5);
+	CPPUNIT_ASSERT(!bsc.too_small(box,0));
+
+	pair<IntervalVector,IntervalVector> boxes=bsc.bisect(box);
+	CPPUNIT_ASSERT(boxes.first[0].ub()<1);
+	CPPUNIT_ASSERT(p[0].name=="rr");
+	CPPUNIT_ASSERT(p[0].nb_calls==1);
+	CPPUNIT_ASSERT(p[0].nb_success==1);
+	CPPUNIT_ASSERT(p[0].nb_reductions==0);
+}
+
+void TestProfiler::json() {
+	Profiler p;
+	Profiler::Entry& e=p.add("a \"b\"");
+	e.nb_calls=3;
+	e.nb_success=2;
+
+	stringstream ss;
+	p.to_json(ss);
+	string s=ss.str();
+	CPPUNIT_ASSERT(s.find("\"name\": \"a \\\"b\\\"\"")!=string::npos);
+	CPPUNIT_ASSERT(s.find("\"calls\": 3")!=string::npos);
+	CPPUNIT_ASSERT(s.find("\"success\": 2")!=string::npos);
+	CPPUNIT_ASSERT(s[0]=='[');
+}
+
+} // namespace ibex
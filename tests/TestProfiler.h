@@ -0,0 +1,41 @@
+//============================================================================
+//                                  I B E X
+// File        : TestProfiler.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __TEST_PROFILER_H__
+#define __TEST_PROFILER_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestProfiler : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestProfiler);
+	CPPUNIT_TEST(reduction);
+	CPPUNIT_TEST(names);
+	CPPUNIT_TEST(ctc);
+	CPPUNIT_TEST(bsc);
+	CPPUNIT_TEST(json);
+	CPPUNIT_TEST_SUITE_END();
+
+	void reduction();
+	void names();
+	void ctc();
+	void bsc();
+	void json();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestProfiler);
+
+} // namespace ibex
+
+#endif // __TEST_PROFILER_H__
@@ -0,0 +1,175 @@
+/* ============================================================================
+ * I B E X - QInterProjection Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestQInterProjection.h"
+#include "ibex_QInterProjection.h"
+#include "ibex_QInter.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * Projection of the q-intersection in dimension i by enumeration
+ * of the bounds.
+ */
+Interval brute_force(const Array<IntervalVector>& boxes, int q, int i) {
+	Interval res=Interval::EMPTY_SET;
+	for (int j=0; j<boxes.size(); j++) {
+		if (boxes[j].is_empty()) continue;
+		for (int b=0; b<2; b++) {
+			double x = b==0 ? boxes[j][i].lb() : boxes[j][i].ub();
+			int c=0;
+			for (int k=0; k<boxes.size(); k++)
+				if (!boxes[k].is_empty() && boxes[k][i].contains(x)) c++;
+			if (c>=q) res |= Interval(x);
+		}
+	}
+	return res;
+}
+
+/*
+ * Random boxes with integer bounds in [0,10].
+ */
+void random_boxes(IntervalMatrix& m) {
+	for (int j=0; j<m.nb_rows(); j++)
+		for (int i=0; i<m.nb_cols(); i++) {
+			int a=rand()%11;
+			int b=rand()%11;
+			m[j][i]=Interval(std::min(a,b),std::max(a,b));
+		}
+}
+
+Array<IntervalVector> refs(IntervalMatrix& m) {
+	Array<IntervalVector> a(m.nb_rows());
+	for (int j=0; j<m.nb_rows(); j++) a.set_ref(j,m[j]);
+	return a;
+}
+
+} // end anonymous namespace
+
+void TestQInterProjection::project01() {
+	IntervalMatrix m(3,1);
+	m[0][0]=Interval(0,2);
+	m[1][0]=Interval(1,3);
+	m[2][0]=Interval(2,4);
+	Array<IntervalVector> boxes=refs(m);
+	QInterProjection proj;
+	CPPUNIT_ASSERT(proj.project(boxes,1)==IntervalVector(1,Interval(0,4)));
+	CPPUNIT_ASSERT(proj.project(boxes,2)==IntervalVector(1,Interval(1,3)));
+	// closed intervals: the three boxes share the point 2
+	CPPUNIT_ASSERT(proj.project(boxes,3)==IntervalVector(1,Interval(2,2)));
+	CPPUNIT_ASSERT(proj.project(boxes,4).is_empty());
+}
+
+void TestQInterProjection::project02() {
+	srand(1);
+	IntervalMatrix m(8,3);
+	QInterProjection proj;
+	for (int t=0; t<100; t++) {
+		random_boxes(m);
+		Array<IntervalVector> boxes=refs(m);
+		for (int q=1; q<=8; q++) {
+			IntervalVector x(3);
+			for (int i=0; i<3; i++) {
+				x[i]=brute_force(boxes,q,i);
+				if (x[i].is_empty()) {
+					x.set_empty();
+					break;
+				}
+			}
+			CPPUNIT_ASSERT(proj.project(boxes,q)==x);
+		}
+	}
+}
+
+void TestQInterProjection::empty01() {
+	IntervalMatrix m(3,2);
+	m[0]=IntervalVector::empty(2);
+	m[1]=IntervalVector(2,Interval(0,1));
+	m[2]=IntervalVector(2,Interval(1,2));
+	Array<IntervalVector> boxes=refs(m);
+	QInterProjection proj;
+	CPPUNIT_ASSERT(proj.project(boxes,2)==IntervalVector(2,Interval(1,1)));
+	CPPUNIT_ASSERT(proj.project(boxes,3).is_empty());
+	m[1].set_empty();
+	m[2].set_empty();
+	CPPUNIT_ASSERT(proj.project(boxes,1).is_empty());
+}
+
+void TestQInterProjection::incremental01() {
+	srand(2);
+	IntervalMatrix m(20,2);
+	random_boxes(m);
+	Array<IntervalVector> boxes=refs(m);
+	QInterProjection proj;
+	for (int t=0; t<50; t++) {
+		// contract slightly some of the boxes, as a contractor would do
+		for (int j=0; j<20; j++) {
+			if (rand()%3==0) m[j].set_empty();
+			else if (!m[j].is_empty() && rand()%2==0) {
+				int i=rand()%2;
+				m[j][i]=Interval(m[j][i].lb(), m[j][i].lb() + (m[j][i].diam()*(rand()%4))/4);
+			}
+		}
+		if (t%10==0) random_boxes(m);
+		for (int q=1; q<=6; q++) {
+			QInterProjection fresh;
+			CPPUNIT_ASSERT(proj.project(boxes,q)==fresh.project(boxes,q));
+		}
+	}
+}
+
+void TestQInterProjection::filter01() {
+	IntervalMatrix m(4,2);
+	m[0]=IntervalVector(2,Interval(0,2));
+	m[1]=IntervalVector(2,Interval(1,3));
+	// the projections of these boxes intersect the others
+	// but the boxes don't
+	m[2][0]=Interval(0,3); m[2][1]=Interval(10,11);
+	m[3][0]=Interval(10,11); m[3][1]=Interval(0,3);
+	Array<IntervalVector> boxes=refs(m);
+	QInterProjection proj;
+
+	CPPUNIT_ASSERT(proj.project(boxes,2)==IntervalVector(2,Interval(0,3)));
+
+	CPPUNIT_ASSERT(proj.filter(boxes,2)==IntervalVector(2,Interval(1,2)));
+	CPPUNIT_ASSERT(!proj.discarded(0));
+	CPPUNIT_ASSERT(!proj.discarded(1));
+	CPPUNIT_ASSERT(proj.discarded(2));
+	CPPUNIT_ASSERT(proj.discarded(3));
+
+	CPPUNIT_ASSERT(proj.filter(boxes,3).is_empty());
+}
+
+void TestQInterProjection::qinter01() {
+	srand(3);
+	IntervalMatrix m(10,2);
+	QInterProjection proj;
+	for (int t=0; t<100; t++) {
+		// non-degenerate boxes with distinct bounds
+		for (int j=0; j<10; j++)
+			for (int i=0; i<2; i++) {
+				double a=(rand()%1000)/100.0+j*1e-5;
+				double b=a+(rand()%400+1)/100.0;
+				m[j][i]=Interval(a,b);
+			}
+		Array<IntervalVector> boxes=refs(m);
+		for (int q=1; q<=5; q++) {
+			IntervalVector exact=qinter(boxes,q);
+			IntervalVector filtered=qinter(boxes,q,proj);
+			CPPUNIT_ASSERT(filtered==exact);
+		}
+	}
+}
+
+} // namespace ibex
@@ -0,0 +1,45 @@
+/* ============================================================================
+ * I B E X - QInterProjection Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_Q_INTER_PROJECTION_H__
+#define __TEST_Q_INTER_PROJECTION_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestQInterProjection : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestQInterProjection);
+	CPPUNIT_TEST(project01);
+	CPPUNIT_TEST(project02);
+	CPPUNIT_TEST(empty01);
+	CPPUNIT_TEST(incremental01);
+	CPPUNIT_TEST(filter01);
+	CPPUNIT_TEST(qinter01);
+	CPPUNIT_TEST_SUITE_END();
+
+	void project01();
+	void project02();
+	void empty01();
+	void incremental01();
+	void filter01();
+	void qinter01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestQInterProjection);
+
+} // namespace ibex
+
+#endif // __TEST_Q_INTER_PROJECTION_H__
@@ -0,0 +1,91 @@
+//============================================================================
+//                                  I B E X
+// File        : TestRunSummary.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "TestRunSummary.h"
+#include "ibex_RunSummary.h"
+#include "ibex_Function.h"
+#include "ibex_PointEval.h"
+#include "ibex_ThreadPool.h"
+
+#include <sstream>
+#include <cmath>
+
+using namespace std;
+
+namespace ibex {
+
+void TestRunSummary::json() {
+	RunSummary s;
+	s.add_string("status", "a \"quoted\" name");
+	s.add_int("nb_cells", 12);
+	s.add_real("time", 0.5);
+	s.add_real("loup", POS_INFINITY);
+	s.add_real("time_first_loup", NAN);
+	stringstream ss;
+	s.to_json(ss);
+	CPPUNIT_ASSERT(ss.str()=="{\"status\": \"a \\\"quoted\\\" name\", \"nb_cells\": 12, \"time\": 0.5, "
+			"\"loup\": null, \"time_first_loup\": null}\n");
+}
+
+void TestRunSummary::search() {
+	RunSummary s;
+	s.add_search(2, 100, 1000, 10);
+	stringstream ss;
+	s.to_json(ss);
+	string str=ss.str();
+	CPPUNIT_ASSERT(str.find("\"time\": 2, \"nb_cells\": 100, \"cells_per_s\": 50, \"nb_evals\": 1000, \"nb_lp_solves\": 10, \"peak_rss_kb\": ")==1);
+
+	// no throughput if the time is zero
+	RunSummary s2;
+	s2.add_search(0, 100, 0, 0);
+	stringstream ss2;
+	s2.to_json(ss2);
+	CPPUNIT_ASSERT(ss2.str().find("\"cells_per_s\": null")!=string::npos);
+}
+
+void TestRunSummary::count_evals() {
+	Variable x;
+	Function f(x,sqr(x)+1);
+	unsigned long n=RunSummary::nb_evals();
+	f.eval(IntervalVector(1,Interval(1,2)));
+	f.eval(IntervalVector(1,Interval(2,3)));
+	CPPUNIT_ASSERT(RunSummary::nb_evals()-n==2);
+#ifndef _WIN32
+	CPPUNIT_ASSERT(RunSummary::peak_rss()>0);
+#endif
+}
+
+void TestRunSummary::count_point_evals() {
+	Variable x;
+	Function f(x,sqr(x)+1);
+	PointEval pe(f);
+	unsigned long n=RunSummary::nb_evals();
+	pe.eval(Vector(1,2.0));
+	CPPUNIT_ASSERT(RunSummary::nb_evals()-n==1);
+	Matrix pts(3,1,1.0);
+	Matrix res(3,1);
+	pe.eval(pts,res);
+	CPPUNIT_ASSERT(RunSummary::nb_evals()-n==4);
+}
+
+void TestRunSummary::count_threads() {
+	unsigned long n=RunSummary::nb_lp_solves();
+	{
+		ThreadPool pool(4);
+		pool.run([](int t) {
+			for (int i=0; i<=t; i++)
+				Counters::incr(Counters::LP_SOLVE);
+		});
+		// counts of the running threads
+		CPPUNIT_ASSERT(RunSummary::nb_lp_solves()-n==10);
+	}
+	// counts of the terminated threads
+	CPPUNIT_ASSERT(RunSummary::nb_lp_solves()-n==10);
+}
+
+} // end namespace ibex
@@ -0,0 +1,41 @@
+//============================================================================
+//                                  I B E X
+// File        : TestRunSummary.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __TEST_RUN_SUMMARY_H__
+#define __TEST_RUN_SUMMARY_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestRunSummary : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestRunSummary);
+	CPPUNIT_TEST(json);
+	CPPUNIT_TEST(search);
+	CPPUNIT_TEST(count_evals);
+	CPPUNIT_TEST(count_point_evals);
+	CPPUNIT_TEST(count_threads);
+	CPPUNIT_TEST_SUITE_END();
+
+	void json();
+	void search();
+	void count_evals();
+	void count_point_evals();
+	void count_threads();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestRunSummary);
+
+} // namespace ibex
+
+#endif // __TEST_RUN_SUMMARY_H__
@@ -0,0 +1,146 @@
+//============================================================================
+//                                  I B E X
+// File        : TestSearchLog.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "TestSearchLog.h"
+#include "ibex_SearchLog.h"
+#include "ibex_BxpNodeId.h"
+
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <sstream>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+const char* filename="search_log.tmp";
+
+SearchLog::Record record(unsigned long node, unsigned long parent, int depth, SearchLog::Outcome outcome) {
+	SearchLog::Record r;
+	memset(&r, 0, sizeof(r));
+	r.node=node;
+	r.parent=parent;
+	r.depth=depth;
+	r.var=depth==0? -1 : 0;
+	r.outcome=outcome;
+	r.duration=1;
+	return r;
+}
+
+}
+
+void TestSearchLog::write_read() {
+	SearchLog* log=new SearchLog(filename, 4);
+
+	// more records than the capacity of the ring buffer
+	for (int i=1; i<=10; i++)
+		log->append(record(i, i/2, i, SearchLog::EMPTY));
+
+	CPPUNIT_ASSERT(log->nb_records()==10);
+	log->flush();
+	log->append(record(11, 5, 11, SearchLog::SOLUTION));
+	delete log;
+
+	vector<SearchLog::Record> records;
+	SearchLog::read(filename, records);
+	remove(filename);
+
+	CPPUNIT_ASSERT(records.size()==11);
+	for (int i=1; i<=11; i++) {
+		CPPUNIT_ASSERT(records[i-1].node==(uint64_t) i);
+		CPPUNIT_ASSERT(records[i-1].parent==(uint64_t) i/2);
+		CPPUNIT_ASSERT(records[i-1].depth==i);
+	}
+	CPPUNIT_ASSERT(records[10].outcome==SearchLog::SOLUTION);
+}
+
+void TestSearchLog::tree() {
+	SearchLog* log=new SearchLog(filename);
+
+	double _box[][2] = {{0,2},{0,2},{1,1}};
+	Cell* root=new Cell(IntervalVector(3,_box));
+	log->add_property(root->prop);
+
+	log->begin(*root);
+	pair<Cell*,Cell*> p=root->bisect(BisectionPoint(0,0.5,true));
+	// a copy (e.g., in a contraction context) is the same node
+	Cell copy(*root);
+	CPPUNIT_ASSERT(((BxpNodeId*) copy.prop[BxpNodeId::id])->node==1);
+	log->bisected(*root, *p.first, *p.second);
+	log->end(*root, SearchLog::BISECTED, 10, 0);
+
+	log->begin(*p.first);
+	p.first->box[1]=Interval(0,1);
+	log->end(*p.first, SearchLog::KEPT);
+
+	log->begin(*p.second);
+	p.second->box.set_empty();
+	log->end(*p.second, SearchLog::EMPTY);
+
+	delete root;
+	delete p.first;
+	delete p.second;
+	delete log;
+
+	vector<SearchLog::Record> records;
+	SearchLog::read(filename, records);
+	remove(filename);
+
+	CPPUNIT_ASSERT(records.size()==3);
+
+	CPPUNIT_ASSERT(records[0].node==1);
+	CPPUNIT_ASSERT(records[0].parent==0);
+	CPPUNIT_ASSERT(records[0].depth==0);
+	CPPUNIT_ASSERT(records[0].var==-1);
+	CPPUNIT_ASSERT(records[0].outcome==SearchLog::BISECTED);
+	CPPUNIT_ASSERT(records[0].loup==10);
+	CPPUNIT_ASSERT(records[0].uplo==0);
+	// the degenerated dimension is ignored
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(::log(4.0), records[0].log_volume_before, 1e-12);
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(::log(4.0), records[0].log_volume_after, 1e-12);
+
+	CPPUNIT_ASSERT(records[1].node==2);
+	CPPUNIT_ASSERT(records[1].parent==1);
+	CPPUNIT_ASSERT(records[1].depth==1);
+	CPPUNIT_ASSERT(records[1].var==0);
+	CPPUNIT_ASSERT(records[1].outcome==SearchLog::KEPT);
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(::log(2.0), records[1].log_volume_before, 1e-12);
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(::log(1.0), records[1].log_volume_after, 1e-12);
+
+	CPPUNIT_ASSERT(records[2].node==3);
+	CPPUNIT_ASSERT(records[2].parent==1);
+	CPPUNIT_ASSERT(records[2].log_volume_after==NEG_INFINITY);
+
+	for (int i=0; i<3; i++) {
+		CPPUNIT_ASSERT(records[i].duration>=0);
+		CPPUNIT_ASSERT(i==0 || records[i].start>=records[i-1].start);
+	}
+}
+
+void TestSearchLog::report() {
+	vector<SearchLog::Record> records;
+	records.push_back(record(1, 0, 0, SearchLog::KEPT));
+	records.push_back(record(2, 1, 1, SearchLog::SOLUTION));
+	records.push_back(record(3, 1, 1, SearchLog::KEPT));
+	records.push_back(record(4, 3, 2, SearchLog::EMPTY));
+	records.push_back(record(5, 3, 2, SearchLog::PRUNED));
+
+	stringstream ss;
+	SearchLog::report(records, ss);
+	string s=ss.str();
+
+	CPPUNIT_ASSERT(s.find("number of nodes:\t\t5")!=string::npos);
+	CPPUNIT_ASSERT(s.find("maximal depth:\t\t\t2")!=string::npos);
+	// the subtree of node 3 is useless
+	CPPUNIT_ASSERT(s.find("wasted work:\t\t\t3 nodes in 1 subtrees (3s, 60% of the time)")!=string::npos);
+}
+
+} // namespace ibex
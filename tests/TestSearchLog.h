@@ -0,0 +1,37 @@
+//============================================================================
+//                                  I B E X
+// File        : TestSearchLog.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __TEST_SEARCH_LOG_H__
+#define __TEST_SEARCH_LOG_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestSearchLog : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestSearchLog);
+	CPPUNIT_TEST(write_read);
+	CPPUNIT_TEST(tree);
+	CPPUNIT_TEST(report);
+	CPPUNIT_TEST_SUITE_END();
+
+	void write_read();
+	void tree();
+	void report();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestSearchLog);
+
+} // namespace ibex
+
+#endif // __TEST_SEARCH_LOG_H__
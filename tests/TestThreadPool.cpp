@@ -0,0 +1,61 @@
+/* ============================================================================
+ * I B E X - Thread Pool Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestThreadPool.h"
+#include "ibex_ThreadPool.h"
+#include "ibex_Interval.h"
+
+#include <vector>
+
+using namespace std;
+
+namespace ibex {
+
+void TestThreadPool::run01() {
+	ThreadPool pool(3);
+	CPPUNIT_ASSERT(pool.size()==3);
+
+	vector<int> count(3,0);
+	// the same threads are reused by all the tasks
+	for (int k=0; k<100; k++)
+		pool.run([&](int t) { count[t]++; });
+
+	for (int t=0; t<3; t++)
+		CPPUNIT_ASSERT(count[t]==100);
+}
+
+void TestThreadPool::rounding() {
+	ThreadPool pool(4);
+	vector<Interval> x(4);
+
+	pool.run([&](int t) { x[t]=Interval(1)/Interval(3); });
+
+	Interval y=Interval(1)/Interval(3);
+	for (int t=0; t<4; t++)
+		CPPUNIT_ASSERT(x[t]==y && x[t].diam()>0);
+}
+
+void TestThreadPool::exception() {
+	ThreadPool pool(2);
+	bool caught=false;
+	try {
+		pool.run([](int t) { if (t==1) throw DimException("thrown by thread 1"); });
+	} catch(DimException&) {
+		caught=true;
+	}
+	CPPUNIT_ASSERT(caught);
+
+	// the pool can still be used
+	vector<int> count(2,0);
+	pool.run([&](int t) { count[t]++; });
+	CPPUNIT_ASSERT(count[0]==1 && count[1]==1);
+}
+
+} // namespace ibex
@@ -0,0 +1,39 @@
+/* ============================================================================
+ * I B E X - Thread Pool Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_THREAD_POOL_H__
+#define __TEST_THREAD_POOL_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestThreadPool : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestThreadPool);
+	CPPUNIT_TEST(run01);
+	CPPUNIT_TEST(rounding);
+	CPPUNIT_TEST(exception);
+	CPPUNIT_TEST_SUITE_END();
+
+	void run01();
+	void rounding();
+	void exception();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestThreadPool);
+
+} // namespace ibex
+
+#endif // __TEST_THREAD_POOL_H__
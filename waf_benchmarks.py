@@ -1,4 +1,4 @@
-import os, sys, re, math, shutil, collections, logging, math
+import os, sys, re, math, shutil, collections, logging, math, json
 import ibexutils
 from waflib import TaskGen, Task, Utils, Configure, Build, Logs, Errors
 benchlock = Utils.threading.Lock()
@@ -13,6 +13,15 @@ BENCHS_INSTABLE_FACTOR = 1.2
 BENCHS_CMP_REGRESSION_FACTOR = 2.
 BENCHS_CMP_IMPROVMENT_FACTOR = 2.
 
+# Keys of the results that are not performance metrics (see bench_metrics)
+BENCHS_NON_METRIC_KEYS = [ "eps", "status", "uplo", "loup", "random_seed" ]
+# Metrics for which a larger value is better (for the others, smaller is better)
+BENCHS_HIGHER_IS_BETTER = [ "cells_per_s" ]
+# Shift of the geometric means of times (in seconds) and counters, so that
+# tiny values (e.g. timer resolution) do not dominate the means
+BENCHS_GEOMEAN_TIME_SHIFT = 0.01
+BENCHS_GEOMEAN_COUNT_SHIFT = 1.
+
 # return min, max, average and stantard deviation
 def set_stats (S):
 	if S:
@@ -25,6 +34,108 @@ def set_stats (S):
 		nan = float ('nan')
 		return nan, nan, nan, nan
 
+def is_number (v):
+	return isinstance (v, (int, float)) and not isinstance (v, bool) and not math.isnan (v)
+
+# return the sorted list of the performance metrics present in the results
+def bench_metrics (L):
+	keys = set ()
+	for d in L:
+		keys |= set (k for k, v in d.items() if is_number (v))
+	return sorted (keys - set (BENCHS_NON_METRIC_KEYS))
+
+def geomean_shift (metric):
+	if metric.startswith ("time"):
+		return BENCHS_GEOMEAN_TIME_SHIFT
+	elif metric.startswith ("nb_"):
+		return BENCHS_GEOMEAN_COUNT_SHIFT
+	else:
+		return 0.
+
+# return the average of each metric for each instance (file and eps) of a
+# group, as a dict { (file, eps): { metric: value } }
+def instance_means (data):
+	I = {}
+	for f, fdata in data.items():
+		for eps in set (d["eps"] for d in fdata):
+			L = [ d for d in fdata if d["eps"] == eps ]
+			I[(f, eps)] = {}
+			for k in bench_metrics (L):
+				V = [ float (d[k]) for d in L if is_number (d.get (k)) ]
+				if V:
+					I[(f, eps)][k] = sum (V) / len (V)
+	return I
+
+# return the shifted geometric mean of each metric over the instances of a
+# group, as a dict { metric: (mean, number of instances) }
+def group_geomeans (data):
+	I = instance_means (data)
+	G = {}
+	for k in sorted (set (k for m in I.values() for k in m)):
+		shift = geomean_shift (k)
+		V = [ m[k] + shift for m in I.values() if k in m and m[k] + shift > 0 ]
+		if V:
+			G[k] = (math.exp (sum (math.log (v) for v in V) / len (V)) - shift, len (V))
+	return G
+
+# 0.975-quantile of the Student t-distribution (rounded to the nearest lower
+# tabulated number of degrees of freedom, i.e., conservative)
+def t_quantile_975 (df):
+	T = [ (1, 12.706), (2, 4.303), (3, 3.182), (4, 2.776), (5, 2.571),
+	      (6, 2.447), (7, 2.365), (8, 2.306), (9, 2.262), (10, 2.228),
+	      (12, 2.179), (15, 2.131), (20, 2.086), (30, 2.042), (60, 2.000),
+	      (120, 1.980) ]
+	q = float ('nan')
+	for d, v in T:
+		if d <= df:
+			q = v
+	return q
+
+# Compare a metric between two groups of results on their common instances.
+# The per-instance ratios (of shifted values) are summarized by their
+# geometric mean and a 95% confidence interval (t-test on the log-ratios).
+# return a dict with keys "ratio", "ci_low", "ci_high" and "n"
+def geomean_ratio (I0, I1, metric):
+	shift = geomean_shift (metric)
+	R = []
+	for i in set (I0.keys()) & set (I1.keys()):
+		if metric in I0[i] and metric in I1[i]:
+			v0 = I0[i][metric] + shift
+			v1 = I1[i][metric] + shift
+			if v0 > 0 and v1 > 0:
+				R.append (math.log (v1 / v0))
+	nan = float ('nan')
+	if not R:
+		return { "ratio": nan, "ci_low": nan, "ci_high": nan, "n": 0 }
+	n = len (R)
+	av = sum (R) / n
+	if n > 1:
+		sd = (sum ((r-av)**2 for r in R) / (n-1))**0.5
+		h = t_quantile_975 (n-1) * sd / n**0.5
+	else:
+		h = nan
+	return { "ratio": math.exp (av), "ci_low": math.exp (av-h),
+	         "ci_high": math.exp (av+h), "n": n }
+
+# return 1 if the comparison is a significant regression, -1 if it is a
+# significant improvement and 0 otherwise
+def geomean_ratio_verdict (metric, cmp):
+	if cmp["ci_low"] > 1.:
+		v = 1
+	elif cmp["ci_high"] < 1.:
+		v = -1
+	else:
+		return 0
+	return -v if metric in BENCHS_HIGHER_IS_BETTER else v
+
+def json_value (v):
+	if isinstance (v, Eps):
+		return repr (v)
+	elif isinstance (v, float) and (math.isnan (v) or math.isinf (v)):
+		return None
+	else:
+		return v
+
 class BenchRef (object):
 	def __init__ (self, string, hash_salt):
 		self.string = string
@@ -111,6 +222,13 @@ class BenchRun (Bench):
 
 # Class for the task that parses the output of the benchmark and produces a
 # .data file
+#
+# Each run of the benchmark program prints a line "BENCH: {...}" with the JSON
+# summary of the run (see RunSummary): the keys of KEYS_TYPE plus any number
+# of performance metrics (cells_per_s, nb_evals, nb_lp_solves, peak_rss_kb,
+# time_first_loup, time_to_gap_1e-k, ...). The former format
+# "BENCH: key = value ; ..." (restricted to KEYS_TYPE) is still read, so that
+# older saved results can be compared.
 class BenchData (Bench):
 	KEYS_TYPE = collections.OrderedDict ()
 	KEYS_TYPE["eps"] = Eps
@@ -123,22 +241,42 @@ class BenchData (Bench):
 	PREFIX = "BENCH: "
 	RESULTS_PATTERN = "(%s) = (.*)" % "|".join(KEYS_TYPE.keys())
 	RESULTS_RE = re.compile (RESULTS_PATTERN)
-	RESULTS_FORMAT = PREFIX + " ; ".join("%s = {%s!r}" % (k,k) for k in KEYS_TYPE.keys())
+	# value of null (non-finite) bounds in the JSON summary
+	NULL_VALUES = { "uplo": float ("-inf"), "loup": float ("inf") }
 
 	@classmethod
 	def parse_bench_line (cls, line):
 		if line.startswith (cls.PREFIX):
 			D = {}
 			line = line[len(cls.PREFIX):]
-			for part in line.split (" ; "):
-				m = cls.RESULTS_RE.match (part)
-				if m:
-					k = str(m.group(1))
-					D[k] = cls.KEYS_TYPE[k](m.group(2))
+			if line.lstrip().startswith ("{"):
+				for k, v in json.loads (line).items():
+					k = str (k)
+					if v is None:
+						D[k] = cls.NULL_VALUES.get (k, float ("nan"))
+					elif k == "eps":
+						D[k] = Eps (v)
+					elif isinstance (v, (int, float)):
+						D[k] = v
+					else:
+						D[k] = str (v)
+			else:
+				for part in line.split (" ; "):
+					m = cls.RESULTS_RE.match (part)
+					if m:
+						k = str(m.group(1))
+						D[k] = cls.KEYS_TYPE[k](m.group(2))
 			return D
 		else:
 			return None
 
+	@classmethod
+	def format_bench_line (cls, D):
+		keys = list (cls.KEYS_TYPE.keys())
+		keys += sorted (k for k in D.keys() if not k in cls.KEYS_TYPE)
+		obj = collections.OrderedDict ((k, json_value (D[k])) for k in keys if k in D)
+		return cls.PREFIX + json.dumps (obj)
+
 	def run (self):
 		# Get the data and write the data file from the results_file
 		data = []
@@ -148,7 +286,8 @@ class BenchData (Bench):
 				data.append (D)
 		data.sort (key=lambda x:x["eps"], reverse=True)
 
-		keys = self.KEYS_TYPE.keys()
+		keys = list (self.KEYS_TYPE.keys()) + bench_metrics (data)
+		keys = sorted (set (keys), key = keys.index)
 		datastr = " ".join(keys) + os.linesep
 		datalines = (" ".join ("%s" % d.get (k, "NaN") for k in keys) for d in data)
 		datastr += os.linesep.join(datalines)
@@ -182,6 +321,9 @@ class BenchGraph (Bench):
 	def keyword (self):
 		return "Generating graph from"
 
+# Class for the task that writes the results of a group: a log (that can be
+# saved with --benchs-save and compared later with --benchs-cmp-to) and a JSON
+# file with the per-instance averages and the geometric means of the metrics
 class BenchSummary (BenchData):
 	def run (self):
 		groupname = self.generator.name
@@ -205,7 +347,7 @@ class BenchSummary (BenchData):
 		for k, d in results["data"].items():
 			lst.append("### File: %s" % k)
 			for m in d:
-				lst.append (self.RESULTS_FORMAT.format (**m))
+				lst.append (self.format_bench_line (m))
 			# check [uplo, loup] interval
 			uplo = max (d["uplo"] for d in d)
 			loup = min (d["loup"] for d in d)
@@ -217,6 +359,12 @@ class BenchSummary (BenchData):
 				err_data = (BenchCurrentRef(), groupname, k, uplo, loup)
 				self.generator.bld.bench_errors.append (err_fmt % err_data)
 
+		# geometric means over the instances (comment lines, ignored when the
+		# file is parsed for comparison)
+		results["geomeans"] = group_geomeans (results["data"])
+		for k, (v, n) in sorted (results["geomeans"].items()):
+			lst.append ("# geomean: %s = %r (%d instances)" % (k, v, n))
+
 		outstr = os.linesep.join(lst) + os.linesep
 
 		self.outputs[0].write (outstr)
@@ -224,13 +372,31 @@ class BenchSummary (BenchData):
 			with open (self.generator.bld.savefile, "a") as f:
 				f.write (outstr)
 
+		instances = collections.OrderedDict ()
+		for (f, eps), m in sorted (instance_means (results["data"]).items()):
+			metrics = dict ((k, json_value (v)) for k, v in m.items())
+			instances.setdefault (f, collections.OrderedDict ())[repr (eps)] = metrics
+		obj = collections.OrderedDict ()
+		obj["group"] = groupname
+		obj["args"] = results["args"]
+		obj["geomeans"] = dict ((k, { "value": json_value (v), "instances": n })
+		                        for k, (v, n) in results["geomeans"].items())
+		obj["instances"] = instances
+		self.outputs[1].write (json.dumps (obj, indent = 1) + os.linesep)
+
 	def keyword (self):
 		return "Writing summary of '%s' into" % self.generator.name
 
 # Class for the task that does the comparison between benchmarks
+#
+# Besides the per-instance comparison of the times, each metric common to both
+# results is compared on the whole group by the geometric mean of the ratios
+# data1/data0 over the common instances, with a 95% confidence interval.
 class BenchCmp (Bench):
 	KEYS = [ "eps", "std1/std0", "#cells1/#cells0" ]
 	CMP_FORMAT = "CMP: " + " ; ".join("%s = {%s!r}" % (k,k) for k in KEYS)
+	GEOMEAN_KEYS = [ "ratio", "ci_low", "ci_high", "n" ]
+	GEOMEAN_FORMAT = "GEOMEAN: {metric} ; " + " ; ".join("%s = {%s!r}" % (k,k) for k in GEOMEAN_KEYS)
 
 	def run (self):
 		if not (self.k0, self.k1) in self.generator.bld.bench_cmp:
@@ -282,9 +448,35 @@ class BenchCmp (Bench):
 				err_data = (f, groupname, uplo0, loup0, self.k0, uplo1, loup1, self.k1)
 				self.generator.bld.bench_errors.append (err_fmt % err_data)
 
-		# Write data in output file
+		# Geometric means of the ratios over the whole group
+		I0 = instance_means (self.data0)
+		I1 = instance_means (self.data1)
+		metrics0 = set (k for m in I0.values() for k in m)
+		metrics1 = set (k for m in I1.values() for k in m)
+		geomeans = collections.OrderedDict ()
+		outstr += "### Geometric means of data1/data0 (95% confidence interval)"
+		outstr += os.linesep
+		for k in sorted (metrics0 & metrics1):
+			geomeans[k] = geomean_ratio (I0, I1, k)
+			outstr += self.GEOMEAN_FORMAT.format (metric = k, **geomeans[k])
+			outstr += os.linesep
+		cmp_geomeans = self.generator.bld.bench_cmp_geomeans
+		cmp_geomeans.setdefault ((self.k0, self.k1), {})[groupname] = geomeans
+
+		# Write data in output files
 		self.outputs[0].write (outstr)
 
+		obj = collections.OrderedDict ()
+		obj["group"] = groupname
+		obj["data0"] = str (self.k0)
+		obj["data1"] = str (self.k1)
+		obj["geomean_ratios"] = collections.OrderedDict ()
+		for k, c in geomeans.items():
+			D = dict ((kc, json_value (v)) for kc, v in c.items())
+			D["verdict"] = [ "improvement", "none", "regression" ][geomean_ratio_verdict (k, c) + 1]
+			obj["geomean_ratios"][k] = D
+		self.outputs[1].write (json.dumps (obj, indent = 1) + os.linesep)
+
 	def keyword (self):
 		return "Writing comparison data into"
 
@@ -413,10 +605,12 @@ def benchmarks_gather_data (self):
 		# Create output node
 		logfiledata = (self.name, "summary", "log")
 		lognode = self.bld.bldnode.make_node (filenameformat % logfiledata)
+		jsonfiledata = (self.name, "summary", "json")
+		jsonnode = self.bld.bldnode.make_node (filenameformat % jsonfiledata)
 
 		# Create summary task
 		prev_tasks = self.tasks[:]
-		tsk = self.create_task ('BenchSummary', [], lognode)
+		tsk = self.create_task ('BenchSummary', [], [lognode, jsonnode])
 		for t in prev_tasks:
 			tsk.set_run_after (t)
 
@@ -438,9 +632,11 @@ def benchmarks_gather_data (self):
 		if all (args0[k] == args1[k] for k in BENCHS_ARGS_NAME):
 			vs = "%s_VS_%s" % (k0.slugify(), k1.slugify())
 			cmpname = filenameformat % (self.name, "cmp.%s" % vs, "summary.log")
+			cmpjsonname = filenameformat % (self.name, "cmp.%s" % vs, "summary.json")
 			spdataname = filenameformat % (self.name, "scatter_plot.%s" % vs, "data")
 			graphname = filenameformat % (self.name, "scatter_plot.%s" % vs, "pdf")
 			cmpnode = self.bld.bldnode.make_node (cmpname)
+			cmpjsonnode = self.bld.bldnode.make_node (cmpjsonname)
 			spdatanode = self.bld.bldnode.make_node (spdataname)
 			graphnode = self.bld.bldnode.make_node (graphname)
 
@@ -448,7 +644,7 @@ def benchmarks_gather_data (self):
 			data1 = self.bld.bench_results[k1][self.name]["data"]
 
 			kw = { "k0": k0, "data0": data0, "k1": k1, "data1": data1 }
-			tsk = self.create_task ('BenchCmp', [], cmpnode, **kw)
+			tsk = self.create_task ('BenchCmp', [], [cmpnode, cmpjsonnode], **kw)
 
 			dm = float(args0["prec_ndigits_min"]) # same value in args1
 			dM = float(args0["prec_ndigits_max"]) # same value in args1
@@ -518,6 +714,10 @@ def benchmarks_format_output (bch):
 					c = "YELLOW" if M/m > 2 else "NORMAL"
 					row = fmt.format (m, av, M, std, fmt=".2e")
 					bch.msg ("  eps = %r" % eps, row, color=c)
+			if groupdict.get ("geomeans"):
+				bch.msg ("geometric means", "value (#instances)", color = "CYAN")
+				for k, (v, n) in sorted (groupdict["geomeans"].items()):
+					bch.msg ("  %s" % k, "%.3e (%d)" % (v, n))
 
 	for k, D in bch.bench_cmp.items():
 		bch.msg (" ", " ", color="NORMAL")
@@ -552,6 +752,14 @@ def benchmarks_format_output (bch):
 					args += [ c2, r, Logs.colors.NORMAL, rc ]
 
 					bch.msg (msg_s, fmt % tuple(args))
+			G = bch.bench_cmp_geomeans.get (k, {}).get (groupname, {})
+			if G:
+				bch.msg ("geometric means", "ratio1/0 [95% confidence] (#instances)", color = "CYAN")
+			for metric, c in G.items():
+				v = geomean_ratio_verdict (metric, c)
+				color = "RED" if v > 0 else ("GREEN" if v < 0 else "NORMAL")
+				row = "%.3f [%.3f, %.3f] (%d)" % (c["ratio"], c["ci_low"], c["ci_high"], c["n"])
+				bch.msg ("  %s" % metric, row, color = color)
 
 	if bch.bench_errors:
 		sep = os.linesep + "  - "